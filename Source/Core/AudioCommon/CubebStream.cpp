@@ -19,6 +19,8 @@
 
 // ~10 ms - needs to be at least 240 for surround
 constexpr u32 BUFFER_SAMPLES = 512;
+// ~3 ms, for the low latency mode in stereo
+constexpr u32 LOW_LATENCY_BUFFER_SAMPLES = 128;
 
 long CubebStream::DataCallback(cubeb_stream* stream, void* user_data, const void* /*input_buffer*/,
                                void* output_buffer, long num_frames)
@@ -91,9 +93,12 @@ bool CubebStream::Init()
         ERROR_LOG_FMT(AUDIO, "Error getting minimum latency");
       INFO_LOG_FMT(AUDIO, "Minimum latency: {} frames", minimum_latency);
 
+      const u32 buffer_samples = m_stereo && Config::Get(Config::MAIN_AUDIO_LOW_LATENCY) ?
+                                     LOW_LATENCY_BUFFER_SAMPLES :
+                                     BUFFER_SAMPLES;
       return_value =
           cubeb_stream_init(m_ctx.get(), &m_stream, "Dolphin Audio Output", nullptr, nullptr,
-                            nullptr, &params, std::max(BUFFER_SAMPLES, minimum_latency),
+                            nullptr, &params, std::max(buffer_samples, minimum_latency),
                             DataCallback, StateCallback, this) == CUBEB_OK;
     }
 
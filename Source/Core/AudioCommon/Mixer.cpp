@@ -7,11 +7,18 @@
 #include <cmath>
 #include <cstring>
 
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #include "AudioCommon/Enums.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "Common/TraceProfiler.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "VideoCommon/PerformanceMetrics.h"
@@ -57,6 +64,97 @@ void Mixer::DoState(PointerWrap& p)
     mixer.DoState(p);
 }
 
+#if defined(_M_X86_64) || defined(_M_ARM_64)
+// Linearly interpolates four stereo frames between the current and next frames, applies the
+// volume and mixes them into samples, with the same rounding as the scalar loop in
+// MixerFifo::Mix. The frames are in FIFO order, which has the channels swapped compared to the
+// output.
+static void ResampleAndMixFrames(s16* samples, const std::array<u32, 4>& current,
+                                 const std::array<u32, 4>& next, const std::array<u16, 8>& fracs,
+                                 s16 lvolume, s16 rvolume, bool byte_swap)
+{
+#if defined(_M_X86_64)
+  __m128i cur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current.data()));
+  __m128i nxt = _mm_loadu_si128(reinterpret_cast<const __m128i*>(next.data()));
+  if (byte_swap)
+  {
+    cur = _mm_or_si128(_mm_slli_epi16(cur, 8), _mm_srli_epi16(cur, 8));
+    nxt = _mm_or_si128(_mm_slli_epi16(nxt, 8), _mm_srli_epi16(nxt, 8));
+  }
+  const __m128i frac = _mm_loadu_si128(reinterpret_cast<const __m128i*>(fracs.data()));
+
+  // Full 32-bit products of the signed samples with the unsigned fractions.
+  const auto mul_frac = [frac](__m128i x, __m128i* lo, __m128i* hi) {
+    const __m128i prod_lo = _mm_mullo_epi16(x, frac);
+    const __m128i prod_hi =
+        _mm_sub_epi16(_mm_mulhi_epu16(x, frac), _mm_and_si128(_mm_srai_epi16(x, 15), frac));
+    *lo = _mm_unpacklo_epi16(prod_lo, prod_hi);
+    *hi = _mm_unpackhi_epi16(prod_lo, prod_hi);
+  };
+  __m128i cur_frac_lo, cur_frac_hi, nxt_frac_lo, nxt_frac_hi;
+  mul_frac(cur, &cur_frac_lo, &cur_frac_hi);
+  mul_frac(nxt, &nxt_frac_lo, &nxt_frac_hi);
+
+  // (cur << 16) + (nxt - cur) * frac, which can't overflow as the result lies between the frames.
+  const __m128i zero = _mm_setzero_si128();
+  __m128i interp_lo = _mm_add_epi32(_mm_unpacklo_epi16(zero, cur),
+                                    _mm_sub_epi32(nxt_frac_lo, cur_frac_lo));
+  __m128i interp_hi = _mm_add_epi32(_mm_unpackhi_epi16(zero, cur),
+                                    _mm_sub_epi32(nxt_frac_hi, cur_frac_hi));
+  __m128i interp =
+      _mm_packs_epi32(_mm_srai_epi32(interp_lo, 16), _mm_srai_epi32(interp_hi, 16));
+  interp = _mm_shufflehi_epi16(_mm_shufflelo_epi16(interp, _MM_SHUFFLE(2, 3, 0, 1)),
+                               _MM_SHUFFLE(2, 3, 0, 1));
+
+  const __m128i volume = _mm_setr_epi16(rvolume, lvolume, rvolume, lvolume, rvolume, lvolume,
+                                        rvolume, lvolume);
+  const __m128i vol_lo = _mm_mullo_epi16(interp, volume);
+  const __m128i vol_hi = _mm_mulhi_epi16(interp, volume);
+
+  const __m128i out = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples));
+  const __m128i sum_lo = _mm_add_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(vol_lo, vol_hi), 8),
+                                       _mm_srai_epi32(_mm_unpacklo_epi16(out, out), 16));
+  const __m128i sum_hi = _mm_add_epi32(_mm_srai_epi32(_mm_unpackhi_epi16(vol_lo, vol_hi), 8),
+                                       _mm_srai_epi32(_mm_unpackhi_epi16(out, out), 16));
+  const __m128i result =
+      _mm_max_epi16(_mm_packs_epi32(sum_lo, sum_hi), _mm_set1_epi16(-32767));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(samples), result);
+#elif defined(_M_ARM_64)
+  int16x8_t cur = vreinterpretq_s16_u32(vld1q_u32(current.data()));
+  int16x8_t nxt = vreinterpretq_s16_u32(vld1q_u32(next.data()));
+  if (byte_swap)
+  {
+    cur = vreinterpretq_s16_u8(vrev16q_u8(vreinterpretq_u8_s16(cur)));
+    nxt = vreinterpretq_s16_u8(vrev16q_u8(vreinterpretq_u8_s16(nxt)));
+  }
+  const uint16x8_t frac = vld1q_u16(fracs.data());
+
+  // (cur << 16) + (nxt - cur) * frac, which can't overflow as the result lies between the frames.
+  const int32x4_t interp_lo = vaddq_s32(
+      vshll_n_s16(vget_low_s16(cur), 16),
+      vmulq_s32(vsubl_s16(vget_low_s16(nxt), vget_low_s16(cur)),
+                vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(frac)))));
+  const int32x4_t interp_hi = vaddq_s32(
+      vshll_n_s16(vget_high_s16(cur), 16),
+      vmulq_s32(vsubl_s16(vget_high_s16(nxt), vget_high_s16(cur)),
+                vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(frac)))));
+  const int16x8_t interp = vrev32q_s16(
+      vcombine_s16(vshrn_n_s32(interp_lo, 16), vshrn_n_s32(interp_hi, 16)));
+
+  const int16x4_t volume = vreinterpret_s16_s32(vdup_n_s32(
+      static_cast<s32>(static_cast<u16>(rvolume) | (static_cast<u32>(lvolume) << 16))));
+  const int16x8_t out = vld1q_s16(samples);
+  const int32x4_t sum_lo = vaddq_s32(vshrq_n_s32(vmull_s16(vget_low_s16(interp), volume), 8),
+                                     vmovl_s16(vget_low_s16(out)));
+  const int32x4_t sum_hi = vaddq_s32(vshrq_n_s32(vmull_s16(vget_high_s16(interp), volume), 8),
+                                     vmovl_s16(vget_high_s16(out)));
+  const int16x8_t result =
+      vmaxq_s16(vcombine_s16(vqmovn_s32(sum_lo), vqmovn_s32(sum_hi)), vdupq_n_s16(-32767));
+  vst1q_s16(samples, result);
+#endif
+}
+#endif
+
 // Executed from sound stream thread
 unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
                                    bool consider_framelimit, float emulationspeed,
@@ -107,6 +205,38 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
     return m_little_endian ? m_buffer[index] : Common::swap16(m_buffer[index]);
   };
 
+#if defined(_M_X86_64) || defined(_M_ARM_64)
+  // Gather four frames at a time, as long as the FIFO has enough samples for all of them.
+  while (currentSample + 8 <= numSamples * 2)
+  {
+    std::array<u32, 4> current;
+    std::array<u32, 4> next;
+    std::array<u16, 8> fracs;
+    u32 index = indexR;
+    u32 frac = m_frac;
+    size_t count = 0;
+    for (; count < 4 && ((indexW - index) & INDEX_MASK) > 2; count++)
+    {
+      std::memcpy(&current[count], &m_buffer[index & INDEX_MASK], sizeof(u32));
+      std::memcpy(&next[count], &m_buffer[(index + 2) & INDEX_MASK], sizeof(u32));
+      fracs[count * 2] = static_cast<u16>(frac);
+      fracs[count * 2 + 1] = static_cast<u16>(frac);
+
+      frac += ratio;
+      index += 2 * (u16)(frac >> 16);
+      frac &= 0xffff;
+    }
+    if (count != 4)
+      break;
+
+    ResampleAndMixFrames(&samples[currentSample], current, next, fracs, lvolume, rvolume,
+                         !m_little_endian);
+    indexR = index;
+    m_frac = frac;
+    currentSample += 8;
+  }
+#endif
+
   // TODO: consider a higher-quality resampling algorithm.
   for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 2; currentSample += 2)
   {
@@ -160,12 +290,15 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
   if (!samples)
     return 0;
 
+  TRACE_ZONE("Audio mix");
+
   memset(samples, 0, num_samples * 2 * sizeof(short));
 
   // TODO: Determine how emulation speed will be used in audio
   // const float emulation_speed = g_perf_metrics.GetSpeed();
   const float emulation_speed = m_config_emulation_speed;
-  const int timing_variance = m_config_timing_variance;
+  const int fifo_latency = m_config_audio_stretch ? m_config_timing_variance :
+                                                       UpdateLatencyTarget();
   if (m_config_audio_stretch)
   {
     unsigned int available_samples =
@@ -179,17 +312,17 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
     m_scratch_buffer.fill(0);
 
     m_dma_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                    timing_variance);
+                    fifo_latency);
     m_streaming_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                          timing_variance);
+                          fifo_latency);
     m_wiimote_speaker_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                                timing_variance);
+                                fifo_latency);
     m_skylander_portal_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                                 timing_variance);
+                                 fifo_latency);
     for (auto& mixer : m_gba_mixers)
     {
       mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                timing_variance);
+                fifo_latency);
     }
 
     if (!m_is_stretching)
@@ -202,18 +335,67 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
   }
   else
   {
-    m_dma_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_streaming_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_wiimote_speaker_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_skylander_portal_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
+    const unsigned int dma_samples =
+        m_dma_mixer.Mix(samples, num_samples, true, emulation_speed, fifo_latency);
+    m_streaming_mixer.Mix(samples, num_samples, true, emulation_speed, fifo_latency);
+    m_wiimote_speaker_mixer.Mix(samples, num_samples, true, emulation_speed, fifo_latency);
+    m_skylander_portal_mixer.Mix(samples, num_samples, true, emulation_speed, fifo_latency);
     for (auto& mixer : m_gba_mixers)
-      mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
+      mixer.Mix(samples, num_samples, true, emulation_speed, fifo_latency);
     m_is_stretching = false;
+
+    // Only count the first callback that runs dry, so that pausing or games which stop the DMA
+    // don't keep raising the latency target.
+    const bool dma_full = dma_samples == num_samples;
+    m_dma_underrun = !dma_full && m_dma_was_full;
+    m_dma_was_full = dma_full;
+    if (m_dma_underrun)
+      g_perf_metrics.CountAudioUnderrun();
   }
 
   return num_samples;
 }
 
+// Measures the interval between the backend callbacks and returns the FIFO latency in ms that
+// MixerFifo::Mix should aim for.
+int Mixer::UpdateLatencyTarget()
+{
+  if (!m_config_low_latency)
+  {
+    g_perf_metrics.SetAudioLatency(std::chrono::milliseconds(m_config_timing_variance));
+    return m_config_timing_variance;
+  }
+
+  const TimePoint now = Clock::now();
+  const DT_ms interval = now - m_last_mix_time;
+  m_last_mix_time = now;
+
+  // Start from the configured latency after the stream was stopped, and work down from there.
+  if (interval > std::chrono::seconds(1))
+  {
+    m_latency_target = static_cast<float>(m_config_timing_variance);
+    return m_config_timing_variance;
+  }
+
+  m_callback_interval_avg += (interval - m_callback_interval_avg) / LATENCY_AVG;
+  m_callback_jitter_avg +=
+      (DT_ms(std::abs((interval - m_callback_interval_avg).count())) - m_callback_jitter_avg) /
+      LATENCY_AVG;
+
+  if (m_dma_underrun)
+    m_latency_target += LATENCY_STEP_UP;
+  else
+    m_latency_target -= LATENCY_DECAY * static_cast<float>(DT_s(interval).count());
+
+  const float min_target = static_cast<float>(
+      (m_callback_interval_avg + m_callback_jitter_avg * LATENCY_JITTER_FACTOR).count());
+  const float max_target = static_cast<float>(m_config_timing_variance);
+  m_latency_target = std::clamp(m_latency_target, std::min(min_target, max_target), max_target);
+
+  g_perf_metrics.SetAudioLatency(std::chrono::duration_cast<DT>(DT_ms(m_latency_target)));
+  return static_cast<int>(std::ceil(m_latency_target));
+}
+
 unsigned int Mixer::MixSurround(float* samples, unsigned int num_samples)
 {
   if (!num_samples)
@@ -458,6 +640,7 @@ void Mixer::RefreshConfig()
   m_config_emulation_speed = Config::Get(Config::MAIN_EMULATION_SPEED);
   m_config_timing_variance = Config::Get(Config::MAIN_TIMING_VARIANCE);
   m_config_audio_stretch = Config::Get(Config::MAIN_AUDIO_STRETCH);
+  m_config_low_latency = Config::Get(Config::MAIN_AUDIO_LOW_LATENCY);
 }
 
 void Mixer::MixerFifo::DoState(PointerWrap& p)
@@ -60,6 +60,14 @@ private:
   static constexpr float CONTROL_FACTOR = 0.2f;
   static constexpr u32 CONTROL_AVG = 32;  // In freq_shift per FIFO size offset
 
+  // Adaptive FIFO latency of the low latency mode, in ms. The target rises by LATENCY_STEP_UP
+  // on every underrun and decays by LATENCY_DECAY per second of clean playback, but stays above
+  // the measured callback period plus LATENCY_JITTER_FACTOR times its jitter.
+  static constexpr float LATENCY_STEP_UP = 4.0f;
+  static constexpr float LATENCY_DECAY = 1.0f;
+  static constexpr float LATENCY_JITTER_FACTOR = 4.0f;
+  static constexpr u32 LATENCY_AVG = 16;  // In callbacks
+
   const unsigned int SURROUND_CHANNELS = 6;
 
   class MixerFifo final
@@ -95,6 +103,7 @@ private:
   };
 
   void RefreshConfig();
+  int UpdateLatencyTarget();
 
   MixerFifo m_dma_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 32000, false};
   MixerFifo m_streaming_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 48000, false};
@@ -120,6 +129,15 @@ private:
   float m_config_emulation_speed;
   int m_config_timing_variance;
   bool m_config_audio_stretch;
+  bool m_config_low_latency;
+
+  // Only accessed by the audio thread.
+  TimePoint m_last_mix_time{};
+  DT_ms m_callback_interval_avg{};
+  DT_ms m_callback_jitter_avg{};
+  float m_latency_target = 0.0f;
+  bool m_dma_underrun = false;
+  bool m_dma_was_full = false;
 
   Config::ConfigChangedCallbackID m_config_changed_callback_id;
 };
@@ -14,6 +14,8 @@
 namespace
 {
 const size_t BUFFER_SAMPLES = 512;  // ~10 ms - needs to be at least 240 for surround
+// ~3 ms, for the low latency mode in stereo
+const size_t LOW_LATENCY_BUFFER_SAMPLES = 128;
 }
 
 PulseAudio::PulseAudio() = default;
@@ -22,6 +24,9 @@ bool PulseAudio::Init()
 {
   m_stereo = !Config::ShouldUseDPL2Decoder();
   m_channels = m_stereo ? 2 : 6;  // will tell PA we use a Stereo or 5.0 channel setup
+  m_buffer_samples = m_stereo && Config::Get(Config::MAIN_AUDIO_LOW_LATENCY) ?
+                         LOW_LATENCY_BUFFER_SAMPLES :
+                         BUFFER_SAMPLES;
 
   NOTICE_LOG_FMT(AUDIO, "PulseAudio backend using {} channels", m_channels);
 
@@ -41,6 +46,7 @@ PulseAudio::~PulseAudio()
 void PulseAudio::SoundLoop()
 {
   Common::SetCurrentThreadName("Audio thread - pulse");
+  Common::SetCurrentThreadQoS(Common::ThreadQoS::Emulation);
 
   if (PulseInit())
   {
@@ -117,7 +123,7 @@ bool PulseAudio::PulseInit()
   m_pa_ba.minreq = -1;     // don't read every byte, try to group them _a bit_
   m_pa_ba.prebuf = -1;     // start as early as possible
   m_pa_ba.tlength =
-      BUFFER_SAMPLES * m_channels *
+      m_buffer_samples * m_channels *
       m_bytespersample;  // designed latency, only change this flag for low latency output
   pa_stream_flags flags = pa_stream_flags(PA_STREAM_INTERPOLATE_TIMING | PA_STREAM_ADJUST_LATENCY |
                                           PA_STREAM_AUTO_TIMING_UPDATE);
@@ -155,10 +161,10 @@ void PulseAudio::StateCallback(pa_context* c)
     break;
   }
 }
-// on underflow, increase pulseaudio latency in ~10ms steps
+// on underflow, increase pulseaudio latency in steps of the initial buffer size
 void PulseAudio::UnderflowCallback(pa_stream* s)
 {
-  m_pa_ba.tlength += BUFFER_SAMPLES * m_channels * m_bytespersample;
+  m_pa_ba.tlength += m_buffer_samples * m_channels * m_bytespersample;
   pa_operation* op = pa_stream_set_buffer_attr(s, &m_pa_ba, nullptr, nullptr);
   pa_operation_unref(op);
 
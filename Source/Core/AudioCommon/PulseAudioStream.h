@@ -43,6 +43,7 @@ private:
   bool m_stereo;  // stereo, else surround
   int m_bytespersample;
   int m_channels;
+  size_t m_buffer_samples;
 
   int m_pa_error;
   int m_pa_connected;
@@ -164,6 +164,7 @@ void AnalyticsReporter::Send(AnalyticsReportBuilder&& report)
 void AnalyticsReporter::ThreadProc()
 {
   Common::SetCurrentThreadName("Analytics");
+  Common::SetCurrentThreadQoS(Common::ThreadQoS::Background);
   while (true)
   {
     m_reporter_event.Wait();
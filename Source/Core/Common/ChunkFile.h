@@ -12,6 +12,7 @@
 // - Zero backwards/forwards compatibility
 // - Serialization code for anything complex has to be manually written.
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstring>
@@ -48,15 +49,32 @@ public:
 
 private:
   u8** m_ptr_current;
+  u8* m_ptr_begin;
   u8* m_ptr_end;
   Mode m_mode;
 
+  // Only used by the growable constructor below.
+  std::vector<u8>* m_growable_buffer = nullptr;
+  u8* m_growable_ptr = nullptr;
+
 public:
   PointerWrap(u8** ptr, size_t size, Mode mode)
-      : m_ptr_current(ptr), m_ptr_end(*ptr + size), m_mode(mode)
+      : m_ptr_current(ptr), m_ptr_begin(*ptr), m_ptr_end(*ptr + size), m_mode(mode)
   {
   }
 
+  // Writes to buffer, growing it whenever it would overflow, so that the size doesn't have to be
+  // measured beforehand. The existing size of buffer is used as the initial capacity, and
+  // GetOffset() gives the number of bytes written. Must not be copied.
+  explicit PointerWrap(std::vector<u8>& buffer)
+      : m_ptr_current(&m_growable_ptr), m_ptr_begin(buffer.data()),
+        m_ptr_end(buffer.data() + buffer.size()), m_mode(Mode::Write), m_growable_buffer(&buffer),
+        m_growable_ptr(buffer.data())
+  {
+  }
+  PointerWrap(const PointerWrap&) = delete;
+  PointerWrap& operator=(const PointerWrap&) = delete;
+
   void SetMeasureMode() { m_mode = Mode::Measure; }
   void SetVerifyMode() { m_mode = Mode::Verify; }
   bool IsReadMode() const { return m_mode == Mode::Read; }
@@ -64,6 +82,8 @@ public:
   bool IsMeasureMode() const { return m_mode == Mode::Measure; }
   bool IsVerifyMode() const { return m_mode == Mode::Verify; }
 
+  size_t GetOffset() const { return static_cast<size_t>(*m_ptr_current - m_ptr_begin); }
+
   template <typename K, class V>
   void Do(std::map<K, V>& x)
   {
@@ -219,30 +239,33 @@ public:
   [[nodiscard]] u8* DoExternal(u32& count)
   {
     Do(count);
+    if (!IsMeasureMode() && (*m_ptr_current + count) > m_ptr_end)
+      HandleOverflow(count);
     u8* current = *m_ptr_current;
     *m_ptr_current += count;
-    if (!IsMeasureMode() && *m_ptr_current > m_ptr_end)
-    {
-      // trying to read/write past the end of the buffer, prevent this
-      SetMeasureMode();
-    }
     return current;
   }
 
-  // The reserved u32 is set to 0, and a pointer to it is returned.
-  // The caller needs to fill in the reserved u32 with the appropriate value later on, if they
+  // The reserved u32 is set to 0, and its position is returned.
+  // The caller needs to fill in the reserved u32 with WriteReservedU32 later on, if they
   // want a non-zero value there.
-  [[nodiscard]] u8* ReserveU32()
+  [[nodiscard]] size_t ReserveU32()
   {
     u32 temp = 0;
-    u8* previous_pointer = *m_ptr_current;
+    const size_t previous_position = GetOffset();
     Do(temp);
-    return previous_pointer;
+    return previous_position;
+  }
+
+  void WriteReservedU32(size_t position, u32 value)
+  {
+    if (IsWriteMode())
+      std::memcpy(m_ptr_begin + position, &value, sizeof(u32));
   }
 
-  u32 GetOffsetFromPreviousPosition(u8* previous_pointer)
+  u32 GetOffsetFromPreviousPosition(size_t previous_position)
   {
-    return static_cast<u32>((*m_ptr_current) - previous_pointer);
+    return static_cast<u32>(GetOffset() - previous_position);
   }
 
   void Do(Common::Flag& flag)
@@ -343,14 +366,27 @@ private:
     DoEachElement(x, [](PointerWrap& p, typename T::value_type& elem) { p.Do(elem); });
   }
 
-  DOLPHIN_FORCE_INLINE void DoVoid(void* data, u32 size)
+  void HandleOverflow(u32 size)
   {
-    if (!IsMeasureMode() && (*m_ptr_current + size) > m_ptr_end)
+    if (m_growable_buffer && IsWriteMode())
     {
-      // trying to read/write past the end of the buffer, prevent this
-      SetMeasureMode();
+      const size_t offset = GetOffset();
+      m_growable_buffer->resize(std::max(offset + size, m_growable_buffer->size() * 2));
+      m_ptr_begin = m_growable_buffer->data();
+      m_ptr_end = m_ptr_begin + m_growable_buffer->size();
+      *m_ptr_current = m_ptr_begin + offset;
+      return;
     }
 
+    // trying to read/write past the end of the buffer, prevent this
+    SetMeasureMode();
+  }
+
+  DOLPHIN_FORCE_INLINE void DoVoid(void* data, u32 size)
+  {
+    if (!IsMeasureMode() && (*m_ptr_current + size) > m_ptr_end)
+      HandleOverflow(size);
+
     switch (m_mode)
     {
     case Mode::Read:
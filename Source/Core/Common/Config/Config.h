@@ -65,17 +65,12 @@ T Get(LayerType layer, const Info<T>& info)
 template <typename T>
 T Get(const Info<T>& info)
 {
-  CachedValue<T> cached = info.GetCachedValue();
   const u64 config_version = GetConfigVersion();
+  if (std::optional<T> cached = info.TryGetCachedValue(config_version))
+    return std::move(*cached);
 
-  if (cached.config_version < config_version)
-  {
-    cached.value = GetUncached(info);
-    cached.config_version = config_version;
-
-    info.SetCachedValue(cached);
-  }
-
+  CachedValue<T> cached{GetUncached(info), config_version};
+  info.SetCachedValue(cached);
   return cached.value;
 }
 
@@ -3,7 +3,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <limits>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <string>
 #include <type_traits>
@@ -19,6 +22,15 @@ namespace detail
 // std::underlying_type may only be used with enum types, so make sure T is an enum type first.
 template <typename T>
 using UnderlyingType = typename std::enable_if_t<std::is_enum<T>{}, std::underlying_type<T>>::type;
+
+template <typename T>
+constexpr bool IsLockFreeCacheable()
+{
+  if constexpr (std::is_trivially_copyable_v<T>)
+    return std::atomic<T>::is_always_lock_free;
+  else
+    return false;
+}
 }  // namespace detail
 
 struct Location
@@ -44,7 +56,8 @@ class Info
 {
 public:
   constexpr Info(const Location& location, const T& default_value)
-      : m_location{location}, m_default_value{default_value}, m_cached_value{default_value, 0}
+      : m_location{location}, m_default_value{default_value}, m_cached_value{default_value, 0},
+        m_atomic_cached_value{MakeAtomicCachedValue(default_value)}
   {
   }
 
@@ -66,7 +79,7 @@ public:
   {
     m_location = other.GetLocation();
     m_default_value = other.GetDefaultValue();
-    m_cached_value = other.GetCachedValue();
+    StoreCachedValue(other.GetCachedValue());
     return *this;
   }
 
@@ -75,7 +88,7 @@ public:
   {
     m_location = std::move(other.m_location);
     m_default_value = std::move(other.m_default_value);
-    m_cached_value = std::move(other.m_cached_value);
+    StoreCachedValue(std::move(other.m_cached_value));
     return *this;
   }
 
@@ -87,7 +100,7 @@ public:
   {
     m_location = other.GetLocation();
     m_default_value = static_cast<T>(other.GetDefaultValue());
-    m_cached_value = other.template GetCachedValueCasted<T>();
+    StoreCachedValue(other.template GetCachedValueCasted<T>());
     return *this;
   }
 
@@ -107,18 +120,74 @@ public:
     return CachedValue<U>{static_cast<U>(m_cached_value.value), m_cached_value.config_version};
   }
 
+  // Returns the cached value if it is up to date with config_version. For types that fit in a
+  // lock-free atomic, this doesn't take any locks, so it is cheap to call from hot paths.
+  std::optional<T> TryGetCachedValue(u64 config_version) const
+  {
+    if constexpr (LOCK_FREE_CACHE)
+    {
+      // Sequence lock: the value is only valid if the version didn't change while reading it.
+      const u64 version = m_atomic_cached_version.load(std::memory_order_acquire);
+      if (version == WRITING_VERSION || version < config_version)
+        return std::nullopt;
+      const T value = m_atomic_cached_value.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (m_atomic_cached_version.load(std::memory_order_relaxed) != version)
+        return std::nullopt;
+      return value;
+    }
+    else
+    {
+      CachedValue<T> cached = GetCachedValue();
+      if (cached.config_version < config_version)
+        return std::nullopt;
+      return std::move(cached.value);
+    }
+  }
+
   void SetCachedValue(const CachedValue<T>& cached_value) const
   {
     std::unique_lock lock(m_cached_value_mutex);
     if (m_cached_value.config_version < cached_value.config_version)
-      m_cached_value = cached_value;
+      StoreCachedValue(cached_value);
   }
 
 private:
+  static constexpr bool LOCK_FREE_CACHE = detail::IsLockFreeCacheable<T>();
+  static constexpr u64 WRITING_VERSION = std::numeric_limits<u64>::max();
+
+  struct NoAtomicCache
+  {
+  };
+
+  static constexpr auto MakeAtomicCachedValue(const T& value)
+  {
+    if constexpr (LOCK_FREE_CACHE)
+      return std::atomic<T>(value);
+    else
+      return NoAtomicCache{};
+  }
+
+  void StoreCachedValue(const CachedValue<T>& cached_value) const
+  {
+    m_cached_value = cached_value;
+    if constexpr (LOCK_FREE_CACHE)
+    {
+      m_atomic_cached_version.store(WRITING_VERSION, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      m_atomic_cached_value.store(cached_value.value, std::memory_order_relaxed);
+      m_atomic_cached_version.store(cached_value.config_version, std::memory_order_release);
+    }
+  }
+
   Location m_location;
   T m_default_value;
 
   mutable CachedValue<T> m_cached_value;
   mutable std::shared_mutex m_cached_value_mutex;
+
+  // Copy of m_cached_value that can be read without taking m_cached_value_mutex.
+  mutable std::conditional_t<LOCK_FREE_CACHE, std::atomic<T>, NoAtomicCache> m_atomic_cached_value;
+  mutable std::atomic<u64> m_atomic_cached_version{0};
 };
 }  // namespace Config
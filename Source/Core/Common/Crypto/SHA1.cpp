@@ -362,7 +362,14 @@ private:
 
 #endif
 
-std::unique_ptr<Context> CreateContext()
+enum class Implementation
+{
+  Mbed,
+  X64,
+  Neon,
+};
+
+static Implementation GetImplementation()
 {
   if (cpu_info.bSHA1)
   {
@@ -371,18 +378,64 @@ std::unique_ptr<Context> CreateContext()
     // Seems unlikely we'll see any cpus supporting SHA but not SSSE3 (in the foreseeable future at
     // least).
     if (cpu_info.bSSSE3)
-      return std::make_unique<ContextX64SHA1>();
+      return Implementation::X64;
+#elif defined(_M_ARM_64)
+    return Implementation::Neon;
+#endif
+  }
+  return Implementation::Mbed;
+}
+
+std::unique_ptr<Context> CreateContext()
+{
+  switch (GetImplementation())
+  {
+#ifdef _M_X86_64
+  case Implementation::X64:
+    return std::make_unique<ContextX64SHA1>();
 #elif defined(_M_ARM_64)
+  case Implementation::Neon:
     return std::make_unique<ContextNeon>();
 #endif
+  default:
+    return std::make_unique<ContextMbed>();
+  }
+}
+
+// One-shot hashing keeps the context on the stack, which avoids a heap allocation per digest and
+// lets the compiler devirtualize the calls.
+template <typename ContextType>
+static void CalculateDigests(const u8* msg, size_t chunk_len, size_t count, Digest* digests_out)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    ContextType ctx;
+    Context& context = ctx;
+    context.Update(msg + i * chunk_len, chunk_len);
+    digests_out[i] = context.Finish();
+  }
+}
+
+void CalculateDigests(const u8* msg, size_t chunk_len, size_t count, Digest* digests_out)
+{
+  switch (GetImplementation())
+  {
+#ifdef _M_X86_64
+  case Implementation::X64:
+    return CalculateDigests<ContextX64SHA1>(msg, chunk_len, count, digests_out);
+#elif defined(_M_ARM_64)
+  case Implementation::Neon:
+    return CalculateDigests<ContextNeon>(msg, chunk_len, count, digests_out);
+#endif
+  default:
+    return CalculateDigests<ContextMbed>(msg, chunk_len, count, digests_out);
   }
-  return std::make_unique<ContextMbed>();
 }
 
 Digest CalculateDigest(const u8* msg, size_t len)
 {
-  auto ctx = CreateContext();
-  ctx->Update(msg, len);
-  return ctx->Finish();
+  Digest digest;
+  CalculateDigests(msg, len, 1, &digest);
+  return digest;
 }
 }  // namespace Common::SHA1
@@ -32,6 +32,9 @@ std::unique_ptr<Context> CreateContext();
 
 Digest CalculateDigest(const u8* msg, size_t len);
 
+// Hashes count consecutive chunks of chunk_len bytes each, writing one digest per chunk.
+void CalculateDigests(const u8* msg, size_t chunk_len, size_t count, Digest* digests_out);
+
 template <typename T>
 inline Digest CalculateDigest(const std::vector<T>& msg)
 {
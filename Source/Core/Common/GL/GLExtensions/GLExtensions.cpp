@@ -907,6 +907,11 @@ PFNDOLTEXSTORAGE3DPROC dolTexStorage3D;
 PFNDOLTEXSTORAGE2DMULTISAMPLEPROC dolTexStorage2DMultisample;
 PFNDOLTEXSTORAGE3DMULTISAMPLEPROC dolTexStorage3DMultisample;
 
+// ARB_timer_query
+PFNDOLQUERYCOUNTERPROC dolQueryCounter;
+PFNDOLGETQUERYOBJECTI64VPROC dolGetQueryObjecti64v;
+PFNDOLGETQUERYOBJECTUI64VPROC dolGetQueryObjectui64v;
+
 // ARB_ES2_compatibility
 PFNDOLCLEARDEPTHFPROC dolClearDepthf;
 PFNDOLDEPTHRANGEFPROC dolDepthRangef;
@@ -979,6 +984,9 @@ PFNDOLCLIPCONTROLPROC dolClipControl;
 // ARB_copy_image
 PFNDOLCOPYIMAGESUBDATAPROC dolCopyImageSubData;
 
+// KHR_parallel_shader_compile
+PFNDOLMAXSHADERCOMPILERTHREADSKHRPROC dolMaxShaderCompilerThreadsKHR;
+
 // ARB_shader_storage_buffer_object
 PFNDOLSHADERSTORAGEBLOCKBINDINGPROC dolShaderStorageBlockBinding;
 
@@ -1970,6 +1978,11 @@ const GLFunc gl_function_array[] = {
     GLFUNC_SUFFIX(glTexStorage3DMultisample, OES,
                   "GL_OES_texture_storage_multisample_2d_array !VERSION_GLES_3_2"),
 
+    // ARB_timer_query
+    GLFUNC_REQUIRES(glQueryCounter, "GL_ARB_timer_query"),
+    GLFUNC_REQUIRES(glGetQueryObjecti64v, "GL_ARB_timer_query"),
+    GLFUNC_REQUIRES(glGetQueryObjectui64v, "GL_ARB_timer_query"),
+
     // ARB_ES2_compatibility
     GLFUNC_REQUIRES(glClearDepthf, "GL_ARB_ES2_compatibility |VERSION_GLES_2"),
     GLFUNC_REQUIRES(glDepthRangef, "GL_ARB_ES2_compatibility |VERSION_GLES_2"),
@@ -2143,6 +2156,9 @@ const GLFunc gl_function_array[] = {
 
     // ARB_get_texture_sub_image
     GLFUNC_REQUIRES(glGetTextureSubImage, "GL_ARB_get_texture_sub_image !VERSION_4_5"),
+
+    // KHR_parallel_shader_compile
+    GLFUNC_REQUIRES(glMaxShaderCompilerThreadsKHR, "GL_KHR_parallel_shader_compile"),
 };
 
 namespace GLExtensions
@@ -0,0 +1,15 @@
+/*
+** Copyright (c) 2013-2018 The Khronos Group Inc.
+** SPDX-License-Identifier: MIT
+*/
+
+#include "Common/GL/GLExtensions/gl_common.h"
+
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+
+typedef void(APIENTRYP PFNDOLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+
+extern PFNDOLMAXSHADERCOMPILERTHREADSKHRPROC dolMaxShaderCompilerThreadsKHR;
+
+#define glMaxShaderCompilerThreadsKHR dolMaxShaderCompilerThreadsKHR
@@ -4,9 +4,11 @@
 #include "Common/Hash.h"
 
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <cstring>
 
+#include <xxhash.h>
 #include <zlib.h>
 
 #include "Common/BitUtils.h"
@@ -427,6 +429,32 @@ u64 GetHash64(const u8* src, u32 len, u32 samples)
   return s_texture_hash_func(src, len, samples);
 }
 
+u64 GetXXH3Hash64(const u8* src, u32 len, u32 samples)
+{
+  const u32 word_count = len / 8;
+  if (samples == 0 || samples >= word_count)
+    return XXH3_64bits_withSeed(src, len, len);
+
+  // Gather the sampled words into a buffer, as hashing them one at a time would be much slower.
+  const u32 step = word_count / samples;
+  XXH3_state_t state;
+  XXH3_64bits_reset_withSeed(&state, len);
+  std::array<u64, 64> words;
+  size_t count = 0;
+  for (u32 i = 0; i < word_count; i += step)
+  {
+    std::memcpy(&words[count], src + i * 8, sizeof(u64));
+    if (++count == words.size())
+    {
+      XXH3_64bits_update(&state, words.data(), sizeof(words));
+      count = 0;
+    }
+  }
+  XXH3_64bits_update(&state, words.data(), count * sizeof(u64));
+  XXH3_64bits_update(&state, src + word_count * 8, len & 7);
+  return XXH3_64bits_digest(&state);
+}
+
 u32 StartCRC32()
 {
   return crc32_z(0L, Z_NULL, 0);
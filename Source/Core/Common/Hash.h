@@ -16,6 +16,9 @@ u32 HashEctor(const u8* data, size_t len);
 
 // Specialized hash function used for the texture cache
 u64 GetHash64(const u8* src, u32 len, u32 samples);
+// Alternative texture cache hash based on XXH3, which is faster for fully hashed textures. Samples
+// the same way as GetHash64, but the hashes differ.
+u64 GetXXH3Hash64(const u8* src, u32 len, u32 samples);
 
 u32 StartCRC32();
 u32 UpdateCRC32(u32 crc, const u8* data, size_t len);
@@ -192,7 +192,7 @@ std::string HttpRequest::Impl::GetHeaderValue(std::string_view name) const
 {
   for (const auto& [key, value] : m_response_headers)
   {
-    if (key == name)
+    if (Common::CaseInsensitiveEquals(key, name))
       return value.value();
   }
 
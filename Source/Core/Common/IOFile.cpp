@@ -3,6 +3,7 @@
 
 #include "Common/IOFile.h"
 
+#include <cerrno>
 #include <cstddef>
 #include <cstdio>
 #include <string>
@@ -149,6 +150,41 @@ bool IOFile::Seek(s64 offset, SeekOrigin origin)
   return m_good;
 }
 
+bool IOFile::ReadBytesAt(void* data, size_t length, u64 offset)
+{
+#ifdef _WIN32
+  // Reading at an offset through the OS handle would move the file pointer the CRT relies on.
+  return Seek(static_cast<s64>(offset), SeekOrigin::Begin) && ReadBytes(data, length);
+#else
+  if (!IsOpen())
+  {
+    m_good = false;
+    return m_good;
+  }
+
+  const int fd = fileno(m_file);
+  char* out = static_cast<char*>(data);
+  while (length > 0)
+  {
+    const ssize_t result = pread(fd, out, length, static_cast<off_t>(offset));
+    if (result < 0 && errno == EINTR)
+      continue;
+
+    if (result <= 0)
+    {
+      m_good = false;
+      break;
+    }
+
+    out += result;
+    length -= static_cast<size_t>(result);
+    offset += static_cast<u64>(result);
+  }
+
+  return m_good;
+#endif
+}
+
 u64 IOFile::Tell() const
 {
   if (IsOpen())
@@ -99,6 +99,11 @@ public:
 
   bool WriteString(std::string_view str) { return WriteBytes(str.data(), str.size()); }
 
+  // Reads from the given offset with a single positioned read where the OS supports it, instead of
+  // seeking first. Neither uses nor moves the stdio file position and buffer, so this must not be
+  // mixed with unflushed writes to the same file.
+  bool ReadBytesAt(void* data, size_t length, u64 offset);
+
   bool IsOpen() const { return nullptr != m_file; }
   // m_good is set to false when a read, write or other function fails
   bool IsGood() const { return m_good; }
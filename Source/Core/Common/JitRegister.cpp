@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <cstdio>
 #include <cstdlib>
+#include <ctime>
 #include <fstream>
 #include <string>
 
@@ -21,6 +22,11 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
 #if defined USE_OPROFILE && USE_OPROFILE
 #include <opagent.h>
 #endif
@@ -40,7 +46,118 @@ namespace Common::JitRegister
 {
 static bool s_is_enabled = false;
 
-void Init(const std::string& perf_dir)
+#ifdef __linux__
+// Linux perf jitdump format, see tools/perf/Documentation/jitdump-specification.txt.
+// Unlike the plain map file, it carries the code bytes, which lets `perf inject --jit`
+// annotate generated code even after it has been overwritten.
+constexpr u32 JITDUMP_MAGIC = 0x4A695444;
+constexpr u32 JITDUMP_VERSION = 1;
+constexpr u32 JITDUMP_CODE_LOAD = 0;
+
+struct JitDumpHeader
+{
+  u32 magic;
+  u32 version;
+  u32 total_size;
+  u32 elf_mach;
+  u32 pad1;
+  u32 pid;
+  u64 timestamp;
+  u64 flags;
+};
+
+struct JitDumpCodeLoad
+{
+  u32 id;
+  u32 total_size;
+  u64 timestamp;
+  u32 pid;
+  u32 tid;
+  u64 vma;
+  u64 code_addr;
+  u64 code_size;
+  u64 code_index;
+};
+
+static File::IOFile s_jitdump_file;
+static void* s_jitdump_marker = nullptr;
+static u64 s_jitdump_code_index = 0;
+
+static u64 GetJitDumpTimestamp()
+{
+  // perf must be run with -k mono for the timestamps to match its own.
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<u64>(ts.tv_sec) * 1000000000 + static_cast<u64>(ts.tv_nsec);
+}
+
+static void OpenJitDump(const std::string& dir)
+{
+#if defined(_M_X86_64)
+  constexpr u32 elf_mach = 62;  // EM_X86_64
+#elif defined(_M_ARM_64)
+  constexpr u32 elf_mach = 183;  // EM_AARCH64
+#else
+  constexpr u32 elf_mach = 0;
+#endif
+
+  s_jitdump_file.Open(fmt::format("{}/jit-{}.dump", dir, getpid()), "w+b");
+  if (!s_jitdump_file.IsOpen())
+    return;
+
+  // perf record only picks up the dump if it sees an executable mapping of the file.
+  const long page_size = sysconf(_SC_PAGESIZE);
+  void* marker = mmap(nullptr, page_size, PROT_READ | PROT_EXEC, MAP_PRIVATE,
+                      fileno(s_jitdump_file.GetHandle()), 0);
+  s_jitdump_marker = marker == MAP_FAILED ? nullptr : marker;
+
+  const JitDumpHeader header{JITDUMP_MAGIC,
+                             JITDUMP_VERSION,
+                             sizeof(JitDumpHeader),
+                             elf_mach,
+                             0,
+                             static_cast<u32>(getpid()),
+                             GetJitDumpTimestamp(),
+                             0};
+  s_jitdump_file.WriteBytes(&header, sizeof(header));
+  s_jitdump_file.Flush();
+  s_jitdump_code_index = 0;
+}
+
+static void CloseJitDump()
+{
+  if (s_jitdump_marker)
+  {
+    munmap(s_jitdump_marker, sysconf(_SC_PAGESIZE));
+    s_jitdump_marker = nullptr;
+  }
+
+  if (s_jitdump_file.IsOpen())
+    s_jitdump_file.Close();
+}
+
+static void WriteJitDumpCodeLoad(const void* base_address, u32 code_size,
+                                 const std::string& symbol_name)
+{
+  const u64 address = reinterpret_cast<u64>(base_address);
+  const JitDumpCodeLoad record{
+      JITDUMP_CODE_LOAD,
+      static_cast<u32>(sizeof(JitDumpCodeLoad) + symbol_name.size() + 1 + code_size),
+      GetJitDumpTimestamp(),
+      static_cast<u32>(getpid()),
+      static_cast<u32>(syscall(SYS_gettid)),
+      address,
+      address,
+      code_size,
+      s_jitdump_code_index++};
+  s_jitdump_file.WriteBytes(&record, sizeof(record));
+  s_jitdump_file.WriteBytes(symbol_name.c_str(), symbol_name.size() + 1);
+  s_jitdump_file.WriteBytes(base_address, code_size);
+  s_jitdump_file.Flush();
+}
+#endif
+
+void Init(const std::string& perf_dir, bool jitdump)
 {
 #if defined USE_OPROFILE && USE_OPROFILE
   s_agent = op_open_agent();
@@ -56,6 +173,11 @@ void Init(const std::string& perf_dir)
     // if the event of a crash:
     std::setvbuf(s_perf_map_file.GetHandle(), nullptr, _IONBF, 0);
     s_is_enabled = true;
+
+#ifdef __linux__
+    if (jitdump)
+      OpenJitDump(dir);
+#endif
   }
 }
 
@@ -73,6 +195,10 @@ void Shutdown()
   if (s_perf_map_file.IsOpen())
     s_perf_map_file.Close();
 
+#ifdef __linux__
+  CloseJitDump();
+#endif
+
   s_is_enabled = false;
 }
 
@@ -101,6 +227,11 @@ void Register(const void* base_address, u32 code_size, const std::string& symbol
   iJIT_NotifyEvent(iJVM_EVENT_TYPE_METHOD_LOAD_FINISHED, (void*)&jmethod);
 #endif
 
+#ifdef __linux__
+  if (s_jitdump_file.IsOpen())
+    WriteJitDumpCodeLoad(base_address, code_size, symbol_name);
+#endif
+
   // Linux perf /tmp/perf-$pid.map:
   if (!s_perf_map_file.IsOpen())
     return;
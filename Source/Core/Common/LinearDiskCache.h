@@ -11,6 +11,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/MappedFile.h"
 #include "Common/Version.h"
 
 // On disk format:
@@ -71,6 +72,16 @@ public:
     m_header.Init();
     if (m_file.IsOpen() && ValidateHeader())
     {
+      if constexpr (alignof(V) == 1)
+      {
+        u64 last_valid_value_start;
+        if (ReadEntriesFromMapping(reader, &last_valid_value_start))
+        {
+          m_file.Seek(last_valid_value_start, File::SeekOrigin::Begin);
+          return m_num_entries;
+        }
+      }
+
       // good header, read some key/value pairs
       K key;
 
@@ -136,6 +147,46 @@ public:
   }
 
 private:
+  // Passes values to the reader straight from a mapping of the file instead of copying each of
+  // them into a temporary buffer. Processes that load the same cache share the mapped pages.
+  bool ReadEntriesFromMapping(LinearDiskCacheReader<K, V>& reader, u64* last_valid_value_start)
+  {
+    Common::MappedFile mapping;
+    if (!mapping.Map(m_file))
+      return false;
+
+    const u8* const data = mapping.GetData();
+    const u64 size = mapping.GetSize();
+    u64 offset = m_file.Tell();
+    while (true)
+    {
+      u32 value_size;
+      if (size - offset < sizeof(value_size))
+        break;
+      std::memcpy(&value_size, data + offset, sizeof(value_size));
+
+      const u64 value_offset = offset + sizeof(value_size) + sizeof(K);
+      const u64 entry_end = value_offset + u64(value_size) * sizeof(V) + sizeof(u32);
+      if (entry_end > size)
+        break;
+
+      u32 entry_number;
+      std::memcpy(&entry_number, data + entry_end - sizeof(entry_number), sizeof(entry_number));
+      if (entry_number != m_num_entries + 1)
+        break;
+
+      K key;
+      std::memcpy(&key, data + offset + sizeof(value_size), sizeof(K));
+      reader.Read(key, reinterpret_cast<const V*>(data + value_offset), value_size);
+
+      offset = entry_end;
+      m_num_entries++;
+    }
+
+    *last_valid_value_start = offset;
+    return true;
+  }
+
   void WriteHeader() { m_file.WriteArray(&m_header, 1); }
   bool ValidateHeader()
   {
@@ -32,6 +32,9 @@ const Config::Info<bool> LOGGER_WRITE_TO_WINDOW{
     {Config::System::Logger, "Options", "WriteToWindow"}, true};
 const Config::Info<LogLevel> LOGGER_VERBOSITY{{Config::System::Logger, "Options", "Verbosity"},
                                               LogLevel::LNOTICE};
+// 0 means unlimited.
+const Config::Info<u32> LOGGER_MAX_MESSAGES_PER_SECOND{
+    {Config::System::Logger, "Options", "MaxMessagesPerSecond"}, 0};
 
 class FileLogListener : public LogListener
 {
@@ -68,7 +71,7 @@ void GenericLogFmtImpl(LogLevel level, LogType type, const char* file, int line,
   if (instance == nullptr)
     return;
 
-  if (!instance->IsEnabled(type, level))
+  if (!instance->IsEnabled(type, level) || !instance->CheckRateLimit(type))
     return;
 
   const auto message = fmt::vformat(format, args);
@@ -168,11 +171,18 @@ LogManager::LogManager()
         Config::Info<bool>{{Config::System::Logger, "Logs", container.m_short_name}, false});
   }
 
+  m_max_messages_per_second = Config::Get(LOGGER_MAX_MESSAGES_PER_SECOND);
+
   m_path_cutoff_point = DeterminePathCutOffPoint();
+
+  m_writer.Reset("Log Writer", [this](LogEntry entry) { WriteEntry(entry); });
 }
 
 LogManager::~LogManager()
 {
+  // Write out everything that is still queued while the listeners are alive.
+  m_writer.Shutdown();
+
   // The log window listener pointer is owned by the GUI code.
   delete m_listeners[LogListener::CONSOLE_LISTENER];
   delete m_listeners[LogListener::FILE_LISTENER];
@@ -206,30 +216,64 @@ void LogManager::Log(LogLevel level, LogType type, const char* file, int line, c
   LogWithFullPath(level, type, file + m_path_cutoff_point, line, message);
 }
 
-std::string LogManager::GetTimestamp()
+std::string LogManager::GetTimestamp(std::chrono::system_clock::time_point time)
 {
   // NOTE: the Qt LogWidget hardcodes the expected length of the timestamp portion of the log line,
   // so ensure they stay in sync
 
   // We want milliseconds *and not hours*, so can't directly use STL formatters
-  const auto now = std::chrono::system_clock::now();
-  const auto now_s = std::chrono::floor<std::chrono::seconds>(now);
-  const auto now_ms = std::chrono::floor<std::chrono::milliseconds>(now);
-  return fmt::format("{:%M:%S}:{:03}", now_s, (now_ms - now_s).count());
+  const auto time_s = std::chrono::floor<std::chrono::seconds>(time);
+  const auto time_ms = std::chrono::floor<std::chrono::milliseconds>(time);
+  return fmt::format("{:%M:%S}:{:03}", time_s, (time_ms - time_s).count());
 }
 
 void LogManager::LogWithFullPath(LogLevel level, LogType type, const char* file, int line,
                                  const char* message)
 {
-  const std::string msg =
-      fmt::format("{} {}:{} {}[{}]: {}\n", GetTimestamp(), file, line,
-                  LOG_LEVEL_TO_CHAR[static_cast<int>(level)], GetShortName(type), message);
+  const u32 dropped = m_rate_limits[type].m_dropped.exchange(0, std::memory_order_relaxed);
+  m_writer.EmplaceItem(LogEntry{std::chrono::system_clock::now(), level, type, file, line, message,
+                                dropped});
+}
 
+void LogManager::WriteEntry(const LogEntry& entry)
+{
+  const std::string prefix =
+      fmt::format("{} {}:{} {}[{}]: ", GetTimestamp(entry.m_time), entry.m_file, entry.m_line,
+                  LOG_LEVEL_TO_CHAR[static_cast<int>(entry.m_level)], GetShortName(entry.m_type));
+  std::string msg;
+  if (entry.m_dropped != 0)
+    msg = fmt::format("{}{} messages were dropped by the rate limit\n", prefix, entry.m_dropped);
+  msg += fmt::format("{}{}\n", prefix, entry.m_message);
+
+  std::lock_guard lk(m_listeners_mutex);
   for (const auto listener_id : m_listener_ids)
   {
     if (m_listeners[listener_id])
-      m_listeners[listener_id]->Log(level, msg.c_str());
+      m_listeners[listener_id]->Log(entry.m_level, msg.c_str());
+  }
+}
+
+bool LogManager::CheckRateLimit(LogType type)
+{
+  if (m_max_messages_per_second == 0)
+    return true;
+
+  RateLimit& limit = m_rate_limits[type];
+  const u64 second = std::chrono::duration_cast<std::chrono::seconds>(
+                         std::chrono::steady_clock::now().time_since_epoch())
+                         .count();
+  u64 previous_second = limit.m_second.load(std::memory_order_relaxed);
+  if (previous_second != second &&
+      limit.m_second.compare_exchange_strong(previous_second, second, std::memory_order_relaxed))
+  {
+    limit.m_count.store(0, std::memory_order_relaxed);
   }
+
+  if (limit.m_count.fetch_add(1, std::memory_order_relaxed) < m_max_messages_per_second)
+    return true;
+
+  limit.m_dropped.fetch_add(1, std::memory_order_relaxed);
+  return false;
 }
 
 LogLevel LogManager::GetLogLevel() const
@@ -274,6 +318,7 @@ const char* LogManager::GetFullName(LogType type) const
 
 void LogManager::RegisterListener(LogListener::LISTENER id, LogListener* listener)
 {
+  std::lock_guard lk(m_listeners_mutex);
   m_listeners[id] = listener;
 }
 
@@ -4,13 +4,18 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdarg>
 #include <map>
+#include <mutex>
 #include <string>
 
 #include "Common/BitSet.h"
+#include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
 #include "Common/Logging/Log.h"
+#include "Common/WorkQueueThread.h"
 
 namespace Common::Log
 {
@@ -38,10 +43,16 @@ public:
   static void Init();
   static void Shutdown();
 
+  // Messages are handed to the listeners on a separate thread, so these never wait for a
+  // listener to write them out.
   void Log(LogLevel level, LogType type, const char* file, int line, const char* message);
   void LogWithFullPath(LogLevel level, LogType type, const char* file, int line,
                        const char* message);
 
+  // Returns false if the type has already logged the maximum number of messages allowed in the
+  // current second. Dropped messages are counted and reported with the next message that passes.
+  bool CheckRateLimit(LogType type);
+
   LogLevel GetLogLevel() const;
   void SetLogLevel(LogLevel level);
 
@@ -67,6 +78,24 @@ private:
     bool m_enable = false;
   };
 
+  struct RateLimit
+  {
+    std::atomic<u64> m_second{0};
+    std::atomic<u32> m_count{0};
+    std::atomic<u32> m_dropped{0};
+  };
+
+  struct LogEntry
+  {
+    std::chrono::system_clock::time_point m_time;
+    LogLevel m_level;
+    LogType m_type;
+    std::string m_file;
+    int m_line;
+    std::string m_message;
+    u32 m_dropped;
+  };
+
   LogManager();
   ~LogManager();
 
@@ -75,12 +104,18 @@ private:
   LogManager(LogManager&&) = delete;
   LogManager& operator=(LogManager&&) = delete;
 
-  static std::string GetTimestamp();
+  static std::string GetTimestamp(std::chrono::system_clock::time_point time);
+  void WriteEntry(const LogEntry& entry);
 
   LogLevel m_level;
   EnumMap<LogContainer, LAST_LOG_TYPE> m_log{};
+  EnumMap<RateLimit, LAST_LOG_TYPE> m_rate_limits{};
+  u32 m_max_messages_per_second = 0;
   std::array<LogListener*, LogListener::NUMBER_OF_LISTENERS> m_listeners{};
+  // Held while the writer thread calls a listener, so that it can be safely unregistered.
+  std::mutex m_listeners_mutex;
   BitSet32 m_listener_ids;
   size_t m_path_cutoff_point = 0;
+  Common::WorkQueueThread<LogEntry> m_writer;
 };
 }  // namespace Common::Log
@@ -0,0 +1,149 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/MappedFile.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include "Common/CommonFuncs.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Common
+{
+MappedFile::~MappedFile()
+{
+  Unmap();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)),
+      m_read_ahead_start(std::exchange(other.m_read_ahead_start, 0)),
+      m_read_ahead_end(std::exchange(other.m_read_ahead_end, 0))
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+  if (this != &other)
+  {
+    Unmap();
+    m_data = std::exchange(other.m_data, nullptr);
+    m_size = std::exchange(other.m_size, 0);
+    m_read_ahead_start = std::exchange(other.m_read_ahead_start, 0);
+    m_read_ahead_end = std::exchange(other.m_read_ahead_end, 0);
+  }
+  return *this;
+}
+
+bool MappedFile::Map(File::IOFile& file)
+{
+  Unmap();
+
+  if (!file.IsOpen())
+    return false;
+
+  const u64 size = file.GetSize();
+  if (size == 0)
+    return false;
+
+#ifdef _WIN32
+  const HANDLE file_handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(file.GetHandle())));
+  if (file_handle == INVALID_HANDLE_VALUE)
+    return false;
+
+  // The view keeps a reference to the mapping, so the mapping handle can be closed right away
+  const HANDLE mapping = CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping)
+  {
+    WARN_LOG_FMT(COMMON, "CreateFileMappingW failed: {}", GetLastErrorString());
+    return false;
+  }
+
+  void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (!data)
+  {
+    WARN_LOG_FMT(COMMON, "MapViewOfFile failed: {}", GetLastErrorString());
+    return false;
+  }
+#else
+  void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fileno(file.GetHandle()), 0);
+  if (data == MAP_FAILED)
+  {
+    WARN_LOG_FMT(COMMON, "mmap failed: {}", LastStrerrorString());
+    return false;
+  }
+#endif
+
+  m_data = static_cast<u8*>(data);
+  m_size = size;
+  return true;
+}
+
+void MappedFile::Unmap()
+{
+  if (!m_data)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(m_data);
+#else
+  munmap(m_data, m_size);
+#endif
+
+  m_data = nullptr;
+  m_size = 0;
+  m_read_ahead_start = 0;
+  m_read_ahead_end = 0;
+}
+
+bool MappedFile::Read(u64 offset, u64 size, u8* out_ptr)
+{
+  if (offset > m_size || size > m_size - offset)
+    return false;
+
+  std::memcpy(out_ptr, m_data + offset, size);
+
+  // Only extend the read ahead once half of it has been read, so that sequential reads don't need
+  // a system call each
+  const u64 end = offset + size;
+  if (end < m_read_ahead_start || end + READ_AHEAD_SIZE / 2 > m_read_ahead_end)
+  {
+    Prefetch(end, READ_AHEAD_SIZE);
+    m_read_ahead_start = end;
+    m_read_ahead_end = end + READ_AHEAD_SIZE;
+  }
+
+  return true;
+}
+
+void MappedFile::Prefetch(u64 offset, u64 size) const
+{
+  if (offset >= m_size)
+    return;
+
+  size = std::min(size, m_size - offset);
+
+#ifdef _WIN32
+  WIN32_MEMORY_RANGE_ENTRY range{m_data + offset, static_cast<SIZE_T>(size)};
+  PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+  // madvise requires a page aligned address
+  const u64 page_size = static_cast<u64>(sysconf(_SC_PAGESIZE));
+  const u64 aligned_offset = offset - offset % page_size;
+  madvise(m_data + aligned_offset, size + (offset - aligned_offset), MADV_WILLNEED);
+#endif
+}
+}  // namespace Common
@@ -0,0 +1,55 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+namespace File
+{
+class IOFile;
+}
+
+namespace Common
+{
+// A read-only view of a whole file in the address space. Pages are read in on demand when the view
+// is accessed, so reading data which is already in the page cache doesn't need a system call.
+// Note: Accessing the view after the file was truncated or became unreadable crashes instead of
+// returning an error, so only use this for files which aren't expected to change.
+class MappedFile final
+{
+public:
+  MappedFile() = default;
+  ~MappedFile();
+  MappedFile(const MappedFile&) = delete;
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+
+  // Maps the whole file, returning false if it couldn't be mapped
+  // The file can be closed afterwards, the view stays valid
+  bool Map(File::IOFile& file);
+  void Unmap();
+
+  bool IsMapped() const { return m_data != nullptr; }
+  const u8* GetData() const { return m_data; }
+  u64 GetSize() const { return m_size; }
+
+  // Copies from the view, returning false if the range is out of bounds
+  // The data following the range is prefetched, which makes sequential reads faster
+  bool Read(u64 offset, u64 size, u8* out_ptr);
+
+  // Hints that the given range will be read soon, so that the OS can start reading it in
+  void Prefetch(u64 offset, u64 size) const;
+
+private:
+  static constexpr u64 READ_AHEAD_SIZE = 0x100000;
+
+  u8* m_data = nullptr;
+  u64 m_size = 0;
+
+  // The range which was last prefetched by Read
+  u64 m_read_ahead_start = 0;
+  u64 m_read_ahead_end = 0;
+};
+}  // namespace Common
@@ -7,6 +7,7 @@
 #include <cstdlib>
 #include <string>
 
+#include "Common/Align.h"
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -43,6 +44,32 @@ void* AllocateExecutableMemory(size_t size)
 #if defined(__APPLE__)
   map_flags |= MAP_JIT;
 #endif
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  // Back large code regions with transparent huge pages where the kernel allows it, which cuts
+  // down on iTLB misses when running JIT code. Huge pages are only used for aligned ranges, so
+  // over-allocate and trim the mapping down to an aligned one.
+  constexpr size_t huge_page_size = 2 * 1024 * 1024;
+  if (size >= huge_page_size && size % huge_page_size == 0)
+  {
+    void* ptr = mmap(nullptr, size + huge_page_size, PROT_READ | PROT_WRITE | PROT_EXEC, map_flags,
+                     -1, 0);
+    if (ptr != MAP_FAILED)
+    {
+      u8* const start = static_cast<u8*>(ptr);
+      u8* const aligned_start =
+          reinterpret_cast<u8*>(AlignUp(reinterpret_cast<uintptr_t>(start), huge_page_size));
+      const size_t head_size = aligned_start - start;
+      if (head_size != 0)
+        munmap(start, head_size);
+      if (head_size != huge_page_size)
+        munmap(aligned_start + size, huge_page_size - head_size);
+
+      madvise(aligned_start, size, MADV_HUGEPAGE);
+      return aligned_start;
+    }
+  }
+#endif
+
   void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE | PROT_EXEC, map_flags, -1, 0);
   if (ptr == MAP_FAILED)
     ptr = nullptr;
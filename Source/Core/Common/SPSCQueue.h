@@ -7,8 +7,10 @@
 // single producer, single consumer queue
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cstddef>
+#include <span>
 
 #include "Common/CommonTypes.h"
 
@@ -18,11 +20,15 @@ template <typename T, bool NeedSize = true>
 class SPSCQueue
 {
 public:
-  SPSCQueue() : m_size(0) { m_write_ptr = m_read_ptr = new ElementPtr(); }
+  SPSCQueue() : m_size(0)
+  {
+    m_write_ptr = m_free_ptr = new ElementPtr();
+    m_read_ptr.store(m_write_ptr, std::memory_order_relaxed);
+  }
   ~SPSCQueue()
   {
     // this will empty out the whole queue
-    delete m_read_ptr;
+    DeleteElements(m_free_ptr);
   }
 
   u32 Size() const
@@ -31,8 +37,8 @@ public:
     return m_size.load();
   }
 
-  bool Empty() const { return !m_read_ptr->next.load(); }
-  T& Front() const { return m_read_ptr->current; }
+  bool Empty() const { return !m_read_ptr.load(std::memory_order_relaxed)->next.load(); }
+  T& Front() const { return m_read_ptr.load(std::memory_order_relaxed)->current; }
   template <typename Arg>
   void Push(Arg&& t)
   {
@@ -40,7 +46,7 @@ public:
     m_write_ptr->current = std::forward<Arg>(t);
     // set the next pointer to a new element ptr
     // then advance the write pointer
-    ElementPtr* new_ptr = new ElementPtr();
+    ElementPtr* new_ptr = AllocateElement();
     m_write_ptr->next.store(new_ptr, std::memory_order_release);
     m_write_ptr = new_ptr;
     if (NeedSize)
@@ -51,12 +57,12 @@ public:
   {
     if (NeedSize)
       m_size--;
-    ElementPtr* tmpptr = m_read_ptr;
+    ElementPtr* tmpptr = m_read_ptr.load(std::memory_order_relaxed);
+    ElementPtr* next_ptr = tmpptr->next.load();
+    // destroy the element now rather than when its ElementPtr gets reused
+    tmpptr->current = T{};
     // advance the read pointer
-    m_read_ptr = tmpptr->next.load();
-    // set the next element to nullptr to stop the recursive deletion
-    tmpptr->next.store(nullptr);
-    delete tmpptr;  // this also deletes the element
+    m_read_ptr.store(next_ptr, std::memory_order_release);
   }
 
   bool Pop(T& t)
@@ -67,11 +73,10 @@ public:
     if (NeedSize)
       m_size--;
 
-    ElementPtr* tmpptr = m_read_ptr;
-    m_read_ptr = tmpptr->next.load(std::memory_order_acquire);
+    ElementPtr* tmpptr = m_read_ptr.load(std::memory_order_relaxed);
+    ElementPtr* next_ptr = tmpptr->next.load(std::memory_order_acquire);
     t = std::move(tmpptr->current);
-    tmpptr->next.store(nullptr);
-    delete tmpptr;
+    m_read_ptr.store(next_ptr, std::memory_order_release);
     return true;
   }
 
@@ -79,8 +84,9 @@ public:
   void Clear()
   {
     m_size.store(0);
-    delete m_read_ptr;
-    m_write_ptr = m_read_ptr = new ElementPtr();
+    DeleteElements(m_free_ptr);
+    m_write_ptr = m_free_ptr = new ElementPtr();
+    m_read_ptr.store(m_write_ptr, std::memory_order_relaxed);
   }
 
 private:
@@ -90,20 +96,181 @@ private:
   {
   public:
     ElementPtr() : next(nullptr) {}
-    ~ElementPtr()
-    {
-      ElementPtr* next_ptr = next.load();
-
-      if (next_ptr)
-        delete next_ptr;
-    }
 
     T current{};
     std::atomic<ElementPtr*> next;
   };
 
+  // Popped ElementPtrs stay in the list (from m_free_ptr up to m_read_ptr) so that the producer
+  // can reuse them, which keeps Push and Pop from allocating once the queue has warmed up.
+  ElementPtr* AllocateElement()
+  {
+    if (m_free_ptr == m_read_ptr.load(std::memory_order_acquire))
+      return new ElementPtr();
+
+    ElementPtr* element = m_free_ptr;
+    m_free_ptr = element->next.load(std::memory_order_relaxed);
+    element->next.store(nullptr, std::memory_order_relaxed);
+    return element;
+  }
+
+  static void DeleteElements(ElementPtr* element)
+  {
+    while (element)
+    {
+      ElementPtr* next_ptr = element->next.load();
+      delete element;
+      element = next_ptr;
+    }
+  }
+
   ElementPtr* m_write_ptr;
-  ElementPtr* m_read_ptr;
+  ElementPtr* m_free_ptr;
+  std::atomic<ElementPtr*> m_read_ptr;
   std::atomic<u32> m_size;
 };
+
+// A lockless single producer, single consumer queue of at most Capacity elements, stored in a
+// ring buffer. Unlike SPSCQueue it never allocates, but pushing fails while the queue is full.
+template <typename T, size_t Capacity>
+class BoundedSPSCQueue
+{
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                "Capacity must be a power of two");
+  static_assert(Capacity <= (1u << 31), "Capacity is too large for the u32 indices");
+
+public:
+  static constexpr size_t GetCapacity() { return Capacity; }
+
+  size_t Size() const
+  {
+    // Load the read index first, it can't get past the write index loaded after it.
+    const u32 read_index = m_read_index.load(std::memory_order_acquire);
+    const u32 write_index = m_write_index.load(std::memory_order_acquire);
+    return std::min<size_t>(write_index - read_index, Capacity);
+  }
+  bool Empty() const { return Size() == 0; }
+
+  // Consumer only.
+  T& Front() { return m_buffer[m_read_index.load(std::memory_order_relaxed) % Capacity]; }
+
+  // Producer only.
+  template <typename Arg>
+  bool TryPush(Arg&& t)
+  {
+    const u32 write_index = m_write_index.load(std::memory_order_relaxed);
+    if (GetSpace(write_index, 1) == 0)
+      return false;
+
+    m_buffer[write_index % Capacity] = std::forward<Arg>(t);
+    PublishWrite(write_index + 1);
+    return true;
+  }
+
+  // Producer only. Pushes as many elements as fit and returns how many that was.
+  size_t PushBatch(std::span<const T> elements)
+  {
+    const u32 write_index = m_write_index.load(std::memory_order_relaxed);
+    const u32 count = GetSpace(write_index, static_cast<u32>(std::min(elements.size(), Capacity)));
+    if (count == 0)
+      return 0;
+
+    for (u32 i = 0; i < count; ++i)
+      m_buffer[(write_index + i) % Capacity] = elements[i];
+    PublishWrite(write_index + count);
+    return count;
+  }
+
+  // Consumer only.
+  bool TryPop(T& t)
+  {
+    const u32 read_index = m_read_index.load(std::memory_order_relaxed);
+    if (GetData(read_index, 1) == 0)
+      return false;
+
+    t = std::move(m_buffer[read_index % Capacity]);
+    PublishRead(read_index + 1);
+    return true;
+  }
+
+  // Consumer only. Pops up to elements.size() elements and returns how many there were.
+  size_t PopBatch(std::span<T> elements)
+  {
+    const u32 read_index = m_read_index.load(std::memory_order_relaxed);
+    const u32 count = GetData(read_index, static_cast<u32>(std::min(elements.size(), Capacity)));
+    if (count == 0)
+      return 0;
+
+    for (u32 i = 0; i < count; ++i)
+      elements[i] = std::move(m_buffer[(read_index + i) % Capacity]);
+    PublishRead(read_index + count);
+    return count;
+  }
+
+  // Producer only. Blocks until there is space for at least one element.
+  void WaitForSpace()
+  {
+    const u32 write_index = m_write_index.load(std::memory_order_relaxed);
+    while (GetSpace(write_index, 1) == 0)
+      m_read_index.wait(m_cached_read_index, std::memory_order_acquire);
+  }
+
+  // Consumer only. Blocks until there is at least one element.
+  void WaitForData()
+  {
+    const u32 read_index = m_read_index.load(std::memory_order_relaxed);
+    while (GetData(read_index, 1) == 0)
+      m_write_index.wait(m_cached_write_index, std::memory_order_acquire);
+  }
+
+  // not thread-safe
+  void Clear()
+  {
+    T discarded;
+    while (TryPop(discarded))
+      discarded = T{};
+  }
+
+private:
+  // Return how many of the wanted elements can be written or read. The other side's index is only
+  // reloaded when the cached copy says there isn't enough room, so that the two threads don't keep
+  // pulling each other's cache line.
+  u32 GetSpace(u32 write_index, u32 wanted)
+  {
+    if (Capacity - (write_index - m_cached_read_index) < wanted)
+      m_cached_read_index = m_read_index.load(std::memory_order_acquire);
+    return std::min<u32>(wanted, Capacity - (write_index - m_cached_read_index));
+  }
+
+  u32 GetData(u32 read_index, u32 wanted)
+  {
+    if (m_cached_write_index - read_index < wanted)
+      m_cached_write_index = m_write_index.load(std::memory_order_acquire);
+    return std::min<u32>(wanted, m_cached_write_index - read_index);
+  }
+
+  void PublishWrite(u32 write_index)
+  {
+    m_write_index.store(write_index, std::memory_order_release);
+    m_write_index.notify_one();
+  }
+
+  void PublishRead(u32 read_index)
+  {
+    m_read_index.store(read_index, std::memory_order_release);
+    m_read_index.notify_one();
+  }
+
+  static constexpr size_t CACHE_LINE_SIZE = 64;
+
+  // Written by the producer.
+  alignas(CACHE_LINE_SIZE) std::atomic<u32> m_write_index = 0;
+  u32 m_cached_read_index = 0;
+
+  // Written by the consumer.
+  alignas(CACHE_LINE_SIZE) std::atomic<u32> m_read_index = 0;
+  u32 m_cached_write_index = 0;
+
+  alignas(CACHE_LINE_SIZE) std::array<T, Capacity> m_buffer{};
+};
 }  // namespace Common
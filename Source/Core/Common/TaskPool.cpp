@@ -0,0 +1,185 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/TaskPool.h"
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/Assert.h"
+#include "Common/EnumMap.h"
+#include "Common/Thread.h"
+
+namespace Common
+{
+struct TaskPool::Worker
+{
+  std::mutex mutex;
+  EnumMap<std::deque<QueuedTask>, TaskPriority::Background> queues;
+  std::thread thread;
+};
+
+// The worker the current thread is, if it belongs to a pool. Tasks submitted from a worker go to
+// its own queue.
+static thread_local const TaskPool* s_current_pool = nullptr;
+static thread_local size_t s_current_worker_index = 0;
+
+TaskPool::TaskPool(u32 num_workers)
+{
+  num_workers = std::max(num_workers, 1u);
+  m_workers.reserve(num_workers);
+  for (u32 i = 0; i < num_workers; ++i)
+    m_workers.push_back(std::make_unique<Worker>());
+  for (size_t i = 0; i < m_workers.size(); ++i)
+    m_workers[i]->thread = std::thread(&TaskPool::WorkerThread, this, i);
+}
+
+TaskPool::~TaskPool()
+{
+  {
+    std::lock_guard lk(m_wake_mutex);
+    m_shutdown = true;
+  }
+  m_wake_cv.notify_all();
+
+  for (auto& worker : m_workers)
+    worker->thread.join();
+}
+
+TaskPool& TaskPool::GetInstance()
+{
+  static TaskPool s_pool(std::max(std::thread::hardware_concurrency(), 3u) - 2);
+  return s_pool;
+}
+
+void TaskPool::Submit(Task task, TaskPriority priority)
+{
+  Submit(QueuedTask{std::move(task), nullptr}, priority);
+}
+
+void TaskPool::Submit(QueuedTask task, TaskPriority priority)
+{
+  const size_t worker_index = s_current_pool == this ?
+                                  s_current_worker_index :
+                                  m_next_worker.fetch_add(1, std::memory_order_relaxed) %
+                                      m_workers.size();
+  {
+    Worker& worker = *m_workers[worker_index];
+    std::lock_guard lk(worker.mutex);
+    worker.queues[priority].push_back(std::move(task));
+  }
+
+  {
+    std::lock_guard lk(m_wake_mutex);
+    m_queued_tasks.fetch_add(1, std::memory_order_relaxed);
+  }
+  m_wake_cv.notify_one();
+}
+
+bool TaskPool::TryTakeTask(size_t worker_index, QueuedTask* task)
+{
+  for (const TaskPriority priority : {TaskPriority::Normal, TaskPriority::Background})
+  {
+    // Take the oldest task from our own queue, and the newest one when stealing from others, to
+    // keep the owner and the thieves at opposite ends of the queue.
+    for (size_t i = 0; i < m_workers.size(); ++i)
+    {
+      const bool own_queue = i == 0;
+      Worker& worker = *m_workers[(worker_index + i) % m_workers.size()];
+      std::lock_guard lk(worker.mutex);
+      auto& queue = worker.queues[priority];
+      if (queue.empty())
+        continue;
+
+      if (own_queue)
+      {
+        *task = std::move(queue.front());
+        queue.pop_front();
+      }
+      else
+      {
+        *task = std::move(queue.back());
+        queue.pop_back();
+      }
+      m_queued_tasks.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void TaskPool::WorkerThread(size_t worker_index)
+{
+  Common::SetCurrentThreadName(fmt::format("Task Pool Worker {}", worker_index).c_str());
+  Common::SetCurrentThreadQoS(Common::ThreadQoS::Background);
+  s_current_pool = this;
+  s_current_worker_index = worker_index;
+
+  while (true)
+  {
+    QueuedTask task;
+    if (!TryTakeTask(worker_index, &task))
+    {
+      std::unique_lock lk(m_wake_mutex);
+      m_wake_cv.wait(lk, [this] {
+        return m_shutdown || m_queued_tasks.load(std::memory_order_relaxed) != 0;
+      });
+      if (m_shutdown)
+        return;
+      continue;
+    }
+
+    if (!task.group || !task.group->IsCancelling())
+      task.function();
+    if (task.group)
+      task.group->OnTaskDone();
+  }
+}
+
+TaskGroup::TaskGroup(TaskPriority priority, TaskPool& pool) : m_pool(pool), m_priority(priority)
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+  Cancel();
+}
+
+void TaskGroup::Run(TaskPool::Task task)
+{
+  {
+    std::lock_guard lk(m_mutex);
+    ++m_pending_tasks;
+  }
+  m_pool.Submit(TaskPool::QueuedTask{std::move(task), this}, m_priority);
+}
+
+void TaskGroup::Wait()
+{
+  // Waiting from one of the pool's workers could leave no worker to run the tasks.
+  ASSERT(s_current_pool != &m_pool);
+
+  std::unique_lock lk(m_mutex);
+  m_done_cv.wait(lk, [this] { return m_pending_tasks == 0; });
+}
+
+void TaskGroup::Cancel()
+{
+  m_cancelling.store(true, std::memory_order_relaxed);
+  Wait();
+  m_cancelling.store(false, std::memory_order_relaxed);
+}
+
+void TaskGroup::OnTaskDone()
+{
+  std::lock_guard lk(m_mutex);
+  if (--m_pending_tasks == 0)
+    m_done_cv.notify_all();
+}
+}  // namespace Common
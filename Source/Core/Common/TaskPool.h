@@ -0,0 +1,108 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+// A process-wide pool of worker threads for background work, so that subsystems don't each start
+// their own threads and oversubscribe the cores the CPU and GPU emulation threads run on.
+// Every worker has its own queue, and idle workers steal tasks from the queues of the others.
+
+namespace Common
+{
+enum class TaskPriority
+{
+  // Work something is waiting for.
+  Normal,
+  // Work which only runs when no Normal tasks are queued.
+  Background,
+};
+
+class TaskGroup;
+
+class TaskPool
+{
+public:
+  using Task = std::function<void()>;
+
+  explicit TaskPool(u32 num_workers);
+  ~TaskPool();
+
+  TaskPool(const TaskPool&) = delete;
+  TaskPool& operator=(const TaskPool&) = delete;
+
+  // The shared pool. Leaves two hardware threads for the CPU and GPU emulation threads.
+  static TaskPool& GetInstance();
+
+  u32 GetWorkerCount() const { return static_cast<u32>(m_workers.size()); }
+
+  void Submit(Task task, TaskPriority priority = TaskPriority::Normal);
+
+private:
+  friend class TaskGroup;
+
+  struct QueuedTask
+  {
+    Task function;
+    TaskGroup* group;
+  };
+
+  struct Worker;
+
+  void Submit(QueuedTask task, TaskPriority priority);
+  bool TryTakeTask(size_t worker_index, QueuedTask* task);
+  void WorkerThread(size_t worker_index);
+
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  std::atomic<u32> m_next_worker = 0;
+
+  std::mutex m_wake_mutex;
+  std::condition_variable m_wake_cv;
+  std::atomic<u32> m_queued_tasks = 0;
+  bool m_shutdown = false;
+};
+
+// Tracks a set of tasks submitted to a TaskPool, so that they can be waited for or cancelled
+// together. Destroying the group cancels it.
+class TaskGroup
+{
+public:
+  explicit TaskGroup(TaskPriority priority = TaskPriority::Normal,
+                     TaskPool& pool = TaskPool::GetInstance());
+  ~TaskGroup();
+
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+
+  void Run(TaskPool::Task task);
+
+  // Blocks until every task of the group has finished
+  void Wait();
+
+  // Drops the tasks which haven't started yet and waits for the running ones.
+  // Tasks can poll IsCancelling() to finish early.
+  void Cancel();
+  bool IsCancelling() const { return m_cancelling.load(std::memory_order_relaxed); }
+
+private:
+  friend class TaskPool;
+
+  void OnTaskDone();
+
+  TaskPool& m_pool;
+  TaskPriority m_priority;
+
+  std::mutex m_mutex;
+  std::condition_variable m_done_cv;
+  u32 m_pending_tasks = 0;
+  std::atomic<bool> m_cancelling = false;
+};
+}  // namespace Common
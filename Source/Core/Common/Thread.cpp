@@ -8,6 +8,7 @@
 #include <processthreadsapi.h>
 #else
 #include <pthread.h>
+#include <sys/resource.h>
 #include <unistd.h>
 #endif
 
@@ -29,6 +30,7 @@
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
 #include "Common/StringUtil.h"
+#include "Common/TraceProfiler.h"
 
 namespace Common
 {
@@ -114,6 +116,21 @@ void SetCurrentThreadName(const char* name)
 {
   SetCurrentThreadNameViaException(name);
   SetCurrentThreadNameViaApi(name);
+  TraceProfiler::SetCurrentThreadName(name);
+}
+
+void SetCurrentThreadQoS(ThreadQoS qos)
+{
+  // Windows moves throttled (EcoQoS) threads to efficiency cores, and may start throttling any
+  // thread it considers to be in the background, so opt the emulation threads out explicitly.
+  THREAD_POWER_THROTTLING_STATE throttling{};
+  throttling.Version = THREAD_POWER_THROTTLING_CURRENT_VERSION;
+  throttling.ControlMask = THREAD_POWER_THROTTLING_EXECUTION_SPEED;
+  throttling.StateMask = qos == ThreadQoS::Background ? THREAD_POWER_THROTTLING_EXECUTION_SPEED : 0;
+  SetThreadInformation(GetCurrentThread(), ThreadPowerThrottling, &throttling, sizeof(throttling));
+
+  if (qos == ThreadQoS::Background)
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
 }
 
 #else  // !WIN32, so must be POSIX threads
@@ -183,6 +200,21 @@ void SetCurrentThreadName(const char* name)
   // VTune uses OS thread names by default but probably supports longer names when set via its own
   // API.
   __itt_thread_set_name(name);
+#endif
+  TraceProfiler::SetCurrentThreadName(name);
+}
+
+void SetCurrentThreadQoS(ThreadQoS qos)
+{
+#ifdef __APPLE__
+  // The scheduler picks performance or efficiency cores based on the QoS class.
+  pthread_set_qos_class_self_np(
+      qos == ThreadQoS::Background ? QOS_CLASS_UTILITY : QOS_CLASS_USER_INTERACTIVE, 0);
+#elif defined __linux__
+  // There is no QoS class here, and raising the priority needs privileges, but lowering it
+  // doesn't. The nice value is per thread on Linux, so this only affects the calling thread.
+  if (qos == ThreadQoS::Background)
+    setpriority(PRIO_PROCESS, 0, 10);
 #endif
 }
 
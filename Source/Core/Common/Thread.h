@@ -39,6 +39,18 @@ inline void YieldCPU()
 
 void SetCurrentThreadName(const char* name);
 
+// Tells the OS scheduler how latency sensitive the current thread is. On hybrid CPUs this decides
+// which type of core the thread prefers.
+enum class ThreadQoS
+{
+  // Emulation threads that have to keep up with real time: CPU, GPU, DSP and audio.
+  Emulation,
+  // Work nothing is waiting on right away, like prefetching or flushing files.
+  Background,
+};
+
+void SetCurrentThreadQoS(ThreadQoS qos);
+
 #ifndef _WIN32
 // Returns the lowest address of the stack and the size of the stack
 std::tuple<void*, size_t> GetCurrentThreadStack();
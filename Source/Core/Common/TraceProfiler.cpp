@@ -0,0 +1,219 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/TraceProfiler.h"
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/IOFile.h"
+
+namespace Common::TraceProfiler
+{
+namespace
+{
+// 2^16 zones per thread, which is a few seconds of a busy thread.
+constexpr size_t RING_BUFFER_SIZE = 1 << 16;
+
+// The owning thread is the only writer. Fields are atomics so that an export racing with it reads
+// a possibly stale zone instead of invoking undefined behaviour.
+struct Event
+{
+  std::atomic<const char*> name{nullptr};
+  std::atomic<u64> begin{0};
+  std::atomic<u64> end{0};
+};
+
+struct ThreadBuffer
+{
+  explicit ThreadBuffer(u32 id_) : id(id_) {}
+
+  const u32 id;
+  std::array<Event, RING_BUFFER_SIZE> events;
+  std::atomic<u64> write_index{0};
+  std::atomic<bool> exited{false};
+
+  // Guarded by s_buffers_lock.
+  std::string thread_name;
+};
+
+std::mutex s_buffers_lock;
+std::vector<std::shared_ptr<ThreadBuffer>> s_buffers;
+u32 s_next_thread_id = 1;
+
+const std::chrono::steady_clock::time_point s_epoch = std::chrono::steady_clock::now();
+
+struct ThreadBufferHolder
+{
+  ~ThreadBufferHolder()
+  {
+    if (buffer)
+      buffer->exited.store(true, std::memory_order_relaxed);
+  }
+
+  ThreadBuffer& Get()
+  {
+    if (!buffer)
+    {
+      std::lock_guard lk(s_buffers_lock);
+      buffer = std::make_shared<ThreadBuffer>(s_next_thread_id++);
+      buffer->thread_name = std::move(pending_name);
+      s_buffers.push_back(buffer);
+    }
+    return *buffer;
+  }
+
+  std::shared_ptr<ThreadBuffer> buffer;
+  std::string pending_name;
+};
+
+thread_local ThreadBufferHolder s_thread_buffer;
+
+std::shared_ptr<ThreadBuffer> s_gpu_buffer;
+
+void RecordInto(ThreadBuffer& buffer, const char* name, u64 begin, u64 end)
+{
+  const u64 index = buffer.write_index.load(std::memory_order_relaxed);
+  Event& event = buffer.events[index % RING_BUFFER_SIZE];
+  event.name.store(name, std::memory_order_relaxed);
+  event.begin.store(begin, std::memory_order_relaxed);
+  event.end.store(end, std::memory_order_relaxed);
+  buffer.write_index.store(index + 1, std::memory_order_release);
+}
+
+void WriteEscapedString(File::IOFile& file, std::string_view str)
+{
+  std::string escaped;
+  escaped.reserve(str.size());
+  for (const char c : str)
+  {
+    if (c == '"' || c == '\\')
+      escaped.push_back('\\');
+    if (static_cast<unsigned char>(c) >= 0x20)
+      escaped.push_back(c);
+  }
+  file.WriteString(escaped);
+}
+}  // namespace
+
+namespace detail
+{
+std::atomic<bool> s_enabled{false};
+
+u64 Now()
+{
+  // Offset by one so that zero can mean "not recording" in Zone.
+  return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - s_epoch)
+                              .count()) +
+         1;
+}
+
+void Record(const char* name, u64 begin, u64 end)
+{
+  RecordInto(s_thread_buffer.Get(), name, begin, end);
+}
+}  // namespace detail
+
+void RecordGPUZone(const char* name, u64 begin, u64 end)
+{
+  if (!s_gpu_buffer)
+  {
+    std::lock_guard lk(s_buffers_lock);
+    s_gpu_buffer = std::make_shared<ThreadBuffer>(s_next_thread_id++);
+    s_gpu_buffer->thread_name = "GPU";
+    s_buffers.push_back(s_gpu_buffer);
+  }
+  RecordInto(*s_gpu_buffer, name, begin, end);
+}
+
+void SetEnabled(bool enabled)
+{
+  detail::s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void SetCurrentThreadName(const char* name)
+{
+  if (!s_thread_buffer.buffer)
+  {
+    // Don't allocate a buffer for threads which never record anything.
+    s_thread_buffer.pending_name = name;
+    return;
+  }
+
+  std::lock_guard lk(s_buffers_lock);
+  s_thread_buffer.buffer->thread_name = name;
+}
+
+void Clear()
+{
+  std::lock_guard lk(s_buffers_lock);
+  std::erase_if(s_buffers, [](const std::shared_ptr<ThreadBuffer>& buffer) {
+    return buffer->exited.load(std::memory_order_relaxed);
+  });
+
+  // Only the owning thread may write to its ring buffer, so mark the existing zones as consumed
+  // by dropping them at export time instead.
+  for (const auto& buffer : s_buffers)
+  {
+    for (Event& event : buffer->events)
+      event.name.store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+bool WriteChromeTrace(const std::string& path)
+{
+  File::IOFile file(path, "w");
+  if (!file)
+    return false;
+
+  std::lock_guard lk(s_buffers_lock);
+
+  file.WriteString("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+  bool first = true;
+  const auto begin_event = [&] {
+    if (!first)
+      file.WriteString(",\n");
+    first = false;
+  };
+
+  for (const auto& buffer : s_buffers)
+  {
+    begin_event();
+    file.WriteString(fmt::format(
+        "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"",
+        buffer->id));
+    WriteEscapedString(file, buffer->thread_name.empty() ? fmt::format("Thread {}", buffer->id) :
+                                                           buffer->thread_name);
+    file.WriteString("\"}}");
+
+    const u64 write_index = buffer->write_index.load(std::memory_order_acquire);
+    const u64 first_index = write_index > RING_BUFFER_SIZE ? write_index - RING_BUFFER_SIZE : 0;
+    for (u64 i = first_index; i < write_index; ++i)
+    {
+      const Event& event = buffer->events[i % RING_BUFFER_SIZE];
+      const char* name = event.name.load(std::memory_order_relaxed);
+      const u64 begin = event.begin.load(std::memory_order_relaxed);
+      const u64 end = event.end.load(std::memory_order_relaxed);
+      if (!name || end < begin)
+        continue;
+
+      begin_event();
+      file.WriteString("{\"name\":\"");
+      WriteEscapedString(file, name);
+      // Chrome trace timestamps are in microseconds.
+      file.WriteString(
+          fmt::format("\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                      buffer->id, begin / 1000.0, (end - begin) / 1000.0));
+    }
+  }
+
+  file.WriteString("\n]}\n");
+  return file.IsGood();
+}
+}  // namespace Common::TraceProfiler
@@ -0,0 +1,74 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// A low-overhead timeline profiler. Scoped zones are recorded into a ring buffer owned by the
+// thread that entered them, and can be exported on demand as a Chrome trace event file, which
+// both chrome://tracing and the Perfetto UI can open.
+//
+// While the profiler is disabled a zone costs a single relaxed atomic load.
+
+namespace Common::TraceProfiler
+{
+namespace detail
+{
+extern std::atomic<bool> s_enabled;
+
+u64 Now();
+void Record(const char* name, u64 begin, u64 end);
+}  // namespace detail
+
+void SetEnabled(bool enabled);
+inline bool IsEnabled()
+{
+  return detail::s_enabled.load(std::memory_order_relaxed);
+}
+
+// Nanoseconds on the clock zones are recorded with.
+inline u64 GetTimestamp()
+{
+  return detail::Now();
+}
+
+// Records a zone on the GPU track, for work which isn't bound to a host thread. Only the video
+// thread may call this.
+void RecordGPUZone(const char* name, u64 begin, u64 end);
+
+// Names the calling thread in exported traces. Called by Common::SetCurrentThreadName.
+void SetCurrentThreadName(const char* name);
+
+// Drops every recorded zone, as well as the buffers of threads which have exited.
+void Clear();
+
+bool WriteChromeTrace(const std::string& path);
+
+// The name must outlive the profiler, in practice it should be a string literal.
+class Zone
+{
+public:
+  explicit Zone(const char* name) : m_name(name), m_begin(IsEnabled() ? detail::Now() : 0) {}
+  ~Zone()
+  {
+    if (m_begin != 0 && IsEnabled())
+      detail::Record(m_name, m_begin, detail::Now());
+  }
+
+  Zone(const Zone&) = delete;
+  Zone& operator=(const Zone&) = delete;
+
+private:
+  const char* m_name;
+  u64 m_begin;
+};
+}  // namespace Common::TraceProfiler
+
+#define TRACE_ZONE_CONCAT_(a, b) a##b
+#define TRACE_ZONE_CONCAT(a, b) TRACE_ZONE_CONCAT_(a, b)
+#define TRACE_ZONE(name)                                                                           \
+  Common::TraceProfiler::Zone TRACE_ZONE_CONCAT(trace_zone_, __LINE__)(name)
@@ -5,6 +5,7 @@
 
 #include "Core/AchievementManager.h"
 
+#include <cstring>
 #include <memory>
 
 #include <fmt/format.h>
@@ -18,7 +19,9 @@
 #include "Common/WorkQueueThread.h"
 #include "Core/Config/AchievementSettings.h"
 #include "Core/Core.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 #include "DiscIO/Blob.h"
 #include "VideoCommon/OnScreenDisplay.h"
@@ -696,10 +699,56 @@ void AchievementManager::DoFrame()
   }
 }
 
+const u8* AchievementManager::GetDirectPeekPointer(u32 address, u32 num_bytes) const
+{
+  // With the data cache emulated, RAM may not hold the values the game sees
+  if (m_system->GetPPCState().m_enable_dcache)
+    return nullptr;
+
+  auto& memory = m_system->GetMemory();
+  const u32 segment_offset = address & 0x0FFFFFFF;
+  if (memory.GetRAM() && (address >> 28) == 0x0 && segment_offset < memory.GetRamSizeReal() &&
+      num_bytes <= memory.GetRamSizeReal() - segment_offset)
+  {
+    return memory.GetRAM() + segment_offset;
+  }
+  if (memory.GetEXRAM() && (address >> 28) == 0x1 && segment_offset < memory.GetExRamSizeReal() &&
+      num_bytes <= memory.GetExRamSizeReal() - segment_offset)
+  {
+    return memory.GetEXRAM() + segment_offset;
+  }
+  return nullptr;
+}
+
 u32 AchievementManager::MemoryPeeker(u32 address, u32 num_bytes, void* ud)
 {
   if (!m_system)
     return 0u;
+
+  // Sets can have hundreds of conditions which are all evaluated every frame, so plain RAM is read
+  // directly rather than taking a CPUThreadGuard and going through the MMU for every peek. Values
+  // are returned in the byte order they have in memory, just like the MMU path below.
+  if (const u8* const ptr = GetDirectPeekPointer(address, num_bytes))
+  {
+    switch (num_bytes)
+    {
+    case 1:
+      return *ptr;
+    case 2:
+    {
+      u16 value;
+      std::memcpy(&value, ptr, sizeof(value));
+      return value;
+    }
+    case 4:
+    {
+      u32 value;
+      std::memcpy(&value, ptr, sizeof(value));
+      return value;
+    }
+    }
+  }
+
   Core::CPUThreadGuard threadguard(*m_system);
   switch (num_bytes)
   {
@@ -129,6 +129,7 @@ public:
   void FetchBadges();
 
   void DoFrame();
+  const u8* GetDirectPeekPointer(u32 address, u32 num_bytes) const;
   u32 MemoryPeeker(u32 address, u32 num_bytes, void* ud);
   void AchievementEventHandler(const rc_runtime_event_t* runtime_event);
 
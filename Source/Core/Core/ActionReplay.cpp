@@ -110,6 +110,91 @@ struct ARAddr
   operator u32() const { return address; }
 };
 
+enum class OpType : u8
+{
+  SelfModification,
+  ZeroCodeEnd,
+  ZeroCodeNormal,
+  ZeroCodeRow,
+  ZeroCodeFillAndSlide,
+  ZeroCodeMemoryCopy,
+  ZeroCodeUnknown,
+  RamWriteAndFill,
+  WriteToPointer,
+  AddCode,
+  MasterCode,
+  Conditional,
+};
+
+// A code line with its operation decoded ahead of time.
+struct CompiledOp
+{
+  OpType type;
+  ARAddr addr;
+  u32 data;
+};
+
+// The lines of each active code, decoded when the active codes change so that running the codes
+// every frame only has to dispatch on the operation. Parallel to s_active_codes.
+static std::vector<std::vector<CompiledOp>> s_compiled_codes;
+
+static OpType DecodeOpType(const ARAddr& addr, const u32 data)
+{
+  // ActionReplay program self modification codes
+  if (addr >= 0x00002000 && addr < 0x00003000)
+    return OpType::SelfModification;
+
+  // Zero codes
+  if (0x0 == addr)
+  {
+    switch (data >> 29)
+    {
+    case ZCODE_END:
+      return OpType::ZeroCodeEnd;
+    case ZCODE_NORM:
+      return OpType::ZeroCodeNormal;
+    case ZCODE_ROW:
+      return OpType::ZeroCodeRow;
+    case ZCODE_04:
+      return 0x3 == ((data >> 25) & 0x03) ? OpType::ZeroCodeMemoryCopy :
+                                            OpType::ZeroCodeFillAndSlide;
+    default:
+      return OpType::ZeroCodeUnknown;
+    }
+  }
+
+  if (addr.type != 0x00)
+    return OpType::Conditional;
+
+  switch (addr.subtype)
+  {
+  case SUB_RAM_WRITE:
+    return OpType::RamWriteAndFill;
+  case SUB_WRITE_POINTER:
+    return OpType::WriteToPointer;
+  case SUB_ADD_CODE:
+    return OpType::AddCode;
+  default:  // SUB_MASTER_CODE
+    return OpType::MasterCode;
+  }
+}
+
+static std::vector<CompiledOp> CompileCode(const ARCode& code)
+{
+  std::vector<CompiledOp> ops;
+  ops.reserve(code.ops.size());
+  for (const AREntry& entry : code.ops)
+    ops.push_back({DecodeOpType(entry.cmd_addr, entry.value), entry.cmd_addr, entry.value});
+  return ops;
+}
+
+static void CompileActiveCodes()
+{
+  s_compiled_codes.clear();
+  s_compiled_codes.reserve(s_active_codes.size());
+  std::ranges::transform(s_active_codes, std::back_inserter(s_compiled_codes), CompileCode);
+}
+
 // ----------------------
 // AR Remote Functions
 void ApplyCodes(std::span<const ARCode> codes)
@@ -123,6 +208,7 @@ void ApplyCodes(std::span<const ARCode> codes)
   std::copy_if(codes.begin(), codes.end(), std::back_inserter(s_active_codes),
                [](const ARCode& code) { return code.enabled; });
   s_active_codes.shrink_to_fit();
+  CompileActiveCodes();
 }
 
 void SetSyncedCodesAsActive()
@@ -130,6 +216,7 @@ void SetSyncedCodesAsActive()
   s_active_codes.clear();
   s_active_codes.reserve(s_synced_codes.size());
   s_active_codes = s_synced_codes;
+  CompileActiveCodes();
 }
 
 void UpdateSyncedCodes(std::span<const ARCode> codes)
@@ -150,6 +237,7 @@ std::vector<ARCode> ApplyAndReturnCodes(std::span<const ARCode> codes)
     s_active_codes.clear();
     std::copy_if(codes.begin(), codes.end(), std::back_inserter(s_active_codes),
                  [](const ARCode& code) { return code.enabled; });
+    CompileActiveCodes();
   }
   s_active_codes.shrink_to_fit();
 
@@ -165,6 +253,7 @@ void AddCode(ARCode code)
   {
     std::lock_guard guard(s_lock);
     s_disable_logging = false;
+    s_compiled_codes.emplace_back(CompileCode(code));
     s_active_codes.emplace_back(std::move(code));
   }
 }
@@ -308,19 +397,24 @@ std::string SerializeLine(const AREntry& op)
   return fmt::format("{:08X} {:08X}", op.cmd_addr, op.value);
 }
 
-static void VLogInfo(std::string_view format, fmt::format_args args)
+static bool IsLoggingEnabled()
 {
   if (s_disable_logging)
-    return;
+    return false;
 
-  const bool use_internal_log = s_use_internal_log.load(std::memory_order_relaxed);
-  if (Common::Log::MAX_LOGLEVEL < Common::Log::LogLevel::LINFO && !use_internal_log)
+  return Common::Log::MAX_LOGLEVEL >= Common::Log::LogLevel::LINFO ||
+         s_use_internal_log.load(std::memory_order_relaxed);
+}
+
+static void VLogInfo(std::string_view format, fmt::format_args args)
+{
+  if (!IsLoggingEnabled())
     return;
 
   std::string text = fmt::vformat(format, args);
   INFO_LOG_FMT(ACTIONREPLAY, "{}", text);
 
-  if (use_internal_log)
+  if (s_use_internal_log.load(std::memory_order_relaxed))
   {
     text += '\n';
     s_internal_log.emplace_back(std::move(text));
@@ -489,7 +583,11 @@ static bool Subtype_AddCode(const Core::CPUThreadGuard& guard, const ARAddr& add
     LogInfo("8-bit Add");
     LogInfo("--------");
     PowerPC::MMU::HostWrite_U8(guard, PowerPC::MMU::HostRead_U8(guard, new_addr) + data, new_addr);
-    LogInfo("Wrote {:02x} to address {:08x}", PowerPC::MMU::HostRead_U8(guard, new_addr), new_addr);
+    if (IsLoggingEnabled())
+    {
+      LogInfo("Wrote {:02x} to address {:08x}", PowerPC::MMU::HostRead_U8(guard, new_addr),
+              new_addr);
+    }
     LogInfo("--------");
     break;
 
@@ -498,8 +596,11 @@ static bool Subtype_AddCode(const Core::CPUThreadGuard& guard, const ARAddr& add
     LogInfo("--------");
     PowerPC::MMU::HostWrite_U16(guard, PowerPC::MMU::HostRead_U16(guard, new_addr) + data,
                                 new_addr);
-    LogInfo("Wrote {:04x} to address {:08x}", PowerPC::MMU::HostRead_U16(guard, new_addr),
-            new_addr);
+    if (IsLoggingEnabled())
+    {
+      LogInfo("Wrote {:04x} to address {:08x}", PowerPC::MMU::HostRead_U16(guard, new_addr),
+              new_addr);
+    }
     LogInfo("--------");
     break;
 
@@ -508,8 +609,11 @@ static bool Subtype_AddCode(const Core::CPUThreadGuard& guard, const ARAddr& add
     LogInfo("--------");
     PowerPC::MMU::HostWrite_U32(guard, PowerPC::MMU::HostRead_U32(guard, new_addr) + data,
                                 new_addr);
-    LogInfo("Wrote {:08x} to address {:08x}", PowerPC::MMU::HostRead_U32(guard, new_addr),
-            new_addr);
+    if (IsLoggingEnabled())
+    {
+      LogInfo("Wrote {:08x} to address {:08x}", PowerPC::MMU::HostRead_U32(guard, new_addr),
+              new_addr);
+    }
     LogInfo("--------");
     break;
 
@@ -659,10 +763,9 @@ static bool ZeroCode_MemoryCopy(const Core::CPUThreadGuard& guard, const u32 val
       LogInfo("Resolved Src Address to: {:08x}", ptr_src);
       for (int i = 0; i < num_bytes; ++i)
       {
-        PowerPC::MMU::HostWrite_U8(guard, PowerPC::MMU::HostRead_U8(guard, ptr_src + i),
-                                   ptr_dest + i);
-        LogInfo("Wrote {:08x} to address {:08x}", PowerPC::MMU::HostRead_U8(guard, ptr_src + i),
-                ptr_dest + i);
+        const u8 value = PowerPC::MMU::HostRead_U8(guard, ptr_src + i);
+        PowerPC::MMU::HostWrite_U8(guard, value, ptr_dest + i);
+        LogInfo("Wrote {:08x} to address {:08x}", value, ptr_dest + i);
       }
       LogInfo("--------");
     }
@@ -672,10 +775,9 @@ static bool ZeroCode_MemoryCopy(const Core::CPUThreadGuard& guard, const u32 val
       LogInfo("--------");
       for (int i = 0; i < num_bytes; ++i)
       {
-        PowerPC::MMU::HostWrite_U8(guard, PowerPC::MMU::HostRead_U8(guard, addr_src + i),
-                                   addr_dest + i);
-        LogInfo("Wrote {:08x} to address {:08x}", PowerPC::MMU::HostRead_U8(guard, addr_src + i),
-                addr_dest + i);
+        const u8 value = PowerPC::MMU::HostRead_U8(guard, addr_src + i);
+        PowerPC::MMU::HostWrite_U8(guard, value, addr_dest + i);
+        LogInfo("Wrote {:08x} to address {:08x}", value, addr_dest + i);
       }
       LogInfo("--------");
       return true;
@@ -691,44 +793,6 @@ static bool ZeroCode_MemoryCopy(const Core::CPUThreadGuard& guard, const u32 val
   return true;
 }
 
-static bool NormalCode(const Core::CPUThreadGuard& guard, const ARAddr& addr, const u32 data)
-{
-  switch (addr.subtype)
-  {
-  case SUB_RAM_WRITE:  // Ram write (and fill)
-    LogInfo("Doing Ram Write And Fill");
-    if (!Subtype_RamWriteAndFill(guard, addr, data))
-      return false;
-    break;
-
-  case SUB_WRITE_POINTER:  // Write to pointer
-    LogInfo("Doing Write To Pointer");
-    if (!Subtype_WriteToPointer(guard, addr, data))
-      return false;
-    break;
-
-  case SUB_ADD_CODE:  // Increment Value
-    LogInfo("Doing Add Code");
-    if (!Subtype_AddCode(guard, addr, data))
-      return false;
-    break;
-
-  case SUB_MASTER_CODE:  // Master Code & Write to CCXXXXXX
-    LogInfo("Doing Master Code And Write to CCXXXXXX (ncode not supported)");
-    if (!Subtype_MasterCodeAndWriteToCCXXXXXX(addr, data))
-      return false;
-    break;
-
-  default:
-    LogInfo("Bad Subtype");
-    PanicAlertFmtT("Action Replay: Normal Code 0: Invalid Subtype {0:08x} ({1})", addr.subtype,
-                   s_current_code->name);
-    return false;
-  }
-
-  return true;
-}
-
 static bool CompareValues(const u32 val1, const u32 val2, const int type)
 {
   switch (type)
@@ -830,7 +894,8 @@ static bool ConditionalCode(const Core::CPUThreadGuard& guard, const ARAddr& add
 }
 
 // NOTE: Lock needed to give mutual exclusion to s_current_code and LogInfo
-static bool RunCodeLocked(const Core::CPUThreadGuard& guard, const ARCode& arcode)
+static bool RunCodeLocked(const Core::CPUThreadGuard& guard, const ARCode& arcode,
+                          std::span<const CompiledOp> ops)
 {
   // The mechanism is different than what the real AR uses, so there may be compatibility problems.
 
@@ -845,12 +910,12 @@ static bool RunCodeLocked(const Core::CPUThreadGuard& guard, const ARCode& arcod
   s_current_code = &arcode;
 
   LogInfo("Code Name: {}", arcode.name);
-  LogInfo("Number of codes: {}", arcode.ops.size());
+  LogInfo("Number of codes: {}", ops.size());
 
-  for (const AREntry& entry : arcode.ops)
+  for (const CompiledOp& op : ops)
   {
-    const ARAddr addr(entry.cmd_addr);
-    const u32 data = entry.value;
+    const ARAddr& addr = op.addr;
+    const u32 data = op.data;
 
     // after a conditional code, skip lines if needed
     if (skip_count)
@@ -899,85 +964,96 @@ static bool RunCodeLocked(const Core::CPUThreadGuard& guard, const ARCode& arcod
       continue;
     }
 
-    // ActionReplay program self modification codes
-    if (addr >= 0x00002000 && addr < 0x00003000)
+    // skip these weird init lines
+    // TODO: Where are the "weird init lines"?
+    // if (iter == code.ops.begin() && cmd == 1)
+    // continue;
+
+    switch (op.type)
     {
+    case OpType::SelfModification:
       LogInfo(
           "This action replay simulator does not support codes that modify Action Replay itself.");
       PanicAlertFmtT(
           "This action replay simulator does not support codes that modify Action Replay itself.");
       return false;
-    }
 
-    // skip these weird init lines
-    // TODO: Where are the "weird init lines"?
-    // if (iter == code.ops.begin() && cmd == 1)
-    // continue;
+    case OpType::ZeroCodeEnd:  // END OF CODES
+      LogInfo("Doing Zero Code {:08x}", ZCODE_END);
+      LogInfo("ZCode: End Of Codes");
+      return true;
 
-    // Zero codes
-    if (0x0 == addr)  // Check if the code is a zero code
-    {
-      const u8 zcode = data >> 29;
+    // TODO: the "00000000 40000000"(end if) codes fall into this case, I don't think that is
+    // correct
+    case OpType::ZeroCodeNormal:  // Normal execution of codes
+      // Todo: Set register 1BB4 to 0
+      LogInfo("Doing Zero Code {:08x}", ZCODE_NORM);
+      LogInfo("ZCode: Normal execution of codes, set register 1BB4 to 0 (zcode not supported)");
+      break;
 
-      LogInfo("Doing Zero Code {:08x}", zcode);
+    case OpType::ZeroCodeRow:  // Executes all codes in the same row
+      // Todo: Set register 1BB4 to 1
+      LogInfo("Doing Zero Code {:08x}", ZCODE_ROW);
+      LogInfo("ZCode: Executes all codes in the same row, Set register 1BB4 to 1 (zcode not "
+              "supported)");
+      PanicAlertFmtT("Zero 3 code not supported");
+      return false;
 
-      switch (zcode)
-      {
-      case ZCODE_END:  // END OF CODES
-        LogInfo("ZCode: End Of Codes");
-        return true;
-
-      // TODO: the "00000000 40000000"(end if) codes fall into this case, I don't think that is
-      // correct
-      case ZCODE_NORM:  // Normal execution of codes
-        // Todo: Set register 1BB4 to 0
-        LogInfo("ZCode: Normal execution of codes, set register 1BB4 to 0 (zcode not supported)");
-        break;
-
-      case ZCODE_ROW:  // Executes all codes in the same row
-        // Todo: Set register 1BB4 to 1
-        LogInfo("ZCode: Executes all codes in the same row, Set register 1BB4 to 1 (zcode not "
-                "supported)");
-        PanicAlertFmtT("Zero 3 code not supported");
-        return false;
+    case OpType::ZeroCodeMemoryCopy:
+      LogInfo("Doing Zero Code {:08x}", ZCODE_04);
+      LogInfo("ZCode: Memory Copy");
+      do_memory_copy = true;
+      val_last = data;
+      break;
 
-      case ZCODE_04:  // Fill & Slide or Memory Copy
-        if (0x3 == ((data >> 25) & 0x03))
-        {
-          LogInfo("ZCode: Memory Copy");
-          do_memory_copy = true;
-          val_last = data;
-        }
-        else
-        {
-          LogInfo("ZCode: Fill And Slide");
-          do_fill_and_slide = true;
-          val_last = data;
-        }
-        break;
+    case OpType::ZeroCodeFillAndSlide:
+      LogInfo("Doing Zero Code {:08x}", ZCODE_04);
+      LogInfo("ZCode: Fill And Slide");
+      do_fill_and_slide = true;
+      val_last = data;
+      break;
+
+    case OpType::ZeroCodeUnknown:
+      LogInfo("Doing Zero Code {:08x}", data >> 29);
+      LogInfo("ZCode: Unknown");
+      PanicAlertFmtT("Zero code unknown to Dolphin: {0:08x}", data >> 29);
+      return false;
 
-      default:
-        LogInfo("ZCode: Unknown");
-        PanicAlertFmtT("Zero code unknown to Dolphin: {0:08x}", zcode);
+    case OpType::RamWriteAndFill:
+      LogInfo("Doing Normal Code {:08x}", addr.type);
+      LogInfo("Subtype: {:08x}", addr.subtype);
+      LogInfo("Doing Ram Write And Fill");
+      if (!Subtype_RamWriteAndFill(guard, addr, data))
         return false;
-      }
+      break;
 
-      // done handling zero codes
-      continue;
-    }
+    case OpType::WriteToPointer:
+      LogInfo("Doing Normal Code {:08x}", addr.type);
+      LogInfo("Subtype: {:08x}", addr.subtype);
+      LogInfo("Doing Write To Pointer");
+      if (!Subtype_WriteToPointer(guard, addr, data))
+        return false;
+      break;
 
-    // Normal codes
-    LogInfo("Doing Normal Code {:08x}", addr.type);
-    LogInfo("Subtype: {:08x}", addr.subtype);
+    case OpType::AddCode:  // Increment Value
+      LogInfo("Doing Normal Code {:08x}", addr.type);
+      LogInfo("Subtype: {:08x}", addr.subtype);
+      LogInfo("Doing Add Code");
+      if (!Subtype_AddCode(guard, addr, data))
+        return false;
+      break;
 
-    switch (addr.type)
-    {
-    case 0x00:
-      if (false == NormalCode(guard, addr, data))
+    case OpType::MasterCode:  // Master Code & Write to CCXXXXXX
+      LogInfo("Doing Normal Code {:08x}", addr.type);
+      LogInfo("Subtype: {:08x}", addr.subtype);
+      LogInfo("Doing Master Code And Write to CCXXXXXX (ncode not supported)");
+      if (!Subtype_MasterCodeAndWriteToCCXXXXXX(addr, data))
         return false;
       break;
 
-    default:
+    case OpType::Conditional:
+      LogInfo("Doing Normal Code {:08x}", addr.type);
+      LogInfo("Subtype: {:08x}", addr.subtype);
       LogInfo("This Normal Code is a Conditional Code");
       if (false == ConditionalCode(guard, addr, data, &skip_count))
         return false;
@@ -997,11 +1073,19 @@ void RunAllActive(const Core::CPUThreadGuard& cpu_guard)
   // are only atomic ops unless contested. It should be rare for this to
   // be contested.
   std::lock_guard guard(s_lock);
-  std::erase_if(s_active_codes, [&cpu_guard](const ARCode& code) {
-    const bool success = RunCodeLocked(cpu_guard, code);
+  for (size_t i = 0; i < s_active_codes.size();)
+  {
+    const bool success = RunCodeLocked(cpu_guard, s_active_codes[i], s_compiled_codes[i]);
     LogInfo("\n");
-    return !success;
-  });
+    if (success)
+    {
+      ++i;
+      continue;
+    }
+
+    s_active_codes.erase(s_active_codes.begin() + i);
+    s_compiled_codes.erase(s_compiled_codes.begin() + i);
+  }
   s_disable_logging = true;
 }
 
@@ -3,6 +3,7 @@
 
 #include "Core/CheatSearch.h"
 
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -15,6 +16,7 @@
 #include "Common/Assert.h"
 #include "Common/BitUtils.h"
 #include "Common/StringUtil.h"
+#include "Common/Swap.h"
 
 #include "Core/Config/AchievementSettings.h"
 #include "Core/Core.h"
@@ -198,6 +200,84 @@ TryReadValueFromEmulatedMemory(const Core::CPUThreadGuard& guard, u32 addr,
 {
   return PowerPC::MMU::HostTryReadF64(guard, addr, space);
 }
+
+// Reads values for a search straight from host memory where possible. Translating each page once
+// is much faster than going through the MMU for every single value of a full RAM search.
+class SearchMemoryReader
+{
+public:
+  SearchMemoryReader(const Core::CPUThreadGuard& guard, PowerPC::RequestedAddressSpace space)
+      : m_guard(guard), m_space(space)
+  {
+    const auto& ppc_state = guard.GetSystem().GetPPCState();
+    m_translate = space == PowerPC::RequestedAddressSpace::Virtual ||
+                  (space == PowerPC::RequestedAddressSpace::Effective && ppc_state.msr.DR);
+
+    // With the data cache emulated, RAM may not hold the values the game sees
+    m_direct = !ppc_state.m_enable_dcache &&
+               (space != PowerPC::RequestedAddressSpace::Virtual || ppc_state.msr.DR);
+  }
+
+  template <typename T>
+  std::optional<PowerPC::ReadResult<T>> TryRead(u32 addr)
+  {
+    const u32 page_offset = addr & PowerPC::HW_PAGE_MASK;
+    if (m_direct && page_offset + sizeof(T) <= PowerPC::HW_PAGE_SIZE)
+    {
+      const u32 page_address = addr - page_offset;
+      if (!m_page_looked_up || page_address != m_page_address)
+      {
+        m_page = GetHostPage(page_address);
+        m_page_address = page_address;
+        m_page_looked_up = true;
+      }
+
+      if (m_page)
+      {
+        T value;
+        std::memcpy(&value, m_page + page_offset, sizeof(T));
+        return PowerPC::ReadResult<T>(m_translate, Common::FromBigEndian(value));
+      }
+    }
+
+    // Values crossing a page boundary and anything that isn't plain RAM, like the locked L1 cache,
+    // take the slow path
+    return TryReadValueFromEmulatedMemory<T>(m_guard, addr, m_space);
+  }
+
+private:
+  const u8* GetHostPage(u32 page_address) const
+  {
+    auto& system = m_guard.GetSystem();
+
+    u32 physical_address = page_address;
+    if (m_translate)
+    {
+      const std::optional<u32> translated = system.GetMMU().GetTranslatedAddress(page_address);
+      if (!translated)
+        return nullptr;
+      physical_address = *translated;
+    }
+
+    auto& memory = system.GetMemory();
+    const u32 segment = physical_address >> 28;
+    const u32 segment_offset = physical_address & 0x0FFFFFFF;
+    if (memory.GetRAM() && segment == 0x0 && segment_offset < memory.GetRamSizeReal())
+      return memory.GetRAM() + segment_offset;
+    if (memory.GetEXRAM() && segment == 0x1 && segment_offset < memory.GetExRamSizeReal())
+      return memory.GetEXRAM() + segment_offset;
+    return nullptr;
+  }
+
+  const Core::CPUThreadGuard& m_guard;
+  PowerPC::RequestedAddressSpace m_space;
+  bool m_translate = false;
+  bool m_direct = false;
+
+  bool m_page_looked_up = false;
+  u32 m_page_address = 0;
+  const u8* m_page = nullptr;
+};
 }  // namespace
 
 template <typename T>
@@ -221,6 +301,7 @@ Cheats::NewSearch(const Core::CPUThreadGuard& guard,
   if (address_space == PowerPC::RequestedAddressSpace::Virtual && !ppc_state.msr.DR)
     return Cheats::SearchErrorCode::VirtualAddressesCurrentlyNotAccessible;
 
+  SearchMemoryReader reader(guard, address_space);
   for (const Cheats::MemoryRange& range : memory_ranges)
   {
     if (range.m_length < sizeof(T))
@@ -237,7 +318,7 @@ Cheats::NewSearch(const Core::CPUThreadGuard& guard,
     for (u64 i = 0; i < length; i += increment_per_loop)
     {
       const u32 addr = start_address + i;
-      const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
+      const auto current_value = reader.TryRead<T>(addr);
       if (!current_value)
         continue;
 
@@ -276,10 +357,12 @@ Cheats::NextSearch(const Core::CPUThreadGuard& guard,
   if (address_space == PowerPC::RequestedAddressSpace::Virtual && !ppc_state.msr.DR)
     return Cheats::SearchErrorCode::VirtualAddressesCurrentlyNotAccessible;
 
+  SearchMemoryReader reader(guard, address_space);
+  results.reserve(previous_results.size());
   for (const auto& previous_result : previous_results)
   {
     const u32 addr = previous_result.m_address;
-    const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
+    const auto current_value = reader.TryRead<T>(addr);
     if (!current_value)
     {
       auto& r = results.emplace_back();
@@ -180,6 +180,7 @@ public:
     {
       for (const std::string& filename : GetGameIniFilenames(m_id, m_revision))
         ini.Load(File::GetSysDirectory() + GAMESETTINGS_DIR DIR_SEP + filename, true);
+      LoadPerformanceProfiles(&ini);
     }
     else
     {
@@ -200,6 +201,35 @@ public:
   void Save(Config::Layer* layer) override;
 
 private:
+  // Performance profiles are game INIs kept outside of Sys, so that settings can be tuned per
+  // game without shipping a new build. They take precedence over the bundled game INIs. Only
+  // settings are taken from them; patches and codes still come from the regular game INIs.
+  void LoadPerformanceProfiles(Common::IniFile* ini) const
+  {
+    const std::string profile_directory = Config::Get(Config::MAIN_PERFORMANCE_PROFILE_PATH);
+    if (profile_directory.empty())
+      return;
+
+    for (const std::string& filename : GetGameIniFilenames(m_id, m_revision))
+    {
+      const std::string path = profile_directory + DIR_SEP + filename;
+      Common::IniFile profile;
+      if (!File::Exists(path) || !profile.Load(path))
+        continue;
+
+      for (const auto& section : profile.GetSections())
+      {
+        Common::IniFile::Section* target = ini->GetOrCreateSection(section.GetName());
+        for (const auto& [key, value] : section.GetValues())
+        {
+          NOTICE_LOG_FMT(CORE, "Performance profile {} sets {}.{} = {}", filename,
+                         section.GetName(), key, value);
+          target->Set(key, value);
+        }
+      }
+    }
+  }
+
   void LoadControllerConfig(Config::Layer* layer) const
   {
     // Game INIs can have controller profiles embedded in to them
@@ -30,6 +30,10 @@ static void LoadFromDTM(Config::Layer* config_layer, Movie::DTMHeader* dtm)
   config_layer->Set(Config::MAIN_CPU_THREAD, dtm->bDualCore);
   config_layer->Set(Config::MAIN_DSP_HLE, dtm->bDSPHLE);
   config_layer->Set(Config::MAIN_FAST_DISC_SPEED, dtm->bFastDiscSpeed);
+  // Not stored in DTMs, so keep memory card timing accurate for both recording and playback.
+  config_layer->Set(Config::MAIN_FAST_MEMCARD_SPEED, false);
+  // Depends on host timing, so it would make playback diverge from the recording.
+  config_layer->Set(Config::MAIN_OVERCLOCK_ADAPTIVE, false);
   config_layer->Set(Config::MAIN_CPU_CORE, static_cast<PowerPC::CPUCore>(dtm->CPUCore));
   config_layer->Set(Config::MAIN_SYNC_GPU, dtm->bSyncGPU);
   config_layer->Set(Config::MAIN_GFX_BACKEND, dtm->videoBackend.data());
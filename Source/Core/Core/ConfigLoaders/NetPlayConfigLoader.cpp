@@ -38,6 +38,8 @@ public:
     layer->Set(Config::MAIN_DSP_HLE, m_settings.dsp_hle);
     layer->Set(Config::MAIN_OVERCLOCK_ENABLE, m_settings.oc_enable);
     layer->Set(Config::MAIN_OVERCLOCK, m_settings.oc_factor);
+    // Depends on host timing, so it can't be kept in sync between players.
+    layer->Set(Config::MAIN_OVERCLOCK_ADAPTIVE, false);
     for (ExpansionInterface::Slot slot : ExpansionInterface::SLOTS)
       layer->Set(Config::GetInfoForEXIDevice(slot), m_settings.exi_device[slot]);
     layer->Set(Config::MAIN_MEMORY_CARD_SIZE, m_settings.memcard_size_override);
@@ -61,6 +63,9 @@ public:
 
     layer->Set(Config::GFX_HACK_EFB_ACCESS_ENABLE, m_settings.efb_access_enable);
     layer->Set(Config::GFX_HACK_BBOX_ENABLE, m_settings.bbox_enable);
+    // These make bounding box reads depend on host GPU timing or on local settings.
+    layer->Set(Config::GFX_HACK_BBOX_ASYNC_READBACK, false);
+    layer->Set(Config::GFX_HACK_BBOX_CPU_ESTIMATE, false);
     layer->Set(Config::GFX_HACK_FORCE_PROGRESSIVE, m_settings.force_progressive);
     layer->Set(Config::GFX_HACK_SKIP_EFB_COPY_TO_RAM, m_settings.efb_to_texture_enable);
     layer->Set(Config::GFX_HACK_SKIP_XFB_COPY_TO_RAM, m_settings.xfb_to_texture_enable);
@@ -70,6 +75,8 @@ public:
     layer->Set(Config::GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES,
                m_settings.safe_texture_cache_color_samples);
     layer->Set(Config::GFX_PERF_QUERIES_ENABLE, m_settings.perf_queries_enable);
+    // Makes the results depend on host GPU timing.
+    layer->Set(Config::GFX_HACK_PERF_QUERIES_ASYNC_READBACK, false);
     layer->Set(Config::MAIN_FLOAT_EXCEPTIONS, m_settings.float_exceptions);
     layer->Set(Config::MAIN_DIVIDE_BY_ZERO_EXCEPTIONS, m_settings.divide_by_zero_exceptions);
     layer->Set(Config::MAIN_FPRF, m_settings.fprf);
@@ -83,6 +90,8 @@ public:
 
     layer->Set(Config::MAIN_JIT_FOLLOW_BRANCH, m_settings.jit_follow_branch);
     layer->Set(Config::MAIN_FAST_DISC_SPEED, m_settings.fast_disc_speed);
+    // Only meant for offline use, as it isn't synced between players.
+    layer->Set(Config::MAIN_FAST_MEMCARD_SPEED, false);
     layer->Set(Config::MAIN_MMU, m_settings.mmu);
     layer->Set(Config::MAIN_FASTMEM, m_settings.fastmem);
     layer->Set(Config::MAIN_SKIP_IPL, m_settings.skip_ipl);
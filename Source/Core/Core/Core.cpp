@@ -5,12 +5,16 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstring>
 #include <functional>
 #include <mutex>
 #include <queue>
+#include <string>
+#include <thread>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <fmt/chrono.h>
 #include <fmt/format.h>
@@ -28,8 +32,10 @@
 #include "Common/Event.h"
 #include "Common/FPURoundMode.h"
 #include "Common/FatFsUtil.h"
+#include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 #include "Common/Flag.h"
+#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
@@ -59,6 +65,7 @@
 #include "Core/HW/GCKeyboard.h"
 #include "Core/HW/GCPad.h"
 #include "Core/HW/HW.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/HW/Wiimote.h"
@@ -113,6 +120,8 @@ static bool s_is_throttler_temp_disabled = false;
 static std::atomic<double> s_last_actual_emulation_speed{1.0};
 static bool s_frame_step = false;
 static std::atomic<bool> s_stop_frame_step;
+static std::chrono::steady_clock::time_point s_boot_start_time;
+static std::atomic<bool> s_waiting_for_first_frame = false;
 
 #ifdef USE_MEMORYWATCHER
 static std::unique_ptr<MemoryWatcher> s_memory_watcher;
@@ -142,6 +151,13 @@ static Common::EventHook s_frame_presented = AfterPresentEvent::Register(
 
       if (present_info.reason != PresentInfo::PresentReason::VideoInterfaceDuplicate)
         Core::Callback_FramePresented(last_speed);
+
+      if (s_waiting_for_first_frame.exchange(false, std::memory_order_relaxed))
+      {
+        const auto boot_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - s_boot_start_time);
+        NOTICE_LOG_FMT(BOOT, "Time to first frame: {} ms", boot_time.count());
+      }
     },
     "Core Frame Presented");
 
@@ -263,6 +279,8 @@ bool Init(Core::System& system, std::unique_ptr<BootParameters> boot, const Wind
   g_video_backend->PrepareWindow(prepared_wsi);
 
   // Start the emu thread
+  s_boot_start_time = std::chrono::steady_clock::now();
+  s_waiting_for_first_frame.store(true, std::memory_order_relaxed);
   s_is_booting.Set();
   s_emu_thread = std::thread(EmuThread, std::ref(system), std::move(boot), prepared_wsi);
   return true;
@@ -375,6 +393,7 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
     Common::SetCurrentThreadName("CPU thread");
   else
     Common::SetCurrentThreadName("CPU-GPU thread");
+  Common::SetCurrentThreadQoS(Common::ThreadQoS::Emulation);
 
   // This needs to be delayed until after the video backend is ready.
   DolphinAnalytics::Instance().ReportGameStart();
@@ -383,9 +402,13 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
   g_perf_metrics.Reset();
 
   // The JIT need to be able to intercept faults, both for fastmem and for the BLR optimization.
+  // Write tracking also depends on it, as writes to tracked memory are detected through faults.
   const bool exception_handler = EMM::IsExceptionHandlerSupported();
   if (exception_handler)
+  {
     EMM::InstallExceptionHandler();
+    system.GetMemory().EnableWriteTracking();
+  }
 
 #ifdef USE_MEMORYWATCHER
   s_memory_watcher = std::make_unique<MemoryWatcher>();
@@ -433,7 +456,10 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
   s_is_started = false;
 
   if (exception_handler)
+  {
+    system.GetMemory().DisableWriteTracking();
     EMM::UninstallExceptionHandler();
+  }
 
   if (GDBStub::IsActive())
   {
@@ -452,6 +478,7 @@ static void FifoPlayerThread(Core::System& system, const std::optional<std::stri
     Common::SetCurrentThreadName("FIFO player thread");
   else
     Common::SetCurrentThreadName("FIFO-GPU thread");
+  Common::SetCurrentThreadQoS(Common::ThreadQoS::Emulation);
 
   // Enter CPU run loop. When we leave it - we are done.
   if (auto cpu_core = system.GetFifoPlayer().GetCPUCore())
@@ -475,6 +502,30 @@ static void FifoPlayerThread(Core::System& system, const std::optional<std::stri
   }
 }
 
+// Reads the game's shader and pipeline caches while the rest of the emulated hardware is being
+// initialized, so that the video backend loads them from the OS file cache instead of the disk.
+static void PrefetchShaderCaches(const std::string& game_id, const Common::Flag& stop)
+{
+  Common::SetCurrentThreadName("Shader cache prefetch");
+  Common::SetCurrentThreadQoS(Common::ThreadQoS::Background);
+
+  const std::vector<std::string> paths =
+      Common::DoFileSearch({File::GetUserPath(D_SHADERCACHE_IDX)}, {".cache"});
+  std::vector<u8> buffer(0x100000);
+  for (const std::string& path : paths)
+  {
+    std::string filename;
+    SplitPath(path, nullptr, &filename, nullptr);
+    if (filename.find(game_id) == std::string::npos)
+      continue;
+
+    File::IOFile file(path, "rb");
+    while (!stop.IsSet() && file.ReadBytes(buffer.data(), buffer.size()))
+    {
+    }
+  }
+}
+
 // Initialize and create emulation thread
 // Call browser: Init():s_emu_thread().
 // See the BootManager.cpp file description for a complete call schedule.
@@ -495,6 +546,16 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
 
   Common::SetCurrentThreadName("Emuthread - Starting");
 
+  Common::Flag stop_prefetch;
+  std::thread prefetch_thread;
+  if (const std::string& game_id = SConfig::GetInstance().GetGameID(); !game_id.empty())
+    prefetch_thread = std::thread(PrefetchShaderCaches, game_id, std::cref(stop_prefetch));
+  Common::ScopeGuard prefetch_guard{[&] {
+    stop_prefetch.Set();
+    if (prefetch_thread.joinable())
+      prefetch_thread.join();
+  }};
+
   DeclareAsGPUThread();
 
   // For a time this acts as the CPU thread...
@@ -592,6 +653,9 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
     g_video_backend->Shutdown();
   }};
 
+  // The video backend has loaded its caches by now.
+  prefetch_guard.Exit();
+
   if (cpu_info.HTT)
     Config::SetBaseOrCurrent(Config::MAIN_DSP_THREAD, cpu_info.num_cores > 4);
   else
@@ -668,6 +732,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
     // This thread, after creating the EmuWindow, spawns a CPU
     // thread, and then takes over and becomes the video thread
     Common::SetCurrentThreadName("Video thread");
+    Common::SetCurrentThreadQoS(Common::ThreadQoS::Emulation);
     UndeclareAsCPUThread();
     Common::FPU::LoadDefaultSIMDState();
 
@@ -914,6 +979,9 @@ void Callback_NewField(Core::System& system)
 #ifdef USE_RETRO_ACHIEVEMENTS
   AchievementManager::GetInstance().DoFrame();
 #endif  // USE_RETRO_ACHIEVEMENTS
+
+  State::UpdateRewind(system);
+  system.GetMovie().UpdateKeyframes();
 }
 
 void UpdateTitle(Core::System& system)
@@ -7,6 +7,7 @@
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -15,6 +16,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/SPSCQueue.h"
+#include "Common/TraceProfiler.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/CPUThreadConfigCallback.h"
@@ -42,6 +44,81 @@ static bool operator<(const Event& left, const Event& right)
   return std::tie(left.time, left.fifo_order) < std::tie(right.time, right.fifo_order);
 }
 
+// The event queue is a 4-ary min-heap. It has half as many levels as a binary heap, and the
+// children of a node are next to each other in memory, which makes popping the next event (the
+// most common operation in Advance) cheaper.
+constexpr size_t EVENT_HEAP_ARITY = 4;
+
+// The number of events which are usually pending at most, so that scheduling doesn't allocate
+constexpr size_t EVENT_QUEUE_RESERVED_SIZE = 64;
+
+static void SiftEventUp(std::vector<Event>& heap, size_t index)
+{
+  Event event = std::move(heap[index]);
+  while (index > 0)
+  {
+    const size_t parent = (index - 1) / EVENT_HEAP_ARITY;
+    if (!(heap[parent] > event))
+      break;
+
+    heap[index] = std::move(heap[parent]);
+    index = parent;
+  }
+  heap[index] = std::move(event);
+}
+
+static void SiftEventDown(std::vector<Event>& heap, size_t index)
+{
+  const size_t size = heap.size();
+  Event event = std::move(heap[index]);
+  while (true)
+  {
+    const size_t first_child = index * EVENT_HEAP_ARITY + 1;
+    if (first_child >= size)
+      break;
+
+    const size_t last_child = std::min(first_child + EVENT_HEAP_ARITY, size);
+    size_t earliest_child = first_child;
+    for (size_t child = first_child + 1; child < last_child; ++child)
+    {
+      if (heap[earliest_child] > heap[child])
+        earliest_child = child;
+    }
+
+    if (!(event > heap[earliest_child]))
+      break;
+
+    heap[index] = std::move(heap[earliest_child]);
+    index = earliest_child;
+  }
+  heap[index] = std::move(event);
+}
+
+static void PushEvent(std::vector<Event>& heap, Event event)
+{
+  heap.push_back(std::move(event));
+  SiftEventUp(heap, heap.size() - 1);
+}
+
+static Event PopEvent(std::vector<Event>& heap)
+{
+  Event event = std::move(heap.front());
+  heap.front() = std::move(heap.back());
+  heap.pop_back();
+  if (!heap.empty())
+    SiftEventDown(heap, 0);
+  return event;
+}
+
+static void MakeEventHeap(std::vector<Event>& heap)
+{
+  if (heap.size() <= 1)
+    return;
+
+  for (size_t i = (heap.size() - 2) / EVENT_HEAP_ARITY + 1; i-- > 0;)
+    SiftEventDown(heap, i);
+}
+
 static constexpr int MAX_SLICE_LENGTH = 20000;
 
 static void EmptyTimedCallback(Core::System& system, u64 userdata, s64 cyclesLate)
@@ -92,6 +169,7 @@ void CoreTimingManager::UnregisterAllEvents()
 
 void CoreTimingManager::Init()
 {
+  m_adaptive_oc_factor = 1.0f;
   m_registered_config_callback_id =
       CPUThreadConfigCallback::AddConfigChangedCallback([this]() { RefreshConfig(); });
   RefreshConfig();
@@ -102,6 +180,8 @@ void CoreTimingManager::Init()
   m_globals.slice_length = MAX_SLICE_LENGTH;
   m_globals.global_timer = 0;
   m_idled_cycles = 0;
+  m_adaptive_oc_window_start = 0;
+  m_adaptive_oc_window_idled_cycles = 0;
 
   // The time between CoreTiming being intialized and the first call to Advance() is considered
   // the slice boundary between slice -1 and slice 0. Dispatcher loops must call Advance() before
@@ -113,6 +193,7 @@ void CoreTimingManager::Init()
   ResetThrottle(0);
 
   m_event_fifo_id = 0;
+  m_event_queue.reserve(EVENT_QUEUE_RESERVED_SIZE);
   m_ev_lost = RegisterEvent("_lost_event", &EmptyTimedCallback);
 }
 
@@ -129,8 +210,21 @@ void CoreTimingManager::RefreshConfig()
 {
   m_config_oc_factor =
       Config::Get(Config::MAIN_OVERCLOCK_ENABLE) ? Config::Get(Config::MAIN_OVERCLOCK) : 1.0f;
+  m_config_adaptive_oc = Config::Get(Config::MAIN_OVERCLOCK_ADAPTIVE);
+  if (m_config_adaptive_oc)
+  {
+    m_config_adaptive_oc_min = std::max(Config::Get(Config::MAIN_OVERCLOCK_ADAPTIVE_MIN), 0.01f);
+    m_config_adaptive_oc_max =
+        std::max(Config::Get(Config::MAIN_OVERCLOCK_ADAPTIVE_MAX), m_config_adaptive_oc_min);
+    m_adaptive_oc_factor =
+        std::clamp(m_adaptive_oc_factor, m_config_adaptive_oc_min, m_config_adaptive_oc_max);
+    m_config_oc_factor = m_adaptive_oc_factor;
+  }
   m_config_oc_inv_factor = 1.0f / m_config_oc_factor;
   m_config_sync_on_skip_idle = Config::Get(Config::MAIN_SYNC_ON_SKIP_IDLE);
+  m_config_late_input_latching = Config::Get(Config::MAIN_LATE_INPUT_LATCHING);
+  m_config_sampling_profiler = Config::Get(Config::MAIN_DEBUG_ENABLE_SAMPLING_PROFILER);
+  Common::TraceProfiler::SetEnabled(Config::Get(Config::MAIN_DEBUG_ENABLE_TRACE_PROFILER));
 
   // A maximum fallback is used to prevent the system from sleeping for
   // too long or going full speed in an attempt to catch up to timings.
@@ -207,7 +301,7 @@ void CoreTimingManager::DoState(PointerWrap& p)
     // When loading from a save state, we must assume the Event order is random and meaningless.
     // The exact layout of the heap in memory is implementation defined, therefore it is platform
     // and library version specific.
-    std::make_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+    MakeEventHeap(m_event_queue);
 
     // The stave state has changed the time, so our previous Throttle targets are invalid.
     // Especially when global_time goes down; So we create a fake throttle update.
@@ -264,8 +358,7 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
     if (!m_is_global_timer_sane)
       ForceExceptionCheck(cycles_into_future);
 
-    m_event_queue.emplace_back(Event{timeout, m_event_fifo_id++, userdata, event_type});
-    std::push_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+    PushEvent(m_event_queue, Event{timeout, m_event_fifo_id++, userdata, event_type});
   }
   else
   {
@@ -291,7 +384,7 @@ void CoreTimingManager::RemoveEvent(EventType* event_type)
   if (itr != m_event_queue.end())
   {
     m_event_queue.erase(itr, m_event_queue.end());
-    std::make_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+    MakeEventHeap(m_event_queue);
   }
 }
 
@@ -319,8 +412,7 @@ void CoreTimingManager::MoveEvents()
   for (Event ev; m_ts_queue.Pop(ev);)
   {
     ev.fifo_order = m_event_fifo_id++;
-    m_event_queue.emplace_back(std::move(ev));
-    std::push_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+    PushEvent(m_event_queue, std::move(ev));
   }
 }
 
@@ -333,8 +425,13 @@ void CoreTimingManager::Advance()
   auto& power_pc = m_system.GetPowerPC();
   auto& ppc_state = power_pc.GetPPCState();
 
+  if (m_config_sampling_profiler)
+    power_pc.GetSamplingProfiler().Sample(ppc_state.pc);
+
   int cyclesExecuted = m_globals.slice_length - DowncountToCycles(ppc_state.downcount);
   m_globals.global_timer += cyclesExecuted;
+  if (m_config_adaptive_oc)
+    UpdateAdaptiveOverclock();
   m_last_oc_factor = m_config_oc_factor;
   m_globals.last_OC_factor_inverted = m_config_oc_inv_factor;
   m_globals.slice_length = MAX_SLICE_LENGTH;
@@ -343,11 +440,11 @@ void CoreTimingManager::Advance()
 
   while (!m_event_queue.empty() && m_event_queue.front().time <= m_globals.global_timer)
   {
-    Event evt = std::move(m_event_queue.front());
-    std::pop_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
-    m_event_queue.pop_back();
+    Event evt = PopEvent(m_event_queue);
 
     Throttle(evt.time);
+
+    TRACE_ZONE("CoreTiming event");
     evt.type->callback(m_system, evt.userdata, m_globals.global_timer - evt.time);
   }
 
@@ -369,15 +466,67 @@ void CoreTimingManager::Advance()
   power_pc.CheckExternalExceptions();
 }
 
-void CoreTimingManager::Throttle(const s64 target_cycle)
+// The adaptive overclock is tuned a few times per emulated second, based on how much of the last
+// window the game spent in idle loops. Lowering the clock during idle-heavy scenes saves host
+// power, and raising it helps CPU-bound games, but only as long as the host keeps up.
+static constexpr int ADAPTIVE_OC_UPDATES_PER_SECOND = 4;
+static constexpr double ADAPTIVE_OC_IDLE_HIGH = 0.5;
+static constexpr double ADAPTIVE_OC_IDLE_LOW = 0.1;
+static constexpr float ADAPTIVE_OC_STEP = 0.05f;
+
+void CoreTimingManager::UpdateAdaptiveOverclock()
 {
-  // Based on number of cycles and emulation speed, increase the target deadline
-  const s64 cycles = target_cycle - m_throttle_last_cycle;
+  const s64 window_cycles = m_globals.global_timer - m_adaptive_oc_window_start;
+  if (window_cycles <= 0 ||
+      window_cycles < m_throttle_clock_per_sec / ADAPTIVE_OC_UPDATES_PER_SECOND)
+  {
+    return;
+  }
+
+  const double idle_ratio =
+      static_cast<double>(m_idled_cycles - m_adaptive_oc_window_idled_cycles) / window_cycles;
+  m_adaptive_oc_window_start = m_globals.global_timer;
+  m_adaptive_oc_window_idled_cycles = m_idled_cycles;
+  const bool fell_behind = std::exchange(m_throttle_fell_behind, false);
+
+  float factor = m_adaptive_oc_factor;
+  if (fell_behind || idle_ratio > ADAPTIVE_OC_IDLE_HIGH)
+    factor -= ADAPTIVE_OC_STEP;
+  else if (idle_ratio < ADAPTIVE_OC_IDLE_LOW)
+    factor += ADAPTIVE_OC_STEP;
+  factor = std::clamp(factor, m_config_adaptive_oc_min, m_config_adaptive_oc_max);
+
+  if (factor == m_adaptive_oc_factor)
+    return;
+
+  DEBUG_LOG_FMT(POWERPC, "Adaptive overclock: {:.0f}% idle, changing CPU clock to {:.0f}%",
+                idle_ratio * 100, factor * 100);
+  m_adaptive_oc_factor = factor;
+  m_config_oc_factor = factor;
+  m_config_oc_inv_factor = 1.0f / factor;
+}
 
+void CoreTimingManager::Throttle(const s64 target_cycle)
+{
   // Prevent any throttling code if the amount of time passed is < ~0.122ms
-  if (cycles < m_throttle_min_clock_per_sleep)
+  if (target_cycle - m_throttle_last_cycle < m_throttle_min_clock_per_sleep)
     return;
 
+  ThrottleUntil(target_cycle);
+}
+
+void CoreTimingManager::ThrottleForInput()
+{
+  const s64 target_cycle = GetTicks();
+  if (m_config_late_input_latching && target_cycle > m_throttle_last_cycle)
+    ThrottleUntil(target_cycle);
+}
+
+void CoreTimingManager::ThrottleUntil(const s64 target_cycle)
+{
+  // Based on number of cycles and emulation speed, increase the target deadline
+  const s64 cycles = target_cycle - m_throttle_last_cycle;
+
   m_throttle_last_cycle = target_cycle;
 
   const double speed = Core::GetIsThrottlerTempDisabled() ? 0.0 : m_emulation_speed;
@@ -399,6 +548,8 @@ void CoreTimingManager::Throttle(const s64 target_cycle)
     DEBUG_LOG_FMT(COMMON, "System can not to keep up with timings! [relaxing timings by {} us]",
                   DT_us(min_deadline - m_throttle_deadline).count());
     m_throttle_deadline = min_deadline;
+    // Without a speed limit, the deadline never moves ahead, which isn't the host's fault.
+    m_throttle_fell_behind = 0.0 < speed;
   }
 
   const TimePoint vi_deadline = time - std::min(m_max_fallback, m_max_variance) / 2;
@@ -148,6 +148,12 @@ public:
   // in order to allow custom throttling implementations to be tested.
   void Throttle(const s64 target_cycle);
 
+  // Called right before host input is sampled for the emulated console. If late input latching
+  // is enabled, this waits until the host time catches up with the current emulated time, even
+  // if it's ahead by less than the usual throttling granularity, so that the input is sampled as
+  // late as possible.
+  void ThrottleForInput();
+
   TimePoint GetCPUTimePoint(s64 cyclesLate) const;  // Used by Dolphin Analytics
   bool GetVISkip() const;                           // Used By VideoInterface
 
@@ -163,7 +169,7 @@ private:
   std::unordered_map<std::string, EventType> m_event_types;
 
   // STATE_TO_SAVE
-  // The queue is a min-heap using std::make_heap/push_heap/pop_heap.
+  // The queue is a 4-ary min-heap, see PushEvent/PopEvent in CoreTiming.cpp.
   // We don't use std::priority_queue because we need to be able to serialize, unserialize and
   // erase arbitrary events (RemoveEvent()) regardless of the queue order. These aren't accomodated
   // by the standard adaptor class.
@@ -187,18 +193,33 @@ private:
   float m_config_oc_factor = 0.0f;
   float m_config_oc_inv_factor = 0.0f;
   bool m_config_sync_on_skip_idle = false;
+  bool m_config_late_input_latching = false;
+  bool m_config_sampling_profiler = false;
+  bool m_config_adaptive_oc = false;
+  float m_config_adaptive_oc_min = 1.0f;
+  float m_config_adaptive_oc_max = 1.0f;
+
+  // Not saved in save states, as it depends on host timing anyway.
+  float m_adaptive_oc_factor = 1.0f;
+  s64 m_adaptive_oc_window_start = 0;
+  s64 m_adaptive_oc_window_idled_cycles = 0;
 
   s64 m_throttle_last_cycle = 0;
   TimePoint m_throttle_deadline = Clock::now();
   s64 m_throttle_clock_per_sec = 0;
   s64 m_throttle_min_clock_per_sleep = 0;
   bool m_throttle_disable_vi_int = false;
+  // Set when the host couldn't keep up with the throttling deadline.
+  bool m_throttle_fell_behind = false;
 
   DT m_max_fallback = {};
   DT m_max_variance = {};
   double m_emulation_speed = 1.0;
 
   void ResetThrottle(s64 cycle);
+  void ThrottleUntil(const s64 target_cycle);
+
+  void UpdateAdaptiveOverclock();
 
   int DowncountToCycles(int downcount) const;
   int CyclesToDowncount(int cycles) const;
@@ -8,6 +8,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
+#include "Common/Swap.h"
 
 namespace DSP
 {
@@ -160,6 +161,121 @@ u16 Accelerator::Read(const s16* coefs)
   return val;
 }
 
+void Accelerator::ReadSamples(const s16* coefs, s16* samples, u32 count)
+{
+  u32 i = 0;
+  while (i < count)
+  {
+    u32 n = 0;
+    if (!m_reads_stopped)
+    {
+      const u32 address = m_current_address;
+      switch (m_sample_format)
+      {
+      case 0x00:  // ADPCM audio
+      {
+        // Stay within the current frame, and stop before the end address so that the special
+        // cases and the loop check in Read() are never needed.
+        if (address + 2 < m_end_address)
+          n = std::min({count - i, 15 - (address & 15), m_end_address - 2 - address});
+        if (n == 0)
+          break;
+
+        const s32 scale = 1 << (m_pred_scale & 0xF);
+        const u32 coef_idx = (m_pred_scale >> 4) & 0x7;
+        const s32 coef1 = coefs[coef_idx * 2 + 0];
+        const s32 coef2 = coefs[coef_idx * 2 + 1];
+
+        const u32 first_byte = address >> 1;
+        const u32 byte_count = ((address + n - 1) >> 1) - first_byte + 1;
+        const u8* data = GetMemoryRange(first_byte, byte_count);
+
+        s32 yn1 = m_yn1;
+        s32 yn2 = m_yn2;
+        for (u32 j = 0; j < n; ++j)
+        {
+          const u32 nibble_address = address + j;
+          const u8 byte = data ? data[(nibble_address >> 1) - first_byte] :
+                                 ReadMemory(nibble_address >> 1);
+          s32 temp = (nibble_address & 1) ? (byte & 0xF) : (byte >> 4);
+          if (temp >= 8)
+            temp -= 16;
+
+          const s32 val32 = (scale * temp) + ((0x400 + coef1 * yn1 + coef2 * yn2) >> 11);
+          const s16 val = static_cast<s16>(std::clamp<s32>(val32, -0x7FFF, 0x7FFF));
+          samples[i + j] = val;
+          yn2 = yn1;
+          yn1 = val;
+        }
+        m_yn1 = static_cast<s16>(yn1);
+        m_yn2 = static_cast<s16>(yn2);
+        break;
+      }
+      case 0x0A:  // 16-bit PCM audio
+      {
+        if (address < m_end_address)
+          n = std::min(count - i, m_end_address - address);
+        if (n == 0)
+          break;
+
+        if (const u8* data = GetMemoryRange(address * 2, n * 2))
+        {
+          for (u32 j = 0; j < n; ++j)
+            samples[i + j] = static_cast<s16>(Common::swap16(data + j * 2));
+        }
+        else
+        {
+          for (u32 j = 0; j < n; ++j)
+          {
+            const u32 sample_address = (address + j) * 2;
+            samples[i + j] = static_cast<s16>((ReadMemory(sample_address) << 8) |
+                                              ReadMemory(sample_address + 1));
+          }
+        }
+        break;
+      }
+      case 0x19:  // 8-bit PCM audio
+      {
+        if (address < m_end_address)
+          n = std::min(count - i, m_end_address - address);
+        if (n == 0)
+          break;
+
+        if (const u8* data = GetMemoryRange(address, n))
+        {
+          for (u32 j = 0; j < n; ++j)
+            samples[i + j] = static_cast<s16>(data[j] << 8);
+        }
+        else
+        {
+          for (u32 j = 0; j < n; ++j)
+            samples[i + j] = static_cast<s16>(ReadMemory(address + j) << 8);
+        }
+        break;
+      }
+      default:
+        break;
+      }
+    }
+
+    if (n == 0)
+    {
+      // Near the end address, at frame headers, and for anything unusual, use the exact
+      // sample-by-sample path.
+      samples[i++] = static_cast<s16>(Read(coefs));
+      continue;
+    }
+
+    if (m_sample_format != 0x00)
+    {
+      m_yn2 = n >= 2 ? samples[i + n - 2] : m_yn1;
+      m_yn1 = samples[i + n - 1];
+    }
+    SetCurrentAddress(m_current_address + n);
+    i += n;
+  }
+}
+
 void Accelerator::DoState(PointerWrap& p)
 {
   p.Do(m_start_address);
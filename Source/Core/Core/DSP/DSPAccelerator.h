@@ -15,6 +15,9 @@ public:
   virtual ~Accelerator() = default;
 
   u16 Read(const s16* coefs);
+  // Same as calling Read() <count> times, but decodes runs of samples that cannot hit the end
+  // address or an ADPCM frame header in bulk.
+  void ReadSamples(const s16* coefs, s16* samples, u32 count);
   // Zelda ucode reads ARAM through 0xffd3.
   u16 ReadD3();
   void WriteD3(u16 value);
@@ -39,6 +42,9 @@ public:
 protected:
   virtual void OnEndException() = 0;
   virtual u8 ReadMemory(u32 address) = 0;
+  // Implementations may return a pointer to <size> bytes that ReadMemory would read starting at
+  // <address>, so that bulk reads can skip the per-byte virtual calls.
+  virtual const u8* GetMemoryRange(u32 address, u32 size) { return nullptr; }
   virtual void WriteMemory(u32 address, u8 value) = 0;
 
   // DSP accelerator registers.
@@ -169,5 +169,56 @@ void Analyzer::FindIdleSkips(const SDSP& dsp, u16 start_addr, u16 end_addr)
       }
     }
   }
+
+  // Besides the known signatures, look for any loop that only polls the status bit of a mailbox
+  // and jumps back to itself, which can't finish before the CPU side touches the mailbox.
+  for (u16 addr = start_addr; addr < end_addr; addr++)
+  {
+    if (IsStartOfInstruction(addr) && IsMailboxPollLoop(dsp, addr))
+    {
+      INFO_LOG_FMT(DSPLLE, "Idle skip location found at {:02x} (mailbox poll loop)", addr);
+      m_code_flags[addr] |= CODE_IDLE_SKIP;
+    }
+  }
+}
+
+bool Analyzer::IsMailboxPollLoop(const SDSP& dsp, u16 loop_start) const
+{
+  // LRS $acD.m, @DMBH/@CMBH or LR $acD.m, @DMBH/@CMBH
+  u16 addr = loop_start;
+  u16 inst = dsp.ReadIMEM(addr);
+  u16 reg;
+  u16 mailbox;
+  if ((inst & 0xfe00) == 0x2600)
+  {
+    reg = (inst >> 8) & 1;
+    mailbox = 0xff00 | (inst & 0xff);
+    addr += 1;
+  }
+  else if ((inst & 0xfffe) == 0x00de)
+  {
+    reg = inst & 1;
+    mailbox = dsp.ReadIMEM(static_cast<u16>(addr + 1));
+    addr += 2;
+  }
+  else
+  {
+    return false;
+  }
+  if (mailbox != (0xff00 | DSP_DMBH) && mailbox != (0xff00 | DSP_CMBH))
+    return false;
+
+  // ANDF/ANDCF $acD.m, #0x8000
+  inst = dsp.ReadIMEM(addr);
+  if ((inst & 0xfeff) != 0x02a0 && (inst & 0xfeff) != 0x02c0)
+    return false;
+  if (((inst >> 8) & 1) != reg || dsp.ReadIMEM(static_cast<u16>(addr + 1)) != 0x8000)
+    return false;
+
+  // JLNZ/JLZ back to the load
+  inst = dsp.ReadIMEM(static_cast<u16>(addr + 2));
+  if (inst != 0x029c && inst != 0x029d)
+    return false;
+  return dsp.ReadIMEM(static_cast<u16>(addr + 3)) == loop_start;
 }
 }  // namespace DSP
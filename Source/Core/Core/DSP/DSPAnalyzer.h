@@ -110,6 +110,10 @@ private:
   // Finds locations within the range [start_addr, end_addr) that may contain idle skips.
   void FindIdleSkips(const SDSP& dsp, u16 start_addr, u16 end_addr);
 
+  // Whether the code at the given address is a loop that does nothing but wait for the status bit
+  // of a mailbox to change.
+  [[nodiscard]] bool IsMailboxPollLoop(const SDSP& dsp, u16 loop_start) const;
+
   // Retrieves the flags set during analysis for code in memory.
   [[nodiscard]] u8 GetCodeFlags(u16 address) const { return m_code_flags[address]; }
 
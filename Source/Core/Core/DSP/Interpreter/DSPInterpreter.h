@@ -40,6 +40,9 @@ public:
 
   void ApplyWriteBackLog();
 
+  // See: DspIntBranch.cpp
+  void HandleLoop();
+
   // All the opcode functions.
   void abs(UDSPInstruction opc);
   void add(UDSPInstruction opc);
@@ -194,9 +197,6 @@ private:
 
   bool CheckCondition(u8 condition) const;
 
-  // See: DspIntBranch.cpp
-  void HandleLoop();
-
   u16 IncrementAddressRegister(u16 reg) const;
   u16 DecrementAddressRegister(u16 reg) const;
 
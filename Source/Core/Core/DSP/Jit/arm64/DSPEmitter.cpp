@@ -0,0 +1,269 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/DSP/Jit/arm64/DSPEmitter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+
+#include "Common/Arm64Emitter.h"
+#include "Common/Assert.h"
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+#include "Common/MemoryUtil.h"
+
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPHost.h"
+#include "Core/DSP/DSPTables.h"
+#include "Core/DSP/Interpreter/DSPIntTables.h"
+#include "Core/DSP/Interpreter/DSPInterpreter.h"
+
+using namespace Arm64Gen;
+
+namespace DSP::JIT::arm64
+{
+constexpr size_t COMPILED_CODE_SIZE = 2097152;
+constexpr size_t MAX_BLOCK_SIZE = 250;
+constexpr u32 DSP_IDLE_SKIP_CYCLES = 0x1000;
+
+// Holds the address of the SDSP state for the whole block.
+constexpr ARM64Reg STATE_REG = ARM64Reg::X19;
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+constexpr s32 PC_OFFSET = static_cast<s32>(offsetof(SDSP, pc));
+constexpr s32 EXCEPTIONS_OFFSET = static_cast<s32>(offsetof(SDSP, exceptions));
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+DSPEmitter::DSPEmitter(DSPCore& dsp)
+    : m_blocks(MAX_BLOCKS), m_block_size(MAX_BLOCKS), m_dsp_core{dsp}
+{
+  AllocCodeSpace(COMPILED_CODE_SIZE);
+}
+
+DSPEmitter::~DSPEmitter()
+{
+  FreeCodeSpace();
+}
+
+u16 DSPEmitter::RunCycles(u16 cycles)
+{
+  auto& state = m_dsp_core.DSPState();
+
+  if (state.external_interrupt_waiting.exchange(false, std::memory_order_acquire))
+  {
+    m_dsp_core.CheckExternalInterrupt();
+    m_dsp_core.CheckExceptions();
+  }
+
+  m_cycles_left = cycles;
+  while (m_cycles_left > 0)
+  {
+    if (Host::OnThread() && state.external_interrupt_waiting.load(std::memory_order_relaxed))
+      break;
+
+    if ((state.control_reg & CR_HALT) != 0)
+      break;
+
+    const u16 pc = state.pc;
+    if (!m_blocks[pc])
+      Compile(pc);
+
+    const u32 executed = m_blocks[pc]();
+    m_cycles_left = executed >= m_cycles_left ? 0 : static_cast<u16>(m_cycles_left - executed);
+  }
+
+  if (state.reset_dspjit_codespace)
+    ClearIRAMandDSPJITCodespaceReset();
+
+  return m_cycles_left;
+}
+
+void DSPEmitter::DoState(PointerWrap& p)
+{
+  p.Do(m_cycles_left);
+}
+
+void DSPEmitter::ClearIRAM()
+{
+  // The blocks themselves stay in the code space until the next RunCycles returns, as this can
+  // be called by an instruction in the middle of a block.
+  ClearBlocks(DSP_IRAM_SIZE);
+  m_dsp_core.DSPState().reset_dspjit_codespace = true;
+}
+
+void DSPEmitter::ClearIRAMandDSPJITCodespaceReset()
+{
+  const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
+
+  ClearCodeSpace();
+  ClearBlocks(MAX_BLOCKS);
+  m_dsp_core.DSPState().reset_dspjit_codespace = false;
+}
+
+void DSPEmitter::ClearBlocks(size_t count)
+{
+  std::fill_n(m_blocks.begin(), count, nullptr);
+  std::fill_n(m_block_size.begin(), count, 0);
+}
+
+static void CheckExceptionsThunk(DSPCore& dsp)
+{
+  dsp.CheckExceptions();
+}
+
+static void FallbackThunk(Interpreter::Interpreter& interpreter, UDSPInstruction inst)
+{
+  (interpreter.*Interpreter::GetOp(inst))(inst);
+}
+
+static void FallbackExtThunk(Interpreter::Interpreter& interpreter, UDSPInstruction inst)
+{
+  (interpreter.*Interpreter::GetExtOp(inst))(inst);
+}
+
+static void ApplyWriteBackLogThunk(Interpreter::Interpreter& interpreter)
+{
+  interpreter.ApplyWriteBackLog();
+}
+
+// Returns non-zero if the loop hardware was active, in which case the block has to be left since
+// the PC may have been changed. This returns a u32 rather than a bool so that all of W0 is defined.
+static u32 HandleLoopThunk(Interpreter::Interpreter& interpreter, const SDSP& state)
+{
+  if (state.r.st[2] == 0 || state.r.st[3] == 0)
+    return 0;
+
+  interpreter.HandleLoop();
+  return 1;
+}
+
+u32 DSPEmitter::GetExitCycles(u16 start_addr, u32 block_size) const
+{
+  if (!Host::OnThread() && m_dsp_core.DSPState().GetAnalyzer().IsIdleSkip(start_addr))
+    return DSP_IDLE_SKIP_CYCLES;
+
+  return block_size;
+}
+
+void DSPEmitter::WriteBlockExit(u32 cycles)
+{
+  MOVI2R(ARM64Reg::W0, cycles);
+  m_block_exits.push_back(B());
+}
+
+// Must go out of block if exception is detected
+void DSPEmitter::CheckExceptions(u32 retval)
+{
+  LDRB(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, EXCEPTIONS_OFFSET);
+  const FixupBranch skip_check = CBZ(ARM64Reg::W0);
+
+  MOVI2R(ARM64Reg::W0, m_compile_pc);
+  STRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, PC_OFFSET);
+  ABI_CallFunction(&CheckExceptionsThunk, &m_dsp_core);
+  WriteBlockExit(retval);
+
+  SetJumpTarget(skip_check);
+}
+
+void DSPEmitter::EmitInstruction(UDSPInstruction inst)
+{
+  const DSPOPCTemplate* const op_template = GetOpTemplate(inst);
+  Interpreter::Interpreter* const interpreter = &m_dsp_core.GetInterpreter();
+
+  ASSERT_MSG(DSPLLE, Interpreter::GetOp(inst) != nullptr, "No function for {:04x}", inst);
+
+  // Keep the PC exactly as the interpreter would have it after fetching the instruction, so that
+  // immediates, branches and the loop hardware all behave the same.
+  MOVI2R(ARM64Reg::W0, static_cast<u16>(m_compile_pc + 1));
+  STRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, PC_OFFSET);
+
+  if (op_template->extended)
+    ABI_CallFunction(&FallbackExtThunk, interpreter, inst);
+
+  ABI_CallFunction(&FallbackThunk, interpreter, inst);
+
+  if (op_template->extended)
+    ABI_CallFunction(&ApplyWriteBackLogThunk, interpreter);
+}
+
+void DSPEmitter::Compile(u16 start_addr)
+{
+  const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
+
+  if (IsAlmostFull())
+    ClearIRAMandDSPJITCodespaceReset();
+
+  m_block_exits.clear();
+
+  const u8* entry_point = AlignCode16();
+
+  STP(IndexType::Pre, ARM64Reg::X29, ARM64Reg::X30, ARM64Reg::SP, -32);
+  STR(IndexType::Unsigned, STATE_REG, ARM64Reg::SP, 16);
+  MOVP2R(STATE_REG, &m_dsp_core.DSPState());
+
+  m_compile_pc = start_addr;
+  u32 block_size = 0;
+
+  auto& analyzer = m_dsp_core.DSPState().GetAnalyzer();
+  while (m_compile_pc < start_addr + MAX_BLOCK_SIZE)
+  {
+    if (analyzer.IsCheckExceptions(m_compile_pc))
+      CheckExceptions(block_size);
+
+    const UDSPInstruction inst = m_dsp_core.DSPState().ReadIMEM(m_compile_pc);
+    const DSPOPCTemplate* opcode = GetOpTemplate(inst);
+
+    EmitInstruction(inst);
+
+    block_size++;
+    m_compile_pc += opcode->size;
+
+    // Handle loop condition, only if current instruction was flagged as a loop destination
+    // by the analyzer.
+    if (analyzer.IsLoopEnd(static_cast<u16>(m_compile_pc - 1u)))
+    {
+      ABI_CallFunction(&HandleLoopThunk, &m_dsp_core.GetInterpreter(), &m_dsp_core.DSPState());
+      const FixupBranch loop_inactive = CBZ(ARM64Reg::W0);
+      WriteBlockExit(GetExitCycles(start_addr, block_size));
+      SetJumpTarget(loop_inactive);
+    }
+
+    if (opcode->branch)
+    {
+      if (opcode->uncond_branch)
+        break;
+
+      // Look at the PC to see if we actually branched.
+      LDRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, PC_OFFSET);
+      CMPI2R(ARM64Reg::W0, m_compile_pc, ARM64Reg::W1);
+      const FixupBranch no_branch = B(CCFlags::CC_EQ);
+      WriteBlockExit(GetExitCycles(start_addr, block_size));
+      SetJumpTarget(no_branch);
+    }
+
+    // End the block if we're before an idle skip address
+    if (analyzer.IsIdleSkip(m_compile_pc))
+      break;
+  }
+
+  MOVI2R(ARM64Reg::W0, GetExitCycles(start_addr, block_size));
+  for (const FixupBranch& exit : m_block_exits)
+    SetJumpTarget(exit);
+
+  LDR(IndexType::Unsigned, STATE_REG, ARM64Reg::SP, 16);
+  LDP(IndexType::Post, ARM64Reg::X29, ARM64Reg::X30, ARM64Reg::SP, 32);
+  RET();
+
+  FlushIcache();
+
+  m_blocks[start_addr] = reinterpret_cast<DSPCompiledCode>(entry_point);
+  m_block_size[start_addr] = static_cast<u16>(block_size);
+}
+}  // namespace DSP::JIT::arm64
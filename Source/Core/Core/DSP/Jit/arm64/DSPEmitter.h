@@ -0,0 +1,64 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Common/Arm64Emitter.h"
+#include "Common/CommonTypes.h"
+
+#include "Core/DSP/DSPCommon.h"
+#include "Core/DSP/Jit/DSPEmitterBase.h"
+
+class PointerWrap;
+
+namespace DSP::JIT::arm64
+{
+// A block-compiling DSP LLE recompiler for AArch64.
+//
+// Unlike the x64 recompiler, this one does not have a register cache and does not emit native
+// code for individual opcodes yet. Every instruction is a direct call into the interpreter's
+// opcode handler, which removes the per-instruction fetch, decode and dispatch overhead of the
+// interpreter while keeping its exact semantics. Loop, branch, exception and idle skip handling
+// follow the x64 recompiler so both JITs have identical timing.
+class DSPEmitter final : public JIT::DSPEmitter, public Arm64Gen::ARM64CodeBlock
+{
+public:
+  explicit DSPEmitter(DSPCore& dsp);
+  ~DSPEmitter() override;
+
+  u16 RunCycles(u16 cycles) override;
+  void DoState(PointerWrap& p) override;
+  void ClearIRAM() override;
+
+private:
+  // Returns the number of cycles that were executed by the block.
+  using DSPCompiledCode = u32 (*)();
+
+  void ClearIRAMandDSPJITCodespaceReset();
+  void ClearBlocks(size_t count);
+
+  void Compile(u16 start_addr);
+  void EmitInstruction(UDSPInstruction inst);
+  void CheckExceptions(u32 retval);
+  void WriteBlockExit(u32 cycles);
+
+  u32 GetExitCycles(u16 start_addr, u32 block_size) const;
+
+  static constexpr size_t MAX_BLOCKS = 0x10000;
+
+  u16 m_compile_pc = 0;
+
+  std::vector<DSPCompiledCode> m_blocks;
+  std::vector<u16> m_block_size;
+
+  // Branches to the epilogue of the block that is being compiled.
+  std::vector<Arm64Gen::FixupBranch> m_block_exits;
+
+  u16 m_cycles_left = 0;
+
+  DSPCore& m_dsp_core;
+};
+}  // namespace DSP::JIT::arm64
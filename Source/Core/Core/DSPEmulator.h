@@ -31,6 +31,8 @@ public:
   virtual u16 DSP_ReadControlRegister() = 0;
   virtual u16 DSP_WriteControlRegister(u16 value) = 0;
   virtual void DSP_Update(int cycles) = 0;
+  // Waits until all cycles passed to DSP_Update have been run, for emulators running on a thread.
+  virtual void DSP_Sync() {}
   virtual void DSP_StopSoundStream() = 0;
   virtual u32 DSP_UpdateRate() = 0;
 
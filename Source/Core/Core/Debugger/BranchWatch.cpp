@@ -18,8 +18,53 @@
 
 namespace Core
 {
+void BranchWatch::SubmitRecords()
+{
+  if (!m_merge_thread_started)
+  {
+    m_merge_thread.Reset("Branch Watch Merge",
+                         [this](RecordBuffers records) { MergeRecords(records); });
+    m_merge_thread_started = true;
+  }
+
+  m_merge_thread.Push(std::move(m_records));
+  for (std::vector<BranchWatchRecord>& records : m_records)
+  {
+    records.clear();
+    records.reserve(RECORD_BUFFER_SIZE);
+  }
+}
+
+void BranchWatch::FlushRecords()
+{
+  m_merge_thread.WaitForCompletion();
+  MergeRecords(m_records);
+  for (std::vector<BranchWatchRecord>& records : m_records)
+    records.clear();
+}
+
+void BranchWatch::MergeRecords(const RecordBuffers& records)
+{
+  const auto routine = [](Collection& collection, const std::vector<BranchWatchRecord>& buffer) {
+    for (const BranchWatchRecord& record : buffer)
+    {
+      collection[{Common::BitCast<FakeBranchWatchCollectionKey>(record.fake_key),
+                  record.original_inst}]
+          .total_hits += record.hits;
+    }
+  };
+  routine(m_collection_vt, records[RecordBuffer::VirtualTrue]);
+  routine(m_collection_vf, records[RecordBuffer::VirtualFalse]);
+  routine(m_collection_pt, records[RecordBuffer::PhysicalTrue]);
+  routine(m_collection_pf, records[RecordBuffer::PhysicalFalse]);
+}
+
 void BranchWatch::Clear(const CPUThreadGuard&)
 {
+  m_merge_thread.WaitForCompletion();
+  for (std::vector<BranchWatchRecord>& records : m_records)
+    records.clear();
+
   m_selection.clear();
   m_collection_vt.clear();
   m_collection_vf.clear();
@@ -59,8 +104,10 @@ union USnapshotMetadata
   }
 };
 
-void BranchWatch::Save(const CPUThreadGuard& guard, std::FILE* file) const
+void BranchWatch::Save(const CPUThreadGuard& guard, std::FILE* file)
 {
+  FlushRecords();
+
   if (!CanSave())
   {
     ASSERT_MSG(CORE, false, "BranchWatch can not be saved.");
@@ -131,6 +178,8 @@ void BranchWatch::Load(const CPUThreadGuard& guard, std::FILE* file)
 
 void BranchWatch::IsolateHasExecuted(const CPUThreadGuard&)
 {
+  FlushRecords();
+
   switch (m_recording_phase)
   {
   case Phase::Blacklist:
@@ -169,6 +218,8 @@ void BranchWatch::IsolateHasExecuted(const CPUThreadGuard&)
 
 void BranchWatch::IsolateNotExecuted(const CPUThreadGuard&)
 {
+  FlushRecords();
+
   switch (m_recording_phase)
   {
   case Phase::Blacklist:
@@ -198,6 +249,8 @@ void BranchWatch::IsolateNotExecuted(const CPUThreadGuard&)
 
 void BranchWatch::IsolateWasOverwritten(const CPUThreadGuard& guard)
 {
+  FlushRecords();
+
   if (Core::GetState(guard.GetSystem()) == Core::State::Uninitialized)
   {
     ASSERT_MSG(CORE, false, "Core is uninitialized.");
@@ -246,6 +299,8 @@ void BranchWatch::IsolateWasOverwritten(const CPUThreadGuard& guard)
 
 void BranchWatch::IsolateNotOverwritten(const CPUThreadGuard& guard)
 {
+  FlushRecords();
+
   if (Core::GetState(guard.GetSystem()) == Core::State::Uninitialized)
   {
     ASSERT_MSG(CORE, false, "Core is uninitialized.");
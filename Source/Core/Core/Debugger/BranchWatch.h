@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdio>
 #include <functional>
@@ -12,6 +13,7 @@
 #include "Common/BitUtils.h"
 #include "Common/CommonTypes.h"
 #include "Common/EnumUtils.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/PowerPC/Gekko.h"
 
 namespace Core
@@ -38,6 +40,14 @@ struct BranchWatchCollectionValue
   std::size_t total_hits = 0;
   std::size_t hits_snapshot = 0;
 };
+// A hit as recorded by the CPU thread, before it has been merged into a collection.
+struct BranchWatchRecord
+{
+  u64 fake_key;
+  u32 original_inst;
+  u32 hits;
+};
+static_assert(sizeof(BranchWatchRecord) == 16);
 }  // namespace Core
 
 template <>
@@ -123,7 +133,7 @@ public:
   void Pause() { SetRecordingActive(false); }
   void Clear(const CPUThreadGuard& guard);
 
-  void Save(const CPUThreadGuard& guard, std::FILE* file) const;
+  void Save(const CPUThreadGuard& guard, std::FILE* file);
   void Load(const CPUThreadGuard& guard, std::FILE* file);
 
   void IsolateHasExecuted(const CPUThreadGuard& guard);
@@ -155,38 +165,32 @@ public:
   // but also increment the total_hits by N (see dcbx JIT code).
   static void HitVirtualTrue_fk(BranchWatch* branch_watch, u64 fake_key, u32 inst)
   {
-    branch_watch->m_collection_vt[{Common::BitCast<FakeBranchWatchCollectionKey>(fake_key), inst}]
-        .total_hits += 1;
+    branch_watch->Record(RecordBuffer::VirtualTrue, fake_key, inst, 1);
   }
 
   static void HitPhysicalTrue_fk(BranchWatch* branch_watch, u64 fake_key, u32 inst)
   {
-    branch_watch->m_collection_pt[{Common::BitCast<FakeBranchWatchCollectionKey>(fake_key), inst}]
-        .total_hits += 1;
+    branch_watch->Record(RecordBuffer::PhysicalTrue, fake_key, inst, 1);
   }
 
   static void HitVirtualFalse_fk(BranchWatch* branch_watch, u64 fake_key, u32 inst)
   {
-    branch_watch->m_collection_vf[{Common::BitCast<FakeBranchWatchCollectionKey>(fake_key), inst}]
-        .total_hits += 1;
+    branch_watch->Record(RecordBuffer::VirtualFalse, fake_key, inst, 1);
   }
 
   static void HitPhysicalFalse_fk(BranchWatch* branch_watch, u64 fake_key, u32 inst)
   {
-    branch_watch->m_collection_pf[{Common::BitCast<FakeBranchWatchCollectionKey>(fake_key), inst}]
-        .total_hits += 1;
+    branch_watch->Record(RecordBuffer::PhysicalFalse, fake_key, inst, 1);
   }
 
   static void HitVirtualTrue_fk_n(BranchWatch* branch_watch, u64 fake_key, u32 inst, u32 n)
   {
-    branch_watch->m_collection_vt[{Common::BitCast<FakeBranchWatchCollectionKey>(fake_key), inst}]
-        .total_hits += n;
+    branch_watch->Record(RecordBuffer::VirtualTrue, fake_key, inst, n);
   }
 
   static void HitPhysicalTrue_fk_n(BranchWatch* branch_watch, u64 fake_key, u32 inst, u32 n)
   {
-    branch_watch->m_collection_pt[{Common::BitCast<FakeBranchWatchCollectionKey>(fake_key), inst}]
-        .total_hits += n;
+    branch_watch->Record(RecordBuffer::PhysicalTrue, fake_key, inst, n);
   }
 
   // HitVirtualFalse_fk_n and HitPhysicalFalse_fk_n are never used, so they are omitted here.
@@ -241,6 +245,33 @@ public:
   }
 
 private:
+  // Hits are appended to these buffers rather than looked up in the collections right away, which
+  // would cost a hash table lookup for every branch. Full buffers are merged on a worker thread.
+  static constexpr std::size_t RECORD_BUFFER_SIZE = 4096;
+
+  enum RecordBuffer : std::size_t
+  {
+    VirtualTrue,
+    VirtualFalse,
+    PhysicalTrue,
+    PhysicalFalse,
+    Count,
+  };
+  using RecordBuffers = std::array<std::vector<BranchWatchRecord>, RecordBuffer::Count>;
+
+  void Record(RecordBuffer buffer, u64 fake_key, u32 inst, u32 n)
+  {
+    std::vector<BranchWatchRecord>& records = m_records[buffer];
+    records.push_back({fake_key, inst, n});
+    if (records.size() >= RECORD_BUFFER_SIZE)
+      SubmitRecords();
+  }
+
+  void SubmitRecords();
+  // Must only be called while the CPU thread is paused
+  void FlushRecords();
+  void MergeRecords(const RecordBuffers& records);
+
   Collection& GetCollectionV(bool condition)
   {
     if (condition)
@@ -270,6 +301,11 @@ private:
   Collection m_collection_pt;  // physical address space | true path
   Collection m_collection_pf;  // physical address space | false path
   Selection m_selection;
+
+  RecordBuffers m_records;
+  // Declared last so that it is shut down before anything it merges into is destroyed
+  Common::WorkQueueThread<RecordBuffers> m_merge_thread;
+  bool m_merge_thread_started = false;
 };
 
 #if _M_X86_64
@@ -0,0 +1,107 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/Debugger/CodeCoverage.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/SymbolDB.h"
+#include "Core/PowerPC/PPCSymbolDB.h"
+
+namespace Core
+{
+void CodeCoverage::Record(u32 address, u32 num_instructions)
+{
+  Page* page = nullptr;
+  u32 page_index = 0;
+  for (u32 i = 0; i < num_instructions; ++i, address += 4)
+  {
+    const u32 index = address >> PAGE_SHIFT;
+    if (!page || index != page_index)
+    {
+      page = &m_pages[index];
+      page_index = index;
+    }
+    page->set((address >> 2) % INSTRUCTIONS_PER_PAGE);
+  }
+}
+
+void CodeCoverage::Clear(const CPUThreadGuard& guard)
+{
+  m_pages.clear();
+}
+
+bool CodeCoverage::IsCovered(const CPUThreadGuard& guard, u32 address) const
+{
+  const auto it = m_pages.find(address >> PAGE_SHIFT);
+  return it != m_pages.end() && it->second.test((address >> 2) % INSTRUCTIONS_PER_PAGE);
+}
+
+u64 CodeCoverage::GetCoveredInstructionCount(const CPUThreadGuard& guard) const
+{
+  u64 count = 0;
+  for (const auto& [index, page] : m_pages)
+    count += page.count();
+  return count;
+}
+
+void CodeCoverage::Write(const CPUThreadGuard& guard, PPCSymbolDB& ppc_symbol_db,
+                         std::FILE* file) const
+{
+  std::fputs("ppcAddress\tsize\texecuted\tinstructions\tpercent\tsymbol\n", file);
+  for (const auto& [address, symbol] : ppc_symbol_db.Symbols())
+  {
+    if (symbol.type != Common::Symbol::Type::Function)
+      continue;
+
+    const u32 instructions = symbol.size / 4;
+    u32 executed = 0;
+    for (u32 i = 0; i < instructions; ++i)
+      executed += IsCovered(guard, address + i * 4);
+
+    const double percent = instructions == 0 ? double{} : 100.0 * executed / instructions;
+    fmt::println(file, "{:08x}\t{}\t{}\t{}\t{:.2f}\t\"{}\"", address, symbol.size, executed,
+                 instructions, percent, symbol.name);
+  }
+
+  std::vector<u32> page_indices;
+  page_indices.reserve(m_pages.size());
+  for (const auto& [index, page] : m_pages)
+    page_indices.push_back(index);
+  std::sort(page_indices.begin(), page_indices.end());
+
+  // Merge the executed instructions outside of known functions into ranges.
+  std::fputs("\nppcAddress\tsize\n", file);
+  u32 range_start = 0;
+  u32 range_end = 0;
+  const auto flush_range = [&] {
+    if (range_start != range_end)
+      fmt::println(file, "{:08x}\t{}", range_start, range_end - range_start);
+    range_start = range_end = 0;
+  };
+  for (const u32 index : page_indices)
+  {
+    const Page& page = m_pages.at(index);
+    for (u32 i = 0; i < INSTRUCTIONS_PER_PAGE; ++i)
+    {
+      if (!page.test(i))
+        continue;
+
+      const u32 address = (index << PAGE_SHIFT) + i * 4;
+      if (ppc_symbol_db.GetSymbolFromAddr(address))
+        continue;
+
+      if (address != range_end || range_start == range_end)
+      {
+        flush_range();
+        range_start = address;
+      }
+      range_end = address + 4;
+    }
+  }
+  flush_range();
+}
+}  // namespace Core
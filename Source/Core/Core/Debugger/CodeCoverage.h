@@ -0,0 +1,44 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <bitset>
+#include <cstdio>
+#include <unordered_map>
+
+#include "Common/CommonTypes.h"
+
+class PPCSymbolDB;
+
+namespace Core
+{
+class CPUThreadGuard;
+
+// Records which guest instructions have run at least once.
+//
+// The JIT and the cached interpreter record every block when it gets compiled, which always
+// happens right before its first execution, so collecting coverage costs nothing while the
+// compiled code runs. Executed instructions are kept as one bit per word, in 4 KiB pages that are
+// only allocated once they contain executed code.
+class CodeCoverage
+{
+public:
+  void Record(u32 address, u32 num_instructions);
+
+  void Clear(const CPUThreadGuard& guard);
+  bool IsCovered(const CPUThreadGuard& guard, u32 address) const;
+  u64 GetCoveredInstructionCount(const CPUThreadGuard& guard) const;
+
+  // Writes one tab-separated line per PPCSymbolDB function, including the ones that never ran,
+  // followed by the executed address ranges that aren't part of any known function.
+  void Write(const CPUThreadGuard& guard, PPCSymbolDB& ppc_symbol_db, std::FILE* file) const;
+
+private:
+  static constexpr u32 PAGE_SHIFT = 12;
+  static constexpr u32 INSTRUCTIONS_PER_PAGE = (1 << PAGE_SHIFT) / 4;
+  using Page = std::bitset<INSTRUCTIONS_PER_PAGE>;
+
+  std::unordered_map<u32, Page> m_pages;
+};
+}  // namespace Core
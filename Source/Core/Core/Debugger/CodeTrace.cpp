@@ -4,13 +4,19 @@
 #include "Core/Debugger/CodeTrace.h"
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <chrono>
 #include <regex>
 
 #include "Common/Event.h"
+#include "Common/GekkoDisassembler.h"
+#include "Common/IOFile.h"
 #include "Core/Core.h"
 #include "Core/Debugger/PPCDebugInterface.h"
 #include "Core/HW/CPU.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PPCTables.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 
@@ -63,6 +69,24 @@ bool CompareMemoryTargetToTracked(const std::string& instr, const u32 mem_target
   // If the base value doesn't hit, still need to check if longer values overlap.
   return *it_lower < mem_target + GetMemoryTargetSize(instr);
 }
+
+u32 GetMemoryTargetFromInstruction(UGeckoInstruction inst, const PowerPC::PowerPCState& ppc_state)
+{
+  const u32 base = inst.RA == 0 ? 0 : ppc_state.gpr[inst.RA];
+  switch (inst.OPCD)
+  {
+  case 4:   // psq_lx, psq_stx and friends
+  case 31:  // Indexed loads and stores
+    return base + ppc_state.gpr[inst.RB];
+  case 56:  // psq_l
+  case 57:  // psq_lu
+  case 60:  // psq_st
+  case 61:  // psq_stu
+    return base + inst.SIMM_12;
+  default:
+    return base + inst.SIMM_16;
+  }
+}
 }  // namespace
 
 void CodeTrace::SetRegTracked(const std::string& reg)
@@ -223,6 +247,108 @@ AutoStepResults CodeTrace::AutoStepping(const Core::CPUThreadGuard& guard, bool
   return results;
 }
 
+u32 CodeTrace::RecordTrace(const Core::CPUThreadGuard& guard, u32 steps,
+                           std::size_t trace_capacity)
+{
+  if (m_recording || trace_capacity == 0)
+    return 0;
+
+  m_recording = true;
+  m_trace.assign(trace_capacity, {});
+  m_trace_next = 0;
+  m_trace_count = 0;
+
+  auto& power_pc = guard.GetSystem().GetPowerPC();
+  auto& ppc_state = power_pc.GetPPCState();
+  power_pc.GetBreakPoints().ClearAllTemporary();
+
+  PowerPC::CoreMode old_mode = power_pc.GetMode();
+  power_pc.SetMode(PowerPC::CoreMode::Interpreter);
+
+  std::array<u32, 32> old_gprs;
+  std::array<PowerPC::PairedSingle, 32> old_fprs;
+  u32 count = 0;
+  for (; count < steps; ++count)
+  {
+    TraceRecord& record = m_trace[m_trace_next];
+    record = {};
+    record.address = ppc_state.pc;
+
+    const std::optional read_result = PowerPC::MMU::HostTryReadInstruction(guard, ppc_state.pc);
+    if (read_result)
+    {
+      const UGeckoInstruction inst{read_result->value};
+      record.instruction = inst.hex;
+
+      const GekkoOPInfo* const info = PPCTables::GetOpInfo(inst, ppc_state.pc);
+      if (info && (info->flags & FL_LOADSTORE))
+      {
+        record.is_load_store = true;
+        record.memory_target = GetMemoryTargetFromInstruction(inst, ppc_state);
+      }
+    }
+
+    std::copy(std::begin(ppc_state.gpr), std::end(ppc_state.gpr), old_gprs.begin());
+    std::copy(std::begin(ppc_state.ps), std::end(ppc_state.ps), old_fprs.begin());
+
+    power_pc.SingleStep();
+
+    for (u32 i = 0; i < 32; ++i)
+    {
+      if (ppc_state.gpr[i] != old_gprs[i])
+        record.changed_gprs |= 1u << i;
+      if (ppc_state.ps[i].PS0AsU64() != old_fprs[i].PS0AsU64() ||
+          ppc_state.ps[i].PS1AsU64() != old_fprs[i].PS1AsU64())
+      {
+        record.changed_fprs |= 1u << i;
+      }
+    }
+    if (record.changed_gprs != 0)
+      record.gpr_value = ppc_state.gpr[std::countr_zero(record.changed_gprs)];
+    if (record.changed_fprs != 0)
+      record.fpr_value = ppc_state.ps[std::countr_zero(record.changed_fprs)].PS0AsU64();
+
+    m_trace_next = (m_trace_next + 1) % trace_capacity;
+    m_trace_count = std::min(m_trace_count + 1, trace_capacity);
+  }
+
+  power_pc.SetMode(old_mode);
+  m_recording = false;
+
+  return count;
+}
+
+const TraceRecord& CodeTrace::GetTraceRecord(std::size_t index) const
+{
+  // Once the buffer has wrapped around, the oldest record is the one that gets overwritten next.
+  const std::size_t oldest = m_trace_count < m_trace.size() ? 0 : m_trace_next;
+  return m_trace[(oldest + index) % m_trace.size()];
+}
+
+TraceOutput CodeTrace::GetTraceOutput(const TraceRecord& record)
+{
+  TraceOutput output;
+  output.address = record.address;
+  output.instruction = Common::GekkoDisassembler::Disassemble(record.instruction, record.address);
+  if (record.is_load_store)
+    output.memory_target = record.memory_target;
+  return output;
+}
+
+bool CodeTrace::SaveTraceRecords(const std::string& path) const
+{
+  File::IOFile file(path, "wb");
+  if (!file)
+    return false;
+
+  // Once the buffer has wrapped around, it has to be written in two parts to keep the order.
+  if (m_trace_count < m_trace.size())
+    return file.WriteArray(m_trace.data(), m_trace_count);
+
+  return file.WriteArray(m_trace.data() + m_trace_next, m_trace.size() - m_trace_next) &&
+         file.WriteArray(m_trace.data(), m_trace_next);
+}
+
 HitType CodeTrace::TraceLogic(const TraceOutput& current_instr, bool first_hit)
 {
   // Tracks the original value that is in the targeted register or memory through loads, stores,
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <optional>
 #include <set>
 #include <string>
@@ -36,6 +37,24 @@ struct TraceOutput
   std::string instruction;
 };
 
+// A traced instruction in compact binary form. Disassembly is only done when a record is turned
+// into a TraceOutput, which keeps recording millions of instructions practical.
+struct TraceRecord
+{
+  // New ps0 of the lowest changed FPR
+  u64 fpr_value = 0;
+  u32 address = 0;
+  u32 instruction = 0;
+  // Effective address accessed by the instruction, only valid if is_load_store is set
+  u32 memory_target = 0;
+  // Bit N is set if rN or fN was changed by the instruction
+  u32 changed_gprs = 0;
+  u32 changed_fprs = 0;
+  // New value of the lowest changed GPR
+  u32 gpr_value = 0;
+  bool is_load_store = false;
+};
+
 struct AutoStepResults
 {
   std::vector<std::string> reg_tracked;
@@ -71,7 +90,20 @@ public:
   AutoStepResults AutoStepping(const Core::CPUThreadGuard& guard, bool continue_previous = false,
                                AutoStop stop_on = AutoStop::Always);
 
+  // Single steps the given number of instructions with the interpreter, keeping the last
+  // trace_capacity of them as TraceRecords. Returns the number of instructions stepped.
+  u32 RecordTrace(const Core::CPUThreadGuard& guard, u32 steps,
+                  std::size_t trace_capacity = DEFAULT_TRACE_CAPACITY);
+  std::size_t GetTraceRecordCount() const { return m_trace_count; }
+  // Index 0 is the oldest record still in the buffer.
+  const TraceRecord& GetTraceRecord(std::size_t index) const;
+  static TraceOutput GetTraceOutput(const TraceRecord& record);
+  // Writes the records as a raw array of TraceRecord, oldest first.
+  bool SaveTraceRecords(const std::string& path) const;
+
 private:
+  static constexpr std::size_t DEFAULT_TRACE_CAPACITY = 1 << 22;
+
   InstructionAttributes GetInstructionAttributes(const TraceOutput& line) const;
   TraceOutput SaveCurrentInstruction(const Core::CPUThreadGuard& guard) const;
   HitType TraceLogic(const TraceOutput& current_instr, bool first_hit = false);
@@ -79,4 +111,8 @@ private:
   bool m_recording = false;
   std::vector<std::string> m_reg_autotrack;
   std::set<u32> m_mem_autotrack;
+
+  std::vector<TraceRecord> m_trace;
+  std::size_t m_trace_next = 0;
+  std::size_t m_trace_count = 0;
 };
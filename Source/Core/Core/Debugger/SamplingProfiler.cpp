@@ -0,0 +1,60 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/Debugger/SamplingProfiler.h"
+
+#include <algorithm>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/SymbolDB.h"
+#include "Core/PowerPC/PPCSymbolDB.h"
+
+namespace Core
+{
+void SamplingProfiler::Clear(const CPUThreadGuard& guard)
+{
+  m_samples.clear();
+  m_total_samples = 0;
+}
+
+void SamplingProfiler::Write(const CPUThreadGuard& guard, PPCSymbolDB& ppc_symbol_db,
+                             std::FILE* file) const
+{
+  struct Entry
+  {
+    u32 address;
+    u64 samples;
+    const Common::Symbol* symbol;
+  };
+
+  // Samples outside of any known function are kept per address.
+  std::unordered_map<u32, Entry> entries;
+  for (const auto& [pc, samples] : m_samples)
+  {
+    const Common::Symbol* const symbol = ppc_symbol_db.GetSymbolFromAddr(pc);
+    const u32 key = symbol ? symbol->address : pc;
+    auto& entry = entries.try_emplace(key, Entry{key, 0, symbol}).first->second;
+    entry.samples += samples;
+  }
+
+  std::vector<Entry> sorted;
+  sorted.reserve(entries.size());
+  for (const auto& [key, entry] : entries)
+    sorted.push_back(entry);
+  std::sort(sorted.begin(), sorted.end(), [](const Entry& a, const Entry& b) {
+    return a.samples != b.samples ? a.samples > b.samples : a.address < b.address;
+  });
+
+  std::fputs("ppcAddress\tsamples\tpercent\tsymbol\n", file);
+  for (const Entry& entry : sorted)
+  {
+    const double percent =
+        m_total_samples == 0 ? double{} : 100.0 * entry.samples / m_total_samples;
+    fmt::println(file, "{:08x}\t{}\t{:.6f}\t\"{}\"", entry.address, entry.samples, percent,
+                 entry.symbol ? std::string_view{entry.symbol->name} : "");
+  }
+}
+}  // namespace Core
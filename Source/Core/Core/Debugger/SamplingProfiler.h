@@ -0,0 +1,42 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdio>
+#include <unordered_map>
+
+#include "Common/CommonTypes.h"
+
+class PPCSymbolDB;
+
+namespace Core
+{
+class CPUThreadGuard;
+
+// Statistical profiler for guest code.
+//
+// The guest PC is sampled whenever CoreTiming runs its scheduled events, where the PC is always
+// up to date regardless of CPU core, and the samples are attributed to PPCSymbolDB functions when
+// written. This costs a single hash map increment per timing slice, unlike JIT block profiling
+// which instruments every block.
+class SamplingProfiler
+{
+public:
+  void Sample(u32 pc)
+  {
+    ++m_samples[pc];
+    ++m_total_samples;
+  }
+
+  void Clear(const CPUThreadGuard& guard);
+  u64 GetTotalSamples(const CPUThreadGuard& guard) const { return m_total_samples; }
+
+  // Writes one tab-separated line per function (or unknown address), hottest first.
+  void Write(const CPUThreadGuard& guard, PPCSymbolDB& ppc_symbol_db, std::FILE* file) const;
+
+private:
+  std::unordered_map<u32, u64> m_samples;
+  u64 m_total_samples = 0;
+};
+}  // namespace Core
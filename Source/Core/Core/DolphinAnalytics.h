@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -186,7 +187,8 @@ private:
   std::vector<PerformanceSample> m_performance_samples;
 
   // What quirks have already been reported about the current game.
-  std::array<bool, static_cast<size_t>(GameQuirk::COUNT)> m_reported_quirks;
+  // Atomic, as the DSP HLE can report quirks from its voice worker threads.
+  std::array<std::atomic<bool>, static_cast<size_t>(GameQuirk::COUNT)> m_reported_quirks;
 
   // Builder that contains all non variable data that should be sent with all
   // reports.
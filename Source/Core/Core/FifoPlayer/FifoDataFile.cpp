@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/HW/Memmap.h"
@@ -101,7 +102,35 @@ bool FifoDataFile::GetIsWii() const
 
 void FifoDataFile::AddFrame(const FifoFrameInfo& frameInfo)
 {
-  m_Frames.push_back(frameInfo);
+  m_Frames.push_back(std::make_shared<FifoFrameInfo>(frameInfo));
+}
+
+std::shared_ptr<const FifoFrameInfo> FifoDataFile::GetFrame(u32 frame) const
+{
+  if (frame >= m_mapped_frames.size())
+    return m_Frames[frame - m_mapped_frames.size()];
+
+  std::lock_guard lk(m_mapping_lock);
+
+  // Players and analyzers tend to ask for the same frame several times in a row
+  if (m_last_mapped_frame && m_last_mapped_frame_number == frame)
+    return m_last_mapped_frame;
+
+  auto dstFrame = std::make_shared<FifoFrameInfo>();
+  if (!ReadMappedFrame(m_mapped_frames[frame], *dstFrame, m_mapping))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to read frame {} of DFF file", frame);
+    *dstFrame = {};
+  }
+
+  m_last_mapped_frame = dstFrame;
+  m_last_mapped_frame_number = frame;
+  return dstFrame;
+}
+
+u32 FifoDataFile::GetFrameCount() const
+{
+  return static_cast<u32>(m_mapped_frames.size() + m_Frames.size());
 }
 
 bool FifoDataFile::Save(const std::string& filename)
@@ -115,7 +144,8 @@ bool FifoDataFile::Save(const std::string& filename)
 
   // Add space for frame list
   u64 frameListOffset = file.Tell();
-  PadFile(m_Frames.size() * sizeof(FileFrameInfo), file);
+  const u32 frameCount = GetFrameCount();
+  PadFile(frameCount * sizeof(FileFrameInfo), file);
 
   u64 bpMemOffset = file.Tell();
   file.WriteArray(m_BPMem);
@@ -158,7 +188,7 @@ bool FifoDataFile::Save(const std::string& filename)
   header.texMemSize = TEX_MEM_SIZE;
 
   header.frameListOffset = frameListOffset;
-  header.frameCount = (u32)m_Frames.size();
+  header.frameCount = frameCount;
 
   header.flags = m_Flags;
 
@@ -171,9 +201,10 @@ bool FifoDataFile::Save(const std::string& filename)
   file.WriteBytes(&header, sizeof(FileHeader));
 
   // Write frames list
-  for (unsigned int i = 0; i < m_Frames.size(); ++i)
+  for (u32 i = 0; i < frameCount; ++i)
   {
-    const FifoFrameInfo& srcFrame = m_Frames[i];
+    const auto srcFramePtr = GetFrame(i);
+    const FifoFrameInfo& srcFrame = *srcFramePtr;
 
     // Write FIFO data
     file.Seek(0, File::SeekOrigin::End);
@@ -316,15 +347,23 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
   dataFile->m_ram_size_real = header.mem1_size;
   dataFile->m_exram_size_real = header.mem2_size;
 
-  // Read frames
-  for (u32 i = 0; i < header.frameCount; ++i)
+  // Read frame list
+  std::vector<FileFrameInfo> srcFrames(header.frameCount);
+  file.Seek(header.frameListOffset, File::SeekOrigin::Begin);
+  if (!file.ReadArray(srcFrames.data(), srcFrames.size()))
+    return panic_failed_to_read();
+
+  // DFF files can be several gigabytes, so if possible, map the file and only read frames when
+  // they are requested
+  if (dataFile->m_mapping.Map(file))
   {
-    u64 frameOffset = header.frameListOffset + (i * sizeof(FileFrameInfo));
-    file.Seek(frameOffset, File::SeekOrigin::Begin);
-    FileFrameInfo srcFrame;
-    if (!file.ReadBytes(&srcFrame, sizeof(FileFrameInfo)))
-      return panic_failed_to_read();
+    dataFile->m_mapped_frames = std::move(srcFrames);
+    return dataFile;
+  }
 
+  // Read frames
+  for (const FileFrameInfo& srcFrame : srcFrames)
+  {
     FifoFrameInfo dstFrame;
     dstFrame.fifoData.resize(srcFrame.fifoDataSize);
     dstFrame.fifoStart = srcFrame.fifoStart;
@@ -417,3 +456,34 @@ void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
     file.ReadBytes(dstUpdate.data.data(), srcUpdate.dataSize);
   }
 }
+
+bool FifoDataFile::ReadMappedFrame(const FileFrameInfo& srcFrame, FifoFrameInfo& dstFrame,
+                                   Common::MappedFile& mapping)
+{
+  dstFrame.fifoStart = srcFrame.fifoStart;
+  dstFrame.fifoEnd = srcFrame.fifoEnd;
+
+  dstFrame.fifoData.resize(srcFrame.fifoDataSize);
+  if (!mapping.Read(srcFrame.fifoDataOffset, srcFrame.fifoDataSize, dstFrame.fifoData.data()))
+    return false;
+
+  dstFrame.memoryUpdates.resize(srcFrame.numMemoryUpdates);
+  for (u32 i = 0; i < srcFrame.numMemoryUpdates; ++i)
+  {
+    const u64 updateOffset = srcFrame.memoryUpdatesOffset + (i * sizeof(FileMemoryUpdate));
+    FileMemoryUpdate srcUpdate;
+    if (!mapping.Read(updateOffset, sizeof(FileMemoryUpdate), reinterpret_cast<u8*>(&srcUpdate)))
+      return false;
+
+    MemoryUpdate& dstUpdate = dstFrame.memoryUpdates[i];
+    dstUpdate.address = srcUpdate.address;
+    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
+    dstUpdate.data.resize(srcUpdate.dataSize);
+    dstUpdate.type = static_cast<MemoryUpdate::Type>(srcUpdate.type);
+
+    if (!mapping.Read(srcUpdate.dataOffset, srcUpdate.dataSize, dstUpdate.data.data()))
+      return false;
+  }
+
+  return true;
+}
@@ -5,10 +5,12 @@
 
 #include <array>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/MappedFile.h"
 #include "VideoCommon/XFMemory.h"
 
 namespace File
@@ -16,6 +18,8 @@ namespace File
 class IOFile;
 }
 
+struct FileFrameInfo;
+
 struct MemoryUpdate
 {
   enum class Type : u8
@@ -73,8 +77,10 @@ public:
   u32 GetExRamSizeReal() { return m_exram_size_real; }
 
   void AddFrame(const FifoFrameInfo& frameInfo);
-  const FifoFrameInfo& GetFrame(u32 frame) const { return m_Frames[frame]; }
-  u32 GetFrameCount() const { return static_cast<u32>(m_Frames.size()); }
+  // Frames of a loaded file are read from the file on demand, so callers should only hold on to
+  // the returned frame for as long as they need it
+  std::shared_ptr<const FifoFrameInfo> GetFrame(u32 frame) const;
+  u32 GetFrameCount() const;
   bool Save(const std::string& filename);
 
   static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly);
@@ -93,6 +99,8 @@ private:
   u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
   static void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
                                 std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
+  static bool ReadMappedFrame(const FileFrameInfo& srcFrame, FifoFrameInfo& dstFrame,
+                              Common::MappedFile& mapping);
 
   std::array<u32, BP_MEM_SIZE> m_BPMem{};
   std::array<u32, CP_MEM_SIZE> m_CPMem{};
@@ -105,5 +113,13 @@ private:
   u32 m_Flags = 0;
   u32 m_Version = 0;
 
-  std::vector<FifoFrameInfo> m_Frames;
+  // Frames added by the recorder, or read up front if the file couldn't be mapped
+  std::vector<std::shared_ptr<const FifoFrameInfo>> m_Frames;
+
+  // Frames of a mapped file, which are only read when requested
+  std::vector<FileFrameInfo> m_mapped_frames;
+  mutable Common::MappedFile m_mapping;
+  mutable std::mutex m_mapping_lock;
+  mutable std::shared_ptr<const FifoFrameInfo> m_last_mapped_frame;
+  mutable u32 m_last_mapped_frame_number = 0;
 };
@@ -3,12 +3,19 @@
 
 #include "Core/HLE/HLE_Misc.h"
 
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <vector>
+
 #include "Common/Common.h"
 #include "Common/CommonTypes.h"
 #include "Core/Core.h"
 #include "Core/GeckoCode.h"
 #include "Core/HW/CPU.h"
+#include "Core/HW/Memmap.h"
 #include "Core/Host.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -79,4 +86,127 @@ void GeckoReturnTrampoline(const Core::CPUThreadGuard& guard)
                             PowerPC::MMU::HostRead_U64(guard, SP + 24 + (2 * i + 1) * sizeof(u64)));
   }
 }
+
+// Calls func with a host pointer for every part of the range which doesn't cross a page boundary.
+// Returns false without calling func if any part of the range isn't RAM, or if accessing it through
+// the host pointers wouldn't behave like the guest code (memory breakpoints, data cache emulation).
+template <typename Func>
+static bool ForEachRAMChunk(Core::System& system, u32 address, u32 size, Func func)
+{
+  if (system.GetPPCState().m_enable_dcache || system.GetPowerPC().GetMemChecks().HasAny())
+    return false;
+
+  auto& mmu = system.GetMMU();
+  auto& memory = system.GetMemory();
+
+  const auto for_each_chunk = [&](auto chunk_func) {
+    for (u32 offset = 0; offset < size;)
+    {
+      const u32 chunk_address = address + offset;
+      const u32 chunk_size = std::min<u32>(
+          size - offset, static_cast<u32>(PowerPC::HW_PAGE_SIZE -
+                                          (chunk_address & PowerPC::HW_PAGE_MASK)));
+      const std::optional<u32> physical_address = mmu.GetTranslatedAddress(chunk_address);
+      u8* const pointer =
+          physical_address ? memory.GetPointerForRange(*physical_address, chunk_size) : nullptr;
+      if (!chunk_func(pointer, offset, chunk_size))
+        return false;
+      offset += chunk_size;
+    }
+    return true;
+  };
+
+  if (!for_each_chunk([](u8* pointer, u32, u32) { return pointer != nullptr; }))
+    return false;
+
+  for_each_chunk([&](u8* pointer, u32 offset, u32 chunk_size) {
+    func(pointer, offset, chunk_size);
+    return true;
+  });
+  return true;
+}
+
+// void* memcpy(void* dest, const void* src, size_t n)
+// The SDK implementation handles overlapping ranges like memmove, so the source is read completely
+// before the destination is written.
+void Memcpy(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  const u32 dest = ppc_state.gpr[3];
+  const u32 src = ppc_state.gpr[4];
+  const u32 size = ppc_state.gpr[5];
+
+  std::vector<u8> buffer(size);
+  const bool fast_src = ForEachRAMChunk(system, src, size, [&](u8* pointer, u32 offset, u32 n) {
+    std::memcpy(buffer.data() + offset, pointer, n);
+  });
+  if (!fast_src)
+  {
+    for (u32 i = 0; i < size; ++i)
+      buffer[i] = PowerPC::MMU::HostRead_U8(guard, src + i);
+  }
+
+  const bool fast_dest = ForEachRAMChunk(system, dest, size, [&](u8* pointer, u32 offset, u32 n) {
+    std::memcpy(pointer, buffer.data() + offset, n);
+  });
+  if (!fast_dest)
+  {
+    for (u32 i = 0; i < size; ++i)
+      PowerPC::MMU::HostWrite_U8(guard, buffer[i], dest + i);
+  }
+
+  // r3 is returned unchanged
+  ppc_state.npc = LR(ppc_state);
+}
+
+// void* memset(void* dest, int c, size_t n)
+void Memset(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  const u32 dest = ppc_state.gpr[3];
+  const u8 value = static_cast<u8>(ppc_state.gpr[4]);
+  const u32 size = ppc_state.gpr[5];
+
+  const bool fast = ForEachRAMChunk(system, dest, size, [&](u8* pointer, u32, u32 n) {
+    std::memset(pointer, value, n);
+  });
+  if (!fast)
+  {
+    for (u32 i = 0; i < size; ++i)
+      PowerPC::MMU::HostWrite_U8(guard, value, dest + i);
+  }
+
+  // r3 is returned unchanged
+  ppc_state.npc = LR(ppc_state);
+}
+
+// void DCFlushRange(void* start, u32 n)
+// Without data cache emulation, dcbf only invalidates the JIT cache, so the whole range can be
+// invalidated at once instead of running the loop.
+void DCFlushRange(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  const u32 start = ppc_state.gpr[3];
+  const u32 size = ppc_state.gpr[4];
+
+  if (size != 0)
+  {
+    const u32 line_count = ((start & 0x1f) + size + 0x1f) >> 5;
+    if (ppc_state.m_enable_dcache)
+    {
+      auto& mmu = system.GetMMU();
+      for (u32 i = 0; i < line_count; ++i)
+        mmu.FlushDCacheLine((start & ~0x1f) + i * 32);
+    }
+    else
+    {
+      system.GetJitInterface().InvalidateICacheLines(start, line_count);
+    }
+  }
+
+  ppc_state.npc = LR(ppc_state);
+}
 }  // namespace HLE_Misc
@@ -14,4 +14,7 @@ void UnimplementedFunction(const Core::CPUThreadGuard& guard);
 void HBReload(const Core::CPUThreadGuard& guard);
 void GeckoCodeHandlerICacheFlush(const Core::CPUThreadGuard& guard);
 void GeckoReturnTrampoline(const Core::CPUThreadGuard& guard);
+void Memcpy(const Core::CPUThreadGuard& guard);
+void Memset(const Core::CPUThreadGuard& guard);
+void DCFlushRange(const Core::CPUThreadGuard& guard);
 }  // namespace HLE_Misc
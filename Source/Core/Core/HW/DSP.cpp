@@ -460,6 +460,10 @@ void DSPManager::Do_ARAM_DMA()
 
   m_dsp_control.DMAState = 1;
 
+  // The DSP accelerator reads ARAM, so a DSP thread which is running behind must not observe
+  // the effects of this transfer early.
+  m_dsp_emulator->DSP_Sync();
+
   // ARAM DMA transfer rate has been measured on real hw
   int ticksToTransfer = (m_aram_dma.Cnt.count / 32) * 246;
   core_timing.ScheduleEvent(ticksToTransfer, m_event_type_complete_aram);
@@ -592,6 +596,29 @@ u8 DSPManager::ReadARAM(u32 address) const
   }
 }
 
+const u8* DSPManager::GetARAMRange(u32 address, u32 size) const
+{
+  if (size == 0)
+    return nullptr;
+
+  if (m_aram.wii_mode && !(address & 0x10000000))
+  {
+    auto& memory = m_system.GetMemory();
+    const u32 ram_mask = memory.GetRamMask();
+    const u32 offset = address & ram_mask;
+    if (((address ^ (address + size - 1)) & ~ram_mask) != 0 ||
+        offset + size > memory.GetRamSizeReal())
+    {
+      return nullptr;
+    }
+    return memory.GetRAM() + offset;
+  }
+
+  if (((address ^ (address + size - 1)) & ~m_aram.mask) != 0)
+    return nullptr;
+  return m_aram.ptr + (address & m_aram.mask);
+}
+
 void DSPManager::WriteARAM(u8 value, u32 address)
 {
   // TODO: verify this on Wii
@@ -30,6 +30,7 @@ class Accelerator;
 
 namespace DSP::HLE
 {
+class AXVoiceWorkers;
 class DSPHLE;
 
 // We can't directly use the mixer_control field from the PB because it does
@@ -110,6 +111,9 @@ protected:
 
   std::unique_ptr<Accelerator> m_accelerator;
 
+  // Only created when voices are processed on worker threads.
+  std::unique_ptr<AXVoiceWorkers> m_voice_workers;
+
   // Constructs without any GC-specific state, so it can be used by the deriving AXWii.
   AXUCode(DSPHLE* dsphle, u32 crc, bool dummy);
 
@@ -12,15 +12,25 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <functional>
 #include <memory>
+#include <vector>
+
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
 
 #include "Common/CommonTypes.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/DSP/DSPAccelerator.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/UCodes/AX.h"
 #include "Core/HW/DSPHLE/UCodes/AXStructs.h"
+#include "Core/HW/DSPHLE/UCodes/AXVoiceWorkers.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
 
@@ -87,6 +97,8 @@ union AXBuffers
 #endif
 };
 
+constexpr size_t NUM_AX_BUFFERS = std::size(AXBuffers{}.ptrs);
+
 // Determines if this version of the UCode has a PBLowPassFilter in its AXPB layout.
 bool HasLpf(u32 crc)
 {
@@ -191,12 +203,30 @@ protected:
 
   u8 ReadMemory(u32 address) override { return m_dsp.ReadARAM(address); }
 
+  const u8* GetMemoryRange(u32 address, u32 size) override
+  {
+    return m_dsp.GetARAMRange(address, size);
+  }
+
   void WriteMemory(u32 address, u8 value) override { m_dsp.WriteARAM(value, address); }
 
 private:
   DSP::DSPManager& m_dsp;
 };
 
+// Creates the threads for processing voices in parallel, if they are enabled.
+std::unique_ptr<AXVoiceWorkers> CreateVoiceWorkers(DSP::DSPManager& dsp)
+{
+  constexpr int MAX_VOICE_WORKERS = 15;
+  const int num_workers =
+      std::clamp(Config::Get(Config::MAIN_DSP_HLE_VOICE_THREADS), 0, MAX_VOICE_WORKERS);
+  if (num_workers == 0)
+    return nullptr;
+
+  return std::make_unique<AXVoiceWorkers>(num_workers,
+                                          [&dsp] { return std::make_unique<HLEAccelerator>(dsp); });
+}
+
 // Sets up the simulated accelerator.
 void AcceleratorSetup(HLEAccelerator* accelerator, PB_TYPE* pb)
 {
@@ -359,9 +389,30 @@ void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16
 
   if (coeffs)
     coeffs += pb.coef_select * 0x200;
-  u32 curr_pos = ResampleAudio([accelerator](u32) { return AcceleratorGetSample(accelerator); },
-                               samples, count, pb.src.last_samples, pb.src.cur_addr_frac,
-                               HILO_TO_32(pb.src.ratio), pb.src_type, coeffs);
+
+  // The resampler always consumes the same number of input samples for a given position and
+  // ratio, so decode all of them at once when they fit in the buffer.
+  const u32 ratio = HILO_TO_32(pb.src.ratio);
+  const bool interpolated = pb.src_type == SRCTYPE_LINEAR || pb.src_type == SRCTYPE_POLYPHASE;
+  const u64 needed_samples =
+      interpolated ? (pb.src.cur_addr_frac + u64(ratio) * count) >> 16 : u64(count);
+
+  std::array<s16, 0x400> input_samples;
+  u32 curr_pos;
+  if (needed_samples <= input_samples.size())
+  {
+    accelerator->ReadSamples(accelerator->acc_pb->adpcm.coefs, input_samples.data(),
+                             static_cast<u32>(needed_samples));
+    curr_pos = ResampleAudio([&input_samples](u32 i) { return input_samples[i]; }, samples,
+                             count, pb.src.last_samples, pb.src.cur_addr_frac, ratio, pb.src_type,
+                             coeffs);
+  }
+  else
+  {
+    curr_pos = ResampleAudio([accelerator](u32) { return AcceleratorGetSample(accelerator); },
+                             samples, count, pb.src.last_samples, pb.src.cur_addr_frac, ratio,
+                             pb.src_type, coeffs);
+  }
   pb.src.cur_addr_frac = (curr_pos & 0xFFFF);
 
   // Update current position, YN1, YN2 and pred scale in the PB.
@@ -372,6 +423,60 @@ void GetInputSamples(HLEAccelerator* accelerator, PB_TYPE& pb, s16* samples, u16
   pb.adpcm.pred_scale = accelerator->GetPredScale();
 }
 
+// Both volume stages compute clamp((sample * volume) >> 15, -32767, 32767) with a volume that
+// advances by a fixed delta after every sample. The SIMD versions handle eight samples at a time,
+// giving every lane its own volume, and produce the same results as the scalar loops.
+#if defined(_M_X86_64)
+template <bool SignedVolume>
+__m128i ScaleSamples(__m128i samples, __m128i volumes)
+{
+  const __m128i lo = _mm_mullo_epi16(samples, volumes);
+  __m128i hi = _mm_mulhi_epi16(samples, volumes);
+  // mulhi treats volumes >= 0x8000 as negative, which makes the high half short by samples.
+  if constexpr (!SignedVolume)
+    hi = _mm_add_epi16(hi, _mm_and_si128(samples, _mm_srai_epi16(volumes, 15)));
+
+  const __m128i scaled_lo = _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 15);
+  const __m128i scaled_hi = _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 15);
+  return _mm_max_epi16(_mm_packs_epi32(scaled_lo, scaled_hi), _mm_set1_epi16(-32767));
+}
+
+__m128i GetRampVolumes(u16 volume, u16 volume_delta)
+{
+  const __m128i lanes = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+  return _mm_add_epi16(_mm_set1_epi16(volume),
+                       _mm_mullo_epi16(_mm_set1_epi16(volume_delta), lanes));
+}
+#elif defined(_M_ARM_64)
+template <bool SignedVolume>
+int16x8_t ScaleSamples(int16x8_t samples, uint16x8_t volumes)
+{
+  int32x4_t scaled_lo;
+  int32x4_t scaled_hi;
+  if constexpr (SignedVolume)
+  {
+    const int16x8_t signed_volumes = vreinterpretq_s16_u16(volumes);
+    scaled_lo = vmull_s16(vget_low_s16(samples), vget_low_s16(signed_volumes));
+    scaled_hi = vmull_high_s16(samples, signed_volumes);
+  }
+  else
+  {
+    scaled_lo = vmulq_s32(vmovl_s16(vget_low_s16(samples)),
+                          vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(volumes))));
+    scaled_hi = vmulq_s32(vmovl_high_s16(samples), vreinterpretq_s32_u32(vmovl_high_u16(volumes)));
+  }
+
+  const int16x8_t scaled = vcombine_s16(vqshrn_n_s32(scaled_lo, 15), vqshrn_n_s32(scaled_hi, 15));
+  return vmaxq_s16(scaled, vdupq_n_s16(-32767));
+}
+
+uint16x8_t GetRampVolumes(u16 volume, u16 volume_delta)
+{
+  static constexpr u16 LANES[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+  return vmlaq_u16(vdupq_n_u16(volume), vld1q_u16(LANES), vdupq_n_u16(volume_delta));
+}
+#endif
+
 // Add samples to an output buffer, with optional volume ramping.
 void MixAdd(int* out, const s16* input, u32 count, VolumeData* vd, s16* dpop, bool ramp)
 {
@@ -384,7 +489,50 @@ void MixAdd(int* out, const s16* input, u32 count, VolumeData* vd, s16* dpop, bo
   if (!ramp)
     volume_delta = 0;
 
-  for (u32 i = 0; i < count; ++i)
+  u32 i = 0;
+#if defined(_M_X86_64)
+  if (count >= 8)
+  {
+    __m128i volumes = GetRampVolumes(volume, volume_delta);
+    const __m128i volumes_step = _mm_set1_epi16(static_cast<s16>(volume_delta * 8));
+    __m128i scaled = _mm_setzero_si128();
+    for (; i + 8 <= count; i += 8)
+    {
+      const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[i]));
+      scaled = ScaleSamples<false>(samples, volumes);
+
+      const __m128i sign = _mm_srai_epi16(scaled, 15);
+      __m128i* const out_vec = reinterpret_cast<__m128i*>(&out[i]);
+      _mm_storeu_si128(out_vec, _mm_add_epi32(_mm_loadu_si128(out_vec),
+                                              _mm_unpacklo_epi16(scaled, sign)));
+      _mm_storeu_si128(out_vec + 1, _mm_add_epi32(_mm_loadu_si128(out_vec + 1),
+                                                  _mm_unpackhi_epi16(scaled, sign)));
+      volumes = _mm_add_epi16(volumes, volumes_step);
+    }
+
+    volume += volume_delta * i;
+    *dpop = static_cast<s16>(_mm_extract_epi16(scaled, 7));
+  }
+#elif defined(_M_ARM_64)
+  if (count >= 8)
+  {
+    uint16x8_t volumes = GetRampVolumes(volume, volume_delta);
+    const uint16x8_t volumes_step = vdupq_n_u16(static_cast<u16>(volume_delta * 8));
+    int16x8_t scaled = vdupq_n_s16(0);
+    for (; i + 8 <= count; i += 8)
+    {
+      scaled = ScaleSamples<false>(vld1q_s16(&input[i]), volumes);
+      vst1q_s32(&out[i], vaddw_s16(vld1q_s32(&out[i]), vget_low_s16(scaled)));
+      vst1q_s32(&out[i + 4], vaddw_high_s16(vld1q_s32(&out[i + 4]), scaled));
+      volumes = vaddq_u16(volumes, volumes_step);
+    }
+
+    volume += volume_delta * i;
+    *dpop = vgetq_lane_s16(scaled, 7);
+  }
+#endif
+
+  for (; i < count; ++i)
   {
     s64 sample = input[i];
     sample *= volume;
@@ -398,6 +546,53 @@ void MixAdd(int* out, const s16* input, u32 count, VolumeData* vd, s16* dpop, bo
   }
 }
 
+// Apply a global volume ramp using the volume envelope parameters.
+void ApplyVolumeEnvelope(s16* samples, u32 count, PBVolumeEnvelope& vol_env)
+{
+#ifdef AX_GC
+  // signed on GameCube
+  constexpr bool signed_volume = true;
+#else
+  // unsigned on Wii
+  constexpr bool signed_volume = false;
+#endif
+
+  u32 i = 0;
+#if defined(_M_X86_64) || defined(_M_ARM_64)
+  const u16 volume_delta = static_cast<u16>(vol_env.cur_volume_delta);
+  if (count >= 8)
+  {
+    auto volumes = GetRampVolumes(static_cast<u16>(vol_env.cur_volume), volume_delta);
+#if defined(_M_X86_64)
+    const __m128i volumes_step = _mm_set1_epi16(static_cast<s16>(volume_delta * 8));
+    for (; i + 8 <= count; i += 8)
+    {
+      __m128i* const samples_vec = reinterpret_cast<__m128i*>(&samples[i]);
+      _mm_storeu_si128(samples_vec,
+                       ScaleSamples<signed_volume>(_mm_loadu_si128(samples_vec), volumes));
+      volumes = _mm_add_epi16(volumes, volumes_step);
+    }
+#else
+    const uint16x8_t volumes_step = vdupq_n_u16(static_cast<u16>(volume_delta * 8));
+    for (; i + 8 <= count; i += 8)
+    {
+      vst1q_s16(&samples[i], ScaleSamples<signed_volume>(vld1q_s16(&samples[i]), volumes));
+      volumes = vaddq_u16(volumes, volumes_step);
+    }
+#endif
+    vol_env.cur_volume = static_cast<s16>(static_cast<u16>(vol_env.cur_volume) + volume_delta * i);
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    const s32 volume = signed_volume ? (s16)vol_env.cur_volume : (u16)vol_env.cur_volume;
+    const s32 sample = ((s32)samples[i] * volume) >> 15;
+    samples[i] = std::clamp(sample, -32767, 32767);  // -32768 ?
+    vol_env.cur_volume += vol_env.cur_volume_delta;
+  }
+}
+
 // Execute a low pass filter on the samples using one history value. Returns
 // the new history value.
 s16 LowPassFilter(s16* samples, u32 count, s16 yn1, u16 a0, u16 b0)
@@ -420,20 +615,7 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
   s16 samples[MAX_SAMPLES_PER_FRAME];
   GetInputSamples(accelerator, pb, samples, count, coeffs);
 
-  // Apply a global volume ramp using the volume envelope parameters.
-  for (u32 i = 0; i < count; ++i)
-  {
-#ifdef AX_GC
-    // signed on GameCube
-    const s32 volume = (s16)pb.vol_env.cur_volume;
-#else
-    // unsigned on Wii
-    const s32 volume = (u16)pb.vol_env.cur_volume;
-#endif
-    const s32 sample = ((s32)samples[i] * volume) >> 15;
-    samples[i] = std::clamp(sample, -32767, 32767);  // -32768 ?
-    pb.vol_env.cur_volume += pb.vol_env.cur_volume_delta;
-  }
+  ApplyVolumeEnvelope(samples, count, pb.vol_env);
 
   // Optionally, execute a low pass filter
   if (pb.lpf.enabled)
@@ -574,6 +756,114 @@ void ProcessVoice(HLEAccelerator* accelerator, PB_TYPE& pb, const AXBuffers& buf
 #endif
 }
 
+// Processes all voices of a PB list, calling process_pb(pb, buffers, accelerator) for each PB
+// before writing it back. buffer_sizes holds the number of samples in each of the buffers.
+//
+// With voice workers, the list is read in full first and split into runs of consecutive voices,
+// one per thread. Every run mixes into zeroed buffers of its own, which are added to the output
+// buffers at the end. Integer addition doesn't depend on the order, so the samples are the same
+// as when processing the voices one after another. Lists where that isn't possible (a PB which is
+// listed twice, or an update that changes the address of the next PB) are processed one voice at
+// a time from the start, as the PBs in memory are only updated once all voices are done.
+template <typename ProcessPB>
+void ProcessVoices(Memory::MemoryManager& memory, u32 pb_addr, u32 crc,
+                   HLEAccelerator* accelerator, AXVoiceWorkers* workers, const AXBuffers& buffers,
+                   const std::array<size_t, NUM_AX_BUFFERS>& buffer_sizes,
+                   const ProcessPB& process_pb)
+{
+  const auto process_serially = [&] {
+    PB_TYPE pb;
+    for (u32 addr = pb_addr; addr != 0; addr = HILO_TO_32(pb.next_pb))
+    {
+      ReadPB(memory, addr, pb, crc);
+      process_pb(pb, buffers, accelerator);
+      WritePB(memory, addr, pb, crc);
+    }
+  };
+
+  // Runs with fewer voices than this aren't worth handing to another thread.
+  constexpr u32 MIN_VOICES_PER_RUN = 4;
+
+  if (!workers)
+  {
+    process_serially();
+    return;
+  }
+
+  std::vector<u32> addresses;
+  std::vector<PB_TYPE> pbs;
+  for (u32 addr = pb_addr; addr != 0; addr = HILO_TO_32(pbs.back().next_pb))
+  {
+    if (std::find(addresses.begin(), addresses.end(), addr) != addresses.end())
+    {
+      process_serially();
+      return;
+    }
+    addresses.push_back(addr);
+    ReadPB(memory, addr, pbs.emplace_back(), crc);
+  }
+
+  const u32 num_voices = static_cast<u32>(pbs.size());
+  const u32 num_runs = std::min(workers->GetWorkerCount() + 1, num_voices / MIN_VOICES_PER_RUN);
+  if (num_runs < 2)
+  {
+    process_serially();
+    return;
+  }
+
+  size_t total_size = 0;
+  for (size_t size : buffer_sizes)
+    total_size += size;
+
+  workers->Run(num_runs, [&](u32 run) {
+    std::vector<int>& samples = workers->GetMixBuffer(run);
+    samples.assign(total_size, 0);
+
+    AXBuffers run_buffers;
+    size_t offset = 0;
+    for (size_t i = 0; i < buffer_sizes.size(); ++i)
+    {
+      run_buffers.ptrs[i] = samples.data() + offset;
+      offset += buffer_sizes[i];
+    }
+
+    // The last run is on the calling thread, so the ucode's accelerator ends up with the state of
+    // the last voice, like when processing one voice at a time.
+    HLEAccelerator* run_accelerator =
+        run == num_runs - 1 ? accelerator :
+                              static_cast<HLEAccelerator*>(workers->GetAccelerator(run));
+
+    const u32 begin = num_voices * run / num_runs;
+    const u32 end = num_voices * (run + 1) / num_runs;
+    for (u32 i = begin; i < end; ++i)
+      process_pb(pbs[i], run_buffers, run_accelerator);
+  });
+
+  for (u32 i = 0; i < num_voices; ++i)
+  {
+    const u32 next_addr = i + 1 < num_voices ? addresses[i + 1] : 0;
+    if (HILO_TO_32(pbs[i].next_pb) != next_addr)
+    {
+      process_serially();
+      return;
+    }
+  }
+
+  for (u32 i = 0; i < num_voices; ++i)
+    WritePB(memory, addresses[i], pbs[i], crc);
+
+  for (u32 run = 0; run < num_runs; ++run)
+  {
+    const int* samples = workers->GetMixBuffer(run).data();
+    for (size_t i = 0; i < buffer_sizes.size(); ++i)
+    {
+      for (size_t j = 0; j < buffer_sizes[i]; ++j)
+        buffers.ptrs[i][j] += samples[j];
+      samples += buffer_sizes[i];
+    }
+  }
+}
+
 }  // namespace
 }  // inline namespace AXGC/AXWii
 }  // namespace DSP::HLE
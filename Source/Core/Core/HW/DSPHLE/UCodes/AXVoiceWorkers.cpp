@@ -0,0 +1,42 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXVoiceWorkers.h"
+
+#include "Common/Assert.h"
+#include "Core/DSP/DSPAccelerator.h"
+
+namespace DSP::HLE
+{
+AXVoiceWorkers::AXVoiceWorkers(
+    u32 num_workers, const std::function<std::unique_ptr<Accelerator>()>& create_accelerator)
+    : m_mix_buffers(num_workers + 1)
+{
+  m_accelerators.reserve(num_workers);
+  m_threads.reserve(num_workers);
+  for (u32 i = 0; i < num_workers; i++)
+  {
+    m_accelerators.push_back(create_accelerator());
+    m_threads.push_back(std::make_unique<Common::WorkQueueThread<u32>>(
+        "AX Voice Worker", [this](u32 run) { (*m_func)(run); }));
+  }
+}
+
+AXVoiceWorkers::~AXVoiceWorkers() = default;
+
+void AXVoiceWorkers::Run(u32 num_runs, const std::function<void(u32)>& func)
+{
+  ASSERT(num_runs != 0 && num_runs <= GetWorkerCount() + 1);
+
+  // The worker queues are locked when pushing, which publishes m_func to the workers.
+  m_func = &func;
+  for (u32 run = 0; run < num_runs - 1; run++)
+    m_threads[run]->Push(run);
+
+  func(num_runs - 1);
+
+  for (u32 run = 0; run < num_runs - 1; run++)
+    m_threads[run]->WaitForCompletion();
+  m_func = nullptr;
+}
+}  // namespace DSP::HLE
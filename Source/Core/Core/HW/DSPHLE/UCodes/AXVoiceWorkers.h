@@ -0,0 +1,51 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
+
+namespace DSP
+{
+class Accelerator;
+}
+
+namespace DSP::HLE
+{
+// Threads for processing the voices of an AX PB list in parallel (see ProcessVoices in
+// AXVoice.h). Every worker has its own accelerator and mixing buffer, so that voices can be
+// processed without touching the state of the ucode.
+class AXVoiceWorkers
+{
+public:
+  AXVoiceWorkers(u32 num_workers,
+                 const std::function<std::unique_ptr<Accelerator>()>& create_accelerator);
+  ~AXVoiceWorkers();
+
+  AXVoiceWorkers(const AXVoiceWorkers&) = delete;
+  AXVoiceWorkers& operator=(const AXVoiceWorkers&) = delete;
+
+  u32 GetWorkerCount() const { return static_cast<u32>(m_threads.size()); }
+  Accelerator* GetAccelerator(u32 worker) const { return m_accelerators[worker].get(); }
+
+  // There is one mixing buffer per run, including the one on the calling thread.
+  std::vector<int>& GetMixBuffer(u32 run) { return m_mix_buffers[run]; }
+
+  // Calls func(run) for every run in [0, num_runs), which must not be more than the worker count
+  // plus one. The last run happens on the calling thread. Returns once all runs are done.
+  void Run(u32 num_runs, const std::function<void(u32)>& func);
+
+private:
+  std::vector<std::unique_ptr<Accelerator>> m_accelerators;
+  std::vector<std::vector<int>> m_mix_buffers;
+  const std::function<void(u32)>* m_func = nullptr;
+
+  // Declared last, so that the threads are stopped before the state they use is destroyed.
+  std::vector<std::unique_ptr<Common::WorkQueueThread<u32>>> m_threads;
+};
+}  // namespace DSP::HLE
@@ -3,6 +3,7 @@
 
 #include "Core/HW/DSPLLE/DSPLLE.h"
 
+#include <algorithm>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -57,6 +58,7 @@ void DSPLLE::DoState(PointerWrap& p)
 void DSPLLE::DSPThread(DSPLLE* dsp_lle)
 {
   Common::SetCurrentThreadName("DSP thread");
+  Common::SetCurrentThreadQoS(Common::ThreadQoS::Emulation);
 
   while (dsp_lle->m_is_running.IsSet())
   {
@@ -74,7 +76,7 @@ void DSPLLE::DSPThread(DSPLLE* dsp_lle)
         {
           dsp_lle->m_dsp_core.GetInterpreter().RunCyclesThread(cycles);
         }
-        dsp_lle->m_cycle_count.store(0);
+        dsp_lle->m_cycle_count.fetch_sub(cycles);
         continue;
       }
     }
@@ -150,6 +152,7 @@ bool DSPLLE::Initialize(bool wii, bool dsp_thread)
 
   m_wii = wii;
   m_is_dsp_on_thread = dsp_thread;
+  m_sync_windows = std::max(Config::Get(Config::MAIN_DSP_THREAD_SYNC_WINDOWS), 1);
 
   m_dsp_core.Reset();
 
@@ -261,6 +264,8 @@ void DSPLLE::DSP_Update(int cycles)
   {
     if (m_request_disable_thread || Core::WantsDeterminism())
     {
+      // The thread may still be running cycles that were passed to it earlier.
+      DSP_Sync();
       DSP_StopSoundStream();
       m_is_dsp_on_thread = false;
       m_request_disable_thread = false;
@@ -276,13 +281,26 @@ void DSPLLE::DSP_Update(int cycles)
   }
   else
   {
-    // Wait for DSP thread to complete its cycle. Note: this logic should be thought through.
-    m_ppc_event.Wait();
+    // Let the DSP thread fall behind by up to m_sync_windows - 1 updates before waiting for it,
+    // so that it can run in parallel to the CPU. A single window means strict lockstep.
+    const u32 max_pending_cycles = static_cast<u32>(dsp_cycles) * (m_sync_windows - 1);
+    while (m_cycle_count.load() > max_pending_cycles)
+      m_ppc_event.Wait();
     m_cycle_count.fetch_add(dsp_cycles);
     m_dsp_event.Set();
   }
 }
 
+void DSPLLE::DSP_Sync()
+{
+  if (!m_is_dsp_on_thread)
+    return;
+
+  // The DSP thread signals m_ppc_event whenever it runs out of cycles.
+  while (m_cycle_count.load() != 0)
+    m_ppc_event.Wait();
+}
+
 u32 DSPLLE::DSP_UpdateRate()
 {
   return 12600;  // TO BE TWEAKED
@@ -301,7 +319,6 @@ void DSPLLE::PauseAndLock(bool do_lock)
     if (m_is_dsp_on_thread)
     {
       // Signal the DSP thread so it can perform any outstanding work now (if any)
-      m_ppc_event.Wait();
       m_dsp_event.Set();
     }
   }
@@ -35,6 +35,7 @@ public:
   u16 DSP_ReadControlRegister() override;
   u16 DSP_WriteControlRegister(u16 value) override;
   void DSP_Update(int cycles) override;
+  void DSP_Sync() override;
   void DSP_StopSoundStream() override;
   u32 DSP_UpdateRate() override;
 
@@ -46,7 +47,9 @@ private:
   std::mutex m_dsp_thread_mutex;
   bool m_is_dsp_on_thread = false;
   Common::Flag m_is_running;
+  // Cycles passed to DSP_Update which the DSP thread hasn't run yet.
   std::atomic<u32> m_cycle_count{};
+  int m_sync_windows = 1;
 
   Common::Event m_dsp_event;
   Common::Event m_ppc_event;
@@ -3,6 +3,7 @@
 
 #include "Core/HW/DVD/DVDThread.h"
 
+#include <cstring>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -20,6 +21,7 @@
 #include "Common/SPSCQueue.h"
 #include "Common/Thread.h"
 #include "Common/Timer.h"
+#include "Common/TraceProfiler.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
@@ -50,6 +52,7 @@ void DVDThread::Start()
   m_result_queue_expanded.Reset();
   m_request_queue.Clear();
   m_result_queue.Clear();
+  m_free_buffers.Clear();
 
   // This is reset on every launch for determinism, but it doesn't matter
   // much, because this will never get exposed to the emulated game.
@@ -326,6 +329,17 @@ void DVDThread::FinishRead(u64 id, s64 cycles_late)
 
   // Notify the emulated software that the command has been executed
   dvd_interface.FinishExecutingCommand(request.reply_type, interrupt, cycles_late, buffer);
+
+  if (m_free_buffers.Size() < MAX_FREE_BUFFERS)
+    m_free_buffers.Push(std::move(result.second));
+}
+
+std::vector<u8> DVDThread::GetReadBuffer(u32 length)
+{
+  std::vector<u8> buffer;
+  m_free_buffers.Pop(buffer);
+  buffer.resize(length);
+  return buffer;
 }
 
 void DVDThread::DVDThreadMain()
@@ -342,16 +356,59 @@ void DVDThread::DVDThreadMain()
     ReadRequest request;
     while (m_request_queue.Pop(request))
     {
-      m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
-
-      std::vector<u8> buffer(request.length);
-      if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
-        buffer.resize(0);
-
-      request.realtime_done_us = Common::Timer::NowUs();
-
-      m_result_queue.Push(ReadResult(std::move(request), std::move(buffer)));
-      m_result_queue_expanded.Set();
+      TRACE_ZONE("DVD read");
+
+      // Gather the queued requests which directly follow this one
+      const u64 batch_start = request.dvd_offset;
+      u64 batch_end = request.dvd_offset + request.length;
+      m_batched_requests.clear();
+      m_batched_requests.push_back(std::move(request));
+      while (!m_request_queue.Empty())
+      {
+        ReadRequest& next = m_request_queue.Front();
+        if (next.dvd_offset != batch_end || next.partition != m_batched_requests[0].partition ||
+            batch_end + next.length - batch_start > MAX_BATCHED_READ_LENGTH)
+        {
+          break;
+        }
+
+        batch_end += next.length;
+        m_batched_requests.push_back(std::move(next));
+        m_request_queue.Pop();
+      }
+
+      bool batch_read = false;
+      if (m_batched_requests.size() > 1)
+      {
+        m_batched_read_buffer.resize(batch_end - batch_start);
+        batch_read = m_disc->Read(batch_start, m_batched_read_buffer.size(),
+                                  m_batched_read_buffer.data(), m_batched_requests[0].partition);
+      }
+
+      for (ReadRequest& batched_request : m_batched_requests)
+      {
+        m_file_logger.Log(*m_disc, batched_request.partition, batched_request.dvd_offset);
+
+        std::vector<u8> buffer = GetReadBuffer(batched_request.length);
+        if (batch_read)
+        {
+          std::memcpy(buffer.data(),
+                      m_batched_read_buffer.data() + (batched_request.dvd_offset - batch_start),
+                      batched_request.length);
+        }
+        else if (!m_disc->Read(batched_request.dvd_offset, batched_request.length, buffer.data(),
+                               batched_request.partition))
+        {
+          // Reading the requests one by one after a batched read failed means that only the
+          // requests which can't be read are reported as failed
+          buffer.resize(0);
+        }
+
+        batched_request.realtime_done_us = Common::Timer::NowUs();
+
+        m_result_queue.Push(ReadResult(std::move(batched_request), std::move(buffer)));
+        m_result_queue_expanded.Set();
+      }
 
       if (m_dvd_thread_exiting.IsSet())
         return;
@@ -99,6 +99,7 @@ private:
   void FinishRead(u64 id, s64 cycles_late);
 
   void DVDThreadMain();
+  std::vector<u8> GetReadBuffer(u32 length);
 
   struct ReadRequest
   {
@@ -126,6 +127,14 @@ private:
 
   using ReadResult = std::pair<ReadRequest, std::vector<u8>>;
 
+  // Requests which continue where the previous one ended are read from the disc at once, up to
+  // this many bytes. The emulated disc interface splits reads into 32 KiB requests, and reading
+  // them one at a time adds a lot of overhead on storage with a high latency.
+  static constexpr u32 MAX_BATCHED_READ_LENGTH = 0x100000;
+
+  // How many buffers of finished reads are kept for reuse
+  static constexpr u32 MAX_FREE_BUFFERS = 64;
+
   CoreTiming::EventType* m_finish_read = nullptr;
 
   u64 m_next_id = 0;
@@ -139,6 +148,13 @@ private:
   Common::SPSCQueue<ReadResult, false> m_result_queue;
   std::map<u64, ReadResult> m_result_map;
 
+  // Buffers of finished reads, which the CPU thread hands back to the DVD thread
+  Common::SPSCQueue<std::vector<u8>, true> m_free_buffers;
+
+  // Only used by the DVD thread
+  std::vector<ReadRequest> m_batched_requests;
+  std::vector<u8> m_batched_read_buffer;
+
   std::unique_ptr<DiscIO::Volume> m_disc;
 
   FileMonitor::FileLogger m_file_logger;
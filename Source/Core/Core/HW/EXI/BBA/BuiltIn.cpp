@@ -668,10 +668,26 @@ bool CEXIETHERNET::BuiltInBBAInterface::SendFrame(const u8* frame, u32 size)
 
 void CEXIETHERNET::BuiltInBBAInterface::ReadThreadHandler(CEXIETHERNET::BuiltInBBAInterface* self)
 {
+  bool delivered_packet = false;
+  bool socket_data_pending = false;
   while (!self->m_read_thread_shutdown.IsSet())
   {
-    // make thread less cpu hungry
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    // make thread less cpu hungry, but drain bursts of frames without waiting between them
+    if (!delivered_packet)
+    {
+      // If data that was ready last time could not be delivered (e.g. the receive ring is full),
+      // waiting on the sockets again would return immediately, so sleep instead.
+      if (socket_data_pending)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        socket_data_pending = false;
+      }
+      else
+      {
+        socket_data_pending = self->WaitForSocketData(sf::milliseconds(1));
+      }
+    }
+    delivered_packet = false;
 
     if (!self->m_read_enabled.IsSet())
       continue;
@@ -756,10 +772,40 @@ void CEXIETHERNET::BuiltInBBAInterface::ReadThreadHandler(CEXIETHERNET::BuiltInB
       }
       self->m_eth_ref->mRecvBufferLength = static_cast<u32>(datasize);
       self->m_eth_ref->RecvHandlePacket();
+      delivered_packet = true;
     }
   }
 }
 
+// Waits until one of the active connections has data or the timeout expires.
+// Returns whether any socket became ready.
+bool CEXIETHERNET::BuiltInBBAInterface::WaitForSocketData(sf::Time timeout)
+{
+  sf::SocketSelector selector;
+  bool has_sockets = false;
+  {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    for (auto& net_ref : network_ref)
+    {
+      if (net_ref.ip == 0)
+        continue;
+      if (net_ref.type == IPPROTO_TCP)
+        selector.add(net_ref.tcp_socket);
+      else
+        selector.add(net_ref.udp_socket);
+      has_sockets = true;
+    }
+  }
+
+  if (!has_sockets)
+  {
+    std::this_thread::sleep_for(std::chrono::microseconds(timeout.asMicroseconds()));
+    return false;
+  }
+
+  return selector.wait(timeout);
+}
+
 bool CEXIETHERNET::BuiltInBBAInterface::RecvInit()
 {
   m_read_thread = std::thread(ReadThreadHandler, this);
@@ -462,6 +462,7 @@ private:
     Common::Flag m_read_enabled;
     Common::Flag m_read_thread_shutdown;
     static void ReadThreadHandler(BuiltInBBAInterface* self);
+    bool WaitForSocketData(sf::Time timeout);
 #endif
     void WriteToQueue(const std::vector<u8>& data);
     StackRef* GetAvailableSlot(u16 port);
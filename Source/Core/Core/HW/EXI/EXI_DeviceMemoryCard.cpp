@@ -49,6 +49,8 @@ namespace ExpansionInterface
 
 static const u32 MC_TRANSFER_RATE_READ = 512 * 1024;
 static const auto MC_TRANSFER_RATE_WRITE = static_cast<u32>(96.125f * 1024.0f);
+// Used for both directions with MAIN_FAST_MEMCARD_SPEED.
+static const u32 MC_TRANSFER_RATE_FAST = 16 * 1024 * 1024;
 
 static Common::EnumMap<CoreTiming::EventType*, MAX_MEMCARD_SLOT> s_et_cmd_done;
 static Common::EnumMap<CoreTiming::EventType*, MAX_MEMCARD_SLOT> s_et_transfer_complete;
@@ -276,6 +278,16 @@ void CEXIMemoryCard::CmdDoneLater(u64 cycles)
   core_timing.ScheduleEvent(cycles, s_et_cmd_done[m_card_slot], static_cast<u64>(m_card_slot));
 }
 
+void CEXIMemoryCard::TransferCompleteLater(u32 size, u32 bytes_per_second)
+{
+  if (Config::Get(Config::MAIN_FAST_MEMCARD_SPEED))
+    bytes_per_second = MC_TRANSFER_RATE_FAST;
+
+  m_system.GetCoreTiming().ScheduleEvent(
+      size * (m_system.GetSystemTimers().GetTicksPerSecond() / bytes_per_second),
+      s_et_transfer_complete[m_card_slot], static_cast<u64>(m_card_slot));
+}
+
 void CEXIMemoryCard::SetCS(int cs)
 {
   if (cs)  // not-selected to selected
@@ -533,9 +545,7 @@ void CEXIMemoryCard::DMARead(u32 addr, u32 size)
   }
 
   // Schedule transfer complete later based on read speed
-  m_system.GetCoreTiming().ScheduleEvent(
-      size * (m_system.GetSystemTimers().GetTicksPerSecond() / MC_TRANSFER_RATE_READ),
-      s_et_transfer_complete[m_card_slot], static_cast<u64>(m_card_slot));
+  TransferCompleteLater(size, MC_TRANSFER_RATE_READ);
 }
 
 // DMA write are preceded by all of the necessary setup via IMMWrite
@@ -551,8 +561,6 @@ void CEXIMemoryCard::DMAWrite(u32 addr, u32 size)
   }
 
   // Schedule transfer complete later based on write speed
-  m_system.GetCoreTiming().ScheduleEvent(
-      size * (m_system.GetSystemTimers().GetTicksPerSecond() / MC_TRANSFER_RATE_WRITE),
-      s_et_transfer_complete[m_card_slot], static_cast<u64>(m_card_slot));
+  TransferCompleteLater(size, MC_TRANSFER_RATE_WRITE);
 }
 }  // namespace ExpansionInterface
@@ -85,6 +85,9 @@ private:
   // Variant of CmdDone which schedules an event later in the future to complete the command.
   void CmdDoneLater(u64 cycles);
 
+  // Schedules TransferComplete for when a DMA of the given size at the given rate is done.
+  void TransferCompleteLater(u32 size, u32 bytes_per_second);
+
   enum class Command
   {
     NintendoID = 0x00,
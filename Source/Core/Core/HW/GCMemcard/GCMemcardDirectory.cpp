@@ -267,6 +267,7 @@ void GCMemcardDirectory::FlushThread()
   }
 
   Common::SetCurrentThreadName(fmt::format("Memcard {} flushing thread", m_card_slot).c_str());
+  Common::SetCurrentThreadQoS(Common::ThreadQoS::Background);
 
   constexpr std::chrono::seconds flush_interval{1};
   while (true)
@@ -620,93 +621,124 @@ bool GCMemcardDirectory::SetUsedBlocks(int save_index)
 
 void GCMemcardDirectory::FlushToFile()
 {
-  std::unique_lock l(m_write_mutex);
-  Memcard::DEntry invalid;
-  for (Memcard::GCIFile& save : m_saves)
+  // The save data is only locked while the modified files are copied out of it, so that EXI
+  // writes never have to wait for the disk. m_flush_mutex keeps the commits in order.
+  std::lock_guard flush_lock(m_flush_mutex);
+
+  struct PendingWrite
   {
-    if (save.m_dirty)
+    std::string filename;
+    Memcard::DEntry header;
+    std::vector<Memcard::GCMBlock> blocks;
+  };
+  std::vector<PendingWrite> pending_writes;
+
+  {
+    std::unique_lock l(m_write_mutex);
+    for (Memcard::GCIFile& save : m_saves)
     {
-      if (save.m_gci_header.m_gamecode != Memcard::DEntry::UNINITIALIZED_GAMECODE)
+      if (save.m_dirty)
       {
-        save.m_dirty = false;
-        if (save.m_save_data.empty())
-        {
-          // The save's header has been changed but the actual save blocks haven't been read/written
-          // to
-          // skip flushing this file until actual save data is modified
-          ERROR_LOG_FMT(EXPANSIONINTERFACE,
-                        "GCI header modified without corresponding save data changes");
-          continue;
-        }
-        if (save.m_filename.empty())
+        if (save.m_gci_header.m_gamecode != Memcard::DEntry::UNINITIALIZED_GAMECODE)
         {
-          std::string default_save_name =
-              m_save_directory + GenerateDefaultGCIFilename(save.m_gci_header, m_hdr.IsShiftJIS());
-
-          // Check to see if another file is using the same name
-          // This seems unlikely except in the case of file corruption
-          // otherwise what user would name another file this way?
-          for (int j = 0; File::Exists(default_save_name) && j < 10; ++j)
+          save.m_dirty = false;
+          if (save.m_save_data.empty())
           {
-            default_save_name.insert(default_save_name.end() - 4, '0');
+            // The save's header has been changed but the actual save blocks haven't been
+            // read/written to
+            // skip flushing this file until actual save data is modified
+            ERROR_LOG_FMT(EXPANSIONINTERFACE,
+                          "GCI header modified without corresponding save data changes");
+            continue;
           }
-          if (File::Exists(default_save_name))
+          if (save.m_filename.empty())
           {
-            PanicAlertFmtT("Failed to find new filename.\n{0}\n will be overwritten",
-                           default_save_name);
+            std::string default_save_name =
+                m_save_directory +
+                GenerateDefaultGCIFilename(save.m_gci_header, m_hdr.IsShiftJIS());
+
+            // Check to see if another file is using the same name
+            // This seems unlikely except in the case of file corruption
+            // otherwise what user would name another file this way?
+            const auto is_name_taken = [&pending_writes](const std::string& name) {
+              return File::Exists(name) ||
+                     std::ranges::any_of(pending_writes, [&name](const PendingWrite& write) {
+                       return write.filename == name;
+                     });
+            };
+            for (int j = 0; is_name_taken(default_save_name) && j < 10; ++j)
+            {
+              default_save_name.insert(default_save_name.end() - 4, '0');
+            }
+            if (is_name_taken(default_save_name))
+            {
+              PanicAlertFmtT("Failed to find new filename.\n{0}\n will be overwritten",
+                             default_save_name);
+            }
+            save.m_filename = default_save_name;
           }
-          save.m_filename = default_save_name;
+          pending_writes.push_back({save.m_filename, save.m_gci_header, save.m_save_data});
         }
-        File::IOFile gci(save.m_filename, "wb");
-        if (gci)
+        else if (save.m_filename.length() != 0)
         {
-          gci.WriteBytes(&save.m_gci_header, Memcard::DENTRY_SIZE);
-          for (const Memcard::GCMBlock& block : save.m_save_data)
-            gci.WriteBytes(block.m_block.data(), Memcard::BLOCK_SIZE);
-
-          if (gci.IsGood())
-          {
-            Core::DisplayMessage("Wrote save contents to GCI Folder", 4000);
-          }
-          else
-          {
-            Core::DisplayMessage(
-                fmt::format("Failed to write save contents to {}", save.m_filename), 10000);
-            ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to save data to {}", save.m_filename);
-          }
-        }
-        else
-        {
-          Core::DisplayMessage(
-              fmt::format("Failed to open file at {} for writing", save.m_filename), 10000);
-          ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to open file at {} for writing",
-                        save.m_filename);
+          save.m_dirty = false;
+          std::string& old_name = save.m_filename;
+          std::string deleted_name = old_name + ".deleted";
+          if (File::Exists(deleted_name))
+            File::Delete(deleted_name);
+          File::Rename(old_name, deleted_name);
+          save.m_filename.clear();
+          save.m_save_data.clear();
+          save.m_used_blocks.clear();
         }
       }
-      else if (save.m_filename.length() != 0)
+
+      // Unload the save data for any game that is not running
+      // we could use !m_dirty, but some games have multiple gci files and may not write to them
+      // simultaneously
+      // this ensures that the save data for all of the current games gci files are stored in the
+      // savestate
+      const u32 gamecode = Common::swap32(save.m_gci_header.m_gamecode.data());
+      if (gamecode != m_game_id && gamecode != 0xFFFFFFFF && !save.m_save_data.empty())
       {
-        save.m_dirty = false;
-        std::string& old_name = save.m_filename;
-        std::string deleted_name = old_name + ".deleted";
-        if (File::Exists(deleted_name))
-          File::Delete(deleted_name);
-        File::Rename(old_name, deleted_name);
-        save.m_filename.clear();
+        INFO_LOG_FMT(EXPANSIONINTERFACE, "Flushing savedata to disk for {}", save.m_filename);
         save.m_save_data.clear();
-        save.m_used_blocks.clear();
       }
     }
+  }
 
-    // Unload the save data for any game that is not running
-    // we could use !m_dirty, but some games have multiple gci files and may not write to them
-    // simultaneously
-    // this ensures that the save data for all of the current games gci files are stored in the
-    // savestate
-    const u32 gamecode = Common::swap32(save.m_gci_header.m_gamecode.data());
-    if (gamecode != m_game_id && gamecode != 0xFFFFFFFF && !save.m_save_data.empty())
+  // Each file is written next to its destination and renamed over it once complete, so that an
+  // interrupted flush never leaves a truncated GCI file behind.
+  for (const PendingWrite& write : pending_writes)
+  {
+    const std::string temp_filename = File::GetTempFilenameForAtomicWrite(write.filename);
+    bool success = false;
+    {
+      File::IOFile gci(temp_filename, "wb");
+      if (!gci)
+      {
+        Core::DisplayMessage(
+            fmt::format("Failed to open file at {} for writing", write.filename), 10000);
+        ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to open file at {} for writing", temp_filename);
+        continue;
+      }
+
+      gci.WriteBytes(&write.header, Memcard::DENTRY_SIZE);
+      for (const Memcard::GCMBlock& block : write.blocks)
+        gci.WriteBytes(block.m_block.data(), Memcard::BLOCK_SIZE);
+      success = gci.IsGood() && gci.Close();
+    }
+
+    if (success && File::RenameSync(temp_filename, write.filename))
+    {
+      Core::DisplayMessage("Wrote save contents to GCI Folder", 4000);
+    }
+    else
     {
-      INFO_LOG_FMT(EXPANSIONINTERFACE, "Flushing savedata to disk for {}", save.m_filename);
-      save.m_save_data.clear();
+      File::Delete(temp_filename, File::IfAbsentBehavior::NoConsoleWarning);
+      Core::DisplayMessage(fmt::format("Failed to write save contents to {}", write.filename),
+                           10000);
+      ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to save data to {}", write.filename);
     }
   }
 #if _WRITE_MC_HEADER
@@ -100,6 +100,7 @@ void MemoryCard::FlushThread()
   }
 
   Common::SetCurrentThreadName(fmt::format("Memcard {} flushing thread", m_card_slot).c_str());
+  Common::SetCurrentThreadQoS(Common::ThreadQoS::Background);
 
   const auto flush_interval = std::chrono::seconds(15);
 
@@ -18,6 +18,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemArena.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
@@ -200,6 +201,9 @@ bool MemoryManager::InitFastmemArena()
   constexpr size_t guard_size = 0x8000'0000;
   constexpr size_t memory_size = ppc_view_size * 2 + guard_size * 3;
 
+  std::lock_guard lock(m_write_tracking_mutex);
+  ResetWriteTracking();
+
   m_fastmem_arena = m_arena.ReserveMemoryRegion(memory_size);
   if (!m_fastmem_arena)
   {
@@ -234,6 +238,10 @@ bool MemoryManager::InitFastmemArena()
 
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  // The new views aren't write-protected, so tracking has to start over.
+  std::lock_guard lock(m_write_tracking_mutex);
+  ResetWriteTracking();
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -278,7 +286,7 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
                   intersection_start, mapped_size, logical_address);
               exit(0);
             }
-            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size});
+            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size, intersection_start});
           }
 
           m_logical_page_mappings[i] =
@@ -340,6 +348,7 @@ void MemoryManager::DoState(PointerWrap& p)
 
 void MemoryManager::Shutdown()
 {
+  DisableWriteTracking();
   ShutdownFastmemArena();
 
   m_is_initialized = false;
@@ -361,6 +370,9 @@ void MemoryManager::ShutdownFastmemArena()
   if (!m_is_fastmem_arena_initialized)
     return;
 
+  std::lock_guard lock(m_write_tracking_mutex);
+  ResetWriteTracking();
+
   for (const PhysicalMemoryRegion& region : m_physical_regions)
   {
     if (!region.active)
@@ -386,6 +398,240 @@ void MemoryManager::ShutdownFastmemArena()
   m_is_fastmem_arena_initialized = false;
 }
 
+void MemoryManager::EnableWriteTracking()
+{
+#ifndef __APPLE__
+  std::lock_guard lock(m_write_tracking_mutex);
+  const u32 exram_size = m_exram ? GetExRamSize() : 0;
+  m_write_tracking_stamps.assign((GetRamSize() + exram_size) / WRITE_TRACKING_PAGE_SIZE, 0);
+  m_write_tracking_enabled = true;
+#endif
+}
+
+void MemoryManager::DisableWriteTracking()
+{
+  std::lock_guard lock(m_write_tracking_mutex);
+  ResetWriteTracking();
+  m_write_tracking_stamps.clear();
+  m_write_tracking_enabled = false;
+}
+
+bool MemoryManager::IsWriteTrackingEnabled() const
+{
+  return m_write_tracking_enabled;
+}
+
+u64 MemoryManager::TrackWrites(const u8* ptr, size_t size)
+{
+  std::lock_guard lock(m_write_tracking_mutex);
+  if (!m_write_tracking_enabled)
+    return 0;
+
+  const std::optional<std::pair<u32, u32>> pages = GetWriteTrackingPages(ptr, size);
+  if (!pages)
+    return 0;
+
+  // Pages which are already tracked keep their older stamp, as they haven't been written since.
+  // The untracked ones are protected in as few calls as possible.
+  const u64 stamp = ++m_write_tracking_stamp;
+  u32 run_start = pages->first;
+  for (u32 page = pages->first; page <= pages->second; page++)
+  {
+    if (m_write_tracking_stamps[page] != 0)
+    {
+      if (page > run_start)
+        SetWriteTrackingProtection(run_start, page - run_start, true);
+      run_start = page + 1;
+      continue;
+    }
+
+    m_write_tracking_stamps[page] = stamp;
+  }
+  if (pages->second >= run_start)
+    SetWriteTrackingProtection(run_start, pages->second - run_start + 1, true);
+
+  return stamp;
+}
+
+bool MemoryManager::IsUnmodifiedSince(const u8* ptr, size_t size, u64 stamp)
+{
+  if (stamp == 0)
+    return false;
+
+  std::lock_guard lock(m_write_tracking_mutex);
+  if (!m_write_tracking_enabled)
+    return false;
+
+  const std::optional<std::pair<u32, u32>> pages = GetWriteTrackingPages(ptr, size);
+  if (!pages)
+    return false;
+
+  for (u32 page = pages->first; page <= pages->second; page++)
+  {
+    // Pages which were written are untracked, or tracked again with a newer stamp.
+    const u64 page_stamp = m_write_tracking_stamps[page];
+    if (page_stamp == 0 || page_stamp > stamp)
+      return false;
+  }
+
+  return true;
+}
+
+bool MemoryManager::HandleWriteTrackingFault(uintptr_t fault_address)
+{
+  std::lock_guard lock(m_write_tracking_mutex);
+  const std::optional<u32> page = GetWriteTrackingPage(reinterpret_cast<const u8*>(fault_address));
+  if (!page)
+    return false;
+
+  if (*page < m_write_tracking_stamps.size() && m_write_tracking_stamps[*page] != 0)
+  {
+    m_write_tracking_stamps[*page] = 0;
+    SetWriteTrackingProtection(*page, 1, false);
+  }
+
+  // Views of RAM are always writable otherwise. If the page isn't tracked, another thread has
+  // already unprotected it, and the write can simply be retried.
+  return true;
+}
+
+std::optional<u32> MemoryManager::GetWriteTrackingPage(const u8* host_address) const
+{
+  if (m_ram && host_address >= m_ram && host_address < m_ram + GetRamSize())
+    return static_cast<u32>(host_address - m_ram) / WRITE_TRACKING_PAGE_SIZE;
+
+  if (m_exram && host_address >= m_exram && host_address < m_exram + GetExRamSize())
+    return (GetRamSize() + static_cast<u32>(host_address - m_exram)) / WRITE_TRACKING_PAGE_SIZE;
+
+  if (!m_is_fastmem_arena_initialized)
+    return std::nullopt;
+
+  if (host_address >= m_physical_base && host_address < m_physical_base + 0x1'0000'0000)
+    return GetWriteTrackingPageForPhysicalAddress(static_cast<u32>(host_address - m_physical_base));
+
+  for (const LogicalMemoryView& view : m_logical_mapped_entries)
+  {
+    const u8* mapped_pointer = static_cast<const u8*>(view.mapped_pointer);
+    if (host_address >= mapped_pointer && host_address < mapped_pointer + view.mapped_size)
+    {
+      return GetWriteTrackingPageForPhysicalAddress(
+          view.physical_address + static_cast<u32>(host_address - mapped_pointer));
+    }
+  }
+
+  return std::nullopt;
+}
+
+std::optional<u32> MemoryManager::GetWriteTrackingPageForPhysicalAddress(u32 address) const
+{
+  if (m_ram && address < GetRamSize())
+    return address / WRITE_TRACKING_PAGE_SIZE;
+
+  if (m_exram && address >= 0x10000000 && address - 0x10000000 < GetExRamSize())
+    return (GetRamSize() + address - 0x10000000) / WRITE_TRACKING_PAGE_SIZE;
+
+  return std::nullopt;
+}
+
+std::optional<std::pair<u32, u32>> MemoryManager::GetWriteTrackingPages(const u8* ptr,
+                                                                       size_t size) const
+{
+  if (size == 0)
+    return std::nullopt;
+
+  // Only ranges within one of the views used by hardware outside the CPU can be tracked.
+  const auto get_pages = [&](const u8* base, u32 view_size,
+                             u32 first_page) -> std::optional<std::pair<u32, u32>> {
+    const size_t offset = static_cast<size_t>(ptr - base);
+    if (size > view_size - offset)
+      return std::nullopt;
+
+    return std::make_pair(first_page + static_cast<u32>(offset / WRITE_TRACKING_PAGE_SIZE),
+                          first_page +
+                              static_cast<u32>((offset + size - 1) / WRITE_TRACKING_PAGE_SIZE));
+  };
+
+  if (m_ram && ptr >= m_ram && ptr < m_ram + GetRamSize())
+    return get_pages(m_ram, GetRamSize(), 0);
+
+  if (m_exram && ptr >= m_exram && ptr < m_exram + GetExRamSize())
+    return get_pages(m_exram, GetExRamSize(), GetRamSize() / WRITE_TRACKING_PAGE_SIZE);
+
+  return std::nullopt;
+}
+
+void MemoryManager::SetWriteTrackingProtection(u32 first_page, u32 page_count, bool write_protect)
+{
+  const u32 ram_page_count = GetRamSize() / WRITE_TRACKING_PAGE_SIZE;
+  u8* host_pointer;
+  u32 physical_address;
+  if (first_page < ram_page_count)
+  {
+    physical_address = first_page * WRITE_TRACKING_PAGE_SIZE;
+    host_pointer = m_ram + physical_address;
+  }
+  else
+  {
+    const u32 offset = (first_page - ram_page_count) * WRITE_TRACKING_PAGE_SIZE;
+    physical_address = 0x10000000 + offset;
+    host_pointer = m_exram + offset;
+  }
+
+  const u32 size = page_count * WRITE_TRACKING_PAGE_SIZE;
+  const auto set_protection = [write_protect](void* ptr, size_t protect_size) {
+    if (write_protect)
+      Common::WriteProtectMemory(ptr, protect_size);
+    else
+      Common::UnWriteProtectMemory(ptr, protect_size);
+  };
+
+  set_protection(host_pointer, size);
+  if (!m_is_fastmem_arena_initialized)
+    return;
+
+  set_protection(m_physical_base + physical_address, size);
+  for (const LogicalMemoryView& view : m_logical_mapped_entries)
+  {
+    const u32 start = std::max(physical_address, view.physical_address);
+    const u32 end = std::min(physical_address + size, view.physical_address + view.mapped_size);
+    if (start < end)
+    {
+      set_protection(static_cast<u8*>(view.mapped_pointer) + (start - view.physical_address),
+                     end - start);
+    }
+  }
+}
+
+void MemoryManager::ResetWriteTracking()
+{
+  // Must be called with m_write_tracking_mutex held.
+  const u32 page_count = static_cast<u32>(m_write_tracking_stamps.size());
+  const u32 ram_page_count = GetRamSize() / WRITE_TRACKING_PAGE_SIZE;
+  u32 run_length = 0;
+  for (u32 page = 0; page < page_count; page++)
+  {
+    // The EXRAM view doesn't follow the MEM1 view, so runs can't continue across them.
+    if (page == ram_page_count && run_length != 0)
+    {
+      SetWriteTrackingProtection(page - run_length, run_length, false);
+      run_length = 0;
+    }
+
+    if (m_write_tracking_stamps[page] != 0)
+    {
+      m_write_tracking_stamps[page] = 0;
+      run_length++;
+    }
+    else if (run_length != 0)
+    {
+      SetWriteTrackingProtection(page - run_length, run_length, false);
+      run_length = 0;
+    }
+  }
+  if (run_length != 0)
+    SetWriteTrackingProtection(page_count - run_length, run_length, false);
+}
+
 void MemoryManager::Clear()
 {
   if (m_ram)
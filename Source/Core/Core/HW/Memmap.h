@@ -4,8 +4,12 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -53,6 +57,7 @@ struct LogicalMemoryView
 {
   void* mapped_pointer;
   u32 mapped_size;
+  u32 physical_address;
 };
 
 class MemoryManager
@@ -102,6 +107,23 @@ public:
 
   void Clear();
 
+  // Write tracking of RAM and EXRAM, so that users like the texture cache can tell whether memory
+  // was modified without hashing it. Tracked pages are write-protected in every view of the memory,
+  // and the exception handler unprotects them again on the first write. Only usable while the
+  // exception handler is installed, and not on macOS, where it only runs on the CPU thread.
+  static constexpr u32 WRITE_TRACKING_PAGE_SIZE = 0x4000;
+  void EnableWriteTracking();
+  void DisableWriteTracking();
+  bool IsWriteTrackingEnabled() const;
+  // Starts tracking the pages covering a range of RAM or EXRAM. Returns a stamp to pass to
+  // IsUnmodifiedSince, or 0 if the range can't be tracked.
+  u64 TrackWrites(const u8* ptr, size_t size);
+  // Returns true if the range wasn't written to after TrackWrites returned the stamp.
+  bool IsUnmodifiedSince(const u8* ptr, size_t size, u64 stamp);
+  // Called by the exception handler. Returns true if the fault was a write to a tracked view of RAM
+  // and can be retried, after the page has stopped being tracked.
+  bool HandleWriteTrackingFault(uintptr_t fault_address);
+
   // Routines to access physically addressed memory, designed for use by
   // emulated hardware outside the CPU. Use "Device_" prefix.
   std::string GetString(u32 em_address, size_t size = 0);
@@ -245,8 +267,22 @@ private:
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_physical_page_mappings{};
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_logical_page_mappings{};
 
+  // Write tracking state, indexed by page. MEM1 pages are followed by EXRAM pages. A page is
+  // write-protected while its stamp is non-zero.
+  std::vector<u64> m_write_tracking_stamps;
+  u64 m_write_tracking_stamp = 0;
+  std::atomic<bool> m_write_tracking_enabled = false;
+  // Also protects m_logical_mapped_entries, which the exception handler reads.
+  std::mutex m_write_tracking_mutex;
+
   Core::System& m_system;
 
   void InitMMIO(bool is_wii);
+
+  std::optional<u32> GetWriteTrackingPage(const u8* host_address) const;
+  std::optional<u32> GetWriteTrackingPageForPhysicalAddress(u32 address) const;
+  std::optional<std::pair<u32, u32>> GetWriteTrackingPages(const u8* ptr, size_t size) const;
+  void SetWriteTrackingProtection(u32 first_page, u32 page_count, bool write_protect);
+  void ResetWriteTracking();
 };
 }  // namespace Memory
@@ -7,8 +7,10 @@
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/GBACore.h"
@@ -17,25 +19,36 @@
 #include "Core/HW/SI/SI_DeviceGCController.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/Host.h"
+#include "Core/Movie.h"
 #include "Core/NetPlayProto.h"
 #include "Core/System.h"
 
 namespace SerialInterface
 {
-static s64 GetSyncInterval(const SystemTimers::SystemTimersManager& timers)
+static s64 GetSyncInterval(Core::System& system)
 {
-  return timers.GetTicksPerSecond() / 1000;
+  const u64 ticks_per_second = system.GetSystemTimers().GetTicksPerSecond();
+
+  // Relaxed sync lets threaded cores run in frame-sized slices between joybus commands instead of
+  // waking up every millisecond. Commands are still run at their exact GC timestamp, but the
+  // slicing affects rounding of the GBA clock, so it is not used when determinism is required.
+  if (Config::Get(Config::MAIN_GBA_RELAXED_SYNC) && Config::Get(Config::MAIN_GBA_THREADS) &&
+      !NetPlay::IsNetPlayRunning() && !system.GetMovie().IsMovieActive())
+  {
+    return ticks_per_second / 60;
+  }
+
+  return ticks_per_second / 1000;
 }
 
 CSIDevice_GBAEmu::CSIDevice_GBAEmu(Core::System& system, SIDevices device, int device_number)
-    : ISIDevice(system, device, device_number)
+    : ISIDevice(system, device, device_number), m_sync_interval(GetSyncInterval(system))
 {
   m_core = std::make_shared<HW::GBA::Core>(system, m_device_number);
   m_core->Start(system.GetCoreTiming().GetTicks());
   m_gbahost = Host_CreateGBAHost(m_core);
   m_core->SetHost(m_gbahost);
-  system.GetSerialInterface().ScheduleEvent(m_device_number,
-                                            GetSyncInterval(system.GetSystemTimers()));
+  system.GetSerialInterface().ScheduleEvent(m_device_number, m_sync_interval);
 }
 
 CSIDevice_GBAEmu::~CSIDevice_GBAEmu()
@@ -62,8 +75,7 @@ int CSIDevice_GBAEmu::RunBuffer(u8* buffer, int request_length)
 
     auto& si = m_system.GetSerialInterface();
     si.RemoveEvent(m_device_number);
-    si.ScheduleEvent(m_device_number,
-                     TransferInterval() + GetSyncInterval(m_system.GetSystemTimers()));
+    si.ScheduleEvent(m_device_number, TransferInterval() + m_sync_interval);
     for (int i = 0; i < MAX_SI_CHANNELS; ++i)
     {
       if (i == m_device_number || si.GetDeviceType(i) != GetDeviceType())
@@ -169,7 +181,7 @@ void CSIDevice_GBAEmu::OnEvent(u64 userdata, s64 cycles_late)
 {
   m_core->SendJoybusCommand(m_system.GetCoreTiming().GetTicks() + userdata, 0, nullptr, m_keys);
 
-  const auto num_cycles = userdata + GetSyncInterval(m_system.GetSystemTimers());
+  const auto num_cycles = userdata + m_sync_interval;
   m_system.GetSerialInterface().ScheduleEvent(m_device_number, num_cycles);
 }
 }  // namespace SerialInterface
@@ -85,6 +85,9 @@ void VideoInterfaceManager::DoState(PointerWrap& p)
   p.Do(m_odd_field_first_hl);
   p.Do(m_even_field_last_hl);
   p.Do(m_odd_field_last_hl);
+
+  if (p.IsReadMode())
+    m_next_scanout_slice_hl = 0;
 }
 
 // Executed after Init, before game boot
@@ -828,10 +831,33 @@ void VideoInterfaceManager::BeginField(FieldType field, u64 ticks)
   // going to change the VI registers while a frame is scanning out.
   if (Config::Get(Config::GFX_HACK_EARLY_XFB_OUTPUT))
     OutputField(field, ticks);
+
+  // Optionally split the scanout into slices and output the field again as each slice finishes.
+  // If the game writes to the XFB while it is being scanned out, a high refresh rate display then
+  // shows those writes a slice at a time instead of a whole field later.
+  const int slices = std::clamp(Config::Get(Config::GFX_HACK_XFB_SCANOUT_SLICES), 1, 16);
+  const u32 first_hl = field == FieldType::Even ? m_even_field_first_hl : m_odd_field_first_hl;
+  const u32 last_hl = field == FieldType::Even ? m_even_field_last_hl : m_odd_field_last_hl;
+  m_next_scanout_slice_hl = 0;
+  if (slices > 1 && last_hl > first_hl)
+  {
+    m_scanout_slice_field = field;
+    m_scanout_slice_half_lines = std::max((last_hl - first_hl) / static_cast<u32>(slices), 1u);
+    m_next_scanout_slice_hl = first_hl + m_scanout_slice_half_lines;
+  }
+}
+
+void VideoInterfaceManager::OutputScanoutSlice(u64 ticks)
+{
+  OutputField(m_scanout_slice_field, ticks);
+  m_next_scanout_slice_hl += m_scanout_slice_half_lines;
 }
 
 void VideoInterfaceManager::EndField(FieldType field, u64 ticks)
 {
+  // The last slice ends with the field itself.
+  m_next_scanout_slice_hl = 0;
+
   // If the game does change VI registers while a frame is scanning out, we can defer output
   // until the end so the last register values are used. This still isn't accurate, but it does
   // produce more acceptable results in some problematic cases.
@@ -874,6 +900,10 @@ void VideoInterfaceManager::Update(u64 ticks)
   {
     EndField(FieldType::Odd, ticks);
   }
+  else if (m_half_line_count == m_next_scanout_slice_hl && m_next_scanout_slice_hl != 0)
+  {
+    OutputScanoutSlice(ticks);
+  }
 
   // If this half-line is at a field boundary, deal with frame stepping before potentially
   // dealing with SI polls, but after potentially sending a swap request to the GPU thread
@@ -887,6 +917,7 @@ void VideoInterfaceManager::Update(u64 ticks)
   {
     Core::UpdateInputGate(!Config::Get(Config::MAIN_INPUT_BACKGROUND_INPUT),
                           Config::Get(Config::MAIN_LOCK_CURSOR));
+    m_system.GetCoreTiming().ThrottleForInput();
     auto& si = m_system.GetSerialInterface();
     si.UpdateDevices();
     m_half_line_of_next_si_poll += 2 * si.GetPollXLines();
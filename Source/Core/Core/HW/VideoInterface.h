@@ -406,6 +406,7 @@ private:
   void OutputField(FieldType field, u64 ticks);
   void BeginField(FieldType field, u64 ticks);
   void EndField(FieldType field, u64 ticks);
+  void OutputScanoutSlice(u64 ticks);
 
   // Registers listed in order:
   UVIVerticalTimingRegister m_vertical_timing_register;
@@ -447,6 +448,12 @@ private:
   u32 m_even_field_last_hl = 0;   // index last halfline of the even field
   u32 m_odd_field_last_hl = 0;    // index last halfline of the odd field
 
+  // Scanout slices of the field currently being scanned out, see BeginField. These aren't part of
+  // savestates, as they only affect when frames are presented.
+  FieldType m_scanout_slice_field{};
+  u32 m_scanout_slice_half_lines = 0;
+  u32 m_next_scanout_slice_hl = 0;  // 0 if there are no more slices in this field
+
   Core::System& m_system;
 };
 }  // namespace VideoInterface
@@ -18,6 +18,7 @@ namespace WiimoteEmu
 void CameraLogic::Reset()
 {
   m_reg_data = {};
+  m_camera_data_valid = false;
 
   m_is_enabled = false;
 }
@@ -26,6 +27,9 @@ void CameraLogic::DoState(PointerWrap& p)
 {
   p.Do(m_reg_data);
 
+  if (p.IsReadMode())
+    m_camera_data_valid = false;
+
   // FYI: m_is_enabled is handled elsewhere.
 }
 
@@ -48,6 +52,8 @@ int CameraLogic::BusWrite(u8 slave_addr, u8 addr, int count, const u8* data_in)
   if (!m_is_enabled)
     return 0;
 
+  m_camera_data_valid = false;
+
   return RawWrite(&m_reg_data, addr, count, data_in);
 }
 
@@ -99,6 +105,13 @@ CameraLogic::GetCameraPoints(const Common::Matrix44& transform, Common::Vec2 fie
 
 void CameraLogic::Update(const std::array<CameraPoint, NUM_POINTS>& camera_points)
 {
+  // Nothing that camera_data depends on has changed.
+  if (m_camera_data_valid && camera_points == m_last_camera_points)
+    return;
+
+  m_last_camera_points = camera_points;
+  m_camera_data_valid = true;
+
   // IR data is read from offset 0x37 on real hardware.
   auto& data = m_reg_data.camera_data;
   data.fill(0xff);
@@ -182,6 +182,11 @@ private:
 
   Register m_reg_data{};
 
+  // Points that camera_data was last built from.
+  // Invalidated by register writes since those may change the mode or the data itself.
+  std::array<CameraPoint, NUM_POINTS> m_last_camera_points{};
+  bool m_camera_data_valid = false;
+
   // When disabled the camera does not respond on the bus.
   // Change is triggered by wiimote report 0x13.
   bool m_is_enabled = false;
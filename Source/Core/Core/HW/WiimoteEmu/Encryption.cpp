@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <bit>
+#include <cstring>
 
 #include "Common/Logging/Log.h"
 namespace
@@ -453,6 +454,33 @@ constexpr std::array<SBox, 8> sboxes_3rd_party = {{
     },
 }};
 
+// The key tables repeat every 8 bytes, so payloads are processed a u64 at a time with each
+// byte treated as an independent lane.
+constexpr u64 LANE_HIGH_BITS = 0x8080808080808080;
+
+// The 8 table entries starting at table[offset], wrapping around.
+u64 GetKeystream(const std::array<u8, 8>& table, u32 offset)
+{
+  std::array<u8, 16> doubled;
+  std::copy(table.begin(), table.end(), doubled.begin());
+  std::copy(table.begin(), table.end(), doubled.begin() + 8);
+
+  u64 result;
+  std::memcpy(&result, doubled.data() + offset, sizeof(result));
+  return result;
+}
+
+// Per-byte addition and subtraction without carries crossing into neighbouring lanes.
+constexpr u64 AddLanes(u64 x, u64 y)
+{
+  return ((x & ~LANE_HIGH_BITS) + (y & ~LANE_HIGH_BITS)) ^ ((x ^ y) & LANE_HIGH_BITS);
+}
+
+constexpr u64 SubtractLanes(u64 x, u64 y)
+{
+  return ((x | LANE_HIGH_BITS) - (y & ~LANE_HIGH_BITS)) ^ ((x ^ ~y) & LANE_HIGH_BITS);
+}
+
 }  // namespace
 
 namespace WiimoteEmu
@@ -608,13 +636,37 @@ EncryptionKey KeyGen3rdParty::GenerateFallbackTables(const EncryptionKey::RandDa
 
 void EncryptionKey::Encrypt(u8* const data, u32 addr, const u32 len) const
 {
-  for (u32 i = 0; i != len; ++i, ++addr)
+  const u64 ft_stream = GetKeystream(ft, addr % 8);
+  const u64 sb_stream = GetKeystream(sb, addr % 8);
+
+  u32 i = 0;
+  for (; i + sizeof(u64) <= len; i += sizeof(u64))
+  {
+    u64 value;
+    std::memcpy(&value, data + i, sizeof(value));
+    value = SubtractLanes(value, ft_stream) ^ sb_stream;
+    std::memcpy(data + i, &value, sizeof(value));
+  }
+
+  for (addr += i; i != len; ++i, ++addr)
     data[i] = (data[i] - ft[addr % 8]) ^ sb[addr % 8];
 }
 
 void EncryptionKey::Decrypt(u8* const data, u32 addr, const u32 len) const
 {
-  for (u32 i = 0; i != len; ++i, ++addr)
+  const u64 ft_stream = GetKeystream(ft, addr % 8);
+  const u64 sb_stream = GetKeystream(sb, addr % 8);
+
+  u32 i = 0;
+  for (; i + sizeof(u64) <= len; i += sizeof(u64))
+  {
+    u64 value;
+    std::memcpy(&value, data + i, sizeof(value));
+    value = AddLanes(value ^ sb_stream, ft_stream);
+    std::memcpy(data + i, &value, sizeof(value));
+  }
+
+  for (addr += i; i != len; ++i, ++addr)
     data[i] = (data[i] ^ sb[addr % 8]) + ft[addr % 8];
 }
 
@@ -508,10 +508,20 @@ void Wiimote::BuildDesiredWiimoteState(DesiredWiimoteState* target_state,
   }
   else if (sensor_bar_state == SensorBarState::Enabled)
   {
-    target_state->camera_points = CameraLogic::GetCameraPoints(
-        GetTotalTransformation(),
-        Common::Vec2(m_fov_x_setting.GetValue(), m_fov_y_setting.GetValue()) / 360 *
-            float(MathUtil::TAU));
+    const auto transform = GetTotalTransformation();
+    const auto fov = Common::Vec2(m_fov_x_setting.GetValue(), m_fov_y_setting.GetValue()) / 360 *
+                     float(MathUtil::TAU);
+
+    if (!m_camera_points_valid || fov != m_camera_points_fov ||
+        transform.data != m_camera_points_transform.data)
+    {
+      m_camera_points = CameraLogic::GetCameraPoints(transform, fov);
+      m_camera_points_transform = transform;
+      m_camera_points_fov = fov;
+      m_camera_points_valid = true;
+    }
+
+    target_state->camera_points = m_camera_points;
   }
   else
   {
@@ -352,6 +352,13 @@ private:
 
   IMUCursorState m_imu_cursor_state;
 
+  // The camera projection only depends on the pointing transformation and FOV.
+  // These stay identical while the remote is held still so the last result is reused.
+  Common::Matrix44 m_camera_points_transform{};
+  Common::Vec2 m_camera_points_fov{};
+  std::array<CameraPoint, CameraLogic::NUM_POINTS> m_camera_points{};
+  bool m_camera_points_valid = false;
+
   Config::ConfigChangedCallbackID m_config_changed_callback_id;
 };
 }  // namespace WiimoteEmu
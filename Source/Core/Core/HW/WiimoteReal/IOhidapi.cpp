@@ -121,7 +121,9 @@ bool WiimoteHidapi::IsConnected() const
 
 int WiimoteHidapi::IORead(u8* buf)
 {
-  int timeout = 200;  // ms
+  // hidapi reads can't be woken up, so only block while there is nothing left to write.
+  // Otherwise bursts of output reports (e.g. speaker data) would be sent one per input report.
+  const int timeout = HasQueuedWrites() ? 0 : 200;  // ms
   int result = hid_read_timeout(m_handle, buf + 1, MAX_PAYLOAD - 1, timeout);
   // TODO: If and once we use hidapi across plaforms, change our internal API to clean up this mess.
   if (result == -1)
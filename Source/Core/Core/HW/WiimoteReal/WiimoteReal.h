@@ -107,6 +107,10 @@ protected:
 
   u8 m_bt_device_index = 0;
 
+  // For backends whose reads can't be interrupted by IOWakeup, so that queued output reports
+  // aren't held back by a blocking read.
+  bool HasQueuedWrites() const { return !m_write_reports.Empty(); }
+
 private:
   void Read();
   bool Write();
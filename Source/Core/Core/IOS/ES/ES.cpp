@@ -525,6 +525,10 @@ void ESDevice::DoState(PointerWrap& p)
     context.DoState(p);
 
   p.Do(m_pending_ppc_boot_content_path);
+
+  // Loading a state can restore a different NAND.
+  if (p.IsReadMode())
+    m_core.InvalidateTitleMetadataCache();
 }
 
 ESDevice::ContextArray::iterator ESDevice::FindActiveContext(s32 fd)
@@ -844,6 +848,7 @@ ReturnCode ESDevice::DIVerify(const ES::TMDReader& tmd, const ES::TicketReader&
   const auto fs = GetEmulationKernel().GetFS();
   if (!m_core.FindInstalledTMD(tmd.GetTitleId()).IsValid())
   {
+    m_core.InvalidateTitleMetadataCache();
     if (const ReturnCode ret = WriteTmdForDiVerify(fs.get(), tmd))
     {
       ERROR_LOG_FMT(IOS_ES, "DiVerify failed to write disc TMD to NAND.");
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -198,6 +199,8 @@ private:
 
   std::string GetContentPath(u64 title_id, const ES::Content& content, Ticks ticks = {}) const;
 
+  ES::TicketReader ReadSignedTicket(u64 title_id, std::optional<u8> desired_version) const;
+
   bool IsActiveTitlePermittedByTicket(const u8* ticket_view) const;
 
   bool IsIssuerCorrect(VerifyContainerType type, const ES::CertReader& issuer_cert) const;
@@ -207,6 +210,9 @@ private:
   ReturnCode CheckStreamKeyPermissions(u32 uid, const u8* ticket_view,
                                        const ES::TMDReader& tmd) const;
 
+  // Must be called whenever ES modifies installed TMDs or tickets.
+  void InvalidateTitleMetadataCache();
+
   struct OpenedContent
   {
     bool m_opened = false;
@@ -223,6 +229,13 @@ private:
 
   TitleContext m_title_context{};
 
+  // Parsed installed TMDs and tickets (including missing ones), keyed by title ID.
+  // The System Menu and many channels query these constantly. Only ES writes title metadata
+  // while emulation is running, so the cache is cleared whenever ES itself modifies it.
+  mutable std::mutex m_title_metadata_cache_lock;
+  mutable std::map<u64, ES::TMDReader> m_installed_tmd_cache;
+  mutable std::map<u64, ES::TicketReader> m_ticket_cache;
+
   friend class ESDevice;
 };
 
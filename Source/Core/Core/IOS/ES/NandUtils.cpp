@@ -46,10 +46,47 @@ ES::TMDReader ESCore::FindImportTMD(u64 title_id, Ticks ticks) const
 
 ES::TMDReader ESCore::FindInstalledTMD(u64 title_id, Ticks ticks) const
 {
-  return FindTMD(m_ios.GetFSCore(), Common::GetTMDFileName(title_id), ticks);
+  std::lock_guard lock(m_title_metadata_cache_lock);
+
+  // Timed lookups always go through FS so that the emulated cost of the read is preserved.
+  if (!ticks.IsTracked())
+  {
+    const auto it = m_installed_tmd_cache.find(title_id);
+    if (it != m_installed_tmd_cache.end())
+      return it->second;
+  }
+
+  ES::TMDReader tmd = FindTMD(m_ios.GetFSCore(), Common::GetTMDFileName(title_id), ticks);
+  m_installed_tmd_cache.insert_or_assign(title_id, tmd);
+  return tmd;
 }
 
 ES::TicketReader ESCore::FindSignedTicket(u64 title_id, std::optional<u8> desired_version) const
+{
+  // Only lookups of the default ticket are cached.
+  if (!desired_version)
+  {
+    std::lock_guard lock(m_title_metadata_cache_lock);
+    const auto it = m_ticket_cache.find(title_id);
+    if (it != m_ticket_cache.end())
+      return it->second;
+
+    ES::TicketReader ticket = ReadSignedTicket(title_id, desired_version);
+    m_ticket_cache.emplace(title_id, ticket);
+    return ticket;
+  }
+
+  return ReadSignedTicket(title_id, desired_version);
+}
+
+void ESCore::InvalidateTitleMetadataCache()
+{
+  std::lock_guard lock(m_title_metadata_cache_lock);
+  m_installed_tmd_cache.clear();
+  m_ticket_cache.clear();
+}
+
+ES::TicketReader ESCore::ReadSignedTicket(u64 title_id, std::optional<u8> desired_version) const
 {
   std::string path = desired_version == 1 ? Common::GetV1TicketFileName(title_id) :
                                             Common::GetTicketFileName(title_id);
@@ -291,6 +328,9 @@ bool ESCore::CreateTitleDirectories(u64 title_id, u16 group_id) const
 
 bool ESCore::InitImport(const ES::TMDReader& tmd)
 {
+  // The installed content directory (and its TMD) may be moved to /import below.
+  InvalidateTitleMetadataCache();
+
   if (!CreateTitleDirectories(tmd.GetTitleId(), tmd.GetGroupId()))
     return false;
 
@@ -345,6 +385,7 @@ bool ESCore::FinishImport(const ES::TMDReader& tmd)
   }
 
   const std::string content_dir = Common::GetTitleContentPath(title_id);
+  InvalidateTitleMetadataCache();
   if (fs->Rename(PID_KERNEL, PID_KERNEL, import_content_dir, content_dir) !=
       FS::ResultCode::Success)
   {
@@ -86,6 +86,7 @@ ReturnCode ESCore::ImportTicket(const std::vector<u8>& ticket_bytes,
       return verify_ret;
   }
 
+  InvalidateTitleMetadataCache();
   const ReturnCode write_ret = WriteTicket(m_ios.GetFS().get(), ticket);
   if (write_ret != IPC_SUCCESS)
     return write_ret;
@@ -559,6 +560,7 @@ ReturnCode ESCore::DeleteTitle(u64 title_id)
     return ES_EINVAL;
 
   const std::string title_dir = Common::GetTitlePath(title_id);
+  InvalidateTitleMetadataCache();
   return FS::ConvertResult(m_ios.GetFS()->Delete(PID_KERNEL, PID_KERNEL, title_dir));
 }
 
@@ -592,6 +594,7 @@ ReturnCode ESCore::DeleteTicket(const u8* ticket_view)
 
   const u64 ticket_id = Common::swap64(ticket_view + offsetof(ES::TicketView, ticket_id));
   ticket.DeleteTicket(ticket_id);
+  InvalidateTitleMetadataCache();
 
   const std::vector<u8>& new_ticket = ticket.GetBytes();
 
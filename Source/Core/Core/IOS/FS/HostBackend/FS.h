@@ -76,12 +76,35 @@ private:
     std::vector<FstEntry> children;
   };
 
+  /// A host file shared by all handles that opened the same path.
+  ///
+  /// The size and stdio stream position are tracked here so that sequential accesses
+  /// don't need to query or seek the host file. Seeking discards the stdio buffer, which
+  /// would turn every small guest read or write into separate host I/O calls.
+  struct HostFile
+  {
+    enum class Access
+    {
+      None,
+      Read,
+      Write,
+    };
+
+    /// Moves the stream to offset if required before an access of the given type.
+    bool PrepareAccess(u64 offset, Access access);
+
+    File::IOFile file;
+    u64 size = 0;
+    u64 position = 0;
+    Access last_access = Access::None;
+  };
+
   struct Handle
   {
     bool opened = false;
     Mode mode = Mode::None;
     std::string wii_path;
-    std::shared_ptr<File::IOFile> host_file;
+    std::shared_ptr<HostFile> host_file;
     u32 file_offset = 0;
   };
   Handle* AssignFreeHandle();
@@ -94,7 +117,7 @@ private:
     bool is_redirect;
   };
   HostFilename BuildFilename(const std::string& wii_path) const;
-  std::shared_ptr<File::IOFile> OpenHostFile(const std::string& host_path);
+  std::shared_ptr<HostFile> OpenHostFile(const std::string& host_path);
 
   ResultCode CreateFileOrDirectory(Uid uid, Gid gid, const std::string& path,
                                    FileAttribute attribute, Modes modes, bool is_file);
@@ -120,7 +143,7 @@ private:
   /// filesystem root manually.
   FstEntry m_root_entry{};
   std::string m_root_path;
-  std::map<std::string, std::weak_ptr<File::IOFile>> m_open_files;
+  std::map<std::string, std::weak_ptr<HostFile>> m_open_files;
   std::array<Handle, 16> m_handles{};
 
   FstEntry m_redirect_fst{};
@@ -71,6 +71,8 @@ public:
       *m_ticks += ticks;
   }
 
+  bool IsTracked() const { return m_ticks != nullptr; }
+
 private:
   u64* m_ticks = nullptr;
 };
@@ -696,9 +696,32 @@ NWC24::ErrorCode NetKDRequestDevice::KDDownload(const u16 entry_index,
 
   INFO_LOG_FMT(IOS_WC24, "NET_KD_REQ: IOCTL_NWC24_DOWNLOAD_NOW_EX - NI - Name: {}", content_name);
 
-  const Common::HttpRequest::Response response = m_http.Get(url);
+  Common::HttpRequest::Headers headers;
+  {
+    std::lock_guard lg(m_download_etags_lock);
+    if (const auto it = m_download_etags.find(url); it != m_download_etags.end())
+      headers.emplace("If-None-Match", it->second);
+  }
 
-  if (!response)
+  Common::HttpRequest::Response response =
+      m_http.Get(url, headers, Common::HttpRequest::AllowedReturnCodes::All);
+  if (response && m_http.GetLastResponseCode() == 304)
+  {
+    // The content has not changed since it was last downloaded. Only skip writing it if it is
+    // still there, as the channel may have deleted it from the VFF since.
+    std::vector<u8> existing_data;
+    if (NWC24::ReadFromVFF(m_dl_list.GetVFFPath(entry_index), content_name, m_ios.GetFS(),
+                           existing_data) == NWC24::WC24_OK)
+    {
+      INFO_LOG_FMT(IOS_WC24, "Content at {} has not changed since the last download.", url);
+      success = true;
+      return NWC24::WC24_OK;
+    }
+
+    response = m_http.Get(url, {}, Common::HttpRequest::AllowedReturnCodes::All);
+  }
+
+  if (!response || m_http.GetLastResponseCode() != 200)
   {
     const s32 last_response_code = m_http.GetLastResponseCode();
     ERROR_LOG_FMT(IOS_WC24, "Failed to request data at {}. HTTP Status Code: {}", url,
@@ -711,6 +734,8 @@ NWC24::ErrorCode NetKDRequestDevice::KDDownload(const u16 entry_index,
     return NWC24::WC24_ERR_SERVER;
   }
 
+  std::string etag = m_http.GetHeaderValue("ETag");
+
   if (!m_dl_list.IsRSASigned(entry_index))
   {
     // Data that is not signed with an RSA key will not have the WC24 header or 320 bytes before the
@@ -770,6 +795,12 @@ NWC24::ErrorCode NetKDRequestDevice::KDDownload(const u16 entry_index,
     return reply;
   }
 
+  if (!etag.empty())
+  {
+    std::lock_guard lg(m_download_etags_lock);
+    m_download_etags.insert_or_assign(url, std::move(etag));
+  }
+
   success = true;
   return reply;
 }
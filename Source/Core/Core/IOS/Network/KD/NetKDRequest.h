@@ -4,7 +4,9 @@
 #pragma once
 
 #include <array>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <string>
 
@@ -120,6 +122,10 @@ private:
   std::shared_ptr<NetKDTimeDevice> m_time_device;
   // TODO: Maybe move away from Common::HttpRequest?
   Common::HttpRequest m_http{std::chrono::minutes{1}};
+  // ETags of the content last downloaded from each URL, used to skip downloading content that
+  // has not changed since.
+  std::map<std::string, std::string> m_download_etags;
+  std::mutex m_download_etags_lock;
   u32 m_download_span = 2;
   u32 m_mail_span = 1;
   bool m_handle_mail;
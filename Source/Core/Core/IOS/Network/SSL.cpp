@@ -5,7 +5,9 @@
 
 #include <array>
 #include <cstring>
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <mbedtls/md.h>
@@ -86,8 +88,53 @@ int SSLRecv(void* ctx, unsigned char* buf, size_t len)
 
   return ret;
 }
+
+struct CachedSession
+{
+  CachedSession() { mbedtls_ssl_session_init(&session); }
+  ~CachedSession() { mbedtls_ssl_session_free(&session); }
+
+  CachedSession(const CachedSession&) = delete;
+  CachedSession& operator=(const CachedSession&) = delete;
+
+  mbedtls_ssl_session session;
+  bool verified = false;
+};
+
+// Sessions of completed handshakes, by hostname.
+std::map<std::string, CachedSession, std::less<>> s_session_cache;
+
+void ResumeCachedSession(WII_SSL* ssl)
+{
+  const auto it = s_session_cache.find(ssl->hostname);
+  if (it == s_session_cache.end())
+    return;
+
+  // Resuming a session skips certificate verification, so only resume sessions whose certificate
+  // was verified when the connection requires it.
+  if (ssl->verify_certificates && !it->second.verified)
+    return;
+
+  mbedtls_ssl_set_session(&ssl->ctx, &it->second.session);
+}
 }  // namespace
 
+void NetSSLDevice::SaveSession(const WII_SSL& ssl)
+{
+  if (ssl.hostname.empty())
+    return;
+
+  CachedSession& cached = s_session_cache[ssl.hostname];
+  mbedtls_ssl_session_free(&cached.session);
+  mbedtls_ssl_session_init(&cached.session);
+  if (mbedtls_ssl_get_session(&ssl.ctx, &cached.session) != 0)
+  {
+    s_session_cache.erase(ssl.hostname);
+    return;
+  }
+  cached.verified = ssl.verify_certificates;
+}
+
 NetSSLDevice::NetSSLDevice(EmulationKernel& ios, const std::string& device_name)
     : EmulationDevice(ios, device_name)
 {
@@ -109,7 +156,6 @@ NetSSLDevice::~NetSSLDevice()
       mbedtls_x509_crt_free(&ssl.cacert);
       mbedtls_x509_crt_free(&ssl.clicert);
 
-      mbedtls_ssl_session_free(&ssl.session);
       mbedtls_ssl_free(&ssl.ctx);
       mbedtls_ssl_config_free(&ssl.config);
       mbedtls_ctr_drbg_free(&ssl.ctr_drbg);
@@ -120,6 +166,8 @@ NetSSLDevice::~NetSSLDevice()
       ssl.active = false;
     }
   }
+
+  s_session_cache.clear();
 }
 
 int NetSSLDevice::GetSSLFreeID() const
@@ -271,9 +319,10 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
       mbedtls_ssl_conf_max_version(&ssl->config, MBEDTLS_SSL_MAJOR_VERSION_3,
                                    MBEDTLS_SSL_MINOR_VERSION_2);
       mbedtls_ssl_conf_cert_profile(&ssl->config, &mbedtls_x509_crt_profile_wii);
-      mbedtls_ssl_set_session(&ssl->ctx, &ssl->session);
 
-      if (Config::Get(Config::MAIN_NETWORK_SSL_VERIFY_CERTIFICATES) && verifyOption)
+      ssl->verify_certificates =
+          Config::Get(Config::MAIN_NETWORK_SSL_VERIFY_CERTIFICATES) && verifyOption;
+      if (ssl->verify_certificates)
         mbedtls_ssl_conf_authmode(&ssl->config, MBEDTLS_SSL_VERIFY_REQUIRED);
       else
         mbedtls_ssl_conf_authmode(&ssl->config, MBEDTLS_SSL_VERIFY_NONE);
@@ -311,7 +360,6 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
       mbedtls_x509_crt_free(&ssl->cacert);
       mbedtls_x509_crt_free(&ssl->clicert);
 
-      mbedtls_ssl_session_free(&ssl->session);
       mbedtls_ssl_free(&ssl->ctx);
       mbedtls_ssl_config_free(&ssl->config);
       mbedtls_ctr_drbg_free(&ssl->ctr_drbg);
@@ -497,6 +545,7 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
     {
       WII_SSL* ssl = &_SSL[sslID];
       mbedtls_ssl_setup(&ssl->ctx, &ssl->config);
+      ResumeCachedSession(ssl);
       ssl->sockfd = memory.Read_U32(BufferOut2);
       ssl->hostfd = GetEmulationKernel().GetSocketManager()->GetHostSocket(ssl->sockfd);
       INFO_LOG_FMT(IOS_SSL, "IOCTLV_NET_SSL_CONNECT socket = {}", ssl->sockfd);
@@ -67,7 +67,6 @@ struct WII_SSL
 {
   mbedtls_ssl_context ctx{};
   mbedtls_ssl_config config{};
-  mbedtls_ssl_session session{};
   mbedtls_entropy_context entropy{};
   mbedtls_ctr_drbg_context ctr_drbg{};
   mbedtls_x509_crt cacert{};
@@ -76,6 +75,7 @@ struct WII_SSL
   int sockfd = -1;
   int hostfd = -1;
   std::string hostname;
+  bool verify_certificates = false;
   bool active = false;
 };
 
@@ -91,6 +91,10 @@ public:
 
   int GetSSLFreeID() const;
 
+  // Remembers the session of a completed handshake, so that the next connection to the same host
+  // can resume it instead of going through a full handshake.
+  static void SaveSession(const WII_SSL& ssl);
+
   static WII_SSL _SSL[NET_SSL_MAXINSTANCES];
 
 private:
@@ -258,6 +258,13 @@ void WiiSocket::Update(bool read, bool write, bool except)
   auto it = pending_sockops.begin();
   while (it != pending_sockops.end())
   {
+    // Retrying these would only return EAGAIN again.
+    if (!read && !except && !it->is_aborted && IsWaitingForData(*it))
+    {
+      ++it;
+      continue;
+    }
+
     s32 ReturnValue = 0;
     bool forceNonBlock = false;
     IPCCommandType ct = it->request.command;
@@ -412,7 +419,8 @@ void WiiSocket::Update(bool read, bool write, bool except)
               break;
             }
 
-            mbedtls_ssl_context* ctx = &NetSSLDevice::_SSL[sslID].ctx;
+            WII_SSL* ssl = &NetSSLDevice::_SSL[sslID];
+            mbedtls_ssl_context* ctx = &ssl->ctx;
             const int ret = mbedtls_ssl_handshake(ctx);
             if (ret != 0)
             {
@@ -423,6 +431,7 @@ void WiiSocket::Update(bool read, bool write, bool except)
             switch (ret)
             {
             case 0:
+              NetSSLDevice::SaveSession(*ssl);
               WriteReturnValue(memory, SSL_OK, BufferIn);
               break;
             case MBEDTLS_ERR_SSL_WANT_READ:
@@ -720,6 +729,28 @@ void WiiSocket::Update(bool read, bool write, bool except)
   }
 }
 
+bool WiiSocket::IsWaitingForData(const sockop& op) const
+{
+  // SSL contexts may have buffered data even if the socket itself isn't readable.
+  if (nonBlock || op.is_ssl)
+    return false;
+
+  if (op.request.command == IPC_CMD_IOCTL)
+    return op.net_type == IOCTL_SO_ACCEPT;
+
+  if (op.request.command != IPC_CMD_IOCTLV || op.net_type != IOCTLV_SO_RECVFROM)
+    return false;
+
+  auto& system = m_socket_manager.m_ios.GetSystem();
+  const IOCtlVRequest ioctlv{system, op.request.address};
+  if (ioctlv.in_vectors.empty())
+    return false;
+
+  // Non-blocking and peeking receives must complete right away.
+  const u32 flags = system.GetMemory().Read_U32(ioctlv.in_vectors[0].address + 0x04);
+  return (flags & (SO_MSG_NONBLOCK | SO_MSG_PEEK)) == 0;
+}
+
 void WiiSocket::UpdateConnectingState(s32 connect_rv)
 {
   if (connect_rv == -SO_EAGAIN || connect_rv == -SO_EALREADY || connect_rv == -SO_EINPROGRESS)
@@ -1000,10 +1031,14 @@ void WiiSockMan::Update()
     const WiiSocket& sock = socket_iter->second;
     if (sock.IsValid())
     {
-      FD_SET(sock.fd, &read_fds);
-      FD_SET(sock.fd, &write_fds);
-      FD_SET(sock.fd, &except_fds);
-      nfds = std::max(nfds, sock.fd + 1);
+      // Only sockets with queued operations need their readiness checked.
+      if (sock.HasPendingOperations())
+      {
+        FD_SET(sock.fd, &read_fds);
+        FD_SET(sock.fd, &write_fds);
+        FD_SET(sock.fd, &except_fds);
+        nfds = std::max(nfds, sock.fd + 1);
+      }
       ++socket_iter;
     }
     else
@@ -1013,22 +1048,26 @@ void WiiSockMan::Update()
     }
   }
 
-  const s32 ret = select(nfds, &read_fds, &write_fds, &except_fds, &t);
+  const s32 ret = nfds != 0 ? select(nfds, &read_fds, &write_fds, &except_fds, &t) : 0;
 
   if (ret >= 0)
   {
     for (auto& pair : WiiSockets)
     {
       WiiSocket& sock = pair.second;
+      if (!sock.HasPendingOperations())
+        continue;
+
       sock.Update(FD_ISSET(sock.fd, &read_fds) != 0, FD_ISSET(sock.fd, &write_fds) != 0,
                   FD_ISSET(sock.fd, &except_fds) != 0);
     }
   }
   else
   {
+    // Readiness is unknown, so every pending operation has to be retried.
     for (auto& elem : WiiSockets)
     {
-      elem.second.Update(false, false, false);
+      elem.second.Update(true, true, true);
     }
   }
   UpdatePollCommands();
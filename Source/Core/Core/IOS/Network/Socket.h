@@ -223,6 +223,8 @@ private:
   void DoSock(Request request, NET_IOCTL type);
   void DoSock(Request request, SSL_IOCTL type);
   void Update(bool read, bool write, bool except);
+  bool IsWaitingForData(const sockop& op) const;
+  bool HasPendingOperations() const { return !pending_sockops.empty(); }
   void UpdateConnectingState(s32 connect_rv);
   ConnectingState GetConnectingState() const;
   bool IsValid() const { return fd >= 0; }
@@ -80,6 +80,9 @@ BluetoothRealDevice::~BluetoothRealDevice()
     libusb_unref_device(m_device);
   }
   SaveLinkKeys();
+
+  for (const auto& [transfer, buffer] : m_free_transfers)
+    libusb_free_transfer(transfer);
 }
 
 std::optional<IPCReply> BluetoothRealDevice::Open(const OpenRequest& request)
@@ -242,13 +245,13 @@ std::optional<IPCReply> BluetoothRealDevice::IOCtlV(const IOCtlVRequest& request
       else
         m_link_keys.erase(delete_cmd.bdaddr);
     }
-    auto buffer = std::make_unique<u8[]>(cmd->length + LIBUSB_CONTROL_SETUP_SIZE);
-    libusb_fill_control_setup(buffer.get(), cmd->request_type, cmd->request, cmd->value, cmd->index,
-                              cmd->length);
-    memory.CopyFromEmu(buffer.get() + LIBUSB_CONTROL_SETUP_SIZE, cmd->data_address, cmd->length);
+    std::vector<u8> buffer(cmd->length + LIBUSB_CONTROL_SETUP_SIZE);
+    libusb_fill_control_setup(buffer.data(), cmd->request_type, cmd->request, cmd->value,
+                              cmd->index, cmd->length);
+    memory.CopyFromEmu(buffer.data() + LIBUSB_CONTROL_SETUP_SIZE, cmd->data_address, cmd->length);
     libusb_transfer* transfer = libusb_alloc_transfer(0);
     transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
-    libusb_fill_control_transfer(transfer, m_handle, buffer.get(), nullptr, this, 0);
+    libusb_fill_control_transfer(transfer, m_handle, buffer.data(), nullptr, this, 0);
     transfer->callback = [](libusb_transfer* tr) {
       static_cast<BluetoothRealDevice*>(tr->user_data)->HandleCtrlTransfer(tr);
     };
@@ -290,15 +293,26 @@ std::optional<IPCReply> BluetoothRealDevice::IOCtlV(const IOCtlVRequest& request
         return std::nullopt;
       }
     }
-    auto buffer = cmd->MakeBuffer(cmd->length);
-    libusb_transfer* transfer = libusb_alloc_transfer(0);
-    transfer->buffer = buffer.get();
+    libusb_transfer* transfer;
+    std::vector<u8> buffer;
+    if (m_free_transfers.empty())
+    {
+      transfer = libusb_alloc_transfer(0);
+    }
+    else
+    {
+      transfer = m_free_transfers.back().first;
+      buffer = std::move(m_free_transfers.back().second);
+      m_free_transfers.pop_back();
+    }
+    buffer.resize(cmd->length);
+    GetSystem().GetMemory().CopyFromEmu(buffer.data(), cmd->data_address, cmd->length);
+    transfer->buffer = buffer.data();
     transfer->callback = [](libusb_transfer* tr) {
       static_cast<BluetoothRealDevice*>(tr->user_data)->HandleBulkOrIntrTransfer(tr);
     };
     transfer->dev_handle = m_handle;
     transfer->endpoint = cmd->endpoint;
-    transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
     transfer->length = cmd->length;
     transfer->timeout = TIMEOUT;
     transfer->type = request.request == USB::IOCTLV_USBV0_BLKMSG ? LIBUSB_TRANSFER_TYPE_BULK :
@@ -329,18 +343,21 @@ void BluetoothRealDevice::DoState(PointerWrap& p)
   }
 
   Device::DoState(p);
-  // Prevent the transfer callbacks from messing with m_current_transfers after we have started
-  // writing a savestate. We cannot use a scoped lock here because DoState is called twice and
-  // we would lose the lock between the two calls.
-  if (p.IsMeasureMode() || p.IsVerifyMode())
-    m_transfers_mutex.lock();
+  // Prevent the transfer callbacks from messing with m_current_transfers while we are writing a
+  // savestate.
+  std::unique_lock transfers_lock(m_transfers_mutex, std::defer_lock);
+  if (!p.IsReadMode())
+    transfers_lock.lock();
 
   std::vector<u32> addresses_to_discard;
   if (!p.IsReadMode())
   {
     // Save addresses of transfer commands to discard on savestate load.
     for (const auto& transfer : m_current_transfers)
-      addresses_to_discard.push_back(transfer.second.command->ios_request.address);
+    {
+      if (transfer.second.command)
+        addresses_to_discard.push_back(transfer.second.command->ios_request.address);
+    }
   }
   p.Do(addresses_to_discard);
   if (p.IsReadMode())
@@ -352,8 +369,10 @@ void BluetoothRealDevice::DoState(PointerWrap& p)
     for (const auto& address_to_discard : addresses_to_discard)
       GetEmulationKernel().EnqueueIPCReply(Request{system, address_to_discard}, 0);
 
-    // Prevent the callbacks from replying to a request that has already been discarded.
-    m_current_transfers.clear();
+    // Prevent the callbacks from replying to a request that has already been discarded. The
+    // transfers themselves are still in flight, so their buffers must stay alive until they finish.
+    for (auto& [transfer, pending_transfer] : m_current_transfers)
+      pending_transfer.command.reset();
 
     OSD::AddMessage("If the savestate does not load correctly, disconnect all Wii Remotes "
                     "and reload it.",
@@ -368,10 +387,6 @@ void BluetoothRealDevice::DoState(PointerWrap& p)
                     OSD::Duration::VERY_LONG);
     s_has_shown_savestate_warning = true;
   }
-
-  // We have finished the savestate now, so the transfers mutex can be unlocked.
-  if (p.IsWriteMode())
-    m_transfers_mutex.unlock();
 }
 
 void BluetoothRealDevice::UpdateSyncButtonState(const bool is_held)
@@ -678,8 +693,14 @@ bool BluetoothRealDevice::OpenDevice(libusb_device* device)
 void BluetoothRealDevice::HandleCtrlTransfer(libusb_transfer* tr)
 {
   std::lock_guard lk(m_transfers_mutex);
-  if (!m_current_transfers.count(tr))
+  const auto it = m_current_transfers.find(tr);
+  if (it == m_current_transfers.end())
+    return;
+  if (!it->second.command)
+  {
+    m_current_transfers.erase(it);
     return;
+  }
 
   if (tr->status != LIBUSB_TRANSFER_COMPLETED && tr->status != LIBUSB_TRANSFER_NO_DEVICE)
   {
@@ -696,18 +717,25 @@ void BluetoothRealDevice::HandleCtrlTransfer(libusb_transfer* tr)
   {
     m_showed_failed_transfer.Clear();
   }
-  const auto& command = m_current_transfers.at(tr).command;
+  const auto& command = it->second.command;
   command->FillBuffer(libusb_control_transfer_get_data(tr), tr->actual_length);
   GetEmulationKernel().EnqueueIPCReply(command->ios_request, tr->actual_length, 0,
                                        CoreTiming::FromThread::ANY);
-  m_current_transfers.erase(tr);
+  m_current_transfers.erase(it);
 }
 
 void BluetoothRealDevice::HandleBulkOrIntrTransfer(libusb_transfer* tr)
 {
   std::lock_guard lk(m_transfers_mutex);
-  if (!m_current_transfers.count(tr))
+  const auto it = m_current_transfers.find(tr);
+  if (it == m_current_transfers.end())
+    return;
+  if (!it->second.command)
+  {
+    m_free_transfers.emplace_back(tr, std::move(it->second.buffer));
+    m_current_transfers.erase(it);
     return;
+  }
 
   if (tr->status != LIBUSB_TRANSFER_COMPLETED && tr->status != LIBUSB_TRANSFER_TIMED_OUT &&
       tr->status != LIBUSB_TRANSFER_NO_DEVICE)
@@ -746,10 +774,11 @@ void BluetoothRealDevice::HandleBulkOrIntrTransfer(libusb_transfer* tr)
     }
   }
 
-  const auto& command = m_current_transfers.at(tr).command;
+  const auto& command = it->second.command;
   command->FillBuffer(tr->buffer, tr->actual_length);
   GetEmulationKernel().EnqueueIPCReply(command->ios_request, tr->actual_length, 0,
                                        CoreTiming::FromThread::ANY);
-  m_current_transfers.erase(tr);
+  m_free_transfers.emplace_back(tr, std::move(it->second.buffer));
+  m_current_transfers.erase(it);
 }
 }  // namespace IOS::HLE
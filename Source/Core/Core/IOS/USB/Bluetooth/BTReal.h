@@ -10,6 +10,8 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Flag.h"
@@ -77,14 +79,14 @@ private:
   std::mutex m_transfers_mutex;
   struct PendingTransfer
   {
-    PendingTransfer(std::unique_ptr<USB::TransferCommand> command_, std::unique_ptr<u8[]> buffer_)
-        : command(std::move(command_)), buffer(std::move(buffer_))
-    {
-    }
+    // Null if the transfer was discarded (on savestate load) and must not be replied to.
     std::unique_ptr<USB::TransferCommand> command;
-    std::unique_ptr<u8[]> buffer;
+    std::vector<u8> buffer;
   };
   std::map<libusb_transfer*, PendingTransfer> m_current_transfers;
+  // Finished bulk and interrupt transfers, kept along with their buffers so that ACL data and HCI
+  // events don't need new allocations for every packet.
+  std::vector<std::pair<libusb_transfer*, std::vector<u8>>> m_free_transfers;
 
   // Set when we received a command to which we need to fake a reply
   Common::Flag m_fake_read_buffer_size_reply;
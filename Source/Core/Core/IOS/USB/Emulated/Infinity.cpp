@@ -535,7 +535,7 @@ void InfinityBase::WriteBlock(u8 fig_num, u8 block, const u8* to_write_buf,
   if (figure.present && file_block < 20)
   {
     memcpy(figure.data.data() + (file_block * 16), to_write_buf, 16);
-    figure.Save();
+    figure.SaveBlock(file_block);
   }
   reply_buf[4] = GenerateChecksum(reply_buf, 4);
 }
@@ -921,4 +921,13 @@ void InfinityFigure::Save()
   inf_file.Seek(0, File::SeekOrigin::Begin);
   inf_file.WriteBytes(data.data(), 0x40 * 0x05);
 }
+
+void InfinityFigure::SaveBlock(u8 block)
+{
+  if (!inf_file)
+    return;
+
+  inf_file.Seek(block * INFINITY_BLOCK_SIZE, File::SeekOrigin::Begin);
+  inf_file.WriteBytes(data.data() + (block * INFINITY_BLOCK_SIZE), INFINITY_BLOCK_SIZE);
+}
 }  // namespace IOS::HLE::USB
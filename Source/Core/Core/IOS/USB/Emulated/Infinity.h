@@ -22,6 +22,8 @@ constexpr u8 INFINITY_BLOCK_SIZE = 0x10;
 struct InfinityFigure final
 {
   void Save();
+  // Writes a single 16 byte block back to the figure file.
+  void SaveBlock(u8 block);
 
   File::IOFile inf_file;
   std::array<u8, INFINITY_NUM_BLOCKS * INFINITY_BLOCK_SIZE> data{};
@@ -1209,7 +1209,7 @@ void SkylanderPortal::WriteBlock(u8 sky_num, u8 block, const u8* to_write_buf, u
   {
     reply_buf[1] = (0x10 | sky_num);
     skylander.figure->SetBlock(block, to_write_buf);
-    skylander.figure->Save();
+    skylander.figure->SaveBlock(block);
   }
   else
   {
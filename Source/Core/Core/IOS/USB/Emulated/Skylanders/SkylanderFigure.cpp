@@ -174,6 +174,12 @@ void SkylanderFigure::Save()
   m_sky_file.WriteBytes(m_data.data(), FIGURE_SIZE);
 }
 
+void SkylanderFigure::SaveBlock(u8 block)
+{
+  m_sky_file.Seek(block * BLOCK_SIZE, File::SeekOrigin::Begin);
+  m_sky_file.WriteBytes(m_data.data() + (block * BLOCK_SIZE), BLOCK_SIZE);
+}
+
 void SkylanderFigure::GetBlock(u8 index, u8* dest) const
 {
   memcpy(dest, m_data.data() + (index * BLOCK_SIZE), BLOCK_SIZE);
@@ -65,6 +65,8 @@ public:
   bool Create(u16 sky_id, u16 sky_var,
               std::optional<std::array<u8, 4>> requested_nuid = std::nullopt);
   void Save();
+  // Writes a single block back to the figure file.
+  void SaveBlock(u8 block);
   void Close();
   bool FileIsOpen() const;
   void GetBlock(u8 index, u8* dest) const;
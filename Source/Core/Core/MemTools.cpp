@@ -14,6 +14,7 @@
 #include "Common/MsgHandler.h"
 #include "Common/Thread.h"
 
+#include "Core/HW/Memmap.h"
 #include "Core/MachineContext.h"
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/System.h"
@@ -41,6 +42,17 @@
 
 namespace EMM
 {
+[[maybe_unused]] static bool HandleFault(uintptr_t access_address, SContext* ctx)
+{
+  // Writes to memory which is write-protected for write tracking must not reach the JIT, as it
+  // would backpatch the access into a slow one.
+  auto& system = Core::System::GetInstance();
+  if (system.GetMemory().HandleWriteTrackingFault(access_address))
+    return true;
+
+  return system.GetJitInterface().HandleFault(access_address, ctx);
+}
+
 #ifdef _WIN32
 
 static PVOID s_veh_handle;
@@ -61,7 +73,7 @@ static LONG NTAPI Handler(PEXCEPTION_POINTERS pPtrs)
     uintptr_t fault_address = (uintptr_t)pPtrs->ExceptionRecord->ExceptionInformation[1];
     SContext* ctx = pPtrs->ContextRecord;
 
-    if (Core::System::GetInstance().GetJitInterface().HandleFault(fault_address, ctx))
+    if (HandleFault(fault_address, ctx))
     {
       return EXCEPTION_CONTINUE_EXECUTION;
     }
@@ -283,13 +295,13 @@ static void sigsegv_handler(int sig, siginfo_t* info, void* raw_context)
   mcontext_t* ctx = &context->uc_mcontext;
 #endif
   // assume it's not a write
-  if (!Core::System::GetInstance().GetJitInterface().HandleFault(bad_address,
+  if (!HandleFault(bad_address,
 #ifdef __APPLE__
-                                                                 *ctx
+                   *ctx
 #else
-                                                                 ctx
+                   ctx
 #endif
-                                                                 ))
+                   ))
   {
     // retry and crash
     // According to the sigaction man page, if sa_flags "SA_SIGINFO" is set to the sigaction
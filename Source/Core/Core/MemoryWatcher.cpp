@@ -3,13 +3,19 @@
 
 #include "Core/MemoryWatcher.h"
 
+#include <atomic>
 #include <cstring>
+#include <fcntl.h>
 #include <fstream>
 #include <iostream>
+#include <set>
 #include <sstream>
+#include <sys/mman.h>
 #include <unistd.h>
 
+#include "Common/Align.h"
 #include "Common/FileUtil.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/PowerPC/MMU.h"
 
@@ -18,8 +24,15 @@ MemoryWatcher::MemoryWatcher()
   m_running = false;
   if (!LoadAddresses(File::GetUserPath(F_MEMORYWATCHERLOCATIONS_IDX)))
     return;
-  if (!OpenSocket(File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX)))
+  if (Config::Get(Config::MAIN_MEMORY_WATCHER_SHARED_MEMORY))
+  {
+    if (!OpenSharedMemory(File::GetUserPath(F_MEMORYWATCHERSHAREDMEMORY_IDX)))
+      return;
+  }
+  else if (!OpenSocket(File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX)))
+  {
     return;
+  }
   m_running = true;
 }
 
@@ -29,7 +42,10 @@ MemoryWatcher::~MemoryWatcher()
     return;
 
   m_running = false;
-  close(m_fd);
+  if (m_shared_memory)
+    munmap(m_shared_memory, m_shared_memory_size);
+  else
+    close(m_fd);
 }
 
 bool MemoryWatcher::LoadAddresses(const std::string& path)
@@ -39,23 +55,27 @@ bool MemoryWatcher::LoadAddresses(const std::string& path)
   if (!locations)
     return false;
 
+  std::set<std::string> lines;
   std::string line;
   while (std::getline(locations, line))
-    ParseLine(line);
+  {
+    if (lines.insert(line).second)
+      ParseLine(line);
+  }
 
-  return !m_values.empty();
+  return !m_watches.empty();
 }
 
 void MemoryWatcher::ParseLine(const std::string& line)
 {
-  m_values[line] = 0;
-  m_addresses[line] = std::vector<u32>();
+  Watch& watch = m_watches.emplace_back();
+  watch.line = line;
 
   std::istringstream offsets(line);
   offsets >> std::hex;
   u32 offset;
   while (offsets >> offset)
-    m_addresses[line].push_back(offset);
+    watch.offsets.push_back(offset);
 }
 
 bool MemoryWatcher::OpenSocket(const std::string& path)
@@ -67,10 +87,40 @@ bool MemoryWatcher::OpenSocket(const std::string& path)
   return m_fd >= 0;
 }
 
-u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line)
+bool MemoryWatcher::OpenSharedMemory(const std::string& path)
+{
+  const std::size_t values_size = Common::AlignUp(m_watches.size() * sizeof(u32), sizeof(u64));
+  const std::size_t size = sizeof(SharedMemoryHeader) + values_size +
+                           SHARED_MEMORY_RING_CAPACITY * sizeof(SharedMemoryRecord);
+
+  const int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+    return false;
+
+  void* const view =
+      ftruncate(fd, size) == 0 ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) :
+                                 MAP_FAILED;
+  close(fd);
+  if (view == MAP_FAILED)
+    return false;
+
+  m_shared_memory = static_cast<u8*>(view);
+  m_shared_memory_size = size;
+
+  // The file is zero-filled, so only the header needs to be written. The magic goes last so that
+  // readers never see a partially written header.
+  auto* const header = reinterpret_cast<SharedMemoryHeader*>(m_shared_memory);
+  header->version = SHARED_MEMORY_VERSION;
+  header->watch_count = static_cast<u32>(m_watches.size());
+  header->ring_capacity = SHARED_MEMORY_RING_CAPACITY;
+  std::atomic_ref(header->magic).store(SHARED_MEMORY_MAGIC, std::memory_order_release);
+  return true;
+}
+
+u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard, const Watch& watch)
 {
   u32 value = 0;
-  for (u32 offset : m_addresses[line])
+  for (u32 offset : watch.offsets)
   {
     value = PowerPC::MMU::HostRead_U32(guard, value + offset);
     if (!PowerPC::MMU::HostIsRAMAddress(guard, value))
@@ -84,28 +134,63 @@ std::string MemoryWatcher::ComposeMessages(const Core::CPUThreadGuard& guard)
   std::ostringstream message_stream;
   message_stream << std::hex;
 
-  for (auto& entry : m_values)
+  for (Watch& watch : m_watches)
   {
-    std::string address = entry.first;
-    u32& current_value = entry.second;
-
-    u32 new_value = ChasePointer(guard, address);
-    if (new_value != current_value)
+    u32 new_value = ChasePointer(guard, watch);
+    if (new_value != watch.value)
     {
       // Update the value
-      current_value = new_value;
-      message_stream << address << '\n' << new_value << '\n';
+      watch.value = new_value;
+      message_stream << watch.line << '\n' << new_value << '\n';
     }
   }
 
   return message_stream.str();
 }
 
+void MemoryWatcher::WriteSharedMemory(const Core::CPUThreadGuard& guard)
+{
+  auto* const header = reinterpret_cast<SharedMemoryHeader*>(m_shared_memory);
+  u32* const values = reinterpret_cast<u32*>(m_shared_memory + sizeof(SharedMemoryHeader));
+  auto* const ring = reinterpret_cast<SharedMemoryRecord*>(
+      m_shared_memory + sizeof(SharedMemoryHeader) +
+      Common::AlignUp(m_watches.size() * sizeof(u32), sizeof(u64)));
+
+  for (u32 i = 0; i < m_watches.size(); ++i)
+  {
+    Watch& watch = m_watches[i];
+    const u32 new_value = ChasePointer(guard, watch);
+    if (new_value == watch.value)
+      continue;
+
+    watch.value = new_value;
+    std::atomic_ref(values[i]).store(new_value, std::memory_order_relaxed);
+
+    // Invalidate the slot before overwriting it, so that readers can tell it changed under them
+    SharedMemoryRecord& record = ring[m_write_index % SHARED_MEMORY_RING_CAPACITY];
+    std::atomic_ref(record.sequence).store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::atomic_ref(record.watch_index).store(i, std::memory_order_relaxed);
+    std::atomic_ref(record.value).store(new_value, std::memory_order_relaxed);
+    std::atomic_ref(record.sequence).store(m_write_index + 1, std::memory_order_release);
+    ++m_write_index;
+  }
+
+  std::atomic_ref(header->write_index).store(m_write_index, std::memory_order_release);
+  std::atomic_ref(header->frame_count).store(++m_frame_count, std::memory_order_release);
+}
+
 void MemoryWatcher::Step(const Core::CPUThreadGuard& guard)
 {
   if (!m_running)
     return;
 
+  if (m_shared_memory)
+  {
+    WriteSharedMemory(guard);
+    return;
+  }
+
   std::string message = ComposeMessages(guard);
   sendto(m_fd, message.c_str(), message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
          sizeof(m_addr));
@@ -5,7 +5,7 @@
 
 #include "Common/CommonTypes.h"
 
-#include <map>
+#include <cstddef>
 #include <string>
 #include <sys/socket.h>
 #include <sys/un.h>
@@ -24,28 +24,75 @@ class CPUThreadGuard;
 // "ABCD EF" will watch the address at (*0xABCD) + 0xEF.
 // The output to the socket is two lines. The first is the address from the
 // input file, and the second is the new value in hex.
+//
+// If Core.MemoryWatcherSharedMemory is enabled, changes are instead written in binary form to the
+// memory-mapped file MemoryWatcher/SharedMemory, which is a lot cheaper for tools watching
+// thousands of addresses. See SharedMemoryHeader for its layout.
 class MemoryWatcher final
 {
 public:
+  // The shared memory file consists of this header, the current value of every watch (in the order
+  // of the input file, padded to a multiple of 8 bytes), and a ring of ring_capacity records.
+  //
+  // Record number N is stored in slot N % ring_capacity. Its sequence is set to N + 1 once it is
+  // complete, and write_index is advanced past it afterwards. Readers should check that the
+  // sequence is still the expected one after copying a record, as it may have been overwritten.
+  struct SharedMemoryHeader
+  {
+    u32 magic;
+    u32 version;
+    u32 watch_count;
+    u32 ring_capacity;
+    u64 write_index;
+    u64 frame_count;
+  };
+  static_assert(sizeof(SharedMemoryHeader) == 32);
+
+  struct SharedMemoryRecord
+  {
+    u64 sequence;
+    // Index of the watch in the input file
+    u32 watch_index;
+    u32 value;
+  };
+  static_assert(sizeof(SharedMemoryRecord) == 16);
+
+  static constexpr u32 SHARED_MEMORY_MAGIC = 0x53574d44;  // "DMWS"
+  static constexpr u32 SHARED_MEMORY_VERSION = 1;
+  static constexpr u32 SHARED_MEMORY_RING_CAPACITY = 0x10000;
+
   MemoryWatcher();
   ~MemoryWatcher();
   void Step(const Core::CPUThreadGuard& guard);
 
 private:
+  struct Watch
+  {
+    // Address as stored in the file
+    std::string line;
+    // Offsets to follow
+    std::vector<u32> offsets;
+    u32 value = 0;
+  };
+
   bool LoadAddresses(const std::string& path);
   bool OpenSocket(const std::string& path);
+  bool OpenSharedMemory(const std::string& path);
 
   void ParseLine(const std::string& line);
-  u32 ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line);
+  u32 ChasePointer(const Core::CPUThreadGuard& guard, const Watch& watch);
   std::string ComposeMessages(const Core::CPUThreadGuard& guard);
+  void WriteSharedMemory(const Core::CPUThreadGuard& guard);
 
   bool m_running = false;
 
-  int m_fd;
+  int m_fd = -1;
   sockaddr_un m_addr{};
 
-  // Address as stored in the file -> list of offsets to follow
-  std::map<std::string, std::vector<u32>> m_addresses;
-  // Address as stored in the file -> current value
-  std::map<std::string, u32> m_values;
+  u8* m_shared_memory = nullptr;
+  std::size_t m_shared_memory_size = 0;
+  u64 m_write_index = 0;
+  u64 m_frame_count = 0;
+
+  std::vector<Watch> m_watches;
 };
@@ -25,9 +25,11 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonPaths.h"
 #include "Common/Config/Config.h"
+#include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 #include "Common/Hash.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/NandPaths.h"
 #include "Common/StringUtil.h"
@@ -49,6 +51,7 @@
 #include "Core/HW/EXI/EXI.h"
 #include "Core/HW/EXI/EXI_DeviceIPL.h"
 #include "Core/HW/EXI/EXI_DeviceMemoryCard.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/ProcessorInterface.h"
 #include "Core/HW/SI/SI.h"
 #include "Core/HW/SI/SI_Device.h"
@@ -64,6 +67,7 @@
 #include "Core/IOS/USB/Bluetooth/BTEmu.h"
 #include "Core/IOS/USB/Bluetooth/WiimoteDevice.h"
 #include "Core/NetPlayProto.h"
+#include "Core/PowerPC/PowerPC.h"
 #include "Core/State.h"
 #include "Core/System.h"
 #include "Core/WiiUtils.h"
@@ -195,6 +199,131 @@ void MovieManager::FrameUpdate()
   }
 
   m_polled = false;
+
+  if (m_seek_target_frame && m_current_frame >= *m_seek_target_frame)
+    FinishSeek();
+}
+
+std::string MovieManager::GetKeyframeDirectory() const
+{
+  return m_movie_path + ".keyframes" DIR_SEP;
+}
+
+void MovieManager::UpdateKeyframes()
+{
+  const u32 interval = Config::Get(Config::MAIN_MOVIE_KEYFRAME_INTERVAL);
+  if (interval == 0 || !IsPlayingInput() || !m_read_only || m_movie_path.empty() ||
+      m_current_frame % interval != 0)
+  {
+    return;
+  }
+
+  const std::string directory = GetKeyframeDirectory();
+  const std::string path = fmt::format("{}{}.sav", directory, m_current_frame);
+  const std::string checksum_path = path + ".crc";
+  const std::string checksum = fmt::format("{:08x}", GetStateChecksum());
+
+  if (File::Exists(path))
+  {
+    std::string recorded_checksum;
+    if (!File::ReadFileToString(checksum_path, recorded_checksum))
+    {
+      File::WriteStringToFile(checksum_path, checksum);
+    }
+    else if (recorded_checksum != checksum)
+    {
+      ++m_keyframe_mismatch_count;
+      ERROR_LOG_FMT(CORE, "Movie desync at keyframe {}: checksum {} does not match recorded {}",
+                    m_current_frame, checksum, recorded_checksum);
+      Core::DisplayMessage(fmt::format("Movie desync at frame {}", m_current_frame), 4000);
+    }
+    return;
+  }
+
+  if (!File::IsDirectory(directory) && !File::CreateDir(directory))
+    return;
+
+  State::SaveAs(m_system, path);
+  File::WriteStringToFile(checksum_path, checksum);
+}
+
+u32 MovieManager::GetKeyframeMismatchCount() const
+{
+  return m_keyframe_mismatch_count;
+}
+
+u32 MovieManager::GetStateChecksum() const
+{
+  auto& memory = m_system.GetMemory();
+  const auto& ppc_state = m_system.GetPPCState();
+
+  u32 crc = Common::StartCRC32();
+  crc = Common::UpdateCRC32(crc, memory.GetRAM(), memory.GetRamSizeReal());
+  if (m_system.IsWii())
+    crc = Common::UpdateCRC32(crc, memory.GetEXRAM(), memory.GetExRamSizeReal());
+  crc = Common::UpdateCRC32(crc, reinterpret_cast<const u8*>(ppc_state.gpr), sizeof(ppc_state.gpr));
+  crc = Common::UpdateCRC32(crc, reinterpret_cast<const u8*>(&ppc_state.pc), sizeof(ppc_state.pc));
+  return crc;
+}
+
+bool MovieManager::SeekToFrame(u64 frame)
+{
+  bool success = false;
+  bool seeking = false;
+  Core::RunOnCPUThread(
+      m_system,
+      [&] {
+        if (!IsPlayingInput())
+          return;
+
+        // Use the latest keyframe that does not overshoot, unless we are already closer to it.
+        std::optional<u64> keyframe;
+        for (const std::string& path : Common::DoFileSearch({GetKeyframeDirectory()}, {".sav"}))
+        {
+          std::string name;
+          u64 keyframe_frame;
+          if (!SplitPath(path, nullptr, &name, nullptr) || !TryParse(name, &keyframe_frame))
+            continue;
+          if (keyframe_frame <= frame && keyframe_frame > keyframe.value_or(0))
+            keyframe = keyframe_frame;
+        }
+
+        if (frame < m_current_frame || (keyframe && *keyframe > m_current_frame))
+        {
+          if (!keyframe)
+          {
+            Core::DisplayMessage("No movie keyframe to seek back to", 2000);
+            return;
+          }
+          State::LoadAs(m_system, fmt::format("{}{}.sav", GetKeyframeDirectory(), *keyframe));
+          if (!IsPlayingInput())
+            return;
+        }
+
+        success = true;
+        if (m_current_frame >= frame)
+          return;
+
+        if (!m_seek_target_frame)
+          m_speed_before_seek = Config::Get(Config::MAIN_EMULATION_SPEED);
+        m_seek_target_frame = frame;
+        Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+        seeking = true;
+      },
+      true);
+
+  if (seeking && Core::GetState(m_system) == Core::State::Paused)
+    Core::SetState(Core::State::Running);
+
+  return success;
+}
+
+void MovieManager::FinishSeek()
+{
+  m_seek_target_frame.reset();
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, m_speed_before_seek);
+  m_system.GetCPU().Break();
+  Core::DisplayMessage(fmt::format("Seeked to frame {}", m_current_frame), 2000);
 }
 
 // called when game is booting up, even if no movie is active,
@@ -945,6 +1074,7 @@ bool MovieManager::PlayInput(const std::string& movie_path,
     return false;
 #endif  // USE_RETRO_ACHIEVEMENTS
 
+  m_movie_path = movie_path;
   m_total_frames = m_temp_header.frameCount;
   m_total_lag_count = m_temp_header.lagCount;
   m_total_input_count = m_temp_header.inputCount;
@@ -1328,6 +1458,12 @@ bool MovieManager::PlayWiimote(int wiimote, WiimoteCommon::DataReportBuilder& rp
 // NOTE: Host / EmuThread / CPU Thread
 void MovieManager::EndPlayInput(bool cont)
 {
+  if (m_seek_target_frame)
+  {
+    m_seek_target_frame.reset();
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, m_speed_before_seek);
+  }
+
   if (cont)
   {
     // If !IsMovieActive(), changing m_play_mode requires calling UpdateWantDeterminism
@@ -162,6 +162,15 @@ public:
   ~MovieManager();
 
   void FrameUpdate();
+  // Called at the end of each frame during read-only playback to write a savestate keyframe next
+  // to the movie every MAIN_MOVIE_KEYFRAME_INTERVAL frames. Each keyframe also records a checksum
+  // of emulated memory and registers. When a keyframe already exists, the checksum is compared
+  // instead, so that replaying a segment from an earlier keyframe verifies it for desyncs.
+  void UpdateKeyframes();
+  u32 GetKeyframeMismatchCount() const;
+  // Loads the closest keyframe at or before <frame> and plays back at unlimited speed until the
+  // movie reaches it, then pauses. Returns false if no movie is being played back.
+  bool SeekToFrame(u64 frame);
   void InputUpdate();
   void Init(const BootParameters& boot);
 
@@ -232,6 +241,10 @@ private:
   void CheckMD5();
   void GetMD5();
 
+  std::string GetKeyframeDirectory() const;
+  u32 GetStateChecksum() const;
+  void FinishSeek();
+
   bool m_read_only = true;
   u32 m_rerecords = 0;
   PlayMode m_play_mode = PlayMode::None;
@@ -269,6 +282,11 @@ private:
   bool m_polled = false;
 
   std::string m_current_file_name;
+  std::string m_movie_path;
+
+  std::optional<u64> m_seek_target_frame;
+  float m_speed_before_seek = 1.0f;
+  u32 m_keyframe_mismatch_count = 0;
 
   // m_input_display is used by both CPU and GPU (is mutable).
   std::mutex m_input_display_lock;
@@ -1618,6 +1618,9 @@ void NetPlayClient::ThreadFunc()
       INFO_LOG_FMT(NETPLAY, "Processing async queue event done.");
       m_async_queue.Pop();
     }
+    // The queue mostly holds our pad data, which the other players are waiting for, so send it
+    // right away instead of after the received event has been handled
+    enet_host_flush(m_client);
     if (net > 0)
     {
       sf::Packet rpac;
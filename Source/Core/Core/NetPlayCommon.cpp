@@ -4,6 +4,9 @@
 #include "Core/NetPlayCommon.h"
 
 #include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 #include <fmt/format.h>
 #include <lzo/lzo1x.h>
@@ -70,10 +73,7 @@ bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
 
     // The size of the data to write is 'out_len'
     packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
+    packet.append(out_buffer.data(), out_len);
 
     if (cur_len != LZO_IN_LEN)
       break;
@@ -87,7 +87,50 @@ bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
   return true;
 }
 
-static bool CompressFolderIntoPacketInternal(const File::FSTEntry& folder, sf::Packet& packet)
+static void CollectFolderFiles(const File::FSTEntry& folder,
+                               std::vector<const File::FSTEntry*>* files)
+{
+  for (const auto& child : folder.children)
+  {
+    if (child.isDirectory)
+      CollectFolderFiles(child, files);
+    else
+      files->push_back(&child);
+  }
+}
+
+// Compresses every file into its own packet on several threads, since save folders can contain
+// a lot of data and the players are waiting for it before the game can start
+static bool CompressFilesIntoPackets(const std::vector<const File::FSTEntry*>& files,
+                                     std::vector<sf::Packet>* packets)
+{
+  packets->resize(files.size());
+
+  std::atomic<size_t> next_file = 0;
+  std::atomic<bool> success = true;
+  const auto compress = [&] {
+    for (size_t i = next_file++; i < files.size() && success; i = next_file++)
+    {
+      if (!CompressFileIntoPacket(files[i]->physicalName, (*packets)[i]))
+        success = false;
+    }
+  };
+
+  const size_t thread_count =
+      std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), files.size());
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < thread_count; ++i)
+    threads.emplace_back(compress);
+  compress();
+  for (std::thread& thread : threads)
+    thread.join();
+
+  return success;
+}
+
+static void WriteFolderIntoPacket(const File::FSTEntry& folder,
+                                  std::vector<sf::Packet>::const_iterator* file_packet,
+                                  sf::Packet& packet)
 {
   const sf::Uint64 size = folder.children.size();
   packet << size;
@@ -96,24 +139,31 @@ static bool CompressFolderIntoPacketInternal(const File::FSTEntry& folder, sf::P
     const bool is_folder = child.isDirectory;
     packet << child.virtualName;
     packet << is_folder;
-    const bool success = is_folder ? CompressFolderIntoPacketInternal(child, packet) :
-                                     CompressFileIntoPacket(child.physicalName, packet);
-    if (!success)
-      return false;
+    if (is_folder)
+    {
+      WriteFolderIntoPacket(child, file_packet, packet);
+    }
+    else
+    {
+      packet.append((*file_packet)->getData(), (*file_packet)->getDataSize());
+      ++*file_packet;
+    }
   }
-  return true;
 }
 
-bool CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet)
+static bool CompressFolderIntoPacketInternal(const File::FSTEntry& folder, sf::Packet& packet)
 {
-  if (!File::IsDirectory(folder_path))
-  {
-    packet << false;
-    return true;
-  }
+  std::vector<const File::FSTEntry*> files;
+  CollectFolderFiles(folder, &files);
+
+  std::vector<sf::Packet> file_packets;
+  if (!CompressFilesIntoPackets(files, &file_packets))
+    return false;
 
-  packet << true;
-  return CompressFolderIntoPacketInternal(File::ScanDirectoryTree(folder_path, true), packet);
+  // The files were collected in the same order as they are written
+  auto file_packet = file_packets.cbegin();
+  WriteFolderIntoPacket(folder, &file_packet, packet);
+  return true;
 }
 
 bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& packet)
@@ -154,10 +204,7 @@ bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& pack
 
     // The size of the data to write is 'out_len'
     packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
+    packet.append(out_buffer.data(), out_len);
 
     if (cur_len != LZO_IN_LEN)
       break;
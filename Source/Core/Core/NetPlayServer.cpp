@@ -294,6 +294,8 @@ void NetPlayServer::ThreadFunc()
       INFO_LOG_FMT(NETPLAY, "Processing async queue event done.");
       m_async_queue.Pop();
     }
+    // Send the queued messages right away instead of after the received event has been handled
+    enet_host_flush(m_server);
     if (net > 0)
     {
       switch (netEvent.type)
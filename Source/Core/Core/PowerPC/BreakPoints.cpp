@@ -290,6 +290,7 @@ void MemChecks::Add(TMemCheck memory_check)
   {
     m_mem_checks.emplace_back(std::move(memory_check));
   }
+  RebuildIndex();
   // If this is the first one, clear the JIT cache so it can switch to
   // watchpoint-compatible code.
   if (!had_any)
@@ -320,6 +321,7 @@ void MemChecks::Remove(u32 address)
 
   const Core::CPUThreadGuard guard(m_system);
   m_mem_checks.erase(iter);
+  RebuildIndex();
   if (!HasAny())
     m_system.GetJitInterface().ClearCache(guard);
   m_system.GetMMU().DBATUpdated();
@@ -329,22 +331,60 @@ void MemChecks::Clear()
 {
   const Core::CPUThreadGuard guard(m_system);
   m_mem_checks.clear();
+  m_index.clear();
   m_system.GetJitInterface().ClearCache(guard);
   m_system.GetMMU().DBATUpdated();
 }
 
+void MemChecks::RebuildIndex()
+{
+  m_index.clear();
+  m_index.reserve(m_mem_checks.size());
+  for (size_t i = 0; i < m_mem_checks.size(); ++i)
+  {
+    const TMemCheck& mc = m_mem_checks[i];
+    m_index.push_back({mc.start_address, mc.end_address, 0, static_cast<u32>(i)});
+  }
+
+  std::ranges::sort(m_index, {}, &IndexEntry::start_address);
+
+  u32 max_end_address = 0;
+  for (IndexEntry& entry : m_index)
+  {
+    max_end_address = std::max(max_end_address, entry.end_address);
+    entry.max_end_address = max_end_address;
+  }
+}
+
+std::optional<size_t> MemChecks::FindOverlapping(u32 start, u64 end) const
+{
+  // Only entries starting at or before the end of the range can overlap it. Walking those
+  // backwards, max_end_address tells when none of the remaining ones reach the range.
+  auto iter = std::ranges::upper_bound(m_index, end, {}, [](const IndexEntry& entry) -> u64 {
+    return entry.start_address;
+  });
+
+  std::optional<size_t> result;
+  while (iter != m_index.begin())
+  {
+    --iter;
+    if (iter->max_end_address < start)
+      break;
+    if (iter->end_address >= start && (!result || iter->mem_check_index < *result))
+      result = iter->mem_check_index;
+  }
+  return result;
+}
+
 TMemCheck* MemChecks::GetMemCheck(u32 address, size_t size)
 {
-  const auto iter =
-      std::find_if(m_mem_checks.begin(), m_mem_checks.end(), [address, size](const auto& mc) {
-        return mc.end_address >= address && address + size - 1 >= mc.start_address;
-      });
+  const std::optional<size_t> index = FindOverlapping(address, u64(address) + size - 1);
 
   // None found
-  if (iter == m_mem_checks.cend())
+  if (!index)
     return nullptr;
 
-  return &*iter;
+  return &m_mem_checks[*index];
 }
 
 bool MemChecks::OverlapsMemcheck(u32 address, u32 length) const
@@ -355,12 +395,7 @@ bool MemChecks::OverlapsMemcheck(u32 address, u32 length) const
   const u32 page_end_suffix = length - 1;
   const u32 page_end_address = address | page_end_suffix;
 
-  return std::any_of(m_mem_checks.cbegin(), m_mem_checks.cend(), [&](const auto& mc) {
-    return ((mc.start_address | page_end_suffix) == page_end_address ||
-            (mc.end_address | page_end_suffix) == page_end_address) ||
-           ((mc.start_address | page_end_suffix) < page_end_address &&
-            (mc.end_address | page_end_suffix) > page_end_address);
-  });
+  return FindOverlapping(page_end_address - page_end_suffix, page_end_address).has_value();
 }
 
 bool TMemCheck::Action(Core::System& system, u64 value, u32 addr, bool write, size_t size, u32 pc)
@@ -122,6 +122,21 @@ public:
   bool HasAny() const { return !m_mem_checks.empty(); }
 
 private:
+  // The memchecks sorted by start address, so that lookups don't have to go through all of them.
+  struct IndexEntry
+  {
+    u32 start_address;
+    u32 end_address;
+    // The highest end address of this entry and all entries before it
+    u32 max_end_address;
+    u32 mem_check_index;
+  };
+
+  void RebuildIndex();
+  // Returns the first memcheck (in the order they were added) overlapping [start, end]
+  std::optional<size_t> FindOverlapping(u32 start, u64 end) const;
+
   TMemChecks m_mem_checks;
+  std::vector<IndexEntry> m_index;
   Core::System& m_system;
 };
@@ -5,6 +5,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
+#include "Common/TraceProfiler.h"
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
 #include "Core/HLE/HLE.h"
@@ -24,42 +25,73 @@ struct CachedInterpreter::Instruction
   using CachedInterpreterCallback = void (*)(CachedInterpreter&, UGeckoInstruction);
   using ConditionalCachedInterpreterCallback = bool (*)(CachedInterpreter&, u32);
 
+  // Runs the instruction and returns whether the block should be exited. Storing a handler for
+  // each kind of callback lets ExecuteOneBlock thread through the instructions with a single
+  // indirect call each, instead of dispatching on a type tag first.
+  using Handler = bool (*)(CachedInterpreter&, const Instruction&);
+
   Instruction() {}
   Instruction(const CommonCallback c, UGeckoInstruction i)
-      : common_callback(c), data(i.hex), type(Type::Common)
+      : common_callback(c), data(i.hex), handler(CallCommon)
   {
   }
 
   Instruction(const ConditionalCallback c, u32 d)
-      : conditional_callback(c), data(d), type(Type::Conditional)
+      : conditional_callback(c), data(d), handler(CallConditional)
   {
   }
 
   Instruction(const InterpreterCallback c, UGeckoInstruction i)
-      : interpreter_callback(c), data(i.hex), type(Type::Interpreter)
+      : interpreter_callback(c), data(i.hex), handler(CallInterpreter)
   {
   }
 
   Instruction(const CachedInterpreterCallback c, UGeckoInstruction i)
-      : cached_interpreter_callback(c), data(i.hex), type(Type::CachedInterpreter)
+      : cached_interpreter_callback(c), data(i.hex), handler(CallCachedInterpreter)
   {
   }
 
   Instruction(const ConditionalCachedInterpreterCallback c, u32 d)
       : conditional_cached_interpreter_callback(c), data(d),
-        type(Type::ConditionalCachedInterpreter)
+        handler(CallConditionalCachedInterpreter)
   {
   }
 
-  enum class Type
+  static bool Abort(CachedInterpreter&, const Instruction&) { return true; }
+
+  static bool CallCommon(CachedInterpreter&, const Instruction& instruction)
   {
-    Abort,
-    Common,
-    Conditional,
-    Interpreter,
-    CachedInterpreter,
-    ConditionalCachedInterpreter,
-  };
+    instruction.common_callback(UGeckoInstruction(instruction.data));
+    return false;
+  }
+
+  static bool CallConditional(CachedInterpreter&, const Instruction& instruction)
+  {
+    return instruction.conditional_callback(instruction.data);
+  }
+
+  static bool CallInterpreter(CachedInterpreter& cached_interpreter,
+                              const Instruction& instruction)
+  {
+    instruction.interpreter_callback(cached_interpreter.m_interpreter,
+                                     UGeckoInstruction(instruction.data));
+    return false;
+  }
+
+  static bool CallCachedInterpreter(CachedInterpreter& cached_interpreter,
+                                    const Instruction& instruction)
+  {
+    instruction.cached_interpreter_callback(cached_interpreter,
+                                            UGeckoInstruction(instruction.data));
+    return false;
+  }
+
+  static bool CallConditionalCachedInterpreter(CachedInterpreter& cached_interpreter,
+                                               const Instruction& instruction)
+  {
+    return instruction.conditional_cached_interpreter_callback(cached_interpreter,
+                                                               instruction.data);
+  }
 
   union
   {
@@ -71,10 +103,11 @@ struct CachedInterpreter::Instruction
   };
 
   u32 data = 0;
-  Type type = Type::Abort;
+  Handler handler = Abort;
 };
 
-CachedInterpreter::CachedInterpreter(Core::System& system) : JitBase(system)
+CachedInterpreter::CachedInterpreter(Core::System& system)
+    : JitBase(system), m_interpreter(system.GetInterpreter())
 {
 }
 
@@ -115,40 +148,8 @@ void CachedInterpreter::ExecuteOneBlock()
   }
 
   const Instruction* code = reinterpret_cast<const Instruction*>(normal_entry);
-  auto& interpreter = m_system.GetInterpreter();
-
-  for (; code->type != Instruction::Type::Abort; ++code)
-  {
-    switch (code->type)
-    {
-    case Instruction::Type::Common:
-      code->common_callback(UGeckoInstruction(code->data));
-      break;
-
-    case Instruction::Type::Conditional:
-      if (code->conditional_callback(code->data))
-        return;
-      break;
-
-    case Instruction::Type::Interpreter:
-      code->interpreter_callback(interpreter, UGeckoInstruction(code->data));
-      break;
-
-    case Instruction::Type::CachedInterpreter:
-      code->cached_interpreter_callback(*this, UGeckoInstruction(code->data));
-      break;
-
-    case Instruction::Type::ConditionalCachedInterpreter:
-      if (code->conditional_cached_interpreter_callback(*this, code->data))
-        return;
-      break;
-
-    default:
-      ERROR_LOG_FMT(POWERPC, "Unknown CachedInterpreter Instruction: {}",
-                    static_cast<int>(code->type));
-      break;
-    }
-  }
+  while (!code->handler(*this, *code))
+    ++code;
 }
 
 void CachedInterpreter::Run()
@@ -288,6 +289,7 @@ bool CachedInterpreter::HandleFunctionHooking(u32 address)
 
 void CachedInterpreter::Jit(u32 address)
 {
+  TRACE_ZONE("JIT compile");
   if (m_code.size() >= CODE_SIZE / sizeof(Instruction) - 0x1000 ||
       SConfig::GetInstance().bJITNoBlockCache)
   {
@@ -10,6 +10,8 @@
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 
+class Interpreter;
+
 class CachedInterpreter : public JitBase
 {
 public:
@@ -56,6 +58,7 @@ private:
   static bool CheckBreakpoint(CachedInterpreter& cached_interpreter, u32 data);
   static bool CheckIdle(CachedInterpreter& cached_interpreter, u32 idle_pc);
 
+  Interpreter& m_interpreter;
   BlockCache m_block_cache{*this};
   std::vector<Instruction> m_code;
 };
@@ -4,6 +4,8 @@
 #include "Core/PowerPC/Expression.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdlib>
 #include <fmt/format.h>
 #include <optional>
@@ -254,6 +256,142 @@ Expression::Expression(std::string_view text, ExprPointer ex, ExprVarListPointer
 
     m_binds.emplace_back(bind);
   }
+
+  Compile();
+}
+
+void Expression::Compile()
+{
+  m_program.clear();
+  m_max_stack_depth = 0;
+  m_compiled = CompileNode(m_expr.get(), 0);
+  if (!m_compiled)
+    m_program.clear();
+}
+
+bool Expression::CompileNode(expr* node, size_t depth)
+{
+  static constexpr std::array<std::pair<expr_type, Opcode>, 3> unary_ops{{
+      {OP_UNARY_MINUS, Opcode::Negate},
+      {OP_UNARY_LOGICAL_NOT, Opcode::LogicalNot},
+      {OP_UNARY_BITWISE_NOT, Opcode::BitwiseNot},
+  }};
+  static constexpr std::array<std::pair<expr_type, Opcode>, 19> binary_ops{{
+      {OP_POWER, Opcode::Power},
+      {OP_MULTIPLY, Opcode::Multiply},
+      {OP_DIVIDE, Opcode::Divide},
+      {OP_REMAINDER, Opcode::Remainder},
+      {OP_PLUS, Opcode::Add},
+      {OP_MINUS, Opcode::Subtract},
+      {OP_SHL, Opcode::ShiftLeft},
+      {OP_SHR, Opcode::ShiftRight},
+      {OP_LT, Opcode::Less},
+      {OP_LE, Opcode::LessEqual},
+      {OP_GT, Opcode::Greater},
+      {OP_GE, Opcode::GreaterEqual},
+      {OP_EQ, Opcode::Equal},
+      {OP_NE, Opcode::NotEqual},
+      {OP_BITWISE_AND, Opcode::BitwiseAnd},
+      {OP_BITWISE_OR, Opcode::BitwiseOr},
+      {OP_BITWISE_XOR, Opcode::BitwiseXor},
+      {OP_LOGICAL_AND, Opcode::JumpIfZero},
+      {OP_LOGICAL_OR, Opcode::JumpIfNonZero},
+  }};
+
+  if (depth >= MAX_STACK_DEPTH)
+    return false;
+  m_max_stack_depth = std::max(m_max_stack_depth, depth + 1);
+
+  const auto find_op = [node](const auto& ops) {
+    return std::find_if(ops.begin(), ops.end(),
+                        [node](const auto& op) { return op.first == node->type; });
+  };
+
+  switch (node->type)
+  {
+  case OP_CONST:
+    m_program.push_back({Opcode::PushConstant, 0, node->param.num.value});
+    return true;
+  case OP_VAR:
+  {
+    auto bind = m_binds.begin();
+    auto* v = m_vars->head;
+    while (v != nullptr && &v->value != node->param.var.value)
+      v = v->next, ++bind;
+    if (v == nullptr)
+      return false;
+
+    switch (bind->type)
+    {
+    case VarBindingType::Zero:
+      m_program.push_back({Opcode::PushConstant, 0, 0.0});
+      break;
+    case VarBindingType::GPR:
+      m_program.push_back({Opcode::LoadGPR, bind->index});
+      break;
+    case VarBindingType::FPR:
+      m_program.push_back({Opcode::LoadFPR, bind->index});
+      m_reads_fpr = true;
+      break;
+    case VarBindingType::SPR:
+      m_program.push_back({Opcode::LoadSPR, bind->index});
+      break;
+    case VarBindingType::PCtr:
+      m_program.push_back({Opcode::LoadPC});
+      break;
+    }
+    return true;
+  }
+  case OP_FUNC:
+    // Functions evaluate their arguments through expr_eval, which reads the variable list, so
+    // the bindings are synchronized lazily before the first call.
+    m_program.push_back({Opcode::CallFunction, 0, 0.0, node});
+    return true;
+  case OP_COMMA:
+    if (!CompileNode(&vec_nth(&node->param.op.args, 0), depth))
+      return false;
+    m_program.push_back({Opcode::Pop});
+    return CompileNode(&vec_nth(&node->param.op.args, 1), depth);
+  case OP_ASSIGN:
+    // Assignments write back into registers and are left to the interpreter.
+    return false;
+  default:
+    break;
+  }
+
+  if (const auto op = find_op(unary_ops); op != unary_ops.end())
+  {
+    if (!CompileNode(&vec_nth(&node->param.op.args, 0), depth))
+      return false;
+    m_program.push_back({op->second});
+    return true;
+  }
+
+  if (const auto op = find_op(binary_ops); op != binary_ops.end())
+  {
+    if (!CompileNode(&vec_nth(&node->param.op.args, 0), depth))
+      return false;
+
+    if (op->second == Opcode::JumpIfZero || op->second == Opcode::JumpIfNonZero)
+    {
+      const size_t jump = m_program.size();
+      m_program.push_back({op->second});
+      if (!CompileNode(&vec_nth(&node->param.op.args, 1), depth))
+        return false;
+      m_program.push_back({Opcode::NormalizeZero});
+      m_program[jump].operand = static_cast<int>(m_program.size());
+      return true;
+    }
+
+    if (!CompileNode(&vec_nth(&node->param.op.args, 1), depth + 1))
+      return false;
+    m_program.push_back({op->second});
+    return true;
+  }
+
+  // Strings and unknown nodes evaluate to NaN.
+  m_program.push_back({Opcode::PushConstant, 0, NAN});
+  return true;
 }
 
 std::optional<Expression> Expression::TryParse(std::string_view text)
@@ -268,6 +406,21 @@ std::optional<Expression> Expression::TryParse(std::string_view text)
 
 double Expression::Evaluate(Core::System& system) const
 {
+  if (m_compiled)
+  {
+    const double result = Execute(system);
+
+    // Only FPR bindings can hold a NaN, so the variables need to be synchronized for reporting
+    // just when the condition passed or something could have gone NaN.
+    if (result != 0.0 || std::isnan(result) || m_reads_fpr)
+    {
+      SynchronizeBindings(system, SynchronizeDirection::From);
+      Reporting(result);
+    }
+
+    return result;
+  }
+
   SynchronizeBindings(system, SynchronizeDirection::From);
 
   double result = expr_eval(m_expr.get());
@@ -279,6 +432,140 @@ double Expression::Evaluate(Core::System& system) const
   return result;
 }
 
+double Expression::Execute(Core::System& system) const
+{
+  auto& ppc_state = system.GetPPCState();
+  std::array<double, MAX_STACK_DEPTH> stack;
+  size_t sp = 0;
+  bool synchronized = false;
+
+  const auto binary = [&stack, &sp](auto op) {
+    --sp;
+    stack[sp - 1] = op(stack[sp - 1], stack[sp]);
+  };
+
+  for (size_t pc = 0; pc < m_program.size(); ++pc)
+  {
+    const Instruction& inst = m_program[pc];
+    switch (inst.opcode)
+    {
+    case Opcode::PushConstant:
+      stack[sp++] = inst.constant;
+      break;
+    case Opcode::LoadGPR:
+      stack[sp++] = static_cast<double>(ppc_state.gpr[inst.operand]);
+      break;
+    case Opcode::LoadFPR:
+      stack[sp++] = ppc_state.ps[inst.operand].PS0AsDouble();
+      break;
+    case Opcode::LoadSPR:
+      stack[sp++] = static_cast<double>(ppc_state.spr[inst.operand]);
+      break;
+    case Opcode::LoadPC:
+      stack[sp++] = static_cast<double>(ppc_state.pc);
+      break;
+    case Opcode::CallFunction:
+    {
+      if (!synchronized)
+      {
+        SynchronizeBindings(system, SynchronizeDirection::From);
+        synchronized = true;
+      }
+      expr* const e = inst.function;
+      stack[sp++] = e->param.func.f->f(e->param.func.f, &e->param.func.args,
+                                       e->param.func.context);
+      break;
+    }
+    case Opcode::Negate:
+      stack[sp - 1] = -stack[sp - 1];
+      break;
+    case Opcode::LogicalNot:
+      stack[sp - 1] = !stack[sp - 1];
+      break;
+    case Opcode::BitwiseNot:
+      stack[sp - 1] = ~to_int(stack[sp - 1]);
+      break;
+    case Opcode::Power:
+      binary([](double a, double b) { return std::pow(a, b); });
+      break;
+    case Opcode::Multiply:
+      binary([](double a, double b) { return a * b; });
+      break;
+    case Opcode::Divide:
+      binary([](double a, double b) { return a / b; });
+      break;
+    case Opcode::Remainder:
+      binary([](double a, double b) { return std::fmod(a, b); });
+      break;
+    case Opcode::Add:
+      binary([](double a, double b) { return a + b; });
+      break;
+    case Opcode::Subtract:
+      binary([](double a, double b) { return a - b; });
+      break;
+    case Opcode::ShiftLeft:
+      binary([](double a, double b) { return to_int(a) << to_int(b); });
+      break;
+    case Opcode::ShiftRight:
+      binary([](double a, double b) { return to_int(a) >> to_int(b); });
+      break;
+    case Opcode::Less:
+      binary([](double a, double b) { return a < b; });
+      break;
+    case Opcode::LessEqual:
+      binary([](double a, double b) { return a <= b; });
+      break;
+    case Opcode::Greater:
+      binary([](double a, double b) { return a > b; });
+      break;
+    case Opcode::GreaterEqual:
+      binary([](double a, double b) { return a >= b; });
+      break;
+    case Opcode::Equal:
+      binary([](double a, double b) { return a == b; });
+      break;
+    case Opcode::NotEqual:
+      binary([](double a, double b) { return a != b; });
+      break;
+    case Opcode::BitwiseAnd:
+      binary([](double a, double b) { return to_int(a) & to_int(b); });
+      break;
+    case Opcode::BitwiseOr:
+      binary([](double a, double b) { return to_int(a) | to_int(b); });
+      break;
+    case Opcode::BitwiseXor:
+      binary([](double a, double b) { return to_int(a) ^ to_int(b); });
+      break;
+    case Opcode::JumpIfZero:
+      if (stack[sp - 1] == 0)
+      {
+        stack[sp - 1] = 0;
+        pc = inst.operand - 1;
+      }
+      else
+      {
+        --sp;
+      }
+      break;
+    case Opcode::JumpIfNonZero:
+      if (stack[sp - 1] != 0 && !std::isnan(stack[sp - 1]))
+        pc = inst.operand - 1;
+      else
+        --sp;
+      break;
+    case Opcode::NormalizeZero:
+      if (stack[sp - 1] == 0)
+        stack[sp - 1] = 0;
+      break;
+    case Opcode::Pop:
+      --sp;
+      break;
+    }
+  }
+
+  return stack[0];
+}
+
 void Expression::SynchronizeBindings(Core::System& system, SynchronizeDirection dir) const
 {
   auto& ppc_state = system.GetPPCState();
@@ -320,15 +607,15 @@ void Expression::SynchronizeBindings(Core::System& system, SynchronizeDirection
 void Expression::Reporting(const double result) const
 {
   bool is_nan = std::isnan(result);
-  std::string message;
+  for (auto* v = m_vars->head; v != nullptr && !is_nan; v = v->next)
+    is_nan = std::isnan(v->value);
 
-  for (auto* v = m_vars->head; v != nullptr; v = v->next)
-  {
-    if (std::isnan(v->value))
-      is_nan = true;
+  if (result == 0.0 && !is_nan)
+    return;
 
+  std::string message;
+  for (auto* v = m_vars->head; v != nullptr; v = v->next)
     fmt::format_to(std::back_inserter(message), "  {}={}", v->name, v->value);
-  }
 
   if (is_nan)
   {
@@ -336,8 +623,7 @@ void Expression::Reporting(const double result) const
     Core::DisplayMessage("Breakpoint condition has encountered a NaN.", 2000);
   }
 
-  if (result != 0.0 || is_nan)
-    NOTICE_LOG_FMT(MEMMAP, "Breakpoint condition returned: {}. Vars:{}", result, message);
+  NOTICE_LOG_FMT(MEMMAP, "Breakpoint condition returned: {}. Vars:{}", result, message);
 }
 
 std::string Expression::GetText() const
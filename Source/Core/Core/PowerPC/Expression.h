@@ -63,8 +63,60 @@ private:
     int index = -1;
   };
 
+  // Expressions without assignments are compiled to a flat stack program whose variable loads
+  // read the bound registers directly, so evaluating them does not need to walk the expr tree or
+  // synchronize every variable beforehand.
+  enum class Opcode
+  {
+    PushConstant,
+    LoadGPR,
+    LoadFPR,
+    LoadSPR,
+    LoadPC,
+    CallFunction,
+    Negate,
+    LogicalNot,
+    BitwiseNot,
+    Power,
+    Multiply,
+    Divide,
+    Remainder,
+    Add,
+    Subtract,
+    ShiftLeft,
+    ShiftRight,
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+    Equal,
+    NotEqual,
+    BitwiseAnd,
+    BitwiseOr,
+    BitwiseXor,
+    // Short-circuit the right operand of && and ||, leaving the result on the stack.
+    JumpIfZero,
+    JumpIfNonZero,
+    NormalizeZero,
+    Pop,
+  };
+
+  struct Instruction
+  {
+    Opcode opcode;
+    int operand = 0;
+    double constant = 0.0;
+    expr* function = nullptr;
+  };
+
+  static constexpr size_t MAX_STACK_DEPTH = 64;
+
   Expression(std::string_view text, ExprPointer ex, ExprVarListPointer vars);
 
+  void Compile();
+  bool CompileNode(expr* node, size_t depth);
+  double Execute(Core::System& system) const;
+
   void SynchronizeBindings(Core::System& system, SynchronizeDirection dir) const;
   void Reporting(const double result) const;
 
@@ -72,6 +124,10 @@ private:
   ExprPointer m_expr;
   ExprVarListPointer m_vars;
   std::vector<VarBinding> m_binds;
+  std::vector<Instruction> m_program;
+  size_t m_max_stack_depth = 0;
+  bool m_compiled = false;
+  bool m_reads_fpr = false;
 };
 
 inline bool EvaluateCondition(Core::System& system, const std::optional<Expression>& condition)
@@ -8,6 +8,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/FloatUtils.h"
 #include "Core/PowerPC/Interpreter/Interpreter_FPUtils.h"
+#include "Core/PowerPC/Interpreter/Interpreter_PairedUtils.h"
 #include "Core/PowerPC/PowerPC.h"
 
 // These "binary instructions" do not alter FPSCR.
@@ -120,12 +121,32 @@ void Interpreter::ps_merge11(Interpreter& interpreter, UGeckoInstruction inst)
 }
 
 // From here on, the real deal.
+
+// Writes the result of one of the TryPaired* fast paths, if it was taken.
+static bool StorePairedResult(PowerPC::PowerPCState& ppc_state, UGeckoInstruction inst,
+                              const std::optional<PairedSingleResult>& result)
+{
+  if (!result)
+    return false;
+
+  ppc_state.ps[inst.FD].SetBoth(result->ps0, result->ps1);
+  ppc_state.UpdateFPRFSingle(result->ps0);
+
+  if (inst.Rc)
+    ppc_state.UpdateCR1();
+
+  return true;
+}
+
 void Interpreter::ps_div(Interpreter& interpreter, UGeckoInstruction inst)
 {
   auto& ppc_state = interpreter.m_ppc_state;
   const auto& a = ppc_state.ps[inst.FA];
   const auto& b = ppc_state.ps[inst.FB];
 
+  if (StorePairedResult(ppc_state, inst, TryPairedDiv(ppc_state.fpscr, a, b)))
+    return;
+
   const float ps0 =
       ForceSingle(ppc_state.fpscr, NI_div(ppc_state, a.PS0AsDouble(), b.PS0AsDouble()).value);
   const float ps1 =
@@ -207,6 +228,9 @@ void Interpreter::ps_sub(Interpreter& interpreter, UGeckoInstruction inst)
   const auto& a = ppc_state.ps[inst.FA];
   const auto& b = ppc_state.ps[inst.FB];
 
+  if (StorePairedResult(ppc_state, inst, TryPairedSub(ppc_state.fpscr, a, b)))
+    return;
+
   const float ps0 =
       ForceSingle(ppc_state.fpscr, NI_sub(ppc_state, a.PS0AsDouble(), b.PS0AsDouble()).value);
   const float ps1 =
@@ -225,6 +249,9 @@ void Interpreter::ps_add(Interpreter& interpreter, UGeckoInstruction inst)
   const auto& a = ppc_state.ps[inst.FA];
   const auto& b = ppc_state.ps[inst.FB];
 
+  if (StorePairedResult(ppc_state, inst, TryPairedAdd(ppc_state.fpscr, a, b)))
+    return;
+
   const float ps0 =
       ForceSingle(ppc_state.fpscr, NI_add(ppc_state, a.PS0AsDouble(), b.PS0AsDouble()).value);
   const float ps1 =
@@ -243,6 +270,9 @@ void Interpreter::ps_mul(Interpreter& interpreter, UGeckoInstruction inst)
   const auto& a = ppc_state.ps[inst.FA];
   const auto& c = ppc_state.ps[inst.FC];
 
+  if (StorePairedResult(ppc_state, inst, TryPairedMul(ppc_state.fpscr, a, c)))
+    return;
+
   const double c0 = Force25Bit(c.PS0AsDouble());
   const double c1 = Force25Bit(c.PS1AsDouble());
 
@@ -263,6 +293,9 @@ void Interpreter::ps_msub(Interpreter& interpreter, UGeckoInstruction inst)
   const auto& b = ppc_state.ps[inst.FB];
   const auto& c = ppc_state.ps[inst.FC];
 
+  if (StorePairedResult(ppc_state, inst, TryPairedMulAdd(ppc_state.fpscr, a, c, b, true, false)))
+    return;
+
   const double c0 = Force25Bit(c.PS0AsDouble());
   const double c1 = Force25Bit(c.PS1AsDouble());
 
@@ -285,6 +318,9 @@ void Interpreter::ps_madd(Interpreter& interpreter, UGeckoInstruction inst)
   const auto& b = ppc_state.ps[inst.FB];
   const auto& c = ppc_state.ps[inst.FC];
 
+  if (StorePairedResult(ppc_state, inst, TryPairedMulAdd(ppc_state.fpscr, a, c, b, false, false)))
+    return;
+
   const double c0 = Force25Bit(c.PS0AsDouble());
   const double c1 = Force25Bit(c.PS1AsDouble());
 
@@ -307,6 +343,9 @@ void Interpreter::ps_nmsub(Interpreter& interpreter, UGeckoInstruction inst)
   const auto& b = ppc_state.ps[inst.FB];
   const auto& c = ppc_state.ps[inst.FC];
 
+  if (StorePairedResult(ppc_state, inst, TryPairedMulAdd(ppc_state.fpscr, a, c, b, true, true)))
+    return;
+
   const double c0 = Force25Bit(c.PS0AsDouble());
   const double c1 = Force25Bit(c.PS1AsDouble());
 
@@ -332,6 +371,9 @@ void Interpreter::ps_nmadd(Interpreter& interpreter, UGeckoInstruction inst)
   const auto& b = ppc_state.ps[inst.FB];
   const auto& c = ppc_state.ps[inst.FC];
 
+  if (StorePairedResult(ppc_state, inst, TryPairedMulAdd(ppc_state.fpscr, a, c, b, false, true)))
+    return;
+
   const double c0 = Force25Bit(c.PS0AsDouble());
   const double c1 = Force25Bit(c.PS1AsDouble());
 
@@ -0,0 +1,301 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cmath>
+#include <optional>
+
+#include "Common/BitUtils.h"
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/PowerPC.h"
+
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+// Fast paths computing both slots of paired single arithmetic at once.
+//
+// When every input is finite, the NI_* helpers neither touch the FPSCR nor change the result of
+// the host operation, and when FPSCR.NI is clear, ForceSingle is a plain conversion. These
+// functions only handle that case and return std::nullopt otherwise, leaving NaN, infinity and
+// non-IEEE mode handling to the scalar path.
+
+struct PairedSingleResult
+{
+  float ps0;
+  float ps1;
+};
+
+namespace PairedUtils
+{
+#if defined(_M_X86_64)
+using Vector = __m128d;
+
+inline Vector Load(const PowerPC::PairedSingle& ps)
+{
+  return _mm_castsi128_pd(_mm_set_epi64x(static_cast<s64>(ps.ps1), static_cast<s64>(ps.ps0)));
+}
+
+inline bool AllFinite(Vector v)
+{
+  // x - x is NaN exactly when x is infinite or NaN.
+  const Vector difference = _mm_sub_pd(v, v);
+  return _mm_movemask_pd(_mm_cmpord_pd(difference, difference)) == 0b11;
+}
+
+inline bool AllNonZero(Vector v)
+{
+  return _mm_movemask_pd(_mm_cmpneq_pd(v, _mm_setzero_pd())) == 0b11;
+}
+
+inline Vector Force25Bit(Vector v)
+{
+  const __m128i integral = _mm_castpd_si128(v);
+  const __m128i truncated = _mm_and_si128(integral, _mm_set1_epi64x(0xFFFFFFFFF8000000ULL));
+  const __m128i round_bit = _mm_and_si128(integral, _mm_set1_epi64x(0x8000000));
+  return _mm_castsi128_pd(_mm_add_epi64(truncated, round_bit));
+}
+
+inline Vector Add(Vector a, Vector b)
+{
+  return _mm_add_pd(a, b);
+}
+
+inline Vector Sub(Vector a, Vector b)
+{
+  return _mm_sub_pd(a, b);
+}
+
+inline Vector Mul(Vector a, Vector b)
+{
+  return _mm_mul_pd(a, b);
+}
+
+inline Vector Div(Vector a, Vector b)
+{
+  return _mm_div_pd(a, b);
+}
+
+// SSE2 has no fused multiply-add, so use the (exact) scalar one for each slot.
+inline Vector MulAdd(Vector a, Vector c, Vector b)
+{
+  const double ps0 = std::fma(_mm_cvtsd_f64(a), _mm_cvtsd_f64(c), _mm_cvtsd_f64(b));
+  const double ps1 = std::fma(_mm_cvtsd_f64(_mm_unpackhi_pd(a, a)),
+                              _mm_cvtsd_f64(_mm_unpackhi_pd(c, c)),
+                              _mm_cvtsd_f64(_mm_unpackhi_pd(b, b)));
+  return _mm_set_pd(ps1, ps0);
+}
+
+inline Vector Negate(Vector v)
+{
+  return _mm_xor_pd(v, _mm_set1_pd(-0.0));
+}
+
+inline PairedSingleResult ToSingle(Vector v)
+{
+  const __m128 singles = _mm_cvtpd_ps(v);
+  return {_mm_cvtss_f32(singles), _mm_cvtss_f32(_mm_shuffle_ps(singles, singles, 1))};
+}
+#elif defined(_M_ARM_64)
+using Vector = float64x2_t;
+
+inline Vector Load(const PowerPC::PairedSingle& ps)
+{
+  return vreinterpretq_f64_u64(vcombine_u64(vcreate_u64(ps.ps0), vcreate_u64(ps.ps1)));
+}
+
+inline bool AllFinite(Vector v)
+{
+  // x - x is NaN exactly when x is infinite or NaN.
+  const Vector difference = vsubq_f64(v, v);
+  return vminvq_u32(vreinterpretq_u32_u64(vceqq_f64(difference, difference))) == 0xFFFFFFFF;
+}
+
+inline bool AllNonZero(Vector v)
+{
+  return vmaxvq_u32(vreinterpretq_u32_u64(vceqzq_f64(v))) == 0;
+}
+
+inline Vector Force25Bit(Vector v)
+{
+  const uint64x2_t integral = vreinterpretq_u64_f64(v);
+  const uint64x2_t truncated = vandq_u64(integral, vdupq_n_u64(0xFFFFFFFFF8000000ULL));
+  const uint64x2_t round_bit = vandq_u64(integral, vdupq_n_u64(0x8000000));
+  return vreinterpretq_f64_u64(vaddq_u64(truncated, round_bit));
+}
+
+inline Vector Add(Vector a, Vector b)
+{
+  return vaddq_f64(a, b);
+}
+
+inline Vector Sub(Vector a, Vector b)
+{
+  return vsubq_f64(a, b);
+}
+
+inline Vector Mul(Vector a, Vector b)
+{
+  return vmulq_f64(a, b);
+}
+
+inline Vector Div(Vector a, Vector b)
+{
+  return vdivq_f64(a, b);
+}
+
+inline Vector MulAdd(Vector a, Vector c, Vector b)
+{
+  return vfmaq_f64(b, a, c);
+}
+
+inline Vector Negate(Vector v)
+{
+  return vnegq_f64(v);
+}
+
+inline PairedSingleResult ToSingle(Vector v)
+{
+  const float32x2_t singles = vcvt_f32_f64(v);
+  return {vget_lane_f32(singles, 0), vget_lane_f32(singles, 1)};
+}
+#else
+struct Vector
+{
+  double ps0;
+  double ps1;
+};
+
+inline Vector Load(const PowerPC::PairedSingle& ps)
+{
+  return {Common::BitCast<double>(ps.ps0), Common::BitCast<double>(ps.ps1)};
+}
+
+inline bool AllFinite(Vector v)
+{
+  return std::isfinite(v.ps0) && std::isfinite(v.ps1);
+}
+
+inline bool AllNonZero(Vector v)
+{
+  return v.ps0 != 0.0 && v.ps1 != 0.0;
+}
+
+inline Vector Force25Bit(Vector v)
+{
+  const auto force = [](double d) {
+    const u64 integral = Common::BitCast<u64>(d);
+    return Common::BitCast<double>((integral & 0xFFFFFFFFF8000000ULL) + (integral & 0x8000000));
+  };
+  return {force(v.ps0), force(v.ps1)};
+}
+
+inline Vector Add(Vector a, Vector b)
+{
+  return {a.ps0 + b.ps0, a.ps1 + b.ps1};
+}
+
+inline Vector Sub(Vector a, Vector b)
+{
+  return {a.ps0 - b.ps0, a.ps1 - b.ps1};
+}
+
+inline Vector Mul(Vector a, Vector b)
+{
+  return {a.ps0 * b.ps0, a.ps1 * b.ps1};
+}
+
+inline Vector Div(Vector a, Vector b)
+{
+  return {a.ps0 / b.ps0, a.ps1 / b.ps1};
+}
+
+inline Vector MulAdd(Vector a, Vector c, Vector b)
+{
+  return {std::fma(a.ps0, c.ps0, b.ps0), std::fma(a.ps1, c.ps1, b.ps1)};
+}
+
+inline Vector Negate(Vector v)
+{
+  return {-v.ps0, -v.ps1};
+}
+
+inline PairedSingleResult ToSingle(Vector v)
+{
+  return {static_cast<float>(v.ps0), static_cast<float>(v.ps1)};
+}
+#endif
+}  // namespace PairedUtils
+
+inline std::optional<PairedSingleResult> TryPairedAdd(const UReg_FPSCR& fpscr,
+                                                      const PowerPC::PairedSingle& a,
+                                                      const PowerPC::PairedSingle& b)
+{
+  using namespace PairedUtils;
+  const Vector va = Load(a);
+  const Vector vb = Load(b);
+  if (fpscr.NI || !AllFinite(va) || !AllFinite(vb))
+    return std::nullopt;
+  return ToSingle(Add(va, vb));
+}
+
+inline std::optional<PairedSingleResult> TryPairedSub(const UReg_FPSCR& fpscr,
+                                                      const PowerPC::PairedSingle& a,
+                                                      const PowerPC::PairedSingle& b)
+{
+  using namespace PairedUtils;
+  const Vector va = Load(a);
+  const Vector vb = Load(b);
+  if (fpscr.NI || !AllFinite(va) || !AllFinite(vb))
+    return std::nullopt;
+  return ToSingle(Sub(va, vb));
+}
+
+inline std::optional<PairedSingleResult> TryPairedMul(const UReg_FPSCR& fpscr,
+                                                      const PowerPC::PairedSingle& a,
+                                                      const PowerPC::PairedSingle& c)
+{
+  using namespace PairedUtils;
+  const Vector va = Load(a);
+  const Vector vc = Force25Bit(Load(c));
+  if (fpscr.NI || !AllFinite(va) || !AllFinite(vc))
+    return std::nullopt;
+  return ToSingle(Mul(va, vc));
+}
+
+inline std::optional<PairedSingleResult> TryPairedDiv(const UReg_FPSCR& fpscr,
+                                                      const PowerPC::PairedSingle& a,
+                                                      const PowerPC::PairedSingle& b)
+{
+  using namespace PairedUtils;
+  const Vector va = Load(a);
+  const Vector vb = Load(b);
+  // Division by zero sets FPSCR.ZX, so it is left to the scalar path.
+  if (fpscr.NI || !AllFinite(va) || !AllFinite(vb) || !AllNonZero(vb))
+    return std::nullopt;
+  return ToSingle(Div(va, vb));
+}
+
+// Computes a * c + b, or a * c - b when <subtract> is set, and negates the result when <negate>
+// is set. The operands have no NaNs here, so negating never needs to preserve one.
+inline std::optional<PairedSingleResult>
+TryPairedMulAdd(const UReg_FPSCR& fpscr, const PowerPC::PairedSingle& a,
+                const PowerPC::PairedSingle& c, const PowerPC::PairedSingle& b, bool subtract,
+                bool negate)
+{
+  using namespace PairedUtils;
+  const Vector va = Load(a);
+  const Vector vb = Load(b);
+  const Vector vc = Force25Bit(Load(c));
+  if (fpscr.NI || !AllFinite(va) || !AllFinite(vb) || !AllFinite(vc))
+    return std::nullopt;
+
+  PairedSingleResult result = ToSingle(MulAdd(va, vc, subtract ? Negate(vb) : vb));
+  if (negate)
+    result = {-result.ps0, -result.ps1};
+  return result;
+}
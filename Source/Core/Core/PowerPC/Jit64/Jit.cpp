@@ -21,6 +21,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
+#include "Common/TraceProfiler.h"
 #include "Common/x64ABI.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -172,6 +173,7 @@ bool Jit64::BackPatch(SContext* ctx)
   }
 
   TrampolineInfo& info = it->second;
+  ++js.fastmemFaultCounts[info.pc];
 
   u8* exceptionHandler = nullptr;
   if (jo.memcheck)
@@ -735,6 +737,7 @@ void Jit64::Jit(u32 em_address)
 
 void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
 {
+  TRACE_ZONE("JIT compile");
   CleanUpAfterStackFault();
 
   if (trampolines.IsAlmostFull() || SConfig::GetInstance().bJITNoBlockCache)
@@ -780,10 +783,13 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     }
   }
 
+  const u32 analyzer_options = SetTierAnalyzerOptions(em_address);
+
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
   const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
+  analyzer.SetOptions(analyzer_options);
 
   if (code_block.m_memory_exception)
   {
@@ -824,12 +830,22 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
       blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block.m_physical_addresses);
       return;
     }
+
+    blocks.DiscardBlock(*b);
   }
 
   if (clear_cache_and_retry_on_failure)
   {
     // Code generation failed due to not enough free space in either the near or far code regions.
-    // Clear the entire JIT cache and retry.
+    // Evict the older half of the blocks and retry, which keeps recompilation work low. Each retry
+    // halves the cache again, down to clearing the entire JIT cache.
+    if (const size_t evicted = blocks.EvictOldBlocks(); evicted != 0)
+    {
+      INFO_LOG_FMT(POWERPC, "Evicted {} old blocks from code caches", evicted);
+      Jit(em_address, true);
+      return;
+    }
+
     WARN_LOG_FMT(POWERPC, "flushing code caches, please report if this happens a lot");
     ClearCache();
     Jit(em_address, false);
@@ -879,6 +895,26 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   // TODO: Test if this or AlignCode16 make a difference from GetCodePtr
   b->normalEntry = AlignCode4();
 
+  // Count the entries of baseline tier blocks, and have them recompiled once they're hot.
+  if (js.isBaselineTier)
+  {
+    b->tier_up_countdown = TIER_UP_THRESHOLD;
+
+    SwitchToFarCode();
+    const u8* tier_up = GetCodePtr();
+    MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
+    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_CallFunctionPC(JitInterface::CompileExceptionCheckFromJIT, &m_system.GetJitInterface(),
+                       static_cast<u32>(JitInterface::ExceptionType::TierUp));
+    ABI_PopRegistersAndAdjustStack({}, 0);
+    JMP(asm_routines.dispatcher_no_check, Jump::Near);
+    SwitchToNearCode();
+
+    MOV(64, R(RSCRATCH), ImmPtr(&b->tier_up_countdown));
+    SUB(32, MatR(RSCRATCH), Imm8(1));
+    J_CC(CC_Z, tier_up);
+  }
+
   // Used to get a trace of the last few blocks before a crash, sometimes VERY useful
   if (m_im_here_debug)
   {
@@ -1697,6 +1697,22 @@ void Jit64::divwx(UGeckoInstruction inst)
 
       SetJumpTarget(done);
     }
+    else if (js.op->gprKnownNonNegative[a] &&
+             (MathUtil::IsPow2(divisor) || MathUtil::IsPow2(-static_cast<s64>(divisor))))
+    {
+      // The dividend is known to be non-negative, so no rounding towards zero is needed.
+      const u32 abs_val = static_cast<u32>(std::abs(static_cast<s64>(divisor)));
+
+      if (d != a)
+        MOV(32, Rd, Ra);
+      SHR(32, Rd, Imm8(MathUtil::IntLog2(abs_val)));
+
+      if (divisor < 0)
+        NEG(32, Rd);
+
+      if (inst.OE)
+        GenerateConstantOverflow(false);
+    }
     else if (divisor == 2 || divisor == -2)
     {
       X64Reg tmp = RSCRATCH;
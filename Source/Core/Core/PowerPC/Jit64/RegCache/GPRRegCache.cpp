@@ -59,17 +59,7 @@ BitSet32 GPRRegCache::GetRegUtilization() const
   return m_jit.js.op->gprInUse;
 }
 
-BitSet32 GPRRegCache::CountRegsIn(preg_t preg, u32 lookahead) const
+BitSet32 GPRRegCache::GetRegsIn(u32 op_offset) const
 {
-  BitSet32 regs_used;
-
-  for (u32 i = 1; i < lookahead; i++)
-  {
-    BitSet32 regs_in = m_jit.js.op[i].regsIn;
-    regs_used |= regs_in;
-    if (regs_in[preg])
-      return regs_used;
-  }
-
-  return regs_used;
+  return m_jit.js.op[op_offset].regsIn;
 }
@@ -601,6 +601,7 @@ X64Reg RegCache::GetFreeXReg()
 
   // Okay, not found; run the register allocator heuristic and
   // figure out which register we should clobber.
+  const std::array<u32, 32> regs_in_counts = CountRegsIn();
   float min_score = std::numeric_limits<float>::max();
   X64Reg best_xreg = INVALID_REG;
   size_t best_preg = 0;
@@ -610,7 +611,7 @@ X64Reg RegCache::GetFreeXReg()
     if (m_xregs[xreg].IsLocked() || m_regs[preg].IsLocked())
       continue;
 
-    const float score = ScoreRegister(xreg);
+    const float score = ScoreRegister(xreg, regs_in_counts);
     if (score < min_score)
     {
       min_score = score;
@@ -641,9 +642,37 @@ int RegCache::NumFreeRegisters() const
   return count;
 }
 
+// For every register, count how many registers are going to be used before it's needed again
+// (including itself). This is done in a single pass over the upcoming instructions, rather than
+// once for every register the allocator considers clobbering.
+std::array<u32, 32> RegCache::CountRegsIn() const
+{
+  // Don't look too far ahead; we don't want to have quadratic compilation times for
+  // enormous block sizes!
+  // This actually improves register allocation a tiny bit; I'm not sure why.
+  const u32 lookahead = std::min(m_jit.js.instructionsLeft, 64);
+
+  std::array<u32, 32> counts{};
+  BitSet32 regs_used;
+  BitSet32 regs_seen;
+  for (u32 i = 1; i < lookahead; i++)
+  {
+    const BitSet32 regs_in = GetRegsIn(i);
+    regs_used |= regs_in;
+    for (const int preg : regs_in & ~regs_seen)
+      counts[preg] = regs_used.Count();
+    regs_seen |= regs_in;
+  }
+
+  for (const int preg : ~regs_seen)
+    counts[preg] = regs_used.Count();
+
+  return counts;
+}
+
 // Estimate roughly how bad it would be to de-allocate this register. Higher score
 // means more bad.
-float RegCache::ScoreRegister(X64Reg xreg) const
+float RegCache::ScoreRegister(X64Reg xreg, const std::array<u32, 32>& regs_in_counts) const
 {
   preg_t preg = m_xregs[xreg].Contents();
   float score = 0;
@@ -659,12 +688,8 @@ float RegCache::ScoreRegister(X64Reg xreg) const
   // writing it back to the register file isn't quite as bad.
   if (GetRegUtilization()[preg])
   {
-    // Don't look too far ahead; we don't want to have quadratic compilation times for
-    // enormous block sizes!
-    // This actually improves register allocation a tiny bit; I'm not sure why.
-    u32 lookahead = std::min(m_jit.js.instructionsLeft, 64);
     // Count how many other registers are going to be used before we need this one again.
-    u32 regs_in_count = CountRegsIn(preg, lookahead).Count();
+    const u32 regs_in_count = regs_in_counts[preg];
     // Totally ad-hoc heuristic to bias based on how many other registers we'll need
     // before this one gets used again.
     score += 1 + 2 * (5 - log2f(1 + (float)regs_in_count));
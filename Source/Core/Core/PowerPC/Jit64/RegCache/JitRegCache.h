@@ -191,7 +191,8 @@ protected:
   virtual std::span<const Gen::X64Reg> GetAllocationOrder() const = 0;
 
   virtual BitSet32 GetRegUtilization() const = 0;
-  virtual BitSet32 CountRegsIn(preg_t preg, u32 lookahead) const = 0;
+  // Registers read by the instruction op_offset instructions after the current one.
+  virtual BitSet32 GetRegsIn(u32 op_offset) const = 0;
 
   void FlushX(Gen::X64Reg reg);
   void DiscardRegContentsIfCached(preg_t preg);
@@ -201,7 +202,8 @@ protected:
   Gen::X64Reg GetFreeXReg();
 
   int NumFreeRegisters() const;
-  float ScoreRegister(Gen::X64Reg xreg) const;
+  std::array<u32, 32> CountRegsIn() const;
+  float ScoreRegister(Gen::X64Reg xreg, const std::array<u32, 32>& regs_in_counts) const;
 
   const Gen::OpArg& R(preg_t preg) const;
   Gen::X64Reg RX(preg_t preg) const;
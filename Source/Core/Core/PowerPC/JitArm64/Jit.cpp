@@ -4,6 +4,7 @@
 #include "Core/PowerPC/JitArm64/Jit.h"
 
 #include <cstdio>
+#include <vector>
 
 #include "Common/Arm64Emitter.h"
 #include "Common/CommonTypes.h"
@@ -11,6 +12,7 @@
 #include "Common/MathUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
+#include "Common/TraceProfiler.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
@@ -873,6 +875,7 @@ void JitArm64::Jit(u32 em_address)
 
 void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
 {
+  TRACE_ZONE("JIT compile");
   CleanUpAfterStackFault();
 
   if (SConfig::GetInstance().bJITNoBlockCache)
@@ -882,13 +885,7 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
   // the local rangesets to allow overwriting them with new code.
   for (auto range : blocks.GetRangesToFreeNear())
   {
-    auto first_fastmem_area = m_fault_to_handler.upper_bound(range.first);
-    auto last_fastmem_area = first_fastmem_area;
-    auto end = m_fault_to_handler.end();
-    while (last_fastmem_area != end && last_fastmem_area->first <= range.second)
-      ++last_fastmem_area;
-    m_fault_to_handler.erase(first_fastmem_area, last_fastmem_area);
-
+    EraseFaultHandlers(range.first, range.second);
     m_free_ranges_near.insert(range.first, range.second);
   }
   for (auto range : blocks.GetRangesToFreeFar())
@@ -923,10 +920,13 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     }
   }
 
+  const u32 analyzer_options = SetTierAnalyzerOptions(em_address);
+
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
   const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
+  analyzer.SetOptions(analyzer_options);
 
   if (code_block.m_memory_exception)
   {
@@ -967,12 +967,23 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
       blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block.m_physical_addresses);
       return;
     }
+
+    blocks.DiscardBlock(*b);
+    EraseFaultHandlers(near_start, GetWritableCodePtr());
   }
 
   if (clear_cache_and_retry_on_failure)
   {
     // Code generation failed due to not enough free space in either the near or far code regions.
-    // Clear the entire JIT cache and retry.
+    // Evict the older half of the blocks and retry, which keeps recompilation work low. Each retry
+    // halves the cache again, down to clearing the entire JIT cache.
+    if (const size_t evicted = blocks.EvictOldBlocks(); evicted != 0)
+    {
+      INFO_LOG_FMT(POWERPC, "Evicted {} old blocks from code caches", evicted);
+      Jit(em_address, true);
+      return;
+    }
+
     WARN_LOG_FMT(POWERPC, "flushing code caches, please report if this happens a lot");
     ClearCache();
     Jit(em_address, false);
@@ -985,6 +996,15 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
   exit(-1);
 }
 
+void JitArm64::EraseFaultHandlers(const u8* begin, const u8* end)
+{
+  auto first_fastmem_area = m_fault_to_handler.upper_bound(begin);
+  auto last_fastmem_area = first_fastmem_area;
+  while (last_fastmem_area != m_fault_to_handler.end() && last_fastmem_area->first <= end)
+    ++last_fastmem_area;
+  m_fault_to_handler.erase(first_fastmem_area, last_fastmem_area);
+}
+
 bool JitArm64::SetEmitterStateToFreeCodeRegion()
 {
   // Find the largest free memory blocks and set code emitters to point at them.
@@ -1015,6 +1035,7 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   js.isLastInstruction = false;
   js.firstFPInstructionFound = false;
   js.assumeNoPairedQuantize = false;
+  js.constantGqrValid = BitSet8();
   js.blockStart = em_address;
   js.fifoBytesSinceCheck = 0;
   js.mustCheckFifo = false;
@@ -1027,6 +1048,28 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 
   b->normalEntry = GetWritableCodePtr();
 
+  // Count the entries of baseline tier blocks, and have them recompiled once they're hot.
+  if (js.isBaselineTier)
+  {
+    b->tier_up_countdown = TIER_UP_THRESHOLD;
+
+    MOVP2R(ARM64Reg::X0, &b->tier_up_countdown);
+    LDR(IndexType::Unsigned, ARM64Reg::W1, ARM64Reg::X0, 0);
+    SUBS(ARM64Reg::W1, ARM64Reg::W1, 1);
+    STR(IndexType::Unsigned, ARM64Reg::W1, ARM64Reg::X0, 0);
+    FixupBranch not_hot = B(CC_NEQ);
+    FixupBranch hot = B();
+    SwitchToFarCode();
+    SetJumpTarget(hot);
+    MOVI2R(DISPATCHER_PC, js.blockStart);
+    STR(IndexType::Unsigned, DISPATCHER_PC, PPC_REG, PPCSTATE_OFF(pc));
+    ABI_CallFunction(&JitInterface::CompileExceptionCheckFromJIT, &m_system.GetJitInterface(),
+                     static_cast<u32>(JitInterface::ExceptionType::TierUp));
+    B(dispatcher_no_check);
+    SwitchToNearCode();
+    SetJumpTarget(not_hot);
+  }
+
   // Conditionally add profiling code.
   if (IsProfilingEnabled())
     ABI_CallFunction(&JitBlock::ProfileData::BeginProfiling, b->profile_data.get());
@@ -1053,6 +1096,38 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     }
   }
 
+  // Otherwise, assume that GQRs which are used but not set by this block keep their current values,
+  // so the quantized load/store routines can be called directly without decoding the GQR.
+  if (!js.assumeNoPairedQuantize &&
+      js.pairedQuantizeAddresses.find(js.blockStart) == js.pairedQuantizeAddresses.end())
+  {
+    const BitSet8 gqr_static = code_block.m_gqr_used & ~code_block.m_gqr_modified;
+    if (gqr_static)
+    {
+      std::vector<FixupBranch> fails;
+      for (const int gqr : gqr_static)
+      {
+        const u32 value = GQR(m_ppc_state, gqr);
+        js.constantGqr[gqr] = value;
+        LDR(IndexType::Unsigned, ARM64Reg::W0, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + gqr));
+        CMPI2R(ARM64Reg::W0, value, ARM64Reg::W1);
+        fails.push_back(B(CC_NEQ));
+      }
+      FixupBranch no_fail = B();
+      SwitchToFarCode();
+      for (const FixupBranch& fail : fails)
+        SetJumpTarget(fail);
+      MOVI2R(DISPATCHER_PC, js.blockStart);
+      STR(IndexType::Unsigned, DISPATCHER_PC, PPC_REG, PPCSTATE_OFF(pc));
+      ABI_CallFunction(&JitInterface::CompileExceptionCheckFromJIT, &m_system.GetJitInterface(),
+                       static_cast<u32>(JitInterface::ExceptionType::PairedQuantize));
+      B(dispatcher_no_check);
+      SwitchToNearCode();
+      SetJumpTarget(no_fail);
+      js.constantGqrValid = gqr_static;
+    }
+  }
+
   gpr.Start(js.gpa);
   fpr.Start(js.fpa);
 
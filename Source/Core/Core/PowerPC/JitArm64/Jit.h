@@ -189,6 +189,7 @@ protected:
   {
     const u8* fast_access_code;
     const u8* slow_access_code;
+    u32 guest_address;
   };
 
   void SetBlockLinkingEnabled(bool enabled);
@@ -287,6 +288,8 @@ protected:
   // Finds a free memory region and sets the near and far code emitters to point at that region.
   // Returns false if no free memory region can be found for either of the two.
   bool SetEmitterStateToFreeCodeRegion();
+  // Forgets the fastmem fault handlers of the code in the given near code range.
+  void EraseFaultHandlers(const u8* begin, const u8* end);
 
   void DoDownCount();
   void Cleanup();
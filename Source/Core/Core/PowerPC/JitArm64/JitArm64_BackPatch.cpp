@@ -62,6 +62,13 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, MemAccessMode mode, ARM64Reg RS,
   if (m_accurate_cpu_cache_enabled)
     mode = MemAccessMode::AlwaysSlowAccess;
 
+  // Don't emit a fastmem access that's known to fault, see js.fastmemFaultCounts.
+  if (mode == MemAccessMode::Auto && jo.fastmem && !emitting_routine &&
+      js.fastmemFaultCounts.contains(js.compilerPC))
+  {
+    mode = MemAccessMode::AlwaysSlowAccess;
+  }
+
   const bool emit_fast_access = mode != MemAccessMode::AlwaysSlowAccess;
   const bool emit_slow_access = mode != MemAccessMode::AlwaysFastAccess;
 
@@ -163,6 +170,7 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, MemAccessMode mode, ARM64Reg RS,
         FastmemArea* fastmem_area = &m_fault_to_handler[fast_access_end];
         fastmem_area->fast_access_code = fast_access_start;
         fastmem_area->slow_access_code = GetCodePtr();
+        fastmem_area->guest_address = js.compilerPC;
       }
     }
 
@@ -332,6 +340,8 @@ bool JitArm64::HandleFastmemFault(SContext* ctx)
   if (pc < fastmem_area_start)
     return false;
 
+  ++js.fastmemFaultCounts[slow_handler_iter->second.guest_address];
+
   const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
   ARM64XEmitter emitter(const_cast<u8*>(fastmem_area_start), const_cast<u8*>(fastmem_area_end));
 
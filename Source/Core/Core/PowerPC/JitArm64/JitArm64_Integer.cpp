@@ -1690,6 +1690,20 @@ void JitArm64::divwx(UGeckoInstruction inst)
       NEGS(gpr.R(d), gpr.R(a));
       CSINV(gpr.R(d), gpr.R(d), ARM64Reg::WZR, CCFlags::CC_VC);
     }
+    else if (js.op->gprKnownNonNegative[a] &&
+             (MathUtil::IsPow2(divisor) || MathUtil::IsPow2(-static_cast<s64>(divisor))))
+    {
+      // The dividend is known to be non-negative, so no rounding towards zero is needed.
+      const u32 abs_val = static_cast<u32>(std::abs(static_cast<s64>(divisor)));
+
+      ARM64Reg RA = gpr.R(a);
+      ARM64Reg RD = gpr.R(d);
+
+      if (divisor < 0)
+        NEG(RD, RA, ArithOption(RA, ShiftType::LSR, MathUtil::IntLog2(abs_val)));
+      else
+        LSR(RD, RA, MathUtil::IntLog2(abs_val));
+    }
     else if (divisor == 2 || divisor == -2)
     {
       ARM64Reg RA = gpr.R(a);
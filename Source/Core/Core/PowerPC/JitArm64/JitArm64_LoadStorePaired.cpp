@@ -100,17 +100,28 @@ void JitArm64::psq_lXX(UGeckoInstruction inst)
   }
   else
   {
-    LDR(IndexType::Unsigned, scale_reg, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + i));
-
     // Stash PC in case asm routine needs to call into C++
     MOVI2R(ARM64Reg::W30, js.compilerPC);
     STR(IndexType::Unsigned, ARM64Reg::W30, PPC_REG, PPCSTATE_OFF(pc));
 
-    UBFM(type_reg, scale_reg, 16, 18);   // Type
-    UBFM(scale_reg, scale_reg, 24, 29);  // Scale
+    const u8** routines = w ? single_load_quantized : paired_load_quantized;
+    if (js.constantGqrValid[i])
+    {
+      // We know what the GQR is here, so we can call the right routine directly.
+      const u32 gqr = js.constantGqr[i];
+      MOVI2R(scale_reg, (gqr >> 24) & 0x3F);
+      MOVP2R(EncodeRegTo64(type_reg), routines[(gqr >> 16) & 0x7]);
+    }
+    else
+    {
+      LDR(IndexType::Unsigned, scale_reg, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + i));
+
+      UBFM(type_reg, scale_reg, 16, 18);   // Type
+      UBFM(scale_reg, scale_reg, 24, 29);  // Scale
 
-    MOVP2R(ARM64Reg::X30, w ? single_load_quantized : paired_load_quantized);
-    LDR(EncodeRegTo64(type_reg), ARM64Reg::X30, ArithOption(EncodeRegTo64(type_reg), true));
+      MOVP2R(ARM64Reg::X30, routines);
+      LDR(EncodeRegTo64(type_reg), ARM64Reg::X30, ArithOption(EncodeRegTo64(type_reg), true));
+    }
     BLR(EncodeRegTo64(type_reg));
 
     WriteConditionalExceptionExit(EXCEPTION_DSI, ARM64Reg::W30, ARM64Reg::Q1);
@@ -257,17 +268,28 @@ void JitArm64::psq_stXX(UGeckoInstruction inst)
   }
   else
   {
-    LDR(IndexType::Unsigned, scale_reg, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + i));
-
     // Stash PC in case asm routine needs to call into C++
     MOVI2R(ARM64Reg::W30, js.compilerPC);
     STR(IndexType::Unsigned, ARM64Reg::W30, PPC_REG, PPCSTATE_OFF(pc));
 
-    UBFM(type_reg, scale_reg, 0, 2);    // Type
-    UBFM(scale_reg, scale_reg, 8, 13);  // Scale
+    const u8** routines = w ? single_store_quantized : paired_store_quantized;
+    if (js.constantGqrValid[i])
+    {
+      // We know what the GQR is here, so we can call the right routine directly.
+      const u32 gqr = js.constantGqr[i];
+      MOVI2R(scale_reg, (gqr >> 8) & 0x3F);
+      MOVP2R(EncodeRegTo64(type_reg), routines[gqr & 0x7]);
+    }
+    else
+    {
+      LDR(IndexType::Unsigned, scale_reg, PPC_REG, PPCSTATE_OFF_SPR(SPR_GQR0 + i));
+
+      UBFM(type_reg, scale_reg, 0, 2);    // Type
+      UBFM(scale_reg, scale_reg, 8, 13);  // Scale
 
-    MOVP2R(ARM64Reg::X30, w ? single_store_quantized : paired_store_quantized);
-    LDR(EncodeRegTo64(type_reg), ARM64Reg::X30, ArithOption(EncodeRegTo64(type_reg), true));
+      MOVP2R(ARM64Reg::X30, routines);
+      LDR(EncodeRegTo64(type_reg), ARM64Reg::X30, ArithOption(EncodeRegTo64(type_reg), true));
+    }
     BLR(EncodeRegTo64(type_reg));
 
     WriteConditionalExceptionExit(EXCEPTION_DSI, ARM64Reg::W30, ARM64Reg::Q1);
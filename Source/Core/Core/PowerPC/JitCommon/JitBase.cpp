@@ -5,10 +5,16 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
+#include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "Common/Align.h"
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/MemoryUtil.h"
 #include "Common/Thread.h"
 
@@ -19,6 +25,7 @@
 #include "Core/CoreTiming.h"
 #include "Core/HW/CPU.h"
 #include "Core/MemTools.h"
+#include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -57,7 +64,12 @@
 // After resetting the stack to the top, we call _resetstkoflw() to restore
 // the guard page at the 256kb mark.
 
-const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitBase::JIT_SETTINGS{{
+// How many previously recorded blocks may be compiled ahead of time per dispatcher miss. This
+// bounds the length of any single stall while still turning many small stutters into few.
+static constexpr size_t DISK_CACHE_WARMUP_BATCH_SIZE = 64;
+static constexpr size_t DISK_CACHE_WARMUP_MAX_SCAN = DISK_CACHE_WARMUP_BATCH_SIZE * 4;
+
+const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 26> JitBase::JIT_SETTINGS{{
     {&JitBase::bJITOff, &Config::MAIN_DEBUG_JIT_OFF},
     {&JitBase::bJITLoadStoreOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_OFF},
     {&JitBase::bJITLoadStorelXzOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_LXZ_OFF},
@@ -72,6 +84,7 @@ const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitB
     {&JitBase::bJITBranchOff, &Config::MAIN_DEBUG_JIT_BRANCH_OFF},
     {&JitBase::bJITRegisterCacheOff, &Config::MAIN_DEBUG_JIT_REGISTER_CACHE_OFF},
     {&JitBase::m_enable_profiling, &Config::MAIN_DEBUG_JIT_ENABLE_PROFILING},
+    {&JitBase::m_enable_code_coverage, &Config::MAIN_DEBUG_ENABLE_CODE_COVERAGE},
     {&JitBase::m_enable_debugging, &Config::MAIN_ENABLE_DEBUGGING},
     {&JitBase::m_enable_branch_following, &Config::MAIN_JIT_FOLLOW_BRANCH},
     {&JitBase::m_enable_float_exceptions, &Config::MAIN_FLOAT_EXCEPTIONS},
@@ -81,6 +94,8 @@ const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitB
     {&JitBase::m_accurate_nans, &Config::MAIN_ACCURATE_NANS},
     {&JitBase::m_fastmem_enabled, &Config::MAIN_FASTMEM},
     {&JitBase::m_accurate_cpu_cache_enabled, &Config::MAIN_ACCURATE_CPU_CACHE},
+    {&JitBase::m_enable_block_disk_cache, &Config::MAIN_JIT_BLOCK_DISK_CACHE},
+    {&JitBase::m_enable_tiered_compilation, &Config::MAIN_JIT_TIERED_COMPILATION},
 }};
 
 const u8* JitBase::Dispatch(JitBase& jit)
@@ -90,7 +105,9 @@ const u8* JitBase::Dispatch(JitBase& jit)
 
 void JitTrampoline(JitBase& jit, u32 em_address)
 {
+  jit.UpdateBlockDiskCache();
   jit.Jit(em_address);
+  jit.WarmUpFromDiskCache(em_address);
 }
 
 JitBase::JitBase(Core::System& system)
@@ -142,6 +159,108 @@ void JitBase::RefreshConfig()
   jo.div_by_zero_exceptions = m_enable_div_by_zero_exceptions;
 }
 
+u64 JitBase::GetCodeGenConfigHash() const
+{
+  std::array<u8, JIT_SETTINGS.size() + sizeof(JitOptions)> data{};
+  for (size_t i = 0; i < JIT_SETTINGS.size(); ++i)
+    data[i] = this->*JIT_SETTINGS[i].first;
+  std::memcpy(data.data() + JIT_SETTINGS.size(), &jo, sizeof(JitOptions));
+  return Common::GetHash64(data.data(), static_cast<u32>(data.size()), 0);
+}
+
+std::optional<u64> JitBase::HashGuestInstructions(u32 address, u32 num_instructions)
+{
+  std::vector<u32> instructions(num_instructions);
+  for (u32 i = 0; i < num_instructions; ++i)
+  {
+    const auto result = m_mmu.TryReadInstruction(address + i * sizeof(u32));
+    if (!result.valid)
+      return std::nullopt;
+    instructions[i] = result.hex;
+  }
+  return Common::GetHash64(reinterpret_cast<const u8*>(instructions.data()),
+                           num_instructions * sizeof(u32), 0);
+}
+
+void JitBase::UpdateBlockDiskCache()
+{
+  const std::string& game_id = SConfig::GetInstance().GetGameID();
+  if (!m_enable_block_disk_cache || m_enable_debugging || game_id.empty())
+  {
+    m_block_disk_cache.Close();
+    return;
+  }
+
+  const std::string path =
+      fmt::format("{}{}-{}-{:016x}.jitcache", File::GetUserPath(D_CACHE_IDX), game_id, GetName(),
+                  GetCodeGenConfigHash());
+  if (m_block_disk_cache.GetPath() != path)
+    m_block_disk_cache.Open(path);
+}
+
+void JitBase::RecordBlockForDiskCache(const JitBlock& block)
+{
+  if (!m_block_disk_cache.IsOpen() || block.originalSize == 0)
+    return;
+
+  const std::optional<u64> hash = HashGuestInstructions(block.effectiveAddress, block.originalSize);
+  if (!hash)
+    return;
+
+  m_block_disk_cache.Record({.effective_address = block.effectiveAddress,
+                             .feature_flags = block.feature_flags,
+                             .num_instructions = block.originalSize,
+                             .padding = 0,
+                             .instruction_hash = *hash});
+}
+
+void JitBase::WarmUpFromDiskCache(u32 em_address)
+{
+  if (m_warming_up || !m_block_disk_cache.IsOpen() || m_system.GetCPU().IsStepping())
+    return;
+
+  const CPUEmuFeatureFlags feature_flags = m_ppc_state.feature_flags;
+  const std::optional<size_t> position = m_block_disk_cache.Find(em_address, feature_flags);
+  if (!position)
+    return;
+
+  m_warming_up = true;
+
+  // Blocks tend to get compiled in the same order every time a game runs, so the blocks that
+  // followed this one last time are the ones most likely to be needed soon.
+  size_t compiled = 0;
+  const size_t end =
+      std::min(m_block_disk_cache.GetEntryCount(), *position + 1 + DISK_CACHE_WARMUP_MAX_SCAN);
+  for (size_t i = *position + 1; i < end && compiled < DISK_CACHE_WARMUP_BATCH_SIZE; ++i)
+  {
+    const JitBlockDiskCache::Entry& entry = m_block_disk_cache.GetEntry(i);
+    if (entry.feature_flags != feature_flags ||
+        GetBlockCache()->GetBlockFromStartAddress(entry.effective_address, feature_flags))
+    {
+      continue;
+    }
+
+    // Revalidate against the current contents of guest memory. This also guarantees that the
+    // first instruction can be translated, so compiling it can't raise an ISI.
+    if (HashGuestInstructions(entry.effective_address, entry.num_instructions) !=
+        entry.instruction_hash)
+    {
+      continue;
+    }
+
+    if (!m_block_disk_cache.TryClaimForWarmUp(i))
+      continue;
+
+    Jit(entry.effective_address);
+    ++compiled;
+  }
+
+  m_warming_up = false;
+
+  if (compiled != 0)
+    DEBUG_LOG_FMT(DYNA_REC, "Warmed up {} blocks after {:08x}", compiled, em_address);
+}
+
 void JitBase::InitFastmemArena()
 {
   auto& memory = m_system.GetMemory();
@@ -260,6 +379,29 @@ void JitBase::CleanUpAfterStackFault()
   }
 }
 
+bool JitBase::ShouldCompileBaselineTier(u32 em_address) const
+{
+  return m_enable_tiered_compilation && !m_enable_debugging &&
+         js.tierUpAddresses.find(em_address) == js.tierUpAddresses.end();
+}
+
+u32 JitBase::SetTierAnalyzerOptions(u32 em_address)
+{
+  const u32 options = analyzer.GetOptions();
+  js.isBaselineTier = ShouldCompileBaselineTier(em_address);
+  if (js.isBaselineTier)
+  {
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CONDITIONAL_CONTINUE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+  }
+  else if (m_enable_tiered_compilation &&
+           analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW))
+  {
+    analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_TRACE_FORMATION);
+  }
+  return options;
+}
+
 bool JitBase::CanMergeNextInstructions(int count) const
 {
   if (m_system.GetCPU().IsStepping() || js.instructionsLeft < count)
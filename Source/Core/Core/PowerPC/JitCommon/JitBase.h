@@ -6,6 +6,8 @@
 #include <array>
 #include <cstddef>
 #include <map>
+#include <optional>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -18,6 +20,7 @@
 #include "Core/MachineContext.h"
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/JitCommon/JitAsmCommon.h"
+#include "Core/PowerPC/JitCommon/JitBlockDiskCache.h"
 #include "Core/PowerPC/JitCommon/JitCache.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 
@@ -76,6 +79,10 @@ protected:
   static constexpr size_t GUARD_SIZE = 64 * 1024;
   static constexpr size_t GUARD_OFFSET = SAFE_STACK_SIZE - GUARD_SIZE;
 
+  // With tiered compilation, blocks are first compiled without the expensive analysis passes.
+  // Once such a block has been entered this many times, it gets recompiled fully optimized.
+  static constexpr u32 TIER_UP_THRESHOLD = 256;
+
   struct JitOptions
   {
     bool enableBlocklink;
@@ -112,6 +119,8 @@ protected:
     CarryFlag carryFlag;
 
     bool generatingTrampoline = false;
+    // Whether the block being compiled is a baseline tier block, see TIER_UP_THRESHOLD.
+    bool isBaselineTier = false;
     u8* trampolineExceptionHandler;
 
     bool mustCheckFifo;
@@ -128,6 +137,13 @@ protected:
     std::unordered_set<u32> fifoWriteAddresses;
     std::unordered_set<u32> pairedQuantizeAddresses;
     std::unordered_set<u32> noSpeculativeConstantsAddresses;
+    // Entry addresses of blocks which were found to be hot and must get the optimizing tier.
+    // This intentionally survives cache clears.
+    std::unordered_set<u32> tierUpAddresses;
+    // Addresses of load and store instructions whose fastmem access has faulted, with the number
+    // of faults. These are compiled without fastmem from then on, which avoids taking the fault
+    // again every time they are recompiled. This intentionally survives cache clears.
+    std::unordered_map<u32, u32> fastmemFaultCounts;
   };
 
   PPCAnalyst::CodeBlock code_block;
@@ -149,6 +165,8 @@ protected:
   bool bJITBranchOff = false;
   bool bJITRegisterCacheOff = false;
   bool m_enable_profiling = false;
+  // Toggling this clears the cache, so that blocks which already ran get recorded again.
+  bool m_enable_code_coverage = false;
   bool m_enable_debugging = false;
   bool m_enable_branch_following = false;
   bool m_enable_float_exceptions = false;
@@ -159,11 +177,13 @@ protected:
   bool m_fastmem_enabled = false;
   bool m_accurate_cpu_cache_enabled = false;
 
+  bool m_enable_block_disk_cache = false;
+  bool m_enable_tiered_compilation = false;
   bool m_enable_blr_optimization = false;
   bool m_cleanup_after_stackfault = false;
   u8* m_stack_guard = nullptr;
 
-  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JIT_SETTINGS;
+  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 26> JIT_SETTINGS;
 
   bool DoesConfigNeedRefresh();
   void RefreshConfig();
@@ -179,6 +199,16 @@ protected:
 
   bool ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op);
 
+  bool ShouldCompileBaselineTier(u32 em_address) const;
+  // Picks the tier for the block at em_address and sets js.isBaselineTier accordingly. Baseline
+  // tier blocks skip the analysis passes that are too costly for code that may only run a few
+  // times, while blocks that were found to be hot get trace formation. Returns the previous
+  // analyzer options, to be restored after analysis.
+  u32 SetTierAnalyzerOptions(u32 em_address);
+
+  u64 GetCodeGenConfigHash() const;
+  std::optional<u64> HashGuestInstructions(u32 address, u32 num_instructions);
+
 public:
   explicit JitBase(Core::System& system);
   JitBase(const JitBase&) = delete;
@@ -189,6 +219,8 @@ public:
 
   bool IsProfilingEnabled() const { return m_enable_profiling; }
   bool IsDebuggingEnabled() const { return m_enable_debugging; }
+  // Blocks compiled ahead of time from the disk cache haven't necessarily run.
+  bool ShouldRecordCodeCoverage() const { return m_enable_code_coverage && !m_warming_up; }
 
   static const u8* Dispatch(JitBase& jit);
   virtual JitBaseBlockCache* GetBlockCache() = 0;
@@ -200,6 +232,14 @@ public:
   virtual bool HandleFault(uintptr_t access_address, SContext* ctx) = 0;
   bool HandleStackFault();
 
+  // Opens the block disk cache matching the running game and the current JIT configuration, or
+  // closes it if the feature is disabled.
+  void UpdateBlockDiskCache();
+  void RecordBlockForDiskCache(const JitBlock& block);
+  // Called after compiling a block the dispatcher couldn't find. If the block was also compiled in
+  // a previous session, compiles the blocks which were compiled right after it back then.
+  void WarmUpFromDiskCache(u32 em_address);
+
   static constexpr std::size_t code_buffer_size = 32000;
 
   // This should probably be removed from public:
@@ -211,6 +251,10 @@ public:
   PowerPC::MMU& m_mmu;
   Core::BranchWatch& m_branch_watch;
   PPCSymbolDB& m_ppc_symbol_db;
+
+private:
+  JitBlockDiskCache m_block_disk_cache;
+  bool m_warming_up = false;
 };
 
 void JitTrampoline(JitBase& jit, u32 em_address);
@@ -0,0 +1,97 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitBlockDiskCache.h"
+
+#include "Common/Logging/Log.h"
+
+JitBlockDiskCache::~JitBlockDiskCache()
+{
+  Close();
+}
+
+void JitBlockDiskCache::Open(const std::string& path)
+{
+  Close();
+
+  class CacheReader : public Common::LinearDiskCacheReader<Entry, u8>
+  {
+  public:
+    explicit CacheReader(JitBlockDiskCache& cache) : m_cache(cache) {}
+    void Read(const Entry& key, const u8*, u32) override { m_cache.AddEntry(key); }
+
+  private:
+    JitBlockDiskCache& m_cache;
+  };
+
+  CacheReader reader(*this);
+  const u32 count = m_disk_cache.OpenAndRead(path, reader);
+  m_path = path;
+  INFO_LOG_FMT(DYNA_REC, "Loaded {} JIT block entries from {}", count, path);
+}
+
+void JitBlockDiskCache::Close()
+{
+  if (!IsOpen())
+    return;
+
+  m_disk_cache.Sync();
+  m_disk_cache.Close();
+  m_path.clear();
+  m_entries.clear();
+  m_claimed.clear();
+  m_lookup.clear();
+}
+
+void JitBlockDiskCache::AddEntry(const Entry& entry)
+{
+  const auto [it, inserted] =
+      m_lookup.try_emplace(MakeLookupKey(entry.effective_address, entry.feature_flags), 0);
+  if (!inserted)
+  {
+    // The code at this address changed since it was first recorded. Keep the compile order
+    // position of the old entry, but validate against the newest contents.
+    m_entries[it->second] = entry;
+    return;
+  }
+
+  it->second = m_entries.size();
+  m_entries.push_back(entry);
+  m_claimed.push_back(false);
+}
+
+void JitBlockDiskCache::Record(const Entry& entry)
+{
+  if (!IsOpen())
+    return;
+
+  const auto it = m_lookup.find(MakeLookupKey(entry.effective_address, entry.feature_flags));
+  if (it != m_lookup.end())
+  {
+    const Entry& known = m_entries[it->second];
+    if (known.num_instructions == entry.num_instructions &&
+        known.instruction_hash == entry.instruction_hash)
+    {
+      return;
+    }
+  }
+
+  AddEntry(entry);
+  m_disk_cache.Append(entry, nullptr, 0);
+}
+
+std::optional<size_t> JitBlockDiskCache::Find(u32 effective_address, u32 feature_flags) const
+{
+  const auto it = m_lookup.find(MakeLookupKey(effective_address, feature_flags));
+  if (it == m_lookup.end())
+    return std::nullopt;
+  return it->second;
+}
+
+bool JitBlockDiskCache::TryClaimForWarmUp(size_t index)
+{
+  if (m_claimed[index])
+    return false;
+  m_claimed[index] = true;
+  return true;
+}
@@ -0,0 +1,72 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/LinearDiskCache.h"
+
+// Remembers which blocks a JIT compiled in previous sessions of a game, in the order they were
+// compiled, so that they can be compiled in batches ahead of time instead of stuttering on each
+// block as it is first reached.
+//
+// Host code is intentionally not stored: the emitted code is not position independent, and by
+// always regenerating blocks from guest memory a stale entry can only ever cost compile time,
+// never correctness.
+class JitBlockDiskCache final
+{
+public:
+  struct Entry
+  {
+    u32 effective_address;
+    u32 feature_flags;
+    u32 num_instructions;
+    u32 padding;
+    // Hash of the num_instructions guest instructions starting at effective_address.
+    u64 instruction_hash;
+  };
+
+  JitBlockDiskCache() = default;
+  JitBlockDiskCache(const JitBlockDiskCache&) = delete;
+  JitBlockDiskCache& operator=(const JitBlockDiskCache&) = delete;
+  ~JitBlockDiskCache();
+
+  // Opens (or creates) the cache file at the given path and reads all previously recorded entries.
+  void Open(const std::string& path);
+  void Close();
+  bool IsOpen() const { return !m_path.empty(); }
+  const std::string& GetPath() const { return m_path; }
+
+  // Appends an entry unless an identical entry is already known.
+  void Record(const Entry& entry);
+
+  // Returns the index of the compile order position of the given block, if it was recorded.
+  std::optional<size_t> Find(u32 effective_address, u32 feature_flags) const;
+
+  size_t GetEntryCount() const { return m_entries.size(); }
+  const Entry& GetEntry(size_t index) const { return m_entries[index]; }
+
+  // Each entry is only handed out for warm-up once per session, so that blocks which keep getting
+  // invalidated don't get compiled over and over again.
+  bool TryClaimForWarmUp(size_t index);
+
+private:
+  static u64 MakeLookupKey(u32 effective_address, u32 feature_flags)
+  {
+    return (u64{feature_flags} << 32) | effective_address;
+  }
+
+  void AddEntry(const Entry& entry);
+
+  std::string m_path;
+  Common::LinearDiskCache<Entry, u8> m_disk_cache;
+  std::vector<Entry> m_entries;
+  std::vector<bool> m_claimed;
+  std::unordered_map<u64, size_t> m_lookup;
+};
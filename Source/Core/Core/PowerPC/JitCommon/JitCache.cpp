@@ -7,9 +7,9 @@
 #include <array>
 #include <cstring>
 #include <functional>
-#include <map>
 #include <set>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/JitRegister.h"
@@ -19,6 +19,7 @@
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -28,8 +29,8 @@ using namespace Gen;
 
 bool JitBlock::OverlapsPhysicalRange(u32 address, u32 length) const
 {
-  return physical_addresses.lower_bound(address) !=
-         physical_addresses.lower_bound(address + length);
+  const auto it = std::lower_bound(physical_addresses.begin(), physical_addresses.end(), address);
+  return it != physical_addresses.end() && *it - address < length;
 }
 
 void JitBlock::ProfileData::BeginProfiling(ProfileData* data)
@@ -52,7 +53,8 @@ JitBaseBlockCache::~JitBaseBlockCache() = default;
 
 void JitBaseBlockCache::Init()
 {
-  Common::JitRegister::Init(Config::Get(Config::MAIN_PERF_MAP_DIR));
+  Common::JitRegister::Init(Config::Get(Config::MAIN_PERF_MAP_DIR),
+                            Config::Get(Config::MAIN_PERF_JITDUMP));
 
   m_entry_points_ptr = nullptr;
 #ifdef _ARCH_64
@@ -80,15 +82,19 @@ void JitBaseBlockCache::Clear()
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
   m_jit.js.noSpeculativeConstantsAddresses.clear();
-  for (auto& e : block_map)
+  for (JitBlock& block : m_block_arena)
   {
-    DestroyBlock(e.second);
+    if (block.in_use)
+      DestroyBlock(block);
   }
-  block_map.clear();
-  links_to.clear();
-  block_range_map.clear();
+  m_block_arena.clear();
+  m_free_blocks.clear();
+  block_map.Clear();
+  links_to.Clear();
+  block_range_map.Clear();
 
   valid_block.ClearAll();
+  code_pages.ClearAll();
 
   if (m_entry_points_ptr)
     m_entry_points_arena.Clear();
@@ -113,20 +119,48 @@ JitBlock** JitBaseBlockCache::GetFastBlockMapFallback()
 void JitBaseBlockCache::RunOnBlocks(const Core::CPUThreadGuard&,
                                     std::function<void(const JitBlock&)> f) const
 {
-  for (const auto& e : block_map)
-    f(e.second);
+  for (const JitBlock& block : m_block_arena)
+  {
+    if (block.in_use)
+      f(block);
+  }
 }
 
 JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
 {
   const u32 physical_address = m_jit.m_mmu.JitCache_TranslateAddress(em_address).address;
-  JitBlock& b = block_map.emplace(physical_address, m_jit.IsProfilingEnabled())->second;
-  b.effectiveAddress = em_address;
-  b.physicalAddress = physical_address;
-  b.feature_flags = m_jit.m_ppc_state.feature_flags;
-  b.linkData.clear();
-  b.fast_block_map_index = 0;
-  return &b;
+  const bool profiling_enabled = m_jit.IsProfilingEnabled();
+
+  JitBlock* b;
+  if (m_free_blocks.empty())
+  {
+    b = &m_block_arena.emplace_back(profiling_enabled);
+  }
+  else
+  {
+    b = m_free_blocks.back();
+    m_free_blocks.pop_back();
+    if (!profiling_enabled)
+      b->profile_data.reset();
+    else if (b->profile_data)
+      *b->profile_data = JitBlock::ProfileData();
+    else
+      b->profile_data = std::make_unique<JitBlock::ProfileData>();
+  }
+
+  b->effectiveAddress = em_address;
+  b->physicalAddress = physical_address;
+  b->feature_flags = m_jit.m_ppc_state.feature_flags;
+  b->linkData.clear();
+  b->physical_addresses.clear();
+  b->fast_block_map_index = 0;
+  b->in_use = true;
+  b->allocation_order = m_next_allocation_order++;
+
+  JitBlock*& head = block_map.GetOrCreate(physical_address >> 2);
+  b->next_in_bucket = head;
+  head = b;
+  return b;
 }
 
 void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
@@ -144,25 +178,42 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   }
   block.fast_block_map_index = index;
 
-  block.physical_addresses = physical_addresses;
+  block.physical_addresses.assign(physical_addresses.begin(), physical_addresses.end());
+
+  // Blocks get compiled right before they run for the first time.
+  if (m_jit.ShouldRecordCodeCoverage())
+  {
+    m_jit.m_system.GetPowerPC().GetCodeCoverage().Record(block.effectiveAddress,
+                                                         block.originalSize);
+  }
 
-  u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
-  for (u32 addr : physical_addresses)
+  // physical_addresses is sorted, so all addresses of one macro block are adjacent.
+  u32 previous_macro_block = 0;
+  bool first = true;
+  for (u32 addr : block.physical_addresses)
   {
     valid_block.Set(addr / 32);
-    block_range_map[addr & range_mask].insert(&block);
+    code_pages.Set(addr);
+    const u32 macro_block = addr / BLOCK_RANGE_MAP_ELEMENTS;
+    if (first || macro_block != previous_macro_block)
+      block_range_map.GetOrCreate(macro_block).push_back(&block);
+    previous_macro_block = macro_block;
+    first = false;
   }
 
   if (block_link)
   {
-    for (const auto& e : block.linkData)
+    for (auto& e : block.linkData)
     {
-      links_to[e.exitAddress].insert(&block);
+      e.source = &block;
+      RegisterLink(e);
     }
 
     LinkBlock(block);
   }
 
+  m_jit.RecordBlockForDiskCache(block);
+
   Common::Symbol* symbol = nullptr;
   if (Common::JitRegister::IsEnabled() &&
       (symbol = m_jit.m_ppc_symbol_db.GetSymbolFromAddr(block.effectiveAddress)) != nullptr)
@@ -177,6 +228,47 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   }
 }
 
+void JitBaseBlockCache::DiscardBlock(JitBlock& block)
+{
+  // The block was never linked or added to the fast block map, so unlike DestroyBlock, there is
+  // nothing else to undo.
+  RemoveFromBlockMap(block);
+  FreeBlock(block);
+}
+
+size_t JitBaseBlockCache::EvictOldBlocks()
+{
+  std::vector<JitBlock*> blocks;
+  for (JitBlock& block : m_block_arena)
+  {
+    if (block.in_use)
+      blocks.push_back(&block);
+  }
+
+  // Blocks are compiled into the largest free code range, so blocks of a similar age tend to be
+  // next to each other, and evicting the oldest ones mostly leaves behind large contiguous ranges.
+  // The recently compiled part of the working set survives, unlike after a full cache clear.
+  const size_t evict_count = (blocks.size() + 1) / 2;
+  const auto evict_end = blocks.begin() + evict_count;
+  std::nth_element(blocks.begin(), evict_end, blocks.end(),
+                   [](const JitBlock* a, const JitBlock* b) {
+                     return a->allocation_order < b->allocation_order;
+                   });
+
+  // The valid_block bits of the evicted blocks are left set. This only means that invalidating
+  // those cache lines later takes the slow path once.
+  for (auto it = blocks.begin(); it != evict_end; ++it)
+  {
+    JitBlock& block = **it;
+    RemoveFromBlockRangeMap(block, NO_MACRO_BLOCK);
+    DestroyBlock(block);
+    RemoveFromBlockMap(block);
+    FreeBlock(block);
+  }
+
+  return evict_count;
+}
+
 JitBlock* JitBaseBlockCache::GetBlockFromStartAddress(u32 addr, CPUEmuFeatureFlags feature_flags)
 {
   u32 translated_addr = addr;
@@ -190,12 +282,17 @@ JitBlock* JitBaseBlockCache::GetBlockFromStartAddress(u32 addr, CPUEmuFeatureFla
     translated_addr = translated.address;
   }
 
-  auto iter = block_map.equal_range(translated_addr);
-  for (; iter.first != iter.second; iter.first++)
+  JitBlock* const* head = block_map.Find(translated_addr >> 2);
+  if (!head)
+    return nullptr;
+
+  for (JitBlock* b = *head; b; b = b->next_in_bucket)
   {
-    JitBlock& b = iter.first->second;
-    if (b.effectiveAddress == addr && b.feature_flags == feature_flags)
-      return &b;
+    if (b->physicalAddress == translated_addr && b->effectiveAddress == addr &&
+        b->feature_flags == feature_flags)
+    {
+      return b;
+    }
   }
 
   return nullptr;
@@ -278,6 +375,12 @@ void JitBaseBlockCache::InvalidateICache(u32 initial_address, u32 initial_length
 void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 address, u32 length,
                                                  bool forced)
 {
+  // Blocks and valid_block bits only exist in pages with code, so there is nothing to do for ranges
+  // outside of them. This also skips the FIFO write address cache below, which only contains
+  // addresses of compiled instructions.
+  if (!code_pages.TestRange(physical_address, length))
+    return;
+
   // Optimization for the case of invalidating a single cache line, which is used by the dcb*
   // instructions. If the valid_block bit for that cacheline is not set, we can safely skip
   // the remaining invalidation logic.
@@ -323,53 +426,84 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
 
 void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
 {
+  if (length == 0)
+    return;
+
   // Iterate over all macro blocks which overlap the given range.
-  u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
-  auto start = block_range_map.lower_bound(address & range_mask);
-  auto end = block_range_map.lower_bound(address + length);
-  while (start != end)
-  {
-    // Iterate over all blocks in the macro block.
-    auto iter = start->second.begin();
-    while (iter != start->second.end())
-    {
-      JitBlock* block = *iter;
-      if (block->OverlapsPhysicalRange(address, length))
-      {
-        // If the block overlaps, also remove all other occupied slots in the other macro blocks.
-        // This will leak empty macro blocks, but they may be reused or cleared later on.
-        for (u32 addr : block->physical_addresses)
-          if ((addr & range_mask) != start->first)
-            block_range_map[addr & range_mask].erase(block);
-
-        // And remove the block.
-        DestroyBlock(*block);
-        auto block_map_iter = block_map.equal_range(block->physicalAddress);
-        while (block_map_iter.first != block_map_iter.second)
+  const u32 first_macro_block = address / BLOCK_RANGE_MAP_ELEMENTS;
+  const u32 last_macro_block =
+      static_cast<u32>((u64{address} + length - 1) / BLOCK_RANGE_MAP_ELEMENTS);
+  block_range_map.ForEachInRange(
+      first_macro_block, last_macro_block, [&](u32 macro_block, std::vector<JitBlock*>& blocks) {
+        // Iterate over all blocks in the macro block.
+        for (size_t i = 0; i < blocks.size();)
         {
-          if (&block_map_iter.first->second == block)
+          JitBlock* block = blocks[i];
+          if (!block->OverlapsPhysicalRange(address, length))
           {
-            block_map.erase(block_map_iter.first);
-            break;
+            ++i;
+            continue;
           }
-          block_map_iter.first++;
+
+          // If the block overlaps, also remove all other occupied slots in the other macro
+          // blocks. Emptied macro blocks keep their capacity so that they can be reused cheaply.
+          RemoveFromBlockRangeMap(*block, macro_block);
+          blocks[i] = blocks.back();
+          blocks.pop_back();
+
+          // And remove the block.
+          DestroyBlock(*block);
+          RemoveFromBlockMap(*block);
+          FreeBlock(*block);
         }
-        iter = start->second.erase(iter);
-      }
-      else
-      {
-        iter++;
-      }
+      });
+}
+
+void JitBaseBlockCache::RemoveFromBlockMap(JitBlock& block)
+{
+  JitBlock** link = block_map.Find(block.physicalAddress >> 2);
+  if (!link)
+    return;
+
+  for (; *link; link = &(*link)->next_in_bucket)
+  {
+    if (*link == &block)
+    {
+      *link = block.next_in_bucket;
+      block.next_in_bucket = nullptr;
+      return;
     }
+  }
+}
 
-    // If the macro block is empty, drop it.
-    if (start->second.empty())
-      start = block_range_map.erase(start);
-    else
-      start++;
+void JitBaseBlockCache::RemoveFromBlockRangeMap(JitBlock& block, u32 skipped_macro_block)
+{
+  u32 previous_macro_block = skipped_macro_block;
+  for (u32 addr : block.physical_addresses)
+  {
+    const u32 macro_block = addr / BLOCK_RANGE_MAP_ELEMENTS;
+    if (macro_block == skipped_macro_block || macro_block == previous_macro_block)
+      continue;
+    previous_macro_block = macro_block;
+
+    std::vector<JitBlock*>* blocks = block_range_map.Find(macro_block);
+    if (!blocks)
+      continue;
+    const auto it = std::find(blocks->begin(), blocks->end(), &block);
+    if (it != blocks->end())
+    {
+      *it = blocks->back();
+      blocks->pop_back();
+    }
   }
 }
 
+void JitBaseBlockCache::FreeBlock(JitBlock& block)
+{
+  block.in_use = false;
+  m_free_blocks.push_back(&block);
+}
+
 u32* JitBaseBlockCache::GetBlockBitSet() const
 {
   return valid_block.m_valid_block.get();
@@ -388,30 +522,36 @@ void JitBaseBlockCache::WriteDestroyBlock(const JitBlock& block)
 void JitBaseBlockCache::LinkBlockExits(JitBlock& block)
 {
   for (auto& e : block.linkData)
+    LinkExit(e, block.feature_flags);
+}
+
+void JitBaseBlockCache::LinkExit(JitBlock::LinkData& exit, CPUEmuFeatureFlags feature_flags)
+{
+  if (exit.linkStatus)
+    return;
+
+  JitBlock* destinationBlock = GetBlockFromStartAddress(exit.exitAddress, feature_flags);
+  if (destinationBlock)
   {
-    if (!e.linkStatus)
-    {
-      JitBlock* destinationBlock = GetBlockFromStartAddress(e.exitAddress, block.feature_flags);
-      if (destinationBlock)
-      {
-        WriteLinkBlock(e, destinationBlock);
-        e.linkStatus = true;
-      }
-    }
+    WriteLinkBlock(exit, destinationBlock);
+    exit.linkStatus = true;
   }
 }
 
 void JitBaseBlockCache::LinkBlock(JitBlock& block)
 {
   LinkBlockExits(block);
-  const auto it = links_to.find(block.effectiveAddress);
-  if (it == links_to.end())
+  JitBlock::LinkData* const* head = links_to.Find(block.effectiveAddress >> 2);
+  if (!head)
     return;
 
-  for (JitBlock* b2 : it->second)
+  for (JitBlock::LinkData* e = *head; e; e = e->next_link)
   {
-    if (block.feature_flags == b2->feature_flags)
-      LinkBlockExits(*b2);
+    if (e->exitAddress == block.effectiveAddress &&
+        e->source->feature_flags == block.feature_flags)
+    {
+      LinkExit(*e, block.feature_flags);
+    }
   }
 }
 
@@ -424,23 +564,51 @@ void JitBaseBlockCache::UnlinkBlock(const JitBlock& block)
   }
 
   // Unlink all exits of other blocks which points to this block
-  const auto it = links_to.find(block.effectiveAddress);
-  if (it == links_to.end())
+  JitBlock::LinkData* const* head = links_to.Find(block.effectiveAddress >> 2);
+  if (!head)
     return;
-  for (JitBlock* sourceBlock : it->second)
+  for (JitBlock::LinkData* e = *head; e; e = e->next_link)
   {
-    if (sourceBlock->feature_flags != block.feature_flags)
-      continue;
-
-    for (auto& e : sourceBlock->linkData)
+    if (e->exitAddress != block.effectiveAddress ||
+        e->source->feature_flags != block.feature_flags)
     {
-      if (e.exitAddress == block.effectiveAddress)
-      {
-        WriteLinkBlock(e, nullptr);
-        e.linkStatus = false;
-      }
+      continue;
     }
+
+    WriteLinkBlock(*e, nullptr);
+    e->linkStatus = false;
+  }
+}
+
+void JitBaseBlockCache::RegisterLink(JitBlock::LinkData& exit)
+{
+  JitBlock::LinkData*& head = links_to.GetOrCreate(exit.exitAddress >> 2);
+  exit.prev_link = nullptr;
+  exit.next_link = head;
+  if (head)
+    head->prev_link = &exit;
+  head = &exit;
+}
+
+void JitBaseBlockCache::UnregisterLink(JitBlock::LinkData& exit)
+{
+  if (exit.prev_link)
+  {
+    exit.prev_link->next_link = exit.next_link;
+  }
+  else
+  {
+    JitBlock::LinkData** head = links_to.Find(exit.exitAddress >> 2);
+    // Exits of blocks which were compiled without block linking were never registered.
+    if (!head || *head != &exit)
+      return;
+    *head = exit.next_link;
   }
+
+  if (exit.next_link)
+    exit.next_link->prev_link = exit.prev_link;
+  exit.prev_link = nullptr;
+  exit.next_link = nullptr;
 }
 
 void JitBaseBlockCache::DestroyBlock(JitBlock& block)
@@ -463,15 +631,8 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
   UnlinkBlock(block);
 
   // Delete linking addresses
-  for (const auto& e : block.linkData)
-  {
-    auto it = links_to.find(e.exitAddress);
-    if (it == links_to.end())
-      continue;
-    it->second.erase(&block);
-    if (it->second.empty())
-      links_to.erase(it);
-  }
+  for (auto& e : block.linkData)
+    UnregisterLink(e);
 
   // Raise an signal if we are going to call this block again
   WriteDestroyBlock(block);
@@ -3,17 +3,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <bitset>
 #include <chrono>
 #include <cstring>
+#include <deque>
 #include <functional>
-#include <map>
 #include <memory>
 #include <set>
 #include <type_traits>
-#include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -99,13 +99,28 @@ struct JitBlock : public JitBlockData
     u32 exitAddress;
     bool linkStatus;  // is it already linked?
     bool call;
+
+    // Intrusive list of all registered exits with the same exitAddress, see
+    // JitBaseBlockCache::links_to. Only valid once the owning block has been finalized.
+    JitBlock* source = nullptr;
+    LinkData* prev_link = nullptr;
+    LinkData* next_link = nullptr;
   };
   std::vector<LinkData> linkData;
 
-  // This set stores all physical addresses of all occupied instructions.
-  std::set<u32> physical_addresses;
+  // This sorted vector stores all physical addresses of all occupied instructions.
+  std::vector<u32> physical_addresses;
 
   std::unique_ptr<ProfileData> profile_data;
+
+  // Next block with the same physical entry address, see JitBaseBlockCache::block_map.
+  JitBlock* next_in_bucket = nullptr;
+  // False while the block sits in the free list of the block arena.
+  bool in_use = false;
+  // Remaining entries until a baseline tier block gets recompiled, decremented by the block itself.
+  u32 tier_up_countdown = 0;
+  // Increases with every allocated block, used to find the oldest blocks when evicting.
+  u64 allocation_order = 0;
 };
 
 typedef void (*CompiledCode)();
@@ -140,6 +155,146 @@ public:
   bool Test(u32 bit) const { return (m_valid_block[bit / 32] & (1u << (bit % 32))) != 0; }
 };
 
+// Tracks which 4 KiB pages of the physical address space contain compiled code. A second level
+// with one bit per 64 pages lets checks of large ranges skip address space without code quickly.
+// Pages are only cleared together with the whole cache.
+class CodePageBitSet final
+{
+public:
+  static constexpr u32 PAGE_SHIFT = 12;
+  static constexpr u32 PAGE_COUNT = 1u << (32 - PAGE_SHIFT);
+
+  void Set(u32 address)
+  {
+    const u32 page = address >> PAGE_SHIFT;
+    m_pages[page / 64] |= u64{1} << (page % 64);
+    m_groups[page / 64 / 64] |= u64{1} << (page / 64 % 64);
+  }
+
+  void ClearAll()
+  {
+    m_pages.fill(0);
+    m_groups.fill(0);
+  }
+
+  // Returns whether any page overlapping [address, address + length) contains code.
+  bool TestRange(u32 address, u32 length) const
+  {
+    if (length == 0)
+      return false;
+
+    const u32 first_page = address >> PAGE_SHIFT;
+    const u32 last_page = static_cast<u32>(
+        std::min<u64>(u64{address} + length - 1, 0xffff'ffff) >> PAGE_SHIFT);
+    u32 word = first_page / 64;
+    while (word <= last_page / 64)
+    {
+      const u64 group = m_groups[word / 64] >> (word % 64);
+      if (group == 0)
+      {
+        word = (word / 64 + 1) * 64;
+        continue;
+      }
+      if ((group & 1) == 0)
+      {
+        word += std::countr_zero(group);
+        continue;
+      }
+
+      u64 mask = ~u64{0};
+      if (word == first_page / 64)
+        mask &= ~u64{0} << (first_page % 64);
+      if (word == last_page / 64)
+        mask &= ~u64{0} >> (63 - last_page % 64);
+      if ((m_pages[word] & mask) != 0)
+        return true;
+      ++word;
+    }
+    return false;
+  }
+
+private:
+  std::array<u64, PAGE_COUNT / 64> m_pages{};
+  std::array<u64, PAGE_COUNT / 64 / 64> m_groups{};
+};
+
+// Sparse table mapping keys of up to KeyBits bits to values of type T. The key space is split
+// into three levels of fixed-size pages which are only allocated once a key inside of them is
+// written. Lookups never allocate and are a few dependent loads, and walking a range of keys skips
+// unpopulated pages entirely.
+template <typename T, u32 KeyBits>
+class JitPagedIndex final
+{
+public:
+  static constexpr u32 LEAF_BITS = 10;
+  static constexpr u32 MID_BITS = 10;
+  static constexpr u32 TOP_BITS = KeyBits - MID_BITS - LEAF_BITS;
+  static_assert(KeyBits > MID_BITS + LEAF_BITS && KeyBits <= 32);
+
+  // Returns nullptr if no value has ever been written to the page containing this key.
+  T* Find(u32 key) const
+  {
+    const auto& mid = m_top[key >> (MID_BITS + LEAF_BITS)];
+    if (!mid)
+      return nullptr;
+    const auto& leaf = (*mid)[(key >> LEAF_BITS) & MID_MASK];
+    if (!leaf)
+      return nullptr;
+    return &(*leaf)[key & LEAF_MASK];
+  }
+
+  T& GetOrCreate(u32 key)
+  {
+    auto& mid = m_top[key >> (MID_BITS + LEAF_BITS)];
+    if (!mid)
+      mid = std::make_unique<MidPage>();
+    auto& leaf = (*mid)[(key >> LEAF_BITS) & MID_MASK];
+    if (!leaf)
+      leaf = std::make_unique<LeafPage>();
+    return (*leaf)[key & LEAF_MASK];
+  }
+
+  // Calls f(key, value) for every key in [first, last] that lies in an allocated page.
+  // f must not allocate new pages in this index.
+  template <typename F>
+  void ForEachInRange(u32 first, u32 last, F f)
+  {
+    u64 key = first;
+    while (key <= last)
+    {
+      const auto& mid = m_top[key >> (MID_BITS + LEAF_BITS)];
+      if (!mid)
+      {
+        key = ((key >> (MID_BITS + LEAF_BITS)) + 1) << (MID_BITS + LEAF_BITS);
+        continue;
+      }
+      const auto& leaf = (*mid)[(key >> LEAF_BITS) & MID_MASK];
+      const u64 leaf_end = ((key >> LEAF_BITS) + 1) << LEAF_BITS;
+      if (leaf)
+      {
+        const u64 end = std::min<u64>(leaf_end, u64{last} + 1);
+        for (; key < end; ++key)
+          f(static_cast<u32>(key), (*leaf)[key & LEAF_MASK]);
+      }
+      key = leaf_end;
+    }
+  }
+
+  void Clear()
+  {
+    for (auto& mid : m_top)
+      mid.reset();
+  }
+
+private:
+  static constexpr u32 MID_MASK = (1u << MID_BITS) - 1;
+  static constexpr u32 LEAF_MASK = (1u << LEAF_BITS) - 1;
+
+  using LeafPage = std::array<T, 1u << LEAF_BITS>;
+  using MidPage = std::array<std::unique_ptr<LeafPage>, 1u << MID_BITS>;
+  std::array<std::unique_ptr<MidPage>, 1u << TOP_BITS> m_top;
+};
+
 class JitBaseBlockCache
 {
 public:
@@ -164,6 +319,11 @@ public:
 
   JitBlock* AllocateBlock(u32 em_address);
   void FinalizeBlock(JitBlock& block, bool block_link, const std::set<u32>& physical_addresses);
+  // Frees a block that was allocated but never finalized, e.g. because code generation failed.
+  void DiscardBlock(JitBlock& block);
+  // Destroys the older half of all blocks to make room in the code space. Returns the number of
+  // destroyed blocks.
+  size_t EvictOldBlocks();
 
   // Look for the block in the slow but accurate way.
   // This function shall be used if FastLookupIndexForAddress() failed.
@@ -196,29 +356,53 @@ private:
   void UnlinkBlock(const JitBlock& block);
   void InvalidateICacheInternal(u32 physical_address, u32 address, u32 length, bool forced);
 
+  void LinkExit(JitBlock::LinkData& exit, CPUEmuFeatureFlags feature_flags);
+  void RegisterLink(JitBlock::LinkData& exit);
+  void UnregisterLink(JitBlock::LinkData& exit);
+  void RemoveFromBlockMap(JitBlock& block);
+  void RemoveFromBlockRangeMap(JitBlock& block, u32 skipped_macro_block);
+  void FreeBlock(JitBlock& block);
+
   JitBlock* MoveBlockIntoFastCache(u32 em_address, CPUEmuFeatureFlags feature_flags);
 
   // Fast but risky block lookup based on fast_block_map.
   size_t FastLookupIndexForAddress(u32 address, u32 msr);
 
+  // Blocks are allocated from this arena. std::deque never relocates its elements, so pointers
+  // to blocks stay valid, and destroyed blocks are recycled through m_free_blocks instead of
+  // being returned to the heap.
+  std::deque<JitBlock> m_block_arena;
+  std::vector<JitBlock*> m_free_blocks;
+  u64 m_next_allocation_order = 0;
+
   // links_to hold all exit points of all valid blocks in a reverse way.
-  // It is used to query all blocks which links to an address.
-  std::unordered_map<u32, std::unordered_set<JitBlock*>> links_to;  // destination_PC -> number
+  // It is used to query all blocks which links to an address. It is indexed by the destination
+  // address in instruction granularity, and each entry is the head of an intrusive list chained
+  // through LinkData::next_link.
+  JitPagedIndex<JitBlock::LinkData*, 30> links_to;  // destination_PC >> 2 -> exits
 
-  // Map indexed by the physical address of the entry point.
-  // This is used to query the block based on the current PC in a slow way.
-  std::multimap<u32, JitBlock> block_map;  // start_addr -> block
+  // Index of the physical address of the entry point, in instruction granularity.
+  // This is used to query the block based on the current PC in a slow way. Each entry is the
+  // head of an intrusive list chained through JitBlock::next_in_bucket.
+  JitPagedIndex<JitBlock*, 30> block_map;  // start_addr >> 2 -> blocks
 
   // Range of overlapping code indexed by a masked physical address.
   // This is used for invalidation of memory regions. The range is grouped
   // in macro blocks of each 0x100 bytes.
   static constexpr u32 BLOCK_RANGE_MAP_ELEMENTS = 0x100;
-  std::map<u32, std::unordered_set<JitBlock*>> block_range_map;
+  // No physical address maps to this macro block.
+  static constexpr u32 NO_MACRO_BLOCK = ~0u;
+  JitPagedIndex<std::vector<JitBlock*>, 24> block_range_map;  // start_addr >> 8 -> blocks
 
   // This bitsets shows which cachelines overlap with any blocks.
   // It is used to provide a fast way to query if no icache invalidation is needed.
   ValidBlockBitSet valid_block;
 
+  // This shows which physical pages have ever contained compiled code since the last clear.
+  // It lets invalidations of ranges without any code, which are common for large ranges, return
+  // without looking at individual cache lines or blocks.
+  CodePageBitSet code_pages;
+
   // This contains the entry points for each block.
   // It is used by the assembly dispatcher to quickly
   // know where to jump based on pc and msr bits.
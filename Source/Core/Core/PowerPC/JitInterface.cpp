@@ -12,6 +12,7 @@
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
 #include "Core/Core.h"
@@ -125,6 +126,12 @@ void JitInterface::JitBlockLogDump(const Core::CPUThreadGuard& guard, std::FILE*
   if (!m_jit)
     return;
 
+  const PowerPC::MMU::SlowAccessStats& stats = m_system.GetMMU().GetSlowAccessStats();
+  NOTICE_LOG_FMT(POWERPC,
+                 "Slow memory accesses since boot: {} MMIO, {} page table, {} unmapped, "
+                 "{} watchpoint",
+                 stats.mmio, stats.page_table, stats.unmapped, stats.watchpoint);
+
   if (m_jit->IsProfilingEnabled())
   {
     u64 overall_cycles_spent = 0;
@@ -224,6 +231,16 @@ JitInterface::GetHostCode(u32 address) const
   return result;
 }
 
+u32 JitInterface::GetFastmemFaultCount(u32 address) const
+{
+  if (!m_jit)
+    return 0;
+
+  const auto& counts = m_jit->js.fastmemFaultCounts;
+  const auto it = counts.find(address);
+  return it != counts.end() ? it->second : 0;
+}
+
 bool JitInterface::HandleFault(uintptr_t access_address, SContext* ctx)
 {
   // Prevent nullptr dereference on a crash with no JIT present
@@ -313,6 +330,9 @@ void JitInterface::CompileExceptionCheck(ExceptionType type)
   case ExceptionType::SpeculativeConstants:
     exception_addresses = &m_jit->js.noSpeculativeConstantsAddresses;
     break;
+  case ExceptionType::TierUp:
+    exception_addresses = &m_jit->js.tierUpAddresses;
+    break;
   }
 
   auto& ppc_state = m_system.GetPPCState();
@@ -178,15 +178,24 @@ T MMU::ReadFromHardware(u32 em_address)
     if (!translated_addr.Success())
     {
       if (flag == XCheckTLBFlag::Read)
+      {
+        m_slow_access_stats.unmapped++;
         GenerateDSIException(em_address, false);
+      }
       return 0;
     }
+    if (flag == XCheckTLBFlag::Read &&
+        translated_addr.result == TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED)
+    {
+      m_slow_access_stats.page_table++;
+    }
     em_address = translated_addr.address;
     wi = translated_addr.wi;
   }
 
   if (flag == XCheckTLBFlag::Read && (em_address & 0xF8000000) == 0x08000000)
   {
+    m_slow_access_stats.mmio++;
     if (em_address < 0x0c000000)
     {
       return EFB_Read(em_address);
@@ -257,6 +266,9 @@ T MMU::ReadFromHardware(u32 em_address)
     return bswap(value);
   }
 
+  if (flag == XCheckTLBFlag::Read)
+    m_slow_access_stats.unmapped++;
+
   PanicAlertFmt("Unable to resolve read address {:x} PC {:x}", em_address, m_ppc_state.pc);
   if (m_system.IsPauseOnPanicMode())
   {
@@ -296,9 +308,17 @@ void MMU::WriteToHardware(u32 em_address, const u32 data, const u32 size)
     if (!translated_addr.Success())
     {
       if (flag == XCheckTLBFlag::Write)
+      {
+        m_slow_access_stats.unmapped++;
         GenerateDSIException(em_address, true);
+      }
       return;
     }
+    if (flag == XCheckTLBFlag::Write &&
+        translated_addr.result == TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED)
+    {
+      m_slow_access_stats.page_table++;
+    }
     em_address = translated_addr.address;
     wi = translated_addr.wi;
   }
@@ -316,6 +336,7 @@ void MMU::WriteToHardware(u32 em_address, const u32 data, const u32 size)
   if (flag == XCheckTLBFlag::Write &&
       (em_address & 0xFFFFF000) == GPFifo::GATHER_PIPE_PHYSICAL_ADDRESS)
   {
+    m_slow_access_stats.mmio++;
     switch (size)
     {
     case 1:
@@ -341,6 +362,7 @@ void MMU::WriteToHardware(u32 em_address, const u32 data, const u32 size)
 
   if (flag == XCheckTLBFlag::Write && (em_address & 0xF8000000) == 0x08000000)
   {
+    m_slow_access_stats.mmio++;
     if (em_address < 0x0c000000)
     {
       EFB_Write(data, em_address);
@@ -447,6 +469,9 @@ void MMU::WriteToHardware(u32 em_address, const u32 data, const u32 size)
     return;
   }
 
+  if (flag == XCheckTLBFlag::Write)
+    m_slow_access_stats.unmapped++;
+
   PanicAlertFmt("Unable to resolve write address {:x} PC {:x}", em_address, m_ppc_state.pc);
   if (m_system.IsPauseOnPanicMode())
   {
@@ -546,6 +571,8 @@ void MMU::Memcheck(u32 address, u64 var, bool write, size_t size)
   if (!m_power_pc.GetMemChecks().HasAny())
     return;
 
+  m_slow_access_stats.watchpoint++;
+
   TMemCheck* mc = m_power_pc.GetMemChecks().GetMemCheck(address, size);
   if (mc == nullptr)
     return;
@@ -109,6 +109,16 @@ enum class XCheckTLBFlag
 class MMU
 {
 public:
+  // How often CPU memory accesses went through ReadFromHardware or WriteToHardware, by the reason
+  // why a JIT couldn't handle them with a direct access to RAM
+  struct SlowAccessStats
+  {
+    u64 mmio = 0;        // MMIO, EFB and gather pipe accesses
+    u64 page_table = 0;  // Accesses translated by the page table rather than by a BAT
+    u64 unmapped = 0;    // Accesses which raised a DSI or didn't resolve to anything
+    u64 watchpoint = 0;  // Accesses checked against memory breakpoints
+  };
+
   MMU(Core::System& system, Memory::MemoryManager& memory, PowerPC::PowerPCManager& power_pc);
   MMU(const MMU& other) = delete;
   MMU(MMU&& other) = delete;
@@ -253,6 +263,9 @@ public:
 
   std::optional<u32> GetTranslatedAddress(u32 address);
 
+  const SlowAccessStats& GetSlowAccessStats() const { return m_slow_access_stats; }
+  void ResetSlowAccessStats() { m_slow_access_stats = {}; }
+
   BatTable& GetIBATTable() { return m_ibat_table; }
   BatTable& GetDBATTable() { return m_dbat_table; }
 
@@ -326,6 +339,8 @@ private:
 
   BatTable m_ibat_table;
   BatTable m_dbat_table;
+
+  SlowAccessStats m_slow_access_stats;
 };
 
 void ClearDCacheLineFromJit(MMU& mmu, u32 address);
@@ -43,6 +43,8 @@ namespace PPCAnalyst
 {
 // 0 does not perform block merging
 constexpr u32 BRANCH_FOLLOWING_THRESHOLD = 2;
+// Used instead of the above with OPTION_TRACE_FORMATION
+constexpr u32 TRACE_FOLLOWING_THRESHOLD = 8;
 
 constexpr u32 INVALID_BRANCH_TARGET = 0xFFFFFFFF;
 
@@ -282,35 +284,32 @@ bool PPCAnalyzer::CanSwapAdjacentOps(const CodeOp& a, const CodeOp& b) const
 static void FindFunctionsFromBranches(const Core::CPUThreadGuard& guard, u32 startAddr, u32 endAddr,
                                       Common::SymbolDB* func_db)
 {
+  // Most of the scanned words aren't calls, and most call targets are called many times, so look
+  // for bl instructions first and only analyze every target once afterwards.
+  std::vector<u32> targets;
   auto& mmu = guard.GetSystem().GetMMU();
   for (u32 addr = startAddr; addr < endAddr; addr += 4)
   {
     const PowerPC::TryReadInstResult read_result = mmu.TryReadInstruction(addr);
     const UGeckoInstruction instr = read_result.hex;
 
-    if (read_result.valid && PPCTables::IsValidInstruction(instr, addr))
+    // Every instruction with primary opcode 18 is a valid branch.
+    if (read_result.valid && instr.OPCD == 18 && instr.LK)
     {
-      switch (instr.OPCD)
-      {
-      case 18:  // branch instruction
-      {
-        if (instr.LK)  // bl
-        {
-          u32 target = SignExt26(instr.LI << 2);
-          if (!instr.AA)
-            target += addr;
-          if (PowerPC::MMU::HostIsRAMAddress(guard, target))
-          {
-            func_db->AddFunction(guard, target);
-          }
-        }
-      }
-      break;
-      default:
-        break;
-      }
+      u32 target = SignExt26(instr.LI << 2);
+      if (!instr.AA)
+        target += addr;
+      targets.push_back(target);
     }
   }
+
+  std::sort(targets.begin(), targets.end());
+  targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+  for (const u32 target : targets)
+  {
+    if (PowerPC::MMU::HostIsRAMAddress(guard, target))
+      func_db->AddFunction(guard, target);
+  }
 }
 
 static void FindFunctionsFromHandlers(const Core::CPUThreadGuard& guard, PPCSymbolDB* func_db)
@@ -731,13 +730,23 @@ void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code,
   }
 }
 
+static bool IsBarrierInstruction(UGeckoInstruction inst)
+{
+  // sync and isync only order memory accesses and instruction fetches, which isn't observable in a
+  // loop which doesn't write to memory
+  return (inst.OPCD == 31 && inst.SUBOP10 == 598) || (inst.OPCD == 19 && inst.SUBOP10 == 150);
+}
+
 bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const
 {
   // Very basic algorithm to detect busy wait loops:
   //   * It loops to itself and does not contain any other branches.
   //   * It does not write to memory.
   //   * It only reads from registers it wrote to earlier in the loop, or it
-  //     does not write to these registers.
+  //     does not write to these registers. The same goes for CR fields, so that
+  //     loops which combine several comparisons with CR instructions are detected.
+  //   * Apart from loads, integer and CR instructions, it may only contain
+  //     barriers, which are common in loops polling hardware registers.
   //
   // Would benefit a lot from basic inlining support - a lot of the most
   // used busy loops are DSP register interactions, which are bl/cmp/bne
@@ -745,6 +754,8 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
   // don't detect these at the moment.
   std::bitset<32> write_disallowed_regs;
   std::bitset<32> written_regs;
+  BitSet8 write_disallowed_crs;
+  BitSet8 written_crs;
   for (size_t i = 0; i <= instructions; ++i)
   {
     if (code[i].opinfo->type == OpType::Branch)
@@ -754,7 +765,12 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
       if (code[i].branchTo == block->m_address && i == instructions)
         return true;
     }
-    else if (code[i].opinfo->type != OpType::Integer && code[i].opinfo->type != OpType::Load)
+    else if (IsBarrierInstruction(code[i].inst))
+    {
+      continue;
+    }
+    else if (code[i].opinfo->type != OpType::Integer && code[i].opinfo->type != OpType::Load &&
+             code[i].opinfo->type != OpType::CR)
     {
       // In the future, some subsets of other instruction types might get
       // supported. Right now, only try loops that have this very
@@ -779,6 +795,11 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
           return false;
         written_regs[reg] = true;
       }
+
+      write_disallowed_crs |= code[i].crIn & ~written_crs;
+      if (code[i].crOut & write_disallowed_crs)
+        return false;
+      written_crs |= code[i].crOut;
     }
   }
   return false;
@@ -794,6 +815,58 @@ static bool CanCauseGatherPipeInterruptCheck(const CodeOp& op)
          op.opinfo->type == OpType::StorePS;
 }
 
+// Returns the GPR which the instruction leaves with its sign bit known to be clear, or -1.
+static int GetNonNegativeOutput(const CodeOp& op, BitSet32 gpr_known_non_negative)
+{
+  const UGeckoInstruction inst = op.inst;
+  switch (inst.OPCD)
+  {
+  case 14:  // addi
+  case 15:  // addis
+    return inst.RA == 0 && inst.SIMM_16 >= 0 ? inst.RD : -1;
+  case 21:  // rlwinmx
+  case 23:  // rlwnmx
+    // The mask doesn't wrap around, and doesn't include the sign bit
+    return inst.MB != 0 && inst.MB <= inst.ME ? inst.RA : -1;
+  case 24:  // ori
+  case 26:  // xori
+    return gpr_known_non_negative[inst.RS] ? inst.RA : -1;
+  case 25:  // oris
+  case 27:  // xoris
+    return inst.UIMM < 0x8000 && gpr_known_non_negative[inst.RS] ? inst.RA : -1;
+  case 28:  // andi.
+    return inst.RA;
+  case 29:  // andis.
+    return inst.UIMM < 0x8000 || gpr_known_non_negative[inst.RS] ? inst.RA : -1;
+  case 34:  // lbz
+  case 35:  // lbzu
+  case 40:  // lhz
+  case 41:  // lhzu
+    return inst.RD;
+  case 31:
+    switch (inst.SUBOP10)
+    {
+    case 87:   // lbzx
+    case 119:  // lbzux
+    case 279:  // lhzx
+    case 311:  // lhzux
+      return inst.RD;
+    case 26:  // cntlzwx
+      return inst.RA;
+    case 28:  // andx
+      return gpr_known_non_negative[inst.RS] || gpr_known_non_negative[inst.RB] ? inst.RA : -1;
+    case 60:  // andcx
+      return gpr_known_non_negative[inst.RS] ? inst.RA : -1;
+    case 316:  // xorx
+    case 444:  // orx
+      return gpr_known_non_negative[inst.RS] && gpr_known_non_negative[inst.RB] ? inst.RA : -1;
+    }
+    break;
+  }
+
+  return -1;
+}
+
 u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
                          std::size_t block_size) const
 {
@@ -823,6 +896,16 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
   u32 num_inst = 0;
 
   const bool enable_follow = m_enable_branch_following;
+  const bool enable_trace = HasOption(OPTION_TRACE_FORMATION);
+
+  const auto can_follow = [&](u32 target, std::size_t num_ops) {
+    if (numFollows < BRANCH_FOLLOWING_THRESHOLD)
+      return true;
+    if (!enable_trace || numFollows >= TRACE_FOLLOWING_THRESHOLD)
+      return false;
+    return std::none_of(code, code + num_ops,
+                        [target](const CodeOp& op) { return op.address == target; });
+  };
 
   auto& system = Core::System::GetInstance();
   auto& mmu = system.GetMMU();
@@ -885,7 +968,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
       {
         code[i].branchTo = code[caller].address + 4;
         if ((inst.BO & BO_DONT_DECREMENT_FLAG) && (inst.BO & BO_DONT_CHECK_CONDITION) &&
-            numFollows < BRANCH_FOLLOWING_THRESHOLD)
+            can_follow(code[i].branchTo, i))
         {
           // bclrx with unconditional branch = return
           // Follow it if we can propagate the LR value of the last CALL instruction.
@@ -945,7 +1028,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     code[i].branchIsIdleLoop =
         code[i].branchTo == block->m_address && IsBusyWaitLoop(block, code, i);
 
-    if (follow && numFollows < BRANCH_FOLLOWING_THRESHOLD)
+    if (follow && can_follow(code[i].branchTo, i))
     {
       // Follow the unconditional branch.
       numFollows++;
@@ -1058,11 +1141,26 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
 
   // Forward scan, for flags that need the other direction for calculation.
   BitSet32 fprIsSingle, fprIsDuplicated, fprIsStoreSafe;
+  BitSet32 gprKnownNonNegative;
   BitSet8 gqrUsed, gqrModified;
   for (u32 i = 0; i < block->m_num_instructions; i++)
   {
     CodeOp& op = code[i];
 
+    op.gprKnownNonNegative = gprKnownNonNegative;
+    if (op.inst.OPCD == 31 && (op.inst.SUBOP10 == 533 || op.inst.SUBOP10 == 597))
+    {
+      // lswx and lswi write more registers than regsOut says.
+      gprKnownNonNegative = BitSet32(0);
+    }
+    else
+    {
+      const int non_negative_output = GetNonNegativeOutput(op, gprKnownNonNegative);
+      gprKnownNonNegative &= ~op.regsOut;
+      if (non_negative_output >= 0)
+        gprKnownNonNegative[non_negative_output] = true;
+    }
+
     op.fprIsSingle = fprIsSingle;
     op.fprIsDuplicated = fprIsDuplicated;
     op.fprIsStoreSafeBeforeInst = fprIsStoreSafe;
@@ -74,6 +74,9 @@ struct CodeOp  // 16B
   // denormals and SNaNs being preserved as long as no arithmetic operation is performed on them.)
   BitSet32 fprIsStoreSafeBeforeInst;
   BitSet32 fprIsStoreSafeAfterInst;
+  // which GPRs are known to have their sign bit clear before this instruction, e.g. because they
+  // were loaded with lbz or masked with rlwinm.
+  BitSet32 gprKnownNonNegative;
 
   BitSet32 GetFregsOut() const
   {
@@ -172,12 +175,21 @@ public:
 
     // Reorder cror instructions next to their associated fcmp.
     OPTION_CROR_MERGE = (1 << 6),
+
+    // Form larger traces for hot code by following more unconditional branches and call/return
+    // pairs than OPTION_BRANCH_FOLLOW does on its own, so that register and constant state carries
+    // across what would otherwise be block boundaries. Code that is already part of the block is
+    // never followed again, so loops don't get unrolled.
+    // Requires OPTION_BRANCH_FOLLOW.
+    OPTION_TRACE_FORMATION = (1 << 7),
   };
 
   // Option setting/getting
   void SetOption(AnalystOption option) { m_options |= option; }
   void ClearOption(AnalystOption option) { m_options &= ~(option); }
   bool HasOption(AnalystOption option) const { return !!(m_options & option); }
+  u32 GetOptions() const { return m_options; }
+  void SetOptions(u32 options) { m_options = options; }
   void SetDebuggingEnabled(bool enabled) { m_is_debugging_enabled = enabled; }
   void SetBranchFollowingEnabled(bool enabled) { m_enable_branch_following = enabled; }
   void SetFloatExceptionsEnabled(bool enabled) { m_enable_float_exceptions = enabled; }
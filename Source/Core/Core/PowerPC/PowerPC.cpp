@@ -306,6 +306,7 @@ void PowerPCManager::Reset()
   m_ppc_state.pagetable_base = 0;
   m_ppc_state.pagetable_hashmask = 0;
   m_ppc_state.tlb = {};
+  m_system.GetMMU().ResetSlowAccessStats();
 
   ResetRegisters();
   m_ppc_state.iCache.Reset(m_system.GetJitInterface());
@@ -6,11 +6,18 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <filesystem>
+#include <functional>
+#include <future>
+#include <limits>
 #include <locale>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <span>
 #include <string>
 #include <thread>
 #include <utility>
@@ -22,11 +29,13 @@
 #include <lz4.h>
 #include <lzo/lzo1x.h>
 
+#include "Common/Align.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/Thread.h"
 #include "Common/TimeUtil.h"
@@ -36,6 +45,7 @@
 
 #include "Core/AchievementManager.h"
 #include "Core/Config/AchievementSettings.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -226,23 +236,368 @@ void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer)
       true);
 }
 
+// Saves the state in a single pass, without measuring its size first. The buffer starts out a bit
+// larger than the previous state, so it usually doesn't have to grow. Must run on the CPU thread.
+// Returns false if DoState aborted the save.
+static bool DoStateToBuffer(Core::System& system, std::vector<u8>& buffer)
+{
+  static size_t s_last_state_size = 0;
+
+  buffer.resize(s_last_state_size + s_last_state_size / 16);
+  PointerWrap p(buffer);
+  DoState(system, p);
+  buffer.resize(p.GetOffset());
+  s_last_state_size = buffer.size();
+  return p.IsWriteMode();
+}
+
 void SaveToBuffer(Core::System& system, std::vector<u8>& buffer)
 {
-  Core::RunOnCPUThread(
-      system,
-      [&] {
-        u8* ptr = nullptr;
-        PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+  Core::RunOnCPUThread(system, [&] { DoStateToBuffer(system, buffer); }, true);
+}
 
-        DoState(system, p_measure);
-        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-        buffer.resize(buffer_size);
+// Savestates are compared in pages of this size when creating deltas
+static constexpr size_t DELTA_PAGE_SIZE = 0x1000;
 
-        ptr = buffer.data();
-        PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
-        DoState(system, p);
-      },
-      true);
+template <typename T>
+static void AppendToDelta(std::vector<u8>& delta, const T& value)
+{
+  const u8* ptr = reinterpret_cast<const u8*>(&value);
+  delta.insert(delta.end(), ptr, ptr + sizeof(T));
+}
+
+template <typename T>
+static bool ReadFromDelta(std::span<const u8> delta, size_t* position, T* value)
+{
+  if (delta.size() - *position < sizeof(T))
+    return false;
+  std::memcpy(value, delta.data() + *position, sizeof(T));
+  *position += sizeof(T);
+  return true;
+}
+
+// The delta starts with the size of the state, followed by runs of pages which differ from the
+// base, each stored as an offset, a size and the data
+static void CreateStateDelta(std::span<const u8> base, std::span<const u8> state,
+                             std::vector<u8>& delta)
+{
+  delta.clear();
+  AppendToDelta<u64>(delta, state.size());
+
+  const auto append_run = [&](size_t start, size_t end) {
+    AppendToDelta<u64>(delta, start);
+    AppendToDelta<u64>(delta, end - start);
+    delta.insert(delta.end(), state.begin() + start, state.begin() + end);
+  };
+
+  std::optional<size_t> run_start;
+  for (size_t offset = 0; offset < state.size(); offset += DELTA_PAGE_SIZE)
+  {
+    const size_t size = std::min(DELTA_PAGE_SIZE, state.size() - offset);
+    const bool differs = offset + size > base.size() ||
+                         std::memcmp(state.data() + offset, base.data() + offset, size) != 0;
+
+    if (differs && !run_start)
+    {
+      run_start = offset;
+    }
+    else if (!differs && run_start)
+    {
+      append_run(*run_start, offset);
+      run_start.reset();
+    }
+  }
+
+  if (run_start)
+    append_run(*run_start, state.size());
+}
+
+static bool ApplyStateDelta(std::span<const u8> base, std::span<const u8> delta,
+                            std::vector<u8>& state)
+{
+  size_t position = 0;
+  u64 state_size;
+  if (!ReadFromDelta(delta, &position, &state_size))
+    return false;
+
+  state.assign(base.begin(), base.begin() + std::min<u64>(state_size, base.size()));
+  state.resize(state_size);
+
+  while (position < delta.size())
+  {
+    u64 run_offset;
+    u64 run_size;
+    if (!ReadFromDelta(delta, &position, &run_offset) ||
+        !ReadFromDelta(delta, &position, &run_size) || run_offset > state_size ||
+        run_size > state_size - run_offset || run_size > delta.size() - position)
+    {
+      return false;
+    }
+
+    std::memcpy(state.data() + run_offset, delta.data() + position, run_size);
+    position += run_size;
+  }
+
+  return true;
+}
+
+void SaveDeltaToBuffer(Core::System& system, const std::vector<u8>& base, std::vector<u8>& delta)
+{
+  std::vector<u8> state;
+  SaveToBuffer(system, state);
+  CreateStateDelta(base, state, delta);
+}
+
+void LoadDeltaFromBuffer(Core::System& system, const std::vector<u8>& base,
+                         const std::vector<u8>& delta)
+{
+  std::vector<u8> state;
+  if (!ApplyStateDelta(base, delta, state))
+  {
+    ERROR_LOG_FMT(CORE, "Invalid savestate delta");
+    return;
+  }
+
+  LoadFromBuffer(system, state);
+}
+
+FrameSnapshots::FrameSnapshots(size_t max_snapshots, size_t snapshots_per_base)
+    : m_max_snapshots(std::max<size_t>(max_snapshots, 1)),
+      m_snapshots_per_base(std::max<size_t>(snapshots_per_base, 1))
+{
+}
+
+void FrameSnapshots::Save(Core::System& system, u64 frame)
+{
+  DiscardFrom(frame);
+
+  std::vector<u8> state;
+  SaveToBuffer(system, state);
+
+  Snapshot& snapshot = m_snapshots.emplace_back();
+  snapshot.frame = frame;
+  if (m_snapshots.size() == 1 || m_snapshots_since_base >= m_snapshots_per_base)
+  {
+    snapshot.base = std::make_shared<const std::vector<u8>>(std::move(state));
+    CreateStateDelta(*snapshot.base, *snapshot.base, snapshot.delta);
+    m_snapshots_since_base = 1;
+  }
+  else
+  {
+    snapshot.base = m_snapshots[m_snapshots.size() - 2].base;
+    CreateStateDelta(*snapshot.base, state, snapshot.delta);
+    m_snapshots_since_base++;
+  }
+
+  // Full states stay alive for as long as a snapshot refers to them
+  while (m_snapshots.size() > m_max_snapshots)
+    m_snapshots.pop_front();
+}
+
+bool FrameSnapshots::Load(Core::System& system, u64 frame)
+{
+  const auto it = std::ranges::find(m_snapshots, frame, &Snapshot::frame);
+  if (it == m_snapshots.end())
+    return false;
+
+  std::vector<u8> state;
+  if (!ApplyStateDelta(*it->base, it->delta, state))
+    return false;
+
+  LoadFromBuffer(system, state);
+  return true;
+}
+
+bool FrameSnapshots::HasSnapshot(u64 frame) const
+{
+  return std::ranges::find(m_snapshots, frame, &Snapshot::frame) != m_snapshots.end();
+}
+
+void FrameSnapshots::DiscardAfter(u64 frame)
+{
+  if (frame != std::numeric_limits<u64>::max())
+    DiscardFrom(frame + 1);
+}
+
+void FrameSnapshots::DiscardFrom(u64 frame)
+{
+  while (!m_snapshots.empty() && m_snapshots.back().frame >= frame)
+  {
+    const bool was_base = m_snapshots.size() == 1 ||
+                          m_snapshots.back().base != m_snapshots[m_snapshots.size() - 2].base;
+    m_snapshots.pop_back();
+    m_snapshots_since_base = was_base ? m_snapshots_per_base : m_snapshots_since_base - 1;
+  }
+}
+
+void FrameSnapshots::Clear()
+{
+  m_snapshots.clear();
+  m_snapshots_since_base = 0;
+}
+
+namespace
+{
+struct CompressedBuffer
+{
+  std::vector<char> data;
+  u64 uncompressed_size = 0;
+};
+
+struct RewindState
+{
+  // The full state that the delta was created against, shared between several rewind states
+  std::shared_ptr<const CompressedBuffer> base;
+  CompressedBuffer delta;
+};
+}  // namespace
+
+// How many rewind states share a full state before a new full state is captured
+static constexpr size_t REWIND_STATES_PER_BASE = 32;
+
+// Everything except s_rewind_thread and s_rewind_frame_counter is only used by the rewind thread
+// or protected by s_rewind_mutex
+static Common::WorkQueueThread<std::vector<u8>> s_rewind_thread;
+static std::atomic<u32> s_rewind_frame_counter = 0;
+static std::mutex s_rewind_mutex;
+static std::deque<RewindState> s_rewind_states;
+static u64 s_rewind_memory_usage = 0;
+static std::vector<u8> s_rewind_base;
+static std::shared_ptr<const CompressedBuffer> s_rewind_compressed_base;
+static size_t s_rewind_states_since_base = 0;
+
+static CompressedBuffer CompressForRewind(std::span<const u8> data)
+{
+  CompressedBuffer result;
+  result.uncompressed_size = data.size();
+  result.data.resize(LZ4_compressBound(static_cast<int>(data.size())));
+  const int compressed_size =
+      LZ4_compress_default(reinterpret_cast<const char*>(data.data()), result.data.data(),
+                           static_cast<int>(data.size()), static_cast<int>(result.data.size()));
+  result.data.resize(std::max(compressed_size, 0));
+  result.data.shrink_to_fit();
+  return result;
+}
+
+static bool DecompressForRewind(const CompressedBuffer& buffer, std::vector<u8>& data)
+{
+  data.resize(buffer.uncompressed_size);
+  return LZ4_decompress_safe(buffer.data.data(), reinterpret_cast<char*>(data.data()),
+                             static_cast<int>(buffer.data.size()),
+                             static_cast<int>(data.size())) == static_cast<int>(data.size());
+}
+
+static void PopOldestRewindState()
+{
+  const RewindState& oldest = s_rewind_states.front();
+  s_rewind_memory_usage -= oldest.delta.data.size();
+
+  // The memory of a full state is counted for as long as any rewind state refers to it
+  if (s_rewind_states.size() == 1 || s_rewind_states[1].base != oldest.base)
+    s_rewind_memory_usage -= oldest.base->data.size();
+
+  s_rewind_states.pop_front();
+}
+
+static void AddRewindState(std::vector<u8> state)
+{
+  RewindState rewind_state;
+  if (!s_rewind_compressed_base || s_rewind_states_since_base >= REWIND_STATES_PER_BASE)
+  {
+    s_rewind_base = std::move(state);
+    s_rewind_compressed_base =
+        std::make_shared<const CompressedBuffer>(CompressForRewind(s_rewind_base));
+    s_rewind_states_since_base = 0;
+
+    std::vector<u8> delta;
+    CreateStateDelta(s_rewind_base, s_rewind_base, delta);
+    rewind_state.delta = CompressForRewind(delta);
+  }
+  else
+  {
+    std::vector<u8> delta;
+    CreateStateDelta(s_rewind_base, state, delta);
+    rewind_state.delta = CompressForRewind(delta);
+  }
+  rewind_state.base = s_rewind_compressed_base;
+  s_rewind_states_since_base++;
+
+  const u64 budget = u64{Config::Get(Config::MAIN_REWIND_MEMORY_BUDGET)} * 1024 * 1024;
+
+  std::lock_guard lk(s_rewind_mutex);
+  const bool base_in_use =
+      !s_rewind_states.empty() && s_rewind_states.back().base == rewind_state.base;
+  s_rewind_memory_usage += rewind_state.delta.data.size();
+  if (!base_in_use)
+    s_rewind_memory_usage += rewind_state.base->data.size();
+  s_rewind_states.push_back(std::move(rewind_state));
+
+  while (s_rewind_states.size() > 1 && s_rewind_memory_usage > budget)
+    PopOldestRewindState();
+}
+
+void UpdateRewind(Core::System& system)
+{
+  if (!Config::Get(Config::MAIN_REWIND_ENABLED) || NetPlay::IsNetPlayRunning())
+    return;
+
+  if (++s_rewind_frame_counter < std::max(Config::Get(Config::MAIN_REWIND_INTERVAL), 1u))
+    return;
+  s_rewind_frame_counter = 0;
+
+  // Only serializing the state happens on the CPU thread. Computing the delta and compressing it
+  // is left to the rewind thread.
+  std::vector<u8> state;
+  SaveToBuffer(system, state);
+  s_rewind_thread.Push(std::move(state));
+}
+
+bool Rewind(Core::System& system)
+{
+  s_rewind_thread.WaitForCompletion();
+
+  RewindState rewind_state;
+  {
+    std::lock_guard lk(s_rewind_mutex);
+    if (s_rewind_states.empty())
+    {
+      Core::DisplayMessage("No state to rewind to", 2000);
+      return false;
+    }
+
+    rewind_state = std::move(s_rewind_states.back());
+    s_rewind_memory_usage -= rewind_state.delta.data.size();
+    s_rewind_states.pop_back();
+    if (s_rewind_states.empty() || s_rewind_states.back().base != rewind_state.base)
+      s_rewind_memory_usage -= rewind_state.base->data.size();
+  }
+
+  std::vector<u8> base;
+  std::vector<u8> delta;
+  std::vector<u8> state;
+  if (!DecompressForRewind(*rewind_state.base, base) ||
+      !DecompressForRewind(rewind_state.delta, delta) || !ApplyStateDelta(base, delta, state))
+  {
+    ERROR_LOG_FMT(CORE, "Failed to decompress rewind state");
+    return false;
+  }
+
+  s_rewind_frame_counter = 0;
+  LoadFromBuffer(system, state);
+  return true;
+}
+
+void ClearRewind()
+{
+  s_rewind_thread.WaitForCompletion();
+
+  std::lock_guard lk(s_rewind_mutex);
+  s_rewind_states.clear();
+  s_rewind_memory_usage = 0;
+  s_rewind_base = {};
+  s_rewind_compressed_base.reset();
+  s_rewind_states_since_base = 0;
+  s_rewind_frame_counter = 0;
 }
 
 namespace
@@ -316,35 +671,65 @@ static bool CompareTimestamp(const SlotWithTimestamp& lhs, const SlotWithTimesta
   return lhs.timestamp < rhs.timestamp;
 }
 
-static void CompressBufferToFile(const u8* raw_buffer, u64 size, File::IOFile& f)
+// LZ4 payloads are split into blocks of this size, so that they can be compressed and
+// decompressed by several threads. Each block is preceded by its compressed size. The loader
+// falls back to decompressing one block after the other for states that were written with
+// differently sized blocks.
+static constexpr u64 LZ4_BLOCK_SIZE = 4 * 1024 * 1024;
+
+static void RunBlocksInParallel(size_t block_count, const std::function<void(size_t)>& function)
 {
-  u64 total_bytes_compressed = 0;
+  const size_t thread_count =
+      std::min<size_t>(block_count, std::max(std::thread::hardware_concurrency(), 1u));
+
+  std::atomic<size_t> next_block = 0;
+  const auto run = [&] {
+    for (size_t i = next_block++; i < block_count; i = next_block++)
+      function(i);
+  };
+
+  std::vector<std::future<void>> futures;
+  for (size_t i = 1; i < thread_count; ++i)
+    futures.push_back(std::async(std::launch::async, run));
+  run();
+  for (std::future<void>& future : futures)
+    future.wait();
+}
 
-  while (true)
-  {
-    u64 bytes_left_to_compress = size - total_bytes_compressed;
+static void CompressBufferToFile(const u8* raw_buffer, u64 size, File::IOFile& f)
+{
+  const size_t block_count = static_cast<size_t>(Common::AlignUp(size, LZ4_BLOCK_SIZE) /
+                                                 LZ4_BLOCK_SIZE);
+  std::vector<std::vector<char>> compressed_blocks(block_count);
+  std::atomic<bool> compression_failed = false;
+
+  RunBlocksInParallel(block_count, [&](size_t i) {
+    const u64 offset = i * LZ4_BLOCK_SIZE;
+    const int bytes_to_compress = static_cast<int>(std::min(LZ4_BLOCK_SIZE, size - offset));
+    std::vector<char>& compressed_block = compressed_blocks[i];
+    compressed_block.resize(LZ4_compressBound(bytes_to_compress));
+
+    const s32 compressed_len = LZ4_compress_default(
+        reinterpret_cast<const char*>(raw_buffer) + offset, compressed_block.data(),
+        bytes_to_compress, static_cast<int>(compressed_block.size()));
+    if (compressed_len == 0)
+      compression_failed = true;
 
-    int bytes_to_compress =
-        static_cast<int>(std::min(static_cast<u64>(LZ4_MAX_INPUT_SIZE), bytes_left_to_compress));
-    int compressed_buffer_size = LZ4_compressBound(bytes_to_compress);
-    auto compressed_buffer = std::make_unique<char[]>(compressed_buffer_size);
-    s32 compressed_len =
-        LZ4_compress_default(reinterpret_cast<const char*>(raw_buffer) + total_bytes_compressed,
-                             compressed_buffer.get(), bytes_to_compress, compressed_buffer_size);
+    compressed_block.resize(compressed_len);
+  });
 
-    if (compressed_len == 0)
-    {
-      PanicAlertFmtT("Internal LZ4 Error - compression failed");
-      break;
-    }
+  if (compression_failed)
+  {
+    PanicAlertFmtT("Internal LZ4 Error - compression failed");
+    return;
+  }
 
+  for (const std::vector<char>& compressed_block : compressed_blocks)
+  {
     // The size of the data to write is 'compressed_len'
+    const s32 compressed_len = static_cast<s32>(compressed_block.size());
     f.WriteArray(&compressed_len, 1);
-    f.WriteBytes(compressed_buffer.get(), compressed_len);
-
-    total_bytes_compressed += bytes_to_compress;
-    if (total_bytes_compressed == size)
-      break;
+    f.WriteBytes(compressed_block.data(), compressed_block.size());
   }
 }
 
@@ -408,11 +793,24 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
 
   WriteHeadersToFile(buffer_size, f);
 
+  const u64 payload_offset = f.Tell();
+  const auto compression_start = std::chrono::steady_clock::now();
+
   if (s_use_compression)
     CompressBufferToFile(buffer_data, buffer_size, f);
   else
     f.WriteBytes(buffer_data, buffer_size);
 
+  std::string compression_info;
+  if (s_use_compression && buffer_size != 0)
+  {
+    const auto compression_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - compression_start);
+    compression_info = fmt::format(" ({:.0f}% of {} MiB in {} ms)",
+                                   100.0 * (f.Tell() - payload_offset) / buffer_size,
+                                   buffer_size >> 20, compression_time.count());
+  }
+
   if (!f.IsGood())
     Core::DisplayMessage("Failed to write state file", 2000);
 
@@ -461,7 +859,9 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
     else
     {
       const std::filesystem::path temp_path(filename);
-      Core::DisplayMessage(fmt::format("Saved State to {}", temp_path.filename().string()), 2000);
+      Core::DisplayMessage(
+          fmt::format("Saved State to {}{}", temp_path.filename().string(), compression_info),
+          2000);
     }
   }
 
@@ -482,20 +882,8 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
           ++s_state_writes_in_queue;
         }
 
-        // Measure the size of the buffer.
-        u8* ptr = nullptr;
-        PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
-        DoState(system, p_measure);
-        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-
-        // Then actually do the write.
         std::vector<u8> current_buffer;
-        current_buffer.resize(buffer_size);
-        ptr = current_buffer.data();
-        PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
-        DoState(system, p);
-
-        if (p.IsWriteMode())
+        if (DoStateToBuffer(system, current_buffer))
         {
           Core::DisplayMessage("Saving State...", 1000);
 
@@ -665,60 +1053,101 @@ u64 GetUnixTimeOfSlot(int slot)
          (DOUBLE_TIME_OFFSET * MS_PER_SEC);
 }
 
-static bool DecompressLZ4(std::vector<u8>& raw_buffer, u64 size, File::IOFile& f)
+static bool DecompressLZ4Blocks(std::vector<u8>& raw_buffer, u64 size,
+                                std::span<const std::span<const u8>> compressed_blocks)
 {
-  raw_buffer.resize(size);
+  // Fast path: If every block except the last one has the size which CompressBufferToFile uses,
+  // the output position of each block is known and they can be decompressed in parallel
+  if (compressed_blocks.size() == Common::AlignUp(size, LZ4_BLOCK_SIZE) / LZ4_BLOCK_SIZE)
+  {
+    std::atomic<bool> block_size_mismatch = false;
+    RunBlocksInParallel(compressed_blocks.size(), [&](size_t i) {
+      const u64 offset = i * LZ4_BLOCK_SIZE;
+      const int expected_size = static_cast<int>(std::min(LZ4_BLOCK_SIZE, size - offset));
+      const int bytes_read = LZ4_decompress_safe(
+          reinterpret_cast<const char*>(compressed_blocks[i].data()),
+          reinterpret_cast<char*>(raw_buffer.data()) + offset,
+          static_cast<int>(compressed_blocks[i].size()), expected_size);
+      if (bytes_read != expected_size)
+        block_size_mismatch = true;
+    });
+
+    if (!block_size_mismatch)
+      return true;
+  }
 
   u64 total_bytes_read = 0;
-  while (true)
+  for (const std::span<const u8> compressed_block : compressed_blocks)
   {
-    s32 compressed_data_len;
-    if (!f.ReadArray(&compressed_data_len, 1))
-    {
-      PanicAlertFmt("Could not read state data length");
-      return false;
-    }
-
-    if (compressed_data_len <= 0)
-    {
-      PanicAlertFmtT("Internal LZ4 Error - Tried decompressing {0} bytes", compressed_data_len);
-      return false;
-    }
-
-    auto compressed_data = std::make_unique<char[]>(compressed_data_len);
-    if (!f.ReadBytes(compressed_data.get(), compressed_data_len))
-    {
-      PanicAlertFmt("Could not read state data");
-      return false;
-    }
-
     u32 max_decompress_size =
         static_cast<u32>(std::min((u64)LZ4_MAX_INPUT_SIZE, size - total_bytes_read));
 
     int bytes_read = LZ4_decompress_safe(
-        compressed_data.get(), reinterpret_cast<char*>(raw_buffer.data()) + total_bytes_read,
-        compressed_data_len, max_decompress_size);
+        reinterpret_cast<const char*>(compressed_block.data()),
+        reinterpret_cast<char*>(raw_buffer.data()) + total_bytes_read,
+        static_cast<int>(compressed_block.size()), max_decompress_size);
 
     if (bytes_read < 0)
     {
       PanicAlertFmtT("Internal LZ4 Error - decompression failed ({0}, {1}, {2})", bytes_read,
-                     compressed_data_len, max_decompress_size);
+                     compressed_block.size(), max_decompress_size);
       return false;
     }
 
     total_bytes_read += static_cast<u64>(bytes_read);
-
     if (total_bytes_read == size)
-    {
       return true;
+  }
+
+  PanicAlertFmtT("Internal LZ4 Error - payload size mismatch ({0} / {1}))", total_bytes_read,
+                 size);
+  return false;
+}
+
+static bool DecompressLZ4(std::vector<u8>& raw_buffer, u64 size, File::IOFile& f)
+{
+  raw_buffer.resize(size);
+
+  // Read all blocks first, so that they can be decompressed in parallel.
+  // The payload is the last thing in the file.
+  std::vector<u8> compressed_data(f.GetSize() - f.Tell());
+  if (!f.ReadBytes(compressed_data.data(), compressed_data.size()))
+  {
+    PanicAlertFmt("Could not read state data");
+    return false;
+  }
+
+  std::vector<std::span<const u8>> compressed_blocks;
+  size_t position = 0;
+  while (position < compressed_data.size())
+  {
+    s32 compressed_data_len;
+    if (compressed_data.size() - position < sizeof(compressed_data_len))
+    {
+      PanicAlertFmt("Could not read state data length");
+      return false;
     }
-    else if (total_bytes_read > size)
+    std::memcpy(&compressed_data_len, compressed_data.data() + position,
+                sizeof(compressed_data_len));
+    position += sizeof(compressed_data_len);
+
+    if (compressed_data_len <= 0)
     {
-      PanicAlertFmtT("Internal LZ4 Error - payload size mismatch ({0} / {1}))", total_bytes_read,
-                     size);
+      PanicAlertFmtT("Internal LZ4 Error - Tried decompressing {0} bytes", compressed_data_len);
       return false;
     }
+
+    if (compressed_data.size() - position < static_cast<u32>(compressed_data_len))
+    {
+      PanicAlertFmt("Could not read state data");
+      return false;
+    }
+
+    compressed_blocks.emplace_back(compressed_data.data() + position, compressed_data_len);
+    position += compressed_data_len;
   }
+
+  return DecompressLZ4Blocks(raw_buffer, size, compressed_blocks);
 }
 
 static bool ValidateHeaders(const StateHeader& header)
@@ -954,11 +1383,15 @@ void Init(Core::System& system)
     if (args.state_write_done_event)
       args.state_write_done_event->Set();
   });
+
+  s_rewind_thread.Reset("Rewind Worker", AddRewindState);
 }
 
 void Shutdown()
 {
   s_save_thread.Shutdown();
+  s_rewind_thread.Shutdown(true);
+  ClearRewind();
 
   // swapping with an empty vector, rather than clear()ing
   // this gives a better guarantee to free the allocated memory right NOW (as opposed to, actually,
@@ -6,7 +6,9 @@
 #pragma once
 
 #include <cstddef>
+#include <deque>
 #include <functional>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -109,11 +111,61 @@ void LoadAs(Core::System& system, const std::string& filename);
 void SaveToBuffer(Core::System& system, std::vector<u8>& buffer);
 void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer);
 
+// Like SaveToBuffer, but only stores the pages of the state which differ from a base state that
+// was created by SaveToBuffer. Useful for taking frequent snapshots without keeping a full copy
+// of emulated memory for each of them.
+void SaveDeltaToBuffer(Core::System& system, const std::vector<u8>& base, std::vector<u8>& delta);
+void LoadDeltaFromBuffer(Core::System& system, const std::vector<u8>& base,
+                         const std::vector<u8>& delta);
+
 void LoadLastSaved(Core::System& system, int i = 1);
 void SaveFirstSaved(Core::System& system);
 void UndoSaveState(Core::System& system);
 void UndoLoadState(Core::System& system);
 
+// Keeps in-memory savestates of the most recent frames, so that emulation can be rolled back to
+// one of them (for instance when a prediction of remote inputs turns out to be wrong).
+// A full state is only kept for every snapshots_per_base snapshots, the others are deltas.
+class FrameSnapshots
+{
+public:
+  FrameSnapshots(size_t max_snapshots, size_t snapshots_per_base);
+
+  // Frames are expected to be saved in increasing order
+  void Save(Core::System& system, u64 frame);
+  // Returns false if there is no snapshot of the given frame
+  bool Load(Core::System& system, u64 frame);
+
+  bool HasSnapshot(u64 frame) const;
+  // Drops the snapshots of frames after the given frame, which are outdated after rolling back
+  void DiscardAfter(u64 frame);
+  void Clear();
+
+private:
+  struct Snapshot
+  {
+    u64 frame;
+    std::shared_ptr<const std::vector<u8>> base;
+    std::vector<u8> delta;
+  };
+
+  void DiscardFrom(u64 frame);
+
+  size_t m_max_snapshots;
+  size_t m_snapshots_per_base;
+  size_t m_snapshots_since_base = 0;
+  std::deque<Snapshot> m_snapshots;
+};
+
+// While rewinding is enabled, a state is captured every MAIN_REWIND_INTERVAL frames and kept in
+// memory, dropping the oldest states once MAIN_REWIND_MEMORY_BUDGET is used up.
+// UpdateRewind should be called once per frame on the CPU thread.
+void UpdateRewind(Core::System& system);
+// Loads the most recently captured state and drops it, so that calling this repeatedly steps
+// further back. Returns false if there is nothing to rewind to.
+bool Rewind(Core::System& system);
+void ClearRewind();
+
 // for calling back into UI code without introducing a dependency on it in core
 using AfterLoadCallbackFunc = std::function<void()>;
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback);
@@ -21,6 +21,7 @@
 #include "DiscIO/NFSBlob.h"
 #include "DiscIO/SplitFileBlob.h"
 #include "DiscIO/TGCBlob.h"
+#include "DiscIO/VolumeWii.h"
 #include "DiscIO/WIABlob.h"
 #include "DiscIO/WbfsBlob.h"
 
@@ -214,6 +215,24 @@ u32 SectorReader::ReadChunk(u8* buffer, u64 chunk_num)
   return 0;
 }
 
+bool CanReadInParallel(const BlobReader& reader, u64 read_size)
+{
+  if (!reader.HasFastRandomAccessInBlock())
+  {
+    u64 block_size = reader.GetBlockSize();
+
+    // WIA and RVZ re-encrypt a whole Wii group whenever any part of it is read
+    const BlobType blob_type = reader.GetBlobType();
+    if (blob_type == BlobType::WIA || blob_type == BlobType::RVZ)
+      block_size = std::max(block_size, VolumeWii::GROUP_TOTAL_SIZE);
+
+    if (block_size != 0 && read_size % block_size != 0)
+      return false;
+  }
+
+  return reader.CopyReader() != nullptr;
+}
+
 std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename)
 {
   File::IOFile file(filename, "rb");
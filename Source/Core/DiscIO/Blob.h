@@ -194,14 +194,22 @@ std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename);
 
 using CompressCB = std::function<bool(const std::string& text, float percent)>;
 
+// Returns whether copies of the reader can read ranges of the given size on separate threads
+// without decoding any data more than once. Used by the conversion functions, which read the
+// input on their compression threads if possible.
+bool CanReadInParallel(const BlobReader& reader, u64 read_size);
+
+// threads is the number of threads to use for reading and compressing, or 0 to use one thread per
+// CPU thread
 bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
                   const std::string& outfile_path, u32 sub_type, int sector_size,
-                  CompressCB callback);
+                  CompressCB callback, unsigned int threads = 0);
 bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
-                    const std::string& outfile_path, CompressCB callback);
+                    const std::string& outfile_path, CompressCB callback,
+                    unsigned int threads = 0);
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, CompressCB callback);
+                       int chunk_size, CompressCB callback, unsigned int threads = 0);
 
 }  // namespace DiscIO
@@ -71,8 +71,7 @@ bool CISOFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
       // calculate the base address
       u64 const file_off = CISO_HEADER_SIZE + m_ciso_map[block] * (u64)m_block_size + data_offset;
 
-      if (!(m_file.Seek(file_off, File::SeekOrigin::Begin) &&
-            m_file.ReadArray(out_ptr, bytes_to_read)))
+      if (!m_file.ReadBytesAt(out_ptr, bytes_to_read, file_off))
       {
         m_file.ClearError();
         return false;
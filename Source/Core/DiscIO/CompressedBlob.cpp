@@ -7,6 +7,7 @@
 #include <cstdio>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -109,8 +110,7 @@ bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
   // clear unused part of zlib buffer. maybe this can be deleted when it works fully.
   memset(&m_zlib_buffer[comp_block_size], 0, m_zlib_buffer.size() - comp_block_size);
 
-  m_file.Seek(offset, File::SeekOrigin::Begin);
-  if (!m_file.ReadBytes(m_zlib_buffer.data(), comp_block_size))
+  if (!m_file.ReadBytesAt(m_zlib_buffer.data(), comp_block_size, offset))
   {
     ERROR_LOG_FMT(DISCIO, "The disc image \"{}\" is truncated, some of the data is missing.",
                   m_file_name);
@@ -175,10 +175,14 @@ struct CompressThreadState
 
   std::vector<u8> compressed_buffer;
   z_stream z;
+
+  // Only set if the input is read on the compression threads
+  std::unique_ptr<BlobReader> reader;
 };
 
 struct CompressParameters
 {
+  // Empty if the block still has to be read
   std::vector<u8> data{};
   u32 block_number = 0;
   u64 inpos = 0;
@@ -203,6 +207,18 @@ static ConversionResult<OutputParameters> Compress(CompressThreadState* state,
                                                    std::vector<u32>* hashes, int* num_stored,
                                                    int* num_compressed)
 {
+  if (parameters.data.empty())
+  {
+    // inpos is the end of the block
+    const u64 data_size = state->reader->GetDataSize();
+    const u64 block_offset = parameters.inpos - block_size;
+    const u64 bytes_to_read = std::min<u64>(block_size, data_size - block_offset);
+
+    parameters.data.resize(block_size);
+    if (!state->reader->Read(block_offset, bytes_to_read, parameters.data.data()))
+      return ConversionResultCode::ReadFailed;
+  }
+
   state->compressed_buffer.resize(block_size);
 
   int retval = deflateReset(&state->z);
@@ -276,7 +292,7 @@ static ConversionResultCode Output(OutputParameters parameters, File::IOFile* ou
 
 bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
                   const std::string& outfile_path, u32 sub_type, int block_size,
-                  CompressCB callback)
+                  CompressCB callback, unsigned int threads)
 {
   ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
 
@@ -317,6 +333,23 @@ bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
   int num_stored = 0;
   int progress_monitor = std::max<int>(1, header.num_blocks / 1000);
 
+  // Decoding the input can be slower than compressing it, so read it on the compression threads
+  // when possible
+  const bool parallel_read = CanReadInParallel(*infile, block_size);
+
+  std::mutex copy_reader_mutex;
+  const auto set_up_compress_thread_state = [&](CompressThreadState* state) {
+    if (parallel_read)
+    {
+      std::lock_guard lk(copy_reader_mutex);
+      state->reader = infile->CopyReader();
+      if (!state->reader)
+        return ConversionResultCode::InternalError;
+    }
+
+    return SetUpCompressThreadState(state);
+  };
+
   const auto compress = [&](CompressThreadState* state, CompressParameters parameters) {
     return Compress(state, std::move(parameters), block_size, &hashes, &num_stored,
                     &num_compressed);
@@ -328,7 +361,7 @@ bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
   };
 
   MultithreadedCompressor<CompressThreadState, CompressParameters, OutputParameters> compressor(
-      SetUpCompressThreadState, compress, output);
+      set_up_compress_thread_state, compress, output, threads);
 
   std::vector<u8> in_buf(block_size);
   for (u32 i = 0; i < header.num_blocks; i++)
@@ -336,6 +369,13 @@ bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
     if (compressor.GetStatus() != ConversionResultCode::Success)
       break;
 
+    if (parallel_read)
+    {
+      inpos += block_size;
+      compressor.CompressAndWrite(CompressParameters{{}, i, inpos});
+      continue;
+    }
+
     const u64 bytes_to_read = std::min<u64>(block_size, header.data_size - inpos);
 
     if (!infile->Read(inpos, bytes_to_read, in_buf.data()))
@@ -97,9 +97,15 @@ bool DiscContent::Read(u64* offset, u64* length, u8** buffer, DirectoryBlobReade
     if (std::holds_alternative<ContentFile>(m_content_source))
     {
       const auto& content = std::get<ContentFile>(m_content_source);
-      File::IOFile file(content.m_filename, "rb");
-      if (!file.Seek(content.m_offset + offset_in_content, File::SeekOrigin::Begin) ||
-          !file.ReadBytes(*buffer, bytes_to_read))
+      File::IOFile temporary_file;
+      File::IOFile* file = &temporary_file;
+      if (blob)
+        file = blob->GetOpenFile(content.m_filename);
+      else
+        temporary_file.Open(content.m_filename, "rb");
+
+      if (!file || !file->Seek(content.m_offset + offset_in_content, File::SeekOrigin::Begin) ||
+          !file->ReadBytes(*buffer, bytes_to_read))
       {
         return false;
       }
@@ -486,6 +492,33 @@ DirectoryBlobReader::DirectoryBlobReader(const DirectoryBlobReader& rhs)
 {
 }
 
+File::IOFile* DirectoryBlobReader::GetOpenFile(const std::string& path)
+{
+  const u64 use = ++m_open_file_counter;
+
+  const auto it = std::ranges::find(m_open_files, path, &OpenFile::path);
+  if (it != m_open_files.end())
+  {
+    it->last_use = use;
+    return &it->file;
+  }
+
+  File::IOFile file(path, "rb");
+  if (!file.IsOpen())
+    return nullptr;
+
+  OpenFile* open_file;
+  if (m_open_files.size() < MAX_OPEN_FILES)
+    open_file = &m_open_files.emplace_back();
+  else
+    open_file = &*std::ranges::min_element(m_open_files, {}, &OpenFile::last_use);
+
+  open_file->path = path;
+  open_file->file = std::move(file);
+  open_file->last_use = use;
+  return &open_file->file;
+}
+
 bool DirectoryBlobReader::Read(u64 offset, u64 length, u8* buffer)
 {
   if (offset + length > m_data_size)
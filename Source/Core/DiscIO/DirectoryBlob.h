@@ -16,6 +16,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/Volume.h"
 #include "DiscIO/WiiEncryptionCache.h"
@@ -23,7 +24,6 @@
 namespace File
 {
 struct FSTEntry;
-class IOFile;
 }  // namespace File
 
 namespace DiscIO
@@ -288,6 +288,15 @@ private:
     PartitionType type;
   };
 
+  struct OpenFile
+  {
+    std::string path;
+    File::IOFile file;
+    u64 last_use = 0;
+  };
+
+  static constexpr size_t MAX_OPEN_FILES = 16;
+
   explicit DirectoryBlobReader(const std::string& game_partition_root,
                                const std::string& true_root);
   explicit DirectoryBlobReader(
@@ -313,6 +322,11 @@ private:
 
   DiscIO::VolumeDisc* GetWrappedVolume() { return m_wrapped_volume.get(); }
 
+  // Returns a handle to the given host file, or nullptr if it can't be opened.
+  // The handles of recently read files are kept open, so that games which read a file in
+  // many small pieces don't reopen it for every read.
+  File::IOFile* GetOpenFile(const std::string& path);
+
   // For GameCube:
   DirectoryBlobPartition m_gamecube_pseudopartition;
 
@@ -327,6 +341,9 @@ private:
   u64 m_data_size;
 
   std::unique_ptr<DiscIO::VolumeDisc> m_wrapped_volume;
+
+  std::vector<OpenFile> m_open_files;
+  u64 m_open_file_counter = 0;
 };
 
 }  // namespace DiscIO
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -12,12 +13,17 @@
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
+#include "Core/Config/MainSettings.h"
+#include "DiscIO/MultithreadedCompressor.h"
 
 namespace DiscIO
 {
 PlainFileReader::PlainFileReader(File::IOFile file) : m_file(std::move(file))
 {
   m_size = m_file.GetSize();
+
+  if (Config::Get(Config::MAIN_MEMORY_MAPPED_DISC_IMAGES))
+    m_mapping.Map(m_file);
 }
 
 std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file)
@@ -35,7 +41,10 @@ std::unique_ptr<BlobReader> PlainFileReader::CopyReader() const
 
 bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 {
-  if (m_file.Seek(offset, File::SeekOrigin::Begin) && m_file.ReadBytes(out_ptr, nbytes))
+  if (m_mapping.IsMapped())
+    return m_mapping.Read(offset, nbytes, out_ptr);
+
+  if (m_file.ReadBytesAt(out_ptr, nbytes, offset))
   {
     return true;
   }
@@ -46,8 +55,44 @@ bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
   }
 }
 
+namespace
+{
+struct PlainCompressThreadState
+{
+  // Only set if the input is read on the compression threads
+  std::unique_ptr<BlobReader> reader;
+};
+
+struct PlainCompressParameters
+{
+  std::vector<u8> data{};
+  u64 offset = 0;
+  u64 size = 0;
+  u64 buffer_index = 0;
+};
+
+struct PlainOutputParameters
+{
+  std::vector<u8> data{};
+  u64 buffer_index = 0;
+};
+
+ConversionResult<PlainOutputParameters> ReadBuffer(PlainCompressThreadState* state,
+                                                   PlainCompressParameters parameters)
+{
+  if (state->reader)
+  {
+    parameters.data.resize(parameters.size);
+    if (!state->reader->Read(parameters.offset, parameters.size, parameters.data.data()))
+      return ConversionResultCode::ReadFailed;
+  }
+
+  return PlainOutputParameters{std::move(parameters.data), parameters.buffer_index};
+}
+}  // namespace
+
 bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
-                    const std::string& outfile_path, CompressCB callback)
+                    const std::string& outfile_path, CompressCB callback, unsigned int threads)
 {
   ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
 
@@ -74,49 +119,86 @@ bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
       buffer_size *= 2;
   }
 
-  std::vector<u8> buffer(buffer_size);
   const u64 num_buffers = (infile->GetDataSize() + buffer_size - 1) / buffer_size;
-  int progress_monitor = std::max<int>(1, num_buffers / 100);
-  bool success = true;
+  const u64 progress_monitor = std::max<u64>(1, num_buffers / 100);
 
-  for (u64 i = 0; i < num_buffers; i++)
-  {
-    if (i % progress_monitor == 0)
+  // Decoding the input is usually the slow part, so spread it over the threads when possible.
+  // Otherwise, the input is read on this thread while the output thread writes.
+  const bool parallel_read = CanReadInParallel(*infile, buffer_size);
+
+  std::mutex copy_reader_mutex;
+  const auto set_up_thread_state = [&](PlainCompressThreadState* state) {
+    if (!parallel_read)
+      return ConversionResultCode::Success;
+
+    std::lock_guard lk(copy_reader_mutex);
+    state->reader = infile->CopyReader();
+    return state->reader ? ConversionResultCode::Success : ConversionResultCode::InternalError;
+  };
+
+  const auto output = [&](PlainOutputParameters parameters) {
+    if (!outfile.WriteBytes(parameters.data.data(), parameters.data.size()))
+      return ConversionResultCode::WriteFailed;
+
+    if (parameters.buffer_index % progress_monitor == 0)
     {
       const bool was_cancelled =
-          !callback(Common::GetStringT("Unpacking"), (float)i / (float)num_buffers);
+          !callback(Common::GetStringT("Unpacking"),
+                    static_cast<float>(parameters.buffer_index) / static_cast<float>(num_buffers));
       if (was_cancelled)
-      {
-        success = false;
-        break;
-      }
+        return ConversionResultCode::Canceled;
     }
+
+    return ConversionResultCode::Success;
+  };
+
+  MultithreadedCompressor<PlainCompressThreadState, PlainCompressParameters, PlainOutputParameters>
+      compressor(set_up_thread_state, ReadBuffer, output, threads);
+
+  for (u64 i = 0; i < num_buffers; i++)
+  {
+    if (compressor.GetStatus() != ConversionResultCode::Success)
+      break;
+
     const u64 inpos = i * buffer_size;
     const u64 sz = std::min(buffer_size, infile->GetDataSize() - inpos);
-    if (!infile->Read(inpos, sz, buffer.data()))
-    {
-      PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
-      success = false;
-      break;
-    }
-    if (!outfile.WriteBytes(buffer.data(), sz))
+
+    PlainCompressParameters parameters{{}, inpos, sz, i};
+    if (!parallel_read)
     {
-      PanicAlertFmtT("Failed to write the output file \"{0}\".\n"
-                     "Check that you have enough space available on the target drive.",
-                     outfile_path);
-      success = false;
-      break;
+      parameters.data.resize(sz);
+      if (!infile->Read(inpos, sz, parameters.data.data()))
+      {
+        compressor.SetError(ConversionResultCode::ReadFailed);
+        break;
+      }
     }
+
+    compressor.CompressAndWrite(std::move(parameters));
+  }
+
+  compressor.Shutdown();
+
+  const ConversionResultCode result = compressor.GetStatus();
+
+  if (result == ConversionResultCode::ReadFailed)
+    PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
+
+  if (result == ConversionResultCode::WriteFailed)
+  {
+    PanicAlertFmtT("Failed to write the output file \"{0}\".\n"
+                   "Check that you have enough space available on the target drive.",
+                   outfile_path);
   }
 
-  if (!success)
+  if (result != ConversionResultCode::Success)
   {
     // Remove the incomplete output file.
     outfile.Close();
     File::Delete(outfile_path);
   }
 
-  return success;
+  return result == ConversionResultCode::Success;
 }
 
 }  // namespace DiscIO
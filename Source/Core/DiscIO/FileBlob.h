@@ -9,6 +9,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/MappedFile.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
@@ -36,6 +37,7 @@ private:
   PlainFileReader(File::IOFile file);
 
   File::IOFile m_file;
+  Common::MappedFile m_mapping;
   u64 m_size;
 };
 
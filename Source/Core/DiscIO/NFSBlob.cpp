@@ -15,6 +15,7 @@
 #include <fmt/format.h>
 
 #include "Common/Align.h"
+#include "Common/Assert.h"
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/AES.h"
 #include "Common/IOFile.h"
@@ -162,6 +163,8 @@ NFSFileReader::NFSFileReader(std::vector<NFSLBARange> lba_ranges, std::vector<Fi
     : m_lba_ranges(std::move(lba_ranges)), m_files(std::move(files)),
       m_aes_context(Common::AES::CreateContextDecrypt(key.data())), m_raw_size(raw_size), m_key(key)
 {
+  m_blocks_encrypted.resize(MAX_BLOCKS_PER_READ * BLOCK_SIZE);
+  m_blocks_decrypted.resize(MAX_BLOCKS_PER_READ * BLOCK_SIZE);
   m_data_size = CalculateExpectedDataSize(m_lba_ranges);
 }
 
@@ -202,10 +205,33 @@ u64 NFSFileReader::ToPhysicalBlockIndex(u64 logical_block_index)
   return std::numeric_limits<u64>::max();
 }
 
-bool NFSFileReader::ReadEncryptedBlock(u64 physical_block_index)
+u64 NFSFileReader::GetContiguousBlockCount(u64 logical_block_index, u64 physical_block_index,
+                                           u64 max_block_count) const
 {
-  constexpr u64 BLOCKS_PER_FILE = MAX_FILE_SIZE / BLOCK_SIZE;
+  // The last block of each file is split between two files, so it has to be read on its own
+  const u64 block_in_file = physical_block_index % BLOCKS_PER_FILE;
+  if (block_in_file == BLOCKS_PER_FILE - 1)
+    return 1;
+
+  u64 block_count = std::min(max_block_count, BLOCKS_PER_FILE - 1 - block_in_file);
 
+  // Consecutive logical blocks are only consecutive physically within the same LBA range
+  for (const NFSLBARange& range : m_lba_ranges)
+  {
+    if (logical_block_index >= range.start_block &&
+        logical_block_index < range.start_block + range.num_blocks)
+    {
+      block_count =
+          std::min<u64>(block_count, range.start_block + range.num_blocks - logical_block_index);
+      break;
+    }
+  }
+
+  return std::max<u64>(block_count, 1);
+}
+
+bool NFSFileReader::ReadEncryptedBlocks(u64 physical_block_index, u64 block_count)
+{
   const u64 file_index = physical_block_index / BLOCKS_PER_FILE;
   const u64 block_in_file = physical_block_index % BLOCKS_PER_FILE;
 
@@ -217,18 +243,20 @@ bool NFSFileReader::ReadEncryptedBlock(u64 physical_block_index)
     constexpr size_t PART_1_SIZE = BLOCK_SIZE - sizeof(NFSHeader);
     constexpr size_t PART_2_SIZE = sizeof(NFSHeader);
 
+    ASSERT(block_count == 1);
+
     File::IOFile& file_1 = m_files[file_index];
     File::IOFile& file_2 = m_files[file_index + 1];
 
     if (!file_1.Seek(sizeof(NFSHeader) + block_in_file * BLOCK_SIZE, File::SeekOrigin::Begin) ||
-        !file_1.ReadBytes(m_current_block_encrypted.data(), PART_1_SIZE))
+        !file_1.ReadBytes(m_blocks_encrypted.data(), PART_1_SIZE))
     {
       file_1.ClearError();
       return false;
     }
 
     if (!file_2.Seek(0, File::SeekOrigin::Begin) ||
-        !file_2.ReadBytes(m_current_block_encrypted.data() + PART_1_SIZE, PART_2_SIZE))
+        !file_2.ReadBytes(m_blocks_encrypted.data() + PART_1_SIZE, PART_2_SIZE))
     {
       file_2.ClearError();
       return false;
@@ -238,10 +266,12 @@ bool NFSFileReader::ReadEncryptedBlock(u64 physical_block_index)
   {
     // Normal case. The read is offset by 0x200 bytes, but it's all within one file.
 
+    ASSERT(block_in_file + block_count < BLOCKS_PER_FILE);
+
     File::IOFile& file = m_files[file_index];
 
     if (!file.Seek(sizeof(NFSHeader) + block_in_file * BLOCK_SIZE, File::SeekOrigin::Begin) ||
-        !file.ReadBytes(m_current_block_encrypted.data(), BLOCK_SIZE))
+        !file.ReadBytes(m_blocks_encrypted.data(), block_count * BLOCK_SIZE))
     {
       file.ClearError();
       return false;
@@ -251,38 +281,52 @@ bool NFSFileReader::ReadEncryptedBlock(u64 physical_block_index)
   return true;
 }
 
-void NFSFileReader::DecryptBlock(u64 logical_block_index)
+void NFSFileReader::DecryptBlock(u64 logical_block_index, size_t index_in_buffer)
 {
   std::array<u8, 16> iv{};
   const u64 swapped_block_index = Common::swap64(logical_block_index);
   std::memcpy(iv.data() + iv.size() - sizeof(swapped_block_index), &swapped_block_index,
               sizeof(swapped_block_index));
 
-  m_aes_context->Crypt(iv.data(), m_current_block_encrypted.data(),
-                       m_current_block_decrypted.data(), BLOCK_SIZE);
+  // Each block has its own IV, so the blocks can't be decrypted as one CBC stream
+  const size_t offset = index_in_buffer * BLOCK_SIZE;
+  m_aes_context->Crypt(iv.data(), m_blocks_encrypted.data() + offset,
+                       m_blocks_decrypted.data() + offset, BLOCK_SIZE);
 }
 
-bool NFSFileReader::ReadAndDecryptBlock(u64 logical_block_index)
+bool NFSFileReader::ReadAndDecryptBlocks(u64 logical_block_index, u64 max_block_count)
 {
   const u64 physical_block_index = ToPhysicalBlockIndex(logical_block_index);
 
+  u64 block_count = 1;
   if (physical_block_index == std::numeric_limits<u64>::max())
   {
     // The block isn't physically present. Treat its contents as all zeroes.
-    m_current_block_decrypted.fill(0);
+    std::fill_n(m_blocks_decrypted.begin(), BLOCK_SIZE, 0);
   }
   else
   {
-    if (!ReadEncryptedBlock(physical_block_index))
+    block_count =
+        GetContiguousBlockCount(logical_block_index, physical_block_index, max_block_count);
+    // If a longer read fails, it might be because it went past the end of a truncated file,
+    // so retry with only the block that was actually requested
+    if (!ReadEncryptedBlocks(physical_block_index, block_count) &&
+        (block_count == 1 || !ReadEncryptedBlocks(physical_block_index, block_count = 1)))
+    {
+      m_cached_block_count = 0;
       return false;
+    }
 
-    DecryptBlock(logical_block_index);
+    for (u64 i = 0; i < block_count; ++i)
+      DecryptBlock(logical_block_index + i, i);
   }
 
   // Small hack: Set 0x61 of the header to 1 so that VolumeWii realizes that the disc is unencrypted
   if (logical_block_index == 0)
-    m_current_block_decrypted[0x61] = 1;
+    m_blocks_decrypted[0x61] = 1;
 
+  m_first_cached_block_index = logical_block_index;
+  m_cached_block_count = block_count;
   return true;
 }
 
@@ -293,16 +337,25 @@ bool NFSFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
     const u64 logical_block_index = offset / BLOCK_SIZE;
     const u64 offset_in_block = offset % BLOCK_SIZE;
 
-    if (logical_block_index != m_current_logical_block_index)
+    if (logical_block_index < m_first_cached_block_index ||
+        logical_block_index >= m_first_cached_block_index + m_cached_block_count)
     {
-      if (!ReadAndDecryptBlock(logical_block_index))
+      // Read all blocks this read needs at once. If the previous read ended right before this
+      // one, it's likely that more reads will follow, so read as many blocks as possible.
+      const bool is_sequential =
+          logical_block_index == m_first_cached_block_index + m_cached_block_count;
+      const u64 blocks_needed = Common::AlignUp(offset_in_block + nbytes, BLOCK_SIZE) / BLOCK_SIZE;
+      const u64 max_block_count =
+          is_sequential ? MAX_BLOCKS_PER_READ : std::min(blocks_needed, MAX_BLOCKS_PER_READ);
+
+      if (!ReadAndDecryptBlocks(logical_block_index, max_block_count))
         return false;
-
-      m_current_logical_block_index = logical_block_index;
     }
 
+    const u64 index_in_buffer = logical_block_index - m_first_cached_block_index;
     const u64 bytes_to_copy = std::min(nbytes, BLOCK_SIZE - offset_in_block);
-    std::memcpy(out_ptr, m_current_block_decrypted.data() + offset_in_block, bytes_to_copy);
+    std::memcpy(out_ptr, m_blocks_decrypted.data() + index_in_buffer * BLOCK_SIZE + offset_in_block,
+                bytes_to_copy);
 
     offset += bytes_to_copy;
     nbytes -= bytes_to_copy;
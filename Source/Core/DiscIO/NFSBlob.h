@@ -62,6 +62,10 @@ private:
   using Key = std::array<u8, Common::AES::Context::KEY_SIZE>;
   static constexpr u32 BLOCK_SIZE = 0x8000;
   static constexpr u32 MAX_FILE_SIZE = 0xFA00000;
+  static constexpr u64 BLOCKS_PER_FILE = MAX_FILE_SIZE / BLOCK_SIZE;
+
+  // How many blocks can be read from the files and decrypted at once
+  static constexpr u64 MAX_BLOCKS_PER_READ = 16;
 
   static bool ReadKey(const std::string& path, const std::string& directory, Key* key_out);
   static std::vector<NFSLBARange> GetLBARanges(const NFSHeader& header);
@@ -74,13 +78,17 @@ private:
                 u64 raw_size);
 
   u64 ToPhysicalBlockIndex(u64 logical_block_index);
-  bool ReadEncryptedBlock(u64 physical_block_index);
-  void DecryptBlock(u64 logical_block_index);
-  bool ReadAndDecryptBlock(u64 logical_block_index);
-
-  std::array<u8, BLOCK_SIZE> m_current_block_encrypted;
-  std::array<u8, BLOCK_SIZE> m_current_block_decrypted;
-  u64 m_current_logical_block_index = std::numeric_limits<u64>::max();
+  u64 GetContiguousBlockCount(u64 logical_block_index, u64 physical_block_index,
+                              u64 max_block_count) const;
+  bool ReadEncryptedBlocks(u64 physical_block_index, u64 block_count);
+  void DecryptBlock(u64 logical_block_index, size_t index_in_buffer);
+  bool ReadAndDecryptBlocks(u64 logical_block_index, u64 max_block_count);
+
+  // The most recently read run of consecutive blocks
+  std::vector<u8> m_blocks_encrypted;
+  std::vector<u8> m_blocks_decrypted;
+  u64 m_first_cached_block_index = std::numeric_limits<u64>::max();
+  u64 m_cached_block_count = 0;
 
   std::vector<NFSLBARange> m_lba_ranges;
   std::vector<File::IOFile> m_files;
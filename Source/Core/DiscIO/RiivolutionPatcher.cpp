@@ -7,6 +7,7 @@
 #include <locale>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <fmt/format.h>
@@ -58,6 +59,29 @@ FileDataLoaderHostFS::FileDataLoaderHostFS(std::string sd_root, const std::strin
 
 std::optional<std::string>
 FileDataLoaderHostFS::MakeAbsoluteFromRelative(std::string_view external_relative_path)
+{
+  if (const auto it = m_resolved_paths.find(external_relative_path); it != m_resolved_paths.end())
+    return it->second;
+
+  auto result = ResolveAbsoluteFromRelative(external_relative_path);
+  m_resolved_paths.emplace(external_relative_path, result);
+  return result;
+}
+
+const std::vector<std::string>&
+FileDataLoaderHostFS::GetHostFolderNames(const std::string& absolute_path)
+{
+  if (const auto it = m_host_folder_names.find(absolute_path); it != m_host_folder_names.end())
+    return it->second;
+
+  std::vector<std::string> names;
+  for (auto& f : ::File::ScanDirectoryTree(absolute_path, false).children)
+    names.emplace_back(std::move(f.virtualName));
+  return m_host_folder_names.emplace(absolute_path, std::move(names)).first->second;
+}
+
+std::optional<std::string>
+FileDataLoaderHostFS::ResolveAbsoluteFromRelative(std::string_view external_relative_path)
 {
 #ifdef _WIN32
   // Riivolution treats a backslash as just a standard filename character, but we can't replicate
@@ -130,13 +154,12 @@ FileDataLoaderHostFS::MakeAbsoluteFromRelative(std::string_view external_relativ
         result.erase(result.size() - element.size(), element.size());
 
         // Re-attach an element that actually matches the capitalization in the host filesystem.
-        auto possible_files = ::File::ScanDirectoryTree(result, false);
         bool found = false;
-        for (auto& f : possible_files.children)
+        for (const std::string& name : GetHostFolderNames(result))
         {
-          if (Common::CaseInsensitiveEquals(element, f.virtualName))
+          if (Common::CaseInsensitiveEquals(element, name))
           {
-            result += f.virtualName;
+            result += name;
             found = true;
             break;
           }
@@ -360,8 +383,59 @@ static void ApplyPatchToFile(const Patch& patch, const File& file_patch,
                    file_patch.m_fileoffset, file_patch.m_length, file_patch.m_resize);
 }
 
+namespace
+{
+// Looks up the first file node with a given name (case-insensitively) in the order
+// FindFilenameNodeInFST would find it, without walking the whole FST for every patched file. Adding
+// nodes to the FST can move existing ones, so the index is rebuilt lazily after that.
+class FSTFilenameIndex
+{
+public:
+  explicit FSTFilenameIndex(std::vector<FSTBuilderNode>* fst) : m_fst(fst) {}
+
+  FSTBuilderNode* Find(std::string_view filename)
+  {
+    if (!m_valid)
+    {
+      m_nodes.clear();
+      AddNodes(*m_fst);
+      m_valid = true;
+    }
+
+    std::string key(filename);
+    Common::ToLower(&key);
+    const auto it = m_nodes.find(key);
+    return it != m_nodes.end() ? it->second : nullptr;
+  }
+
+  void Invalidate() { m_valid = false; }
+
+private:
+  void AddNodes(std::vector<FSTBuilderNode>& fst)
+  {
+    for (FSTBuilderNode& node : fst)
+    {
+      if (node.IsFolder())
+      {
+        AddNodes(node.GetFolderContent());
+      }
+      else
+      {
+        std::string key = node.m_filename;
+        Common::ToLower(&key);
+        m_nodes.emplace(std::move(key), &node);
+      }
+    }
+  }
+
+  std::vector<FSTBuilderNode>* m_fst;
+  std::unordered_map<std::string, FSTBuilderNode*> m_nodes;
+  bool m_valid = false;
+};
+}  // namespace
+
 static FSTBuilderNode* FindFileNodeInFST(std::string_view path, std::vector<FSTBuilderNode>* fst,
-                                         bool create_if_not_exists)
+                                         bool create_if_not_exists, FSTFilenameIndex* index)
 {
   const size_t path_separator = path.find('/');
   const bool is_file = path_separator == std::string_view::npos;
@@ -375,6 +449,7 @@ static FSTBuilderNode* FindFileNodeInFST(std::string_view path, std::vector<FSTB
     if (!create_if_not_exists)
       return nullptr;
 
+    index->Invalidate();
     if (is_file)
     {
       return &fst->emplace_back(
@@ -384,7 +459,8 @@ static FSTBuilderNode* FindFileNodeInFST(std::string_view path, std::vector<FSTB
     auto& new_folder = fst->emplace_back(
         DiscIO::FSTBuilderNode{std::string(name), 0, std::vector<FSTBuilderNode>()});
     return FindFileNodeInFST(path.substr(path_separator + 1),
-                             &std::get<std::vector<FSTBuilderNode>>(new_folder.m_content), true);
+                             &std::get<std::vector<FSTBuilderNode>>(new_folder.m_content), true,
+                             index);
   }
 
   const bool is_existing_node_file = it->IsFile();
@@ -395,38 +471,18 @@ static FSTBuilderNode* FindFileNodeInFST(std::string_view path, std::vector<FSTB
 
   return FindFileNodeInFST(path.substr(path_separator + 1),
                            &std::get<std::vector<FSTBuilderNode>>(it->m_content),
-                           create_if_not_exists);
-}
-
-static DiscIO::FSTBuilderNode* FindFilenameNodeInFST(std::string_view filename,
-                                                     std::vector<FSTBuilderNode>& fst)
-{
-  for (FSTBuilderNode& node : fst)
-  {
-    if (node.IsFolder())
-    {
-      DiscIO::FSTBuilderNode* result = FindFilenameNodeInFST(filename, node.GetFolderContent());
-      if (result)
-        return result;
-    }
-    else if (Common::CaseInsensitiveEquals(node.m_filename, filename))
-    {
-      return &node;
-    }
-  }
-
-  return nullptr;
+                           create_if_not_exists, index);
 }
 
 static void ApplyFilePatchToFST(const Patch& patch, const File& file,
                                 std::vector<DiscIO::FSTBuilderNode>* fst,
-                                DiscIO::FSTBuilderNode* dol_node)
+                                DiscIO::FSTBuilderNode* dol_node, FSTFilenameIndex* index)
 {
   if (!file.m_disc.empty() && file.m_disc[0] == '/')
   {
     // If the disc path starts with a / then we should patch that specific disc path.
     DiscIO::FSTBuilderNode* node =
-        FindFileNodeInFST(std::string_view(file.m_disc).substr(1), fst, file.m_create);
+        FindFileNodeInFST(std::string_view(file.m_disc).substr(1), fst, file.m_create, index);
     if (node)
       ApplyPatchToFile(patch, file, node);
   }
@@ -438,7 +494,7 @@ static void ApplyFilePatchToFST(const Patch& patch, const File& file,
   else
   {
     // Otherwise we want to patch the first file in the FST that matches that filename.
-    DiscIO::FSTBuilderNode* node = FindFilenameNodeInFST(file.m_disc, *fst);
+    DiscIO::FSTBuilderNode* node = index->Find(file.m_disc);
     if (node)
       ApplyPatchToFile(patch, file, node);
   }
@@ -446,8 +502,8 @@ static void ApplyFilePatchToFST(const Patch& patch, const File& file,
 
 static void ApplyFolderPatchToFST(const Patch& patch, const Folder& folder,
                                   std::vector<DiscIO::FSTBuilderNode>* fst,
-                                  DiscIO::FSTBuilderNode* dol_node, std::string_view disc_path,
-                                  std::string_view external_path)
+                                  DiscIO::FSTBuilderNode* dol_node, FSTFilenameIndex* index,
+                                  std::string_view disc_path, std::string_view external_path)
 {
   const auto external_files = patch.m_file_data_loader->GetFolderContents(external_path);
   for (const auto& child : external_files)
@@ -469,7 +525,8 @@ static void ApplyFolderPatchToFST(const Patch& patch, const Folder& folder,
     if (child.m_is_directory)
     {
       if (folder.m_recursive)
-        ApplyFolderPatchToFST(patch, folder, fst, dol_node, child_disc_path, child_external_path);
+        ApplyFolderPatchToFST(patch, folder, fst, dol_node, index, child_disc_path,
+                              child_external_path);
     }
     else
     {
@@ -479,21 +536,22 @@ static void ApplyFolderPatchToFST(const Patch& patch, const Folder& folder,
       file.m_resize = folder.m_resize;
       file.m_create = folder.m_create;
       file.m_length = folder.m_length;
-      ApplyFilePatchToFST(patch, file, fst, dol_node);
+      ApplyFilePatchToFST(patch, file, fst, dol_node, index);
     }
   }
 }
 
 static void ApplyFolderPatchToFST(const Patch& patch, const Folder& folder,
                                   std::vector<DiscIO::FSTBuilderNode>* fst,
-                                  DiscIO::FSTBuilderNode* dol_node)
+                                  DiscIO::FSTBuilderNode* dol_node, FSTFilenameIndex* index)
 {
-  ApplyFolderPatchToFST(patch, folder, fst, dol_node, folder.m_disc, folder.m_external);
+  ApplyFolderPatchToFST(patch, folder, fst, dol_node, index, folder.m_disc, folder.m_external);
 }
 
 void ApplyPatchesToFiles(std::span<const Patch> patches, PatchIndex index,
                          std::vector<FSTBuilderNode>* fst, FSTBuilderNode* dol_node)
 {
+  FSTFilenameIndex filename_index(fst);
   for (const auto& patch : patches)
   {
     const auto& file_patches =
@@ -502,10 +560,10 @@ void ApplyPatchesToFiles(std::span<const Patch> patches, PatchIndex index,
         index == PatchIndex::DolphinSysFiles ? patch.m_sys_folder_patches : patch.m_folder_patches;
 
     for (const auto& file : file_patches)
-      ApplyFilePatchToFST(patch, file, fst, dol_node);
+      ApplyFilePatchToFST(patch, file, fst, dol_node, &filename_index);
 
     for (const auto& folder : folder_patches)
-      ApplyFolderPatchToFST(patch, folder, fst, dol_node);
+      ApplyFolderPatchToFST(patch, folder, fst, dol_node, &filename_index);
   }
 }
 
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <map>
 #include <optional>
 #include <span>
 #include <string>
@@ -66,9 +67,16 @@ public:
 
 private:
   std::optional<std::string> MakeAbsoluteFromRelative(std::string_view external_relative_path);
+  std::optional<std::string> ResolveAbsoluteFromRelative(std::string_view external_relative_path);
+  const std::vector<std::string>& GetHostFolderNames(const std::string& absolute_path);
 
   std::string m_sd_root;
   std::string m_patch_root;
+
+  // Large mods reference thousands of files, often from the same few folders and usually more than
+  // once per file, so resolved paths and host folder listings are cached for the loader's lifetime.
+  std::map<std::string, std::optional<std::string>, std::less<>> m_resolved_paths;
+  std::map<std::string, std::vector<std::string>, std::less<>> m_host_folder_names;
 };
 
 enum class PatchIndex
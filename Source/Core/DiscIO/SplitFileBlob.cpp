@@ -14,6 +14,7 @@
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
+#include "Core/Config/MainSettings.h"
 
 namespace DiscIO
 {
@@ -23,6 +24,12 @@ SplitPlainFileReader::SplitPlainFileReader(std::vector<SingleFile> files)
   m_size = 0;
   for (const auto& f : m_files)
     m_size += f.size;
+
+  if (Config::Get(Config::MAIN_MEMORY_MAPPED_DISC_IMAGES))
+  {
+    for (auto& f : m_files)
+      f.mapping.Map(f.file);
+  }
 }
 
 std::unique_ptr<SplitPlainFileReader> SplitPlainFileReader::Create(std::string_view first_file_path)
@@ -82,7 +89,12 @@ bool SplitPlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
       auto& f = file.file;
       const u64 seek_offset = current_offset - file.offset;
       const u64 current_read = std::min(file.size - seek_offset, rest);
-      if (!f.Seek(seek_offset, File::SeekOrigin::Begin) || !f.ReadBytes(out, current_read))
+      if (file.mapping.IsMapped())
+      {
+        if (!file.mapping.Read(seek_offset, current_read, out))
+          return false;
+      }
+      else if (!f.ReadBytesAt(out, current_read, seek_offset))
       {
         f.ClearError();
         return false;
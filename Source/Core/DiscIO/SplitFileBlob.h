@@ -11,6 +11,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/MappedFile.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
@@ -40,6 +41,7 @@ private:
     File::IOFile file;
     u64 offset;
     u64 size;
+    Common::MappedFile mapping;
   };
 
   SplitPlainFileReader(std::vector<SingleFile> m_files);
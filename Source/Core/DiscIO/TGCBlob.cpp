@@ -112,8 +112,7 @@ bool TGCFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 {
   const u32 tgc_header_size = Common::swap32(m_header.tgc_header_size);
 
-  if (m_file.Seek(offset + tgc_header_size, File::SeekOrigin::Begin) &&
-      m_file.ReadBytes(out_ptr, nbytes))
+  if (m_file.ReadBytesAt(out_ptr, nbytes, offset + tgc_header_size))
   {
     const u32 replacement_dol_offset = SubtractBE32(m_header.dol_real_offset, tgc_header_size);
     const u32 replacement_fst_offset = SubtractBE32(m_header.fst_real_offset, tgc_header_size);
@@ -10,6 +10,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_set>
 
 #include <mbedtls/md5.h>
@@ -358,6 +359,15 @@ RedumpVerifier::Result RedumpVerifier::Finish(const Hashes<std::vector<u8>>& has
 }
 
 constexpr u64 DEFAULT_READ_SIZE = 0x20000;  // Arbitrary value
+constexpr size_t MAX_BLOCK_CHECK_THREADS = 8;
+
+static size_t GetBlockCheckThreadCount()
+{
+  // The CRC32, MD5 and SHA-1 calculations each already occupy a thread
+  const size_t hardware_threads = std::thread::hardware_concurrency();
+  return std::min<size_t>(hardware_threads > 4 ? hardware_threads - 3 : 1,
+                          MAX_BLOCK_CHECK_THREADS);
+}
 
 VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
                                Hashes<bool> hashes_to_calculate)
@@ -1243,14 +1253,48 @@ void VolumeVerifier::Process()
     m_group_future = std::async(std::launch::async, [this, read_failed,
                                                      group_index = m_group_index] {
       const GroupToVerify& group = m_groups[group_index];
+      const size_t block_count = group.block_index_end - group.block_index_start;
+
+      // The hashes of a block can be checked without looking at the other blocks of the group,
+      // so split the blocks between a few threads
+      std::vector<u8> blocks_valid(block_count, false);
+      const auto check_blocks = [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i)
+        {
+          blocks_valid[i] =
+              m_volume.CheckBlockIntegrity(group.block_index_start + i,
+                                           m_data.data() + i * VolumeWii::BLOCK_TOTAL_SIZE,
+                                           group.partition);
+        }
+      };
+
+      if (!read_failed && block_count != 0)
+      {
+        // Check the first block on this thread, so that the lazily loaded partition key and
+        // H3 table don't get initialized by several threads at once
+        check_blocks(0, 1);
+
+        const size_t remaining = block_count - 1;
+        const size_t task_count = std::min(remaining, GetBlockCheckThreadCount());
+        std::vector<std::future<void>> block_futures;
+        block_futures.reserve(task_count);
+        for (size_t task = 0; task < task_count; ++task)
+        {
+          const size_t start = 1 + remaining * task / task_count;
+          const size_t end = 1 + remaining * (task + 1) / task_count;
+          block_futures.push_back(std::async(std::launch::async, check_blocks, start, end));
+        }
+        for (std::future<void>& future : block_futures)
+          future.wait();
+      }
+
       u64 offset_in_group = 0;
       for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
            ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
       {
         const u64 block_offset = group.offset + offset_in_group;
 
-        if (!read_failed && m_volume.CheckBlockIntegrity(
-                                block_index, m_data.data() + offset_in_group, group.partition))
+        if (blocks_valid[block_index - group.block_index_start])
         {
           m_biggest_verified_offset =
               std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
@@ -79,7 +79,8 @@ std::pair<int, int> GetAllowedCompressionLevels(WIARVZCompressionType compressio
 
 template <bool RVZ>
 WIARVZFileReader<RVZ>::WIARVZFileReader(File::IOFile file, const std::string& path)
-    : m_file(std::move(file)), m_path(path), m_encryption_cache(this)
+    : m_file(std::move(file)), m_path(path), m_prefetch_state(std::make_shared<PrefetchState>()),
+      m_encryption_cache(this)
 {
   m_valid = Initialize(path);
 }
@@ -289,7 +290,10 @@ BlobType WIARVZFileReader<RVZ>::GetBlobType() const
 template <bool RVZ>
 std::unique_ptr<BlobReader> WIARVZFileReader<RVZ>::CopyReader() const
 {
-  return Create(m_file.Duplicate("rb"), m_path);
+  std::unique_ptr<WIARVZFileReader> reader = Create(m_file.Duplicate("rb"), m_path);
+  if (reader)
+    reader->m_prefetch_state = m_prefetch_state;
+  return reader;
 }
 
 template <bool RVZ>
@@ -514,35 +518,34 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
     chunk_size = std::min(chunk_size, data_size - group_offset_in_data);
 
     const u64 bytes_to_read = std::min(chunk_size - offset_in_group, *size);
-    u32 group_data_size = Common::swap32(group.data_size);
+    const ChunkParameters chunk_parameters =
+        GetChunkParameters(group, chunk_size, exception_lists, group_offset_in_data);
 
-    WIARVZCompressionType compression_type = m_compression_type;
-    u32 rvz_packed_size = 0;
-    if constexpr (RVZ)
+    if (total_group_index != m_last_read_group_index)
     {
-      if ((group_data_size & 0x80000000) == 0)
-        compression_type = WIARVZCompressionType::None;
-
-      group_data_size &= 0x7FFFFFFF;
-
-      rvz_packed_size = Common::swap32(group.rvz_packed_size);
+      // Decompress the following chunks in the background if the groups are read in order
+      if (total_group_index == m_last_read_group_index + 1)
+        PrefetchGroups(i + 1, chunk_size, data_size, group_index, number_of_groups,
+                       exception_lists);
+      m_last_read_group_index = total_group_index;
     }
 
-    if (group_data_size == 0)
+    if (chunk_parameters.compressed_size == 0)
     {
       std::memset(*out_ptr, 0, bytes_to_read);
     }
     else
     {
-      const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
-
-      Chunk& chunk =
-          ReadCompressedData(group_offset_in_file, group_data_size, chunk_size, compression_type,
-                             exception_lists, rvz_packed_size, group_offset_in_data);
+      Chunk& chunk = ReadCompressedData(
+          chunk_parameters.offset_in_file, chunk_parameters.compressed_size,
+          chunk_parameters.decompressed_size, chunk_parameters.compression_type,
+          chunk_parameters.exception_lists, chunk_parameters.rvz_packed_size,
+          chunk_parameters.data_offset);
 
       if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
       {
         m_cached_chunk_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
+        m_cached_chunk.reset();
         return false;
       }
 
@@ -572,42 +575,179 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
                                           WIARVZCompressionType compression_type,
                                           u32 exception_lists, u32 rvz_packed_size, u64 data_offset)
 {
-  if (offset_in_file == m_cached_chunk_offset)
-    return m_cached_chunk;
+  if (m_cached_chunk && offset_in_file == m_cached_chunk_offset)
+    return *m_cached_chunk;
+
+  if (std::shared_ptr<Chunk> chunk = GetPrefetchedChunk(offset_in_file))
+  {
+    m_cached_chunk = std::move(chunk);
+    m_cached_chunk_offset = offset_in_file;
+    return *m_cached_chunk;
+  }
+
+  const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
+
+  m_cached_chunk = std::make_shared<Chunk>(
+      &m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
+      compressed_exception_lists, rvz_packed_size, data_offset,
+      CreateDecompressor(m_header_2, compression_type, decompressed_size, rvz_packed_size));
+  m_cached_chunk_offset = offset_in_file;
+  return *m_cached_chunk;
+}
+
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::ChunkParameters
+WIARVZFileReader<RVZ>::GetChunkParameters(const GroupEntry& group, u64 chunk_size,
+                                          u32 exception_lists, u64 group_offset_in_data) const
+{
+  u32 group_data_size = Common::swap32(group.data_size);
+
+  WIARVZCompressionType compression_type = m_compression_type;
+  u32 rvz_packed_size = 0;
+  if constexpr (RVZ)
+  {
+    if ((group_data_size & 0x80000000) == 0)
+      compression_type = WIARVZCompressionType::None;
 
-  std::unique_ptr<Decompressor> decompressor;
+    group_data_size &= 0x7FFFFFFF;
+
+    rvz_packed_size = Common::swap32(group.rvz_packed_size);
+  }
+
+  const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
+
+  return ChunkParameters{group_offset_in_file, group_data_size, chunk_size, compression_type,
+                         exception_lists, rvz_packed_size, group_offset_in_data};
+}
+
+template <bool RVZ>
+std::unique_ptr<Decompressor>
+WIARVZFileReader<RVZ>::CreateDecompressor(const WIAHeader2& header_2,
+                                          WIARVZCompressionType compression_type,
+                                          u64 decompressed_size, u32 rvz_packed_size)
+{
   switch (compression_type)
   {
   case WIARVZCompressionType::None:
-    decompressor = std::make_unique<NoneDecompressor>();
-    break;
+    return std::make_unique<NoneDecompressor>();
   case WIARVZCompressionType::Purge:
-    decompressor = std::make_unique<PurgeDecompressor>(rvz_packed_size == 0 ? decompressed_size :
-                                                                              rvz_packed_size);
-    break;
+    return std::make_unique<PurgeDecompressor>(rvz_packed_size == 0 ? decompressed_size :
+                                                                      rvz_packed_size);
   case WIARVZCompressionType::Bzip2:
-    decompressor = std::make_unique<Bzip2Decompressor>();
-    break;
+    return std::make_unique<Bzip2Decompressor>();
   case WIARVZCompressionType::LZMA:
-    decompressor = std::make_unique<LZMADecompressor>(false, m_header_2.compressor_data,
-                                                      m_header_2.compressor_data_size);
-    break;
+    return std::make_unique<LZMADecompressor>(false, header_2.compressor_data,
+                                              header_2.compressor_data_size);
   case WIARVZCompressionType::LZMA2:
-    decompressor = std::make_unique<LZMADecompressor>(true, m_header_2.compressor_data,
-                                                      m_header_2.compressor_data_size);
-    break;
+    return std::make_unique<LZMADecompressor>(true, header_2.compressor_data,
+                                              header_2.compressor_data_size);
   case WIARVZCompressionType::Zstd:
-    decompressor = std::make_unique<ZstdDecompressor>();
-    break;
+    return std::make_unique<ZstdDecompressor>();
   }
 
-  const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
+  return nullptr;
+}
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+template <bool RVZ>
+std::shared_ptr<typename WIARVZFileReader<RVZ>::Chunk>
+WIARVZFileReader<RVZ>::GetPrefetchedChunk(u64 offset_in_file)
+{
+  PrefetchState& state = *m_prefetch_state;
+  std::unique_lock lk(state.mutex);
+
+  // Waiting for a chunk which is already being decompressed is faster than starting over
+  state.chunk_done.wait(lk, [&] {
+    return std::find(state.pending_chunks.begin(), state.pending_chunks.end(), offset_in_file) ==
+           state.pending_chunks.end();
+  });
+
+  const auto it = std::find_if(state.chunks.begin(), state.chunks.end(),
+                               [&](const auto& chunk) { return chunk.first == offset_in_file; });
+  if (it == state.chunks.end())
+    return nullptr;
+
+  // Move the chunk to the back, as it's now the most recently used one
+  std::rotate(it, it + 1, state.chunks.end());
+  return state.chunks.back().second;
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::PrefetchChunk(PrefetchState* state, const WIAHeader2& header_2,
+                                          const ChunkParameters& parameters)
+{
+  const bool compressed_exception_lists =
+      parameters.compression_type > WIARVZCompressionType::Purge;
+
+  auto chunk = std::make_shared<Chunk>(
+      &state->file, parameters.offset_in_file, parameters.compressed_size,
+      parameters.decompressed_size, parameters.exception_lists, compressed_exception_lists,
+      parameters.rvz_packed_size, parameters.data_offset,
+      CreateDecompressor(header_2, parameters.compression_type, parameters.decompressed_size,
+                         parameters.rvz_packed_size));
+  const bool success = chunk->DecompressAll();
+
+  {
+    std::lock_guard lk(state->mutex);
+    std::erase(state->pending_chunks, parameters.offset_in_file);
+    if (success)
+    {
+      if (state->chunks.size() >= MAX_PREFETCHED_CHUNKS)
+        state->chunks.erase(state->chunks.begin());
+      state->chunks.emplace_back(parameters.offset_in_file, std::move(chunk));
+    }
+  }
+  state->chunk_done.notify_all();
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::PrefetchGroups(u64 first_group, u64 chunk_size, u64 data_size,
+                                           u32 group_index, u32 number_of_groups,
+                                           u32 exception_lists)
+{
+  PrefetchState& state = *m_prefetch_state;
+  std::lock_guard lk(state.mutex);
+
+  if (!state.file.IsOpen())
+  {
+    // Use a separate file handle, so that the reader can keep reading while chunks are prefetched
+    state.file = m_file.Duplicate("rb");
+    if (!state.file.IsOpen())
+      return;
+
+    state.thread.Reset("WIA/RVZ Prefetch",
+                       [&state, header_2 = m_header_2](ChunkParameters parameters) {
+                         PrefetchChunk(&state, header_2, parameters);
+                       });
+  }
+
+  const u64 end_group = std::min<u64>(first_group + PREFETCH_CHUNKS, number_of_groups);
+  for (u64 i = first_group; i < end_group; ++i)
+  {
+    const u64 total_group_index = group_index + i;
+    if (total_group_index >= m_group_entries.size())
+      return;
+
+    const u64 group_offset_in_data = i * chunk_size;
+    if (group_offset_in_data >= data_size)
+      return;
+
+    const ChunkParameters parameters =
+        GetChunkParameters(m_group_entries[total_group_index],
+                           std::min(chunk_size, data_size - group_offset_in_data), exception_lists,
+                           group_offset_in_data);
+    if (parameters.compressed_size == 0)
+      continue;
+
+    const u64 offset = parameters.offset_in_file;
+    if (std::ranges::find(state.pending_chunks, offset) != state.pending_chunks.end() ||
+        std::ranges::any_of(state.chunks, [&](const auto& chunk) { return chunk.first == offset; }))
+    {
+      continue;
+    }
+
+    state.pending_chunks.push_back(offset);
+    state.thread.Push(parameters);
+  }
 }
 
 template <bool RVZ>
@@ -657,10 +797,29 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
     return false;
   }
 
-  while (offset + size > GetOutBytesWrittenExcludingExceptions())
+  if (!DecompressUntil(offset + size))
+    return false;
+
+  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
+  return true;
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressAll()
+{
+  if (!m_decompressor || !m_file)
+    return false;
+
+  return DecompressUntil(m_out.data.size() - m_out_bytes_allocated_for_exceptions);
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressUntil(u64 end)
+{
+  while (end > GetOutBytesWrittenExcludingExceptions())
   {
     u64 bytes_to_read;
-    if (offset + size == m_out.data.size())
+    if (end == m_out.data.size())
     {
       // Read all the remaining data.
       bytes_to_read = m_in.data.size() - m_in.bytes_written;
@@ -673,7 +832,7 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
 
       // The compressed data is probably not much bigger than the decompressed data.
       // Add a few bytes for possible compression overhead and for any hash exceptions.
-      bytes_to_read = offset + size - GetOutBytesWrittenExcludingExceptions() + 0x100;
+      bytes_to_read = end - GetOutBytesWrittenExcludingExceptions() + 0x100;
 
       // Align the access in an attempt to gain speed. But we don't actually know the
       // block size of the underlying storage device, so we just use the Wii block size.
@@ -753,7 +912,6 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
     }
   }
 
-  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
   return true;
 }
 
@@ -1735,7 +1893,8 @@ template <bool RVZ>
 ConversionResultCode
 WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                File::IOFile* outfile, WIARVZCompressionType compression_type,
-                               int compression_level, int chunk_size, CompressCB callback)
+                               int compression_level, int chunk_size, CompressCB callback,
+                               unsigned int threads)
 {
   ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
   ASSERT(chunk_size > 0);
@@ -1842,7 +2001,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   };
 
   MultithreadedCompressor<CompressThreadState, CompressParameters, OutputParameters> mt_compressor(
-      set_up_compress_thread_state, process_and_compress, output);
+      set_up_compress_thread_state, process_and_compress, output, threads);
 
   for (const DataEntry& data_entry : data_entries)
   {
@@ -2034,7 +2193,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, CompressCB callback)
+                       int chunk_size, CompressCB callback, unsigned int threads)
 {
   File::IOFile outfile(outfile_path, "wb");
   if (!outfile)
@@ -2052,7 +2211,7 @@ bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
   const auto convert = rvz ? RVZFileReader::Convert : WIAFileReader::Convert;
   const ConversionResultCode result =
       convert(infile, infile_volume.get(), &outfile, compression_type, compression_level,
-              chunk_size, callback);
+              chunk_size, callback, threads);
 
   if (result == ConversionResultCode::ReadFailed)
     PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
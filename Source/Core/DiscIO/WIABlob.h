@@ -4,17 +4,20 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
 #include "Common/IOFile.h"
 #include "Common/Swap.h"
+#include "Common/WorkQueueThread.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/MultithreadedCompressor.h"
 #include "DiscIO/WIACompression.h"
@@ -69,7 +72,8 @@ public:
 
   static ConversionResultCode Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                       File::IOFile* outfile, WIARVZCompressionType compression_type,
-                                      int compression_level, int chunk_size, CompressCB callback);
+                                      int compression_level, int chunk_size, CompressCB callback,
+                                      unsigned int threads = 0);
 
 private:
   using WiiKey = std::array<u8, 16>;
@@ -194,6 +198,9 @@ private:
 
     bool Read(u64 offset, u64 size, u8* out_ptr);
 
+    // Decompresses the whole chunk, so that it can be read without accessing the file
+    bool DecompressAll();
+
     // This can only be called once at least one byte of data has been read
     void GetHashExceptions(std::vector<HashExceptionEntry>* exception_list,
                            u64 exception_list_index, u16 additional_offset) const;
@@ -205,6 +212,7 @@ private:
     }
 
   private:
+    bool DecompressUntil(u64 end);
     bool Decompress();
     bool HandleExceptions(const u8* data, size_t bytes_allocated, size_t bytes_written,
                           size_t* bytes_used, bool align);
@@ -228,6 +236,34 @@ private:
     u64 m_data_offset = 0;
   };
 
+  struct ChunkParameters
+  {
+    u64 offset_in_file;
+    u64 compressed_size;
+    u64 decompressed_size;
+    WIARVZCompressionType compression_type;
+    u32 exception_lists;
+    u32 rvz_packed_size;
+    u64 data_offset;
+  };
+
+  // Chunks which a background thread decompresses ahead of sequential reads. This is shared
+  // between a reader and the readers created by CopyReader.
+  struct PrefetchState
+  {
+    ~PrefetchState() { thread.Shutdown(true); }
+
+    std::mutex mutex;
+    std::condition_variable chunk_done;
+
+    // Ordered from least to most recently used
+    std::vector<std::pair<u64, std::shared_ptr<Chunk>>> chunks;
+    std::vector<u64> pending_chunks;
+
+    File::IOFile file;
+    Common::WorkQueueThread<ChunkParameters> thread;
+  };
+
   explicit WIARVZFileReader(File::IOFile file, const std::string& path);
   bool Initialize(const std::string& path);
   bool HasDataOverlap() const;
@@ -241,6 +277,19 @@ private:
                             WIARVZCompressionType compression_type, u32 exception_lists = 0,
                             u32 rvz_packed_size = 0, u64 data_offset = 0);
 
+  ChunkParameters GetChunkParameters(const GroupEntry& group, u64 chunk_size, u32 exception_lists,
+                                     u64 group_offset_in_data) const;
+  static std::unique_ptr<Decompressor> CreateDecompressor(const WIAHeader2& header_2,
+                                                          WIARVZCompressionType compression_type,
+                                                          u64 decompressed_size,
+                                                          u32 rvz_packed_size);
+
+  std::shared_ptr<Chunk> GetPrefetchedChunk(u64 offset_in_file);
+  static void PrefetchChunk(PrefetchState* state, const WIAHeader2& header_2,
+                            const ChunkParameters& parameters);
+  void PrefetchGroups(u64 first_group, u64 chunk_size, u64 data_size, u32 group_index,
+                      u32 number_of_groups, u32 exception_lists);
+
   static bool ApplyHashExceptions(const std::vector<HashExceptionEntry>& exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
 
@@ -367,8 +416,10 @@ private:
 
   File::IOFile m_file;
   std::string m_path;
-  Chunk m_cached_chunk;
+  std::shared_ptr<PrefetchState> m_prefetch_state;
+  std::shared_ptr<Chunk> m_cached_chunk;
   u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
+  u64 m_last_read_group_index = std::numeric_limits<u64>::max();
   WiiEncryptionCache m_encryption_cache;
 
   std::vector<HashExceptionEntry> m_exception_list;
@@ -383,6 +434,11 @@ private:
 
   std::map<u64, DataEntry> m_data_entries;
 
+  // How many chunks are decompressed ahead of a sequential read, and how many decompressed chunks
+  // are kept for the reader and its copies
+  static constexpr size_t PREFETCH_CHUNKS = 4;
+  static constexpr size_t MAX_PREFETCHED_CHUNKS = 8;
+
   // Perhaps we could set WIA_VERSION_WRITE_COMPATIBLE to 0.9, but WIA version 0.9 was never in
   // any official release of wit, and interim versions (either source or binaries) are hard to find.
   // Since we've been unable to check if we're write compatible with 0.9, we set it 1.0 to be safe.
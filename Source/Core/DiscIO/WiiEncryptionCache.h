@@ -6,6 +6,7 @@
 #include <array>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "DiscIO/VolumeWii.h"
@@ -37,6 +38,8 @@ public:
   // If the returned pointer is nullptr, reading from the blob failed.
   // If the returned pointer is not nullptr, it is guaranteed to be valid until
   // the next call of this function or the destruction of this object.
+  // The most recently used groups are kept, so going back to a group which was read
+  // recently (for instance when reads alternate between two partitions) is cheap.
   const std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>*
   EncryptGroup(u64 offset, u64 partition_data_offset, u64 partition_data_decrypted_size,
                const Key& key, const HashExceptionCallback& hash_exception_callback = {});
@@ -48,9 +51,20 @@ public:
                      const HashExceptionCallback& hash_exception_callback = {});
 
 private:
+  static constexpr size_t MAX_CACHED_GROUPS = 4;
+
+  struct CachedGroup
+  {
+    std::unique_ptr<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>> data;
+    u64 offset = std::numeric_limits<u64>::max();
+    u64 last_use = 0;
+  };
+
+  CachedGroup& GetGroupToReplace();
+
   BlobReader* m_blob;
-  std::unique_ptr<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>> m_cache;
-  u64 m_cached_offset = 0;
+  std::vector<CachedGroup> m_cache;
+  u64 m_use_counter = 0;
 };
 
 }  // namespace DiscIO
@@ -4,26 +4,42 @@
 #include "DolphinNoGUI/Platform.h"
 
 #include <OptionParser.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
+#include <optional>
 #include <signal.h>
 #include <string>
+#include <tuple>
 #include <vector>
 
+#include <fmt/format.h>
+
 #ifndef _WIN32
+#include <sys/resource.h>
+#include <time.h>
 #include <unistd.h>
 #else
 #include <Windows.h>
 #endif
 
+#include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
+#include "Core/CoreTiming.h"
 #include "Core/DolphinAnalytics.h"
+#include "Core/HW/SystemTimers.h"
 #include "Core/Host.h"
+#include "Core/Movie.h"
 #include "Core/System.h"
 
 #include "UICommon/CommandLineParse.h"
@@ -34,7 +50,9 @@
 
 #include "InputCommon/GCAdapter.h"
 
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/VideoBackendBase.h"
+#include "VideoCommon/VideoEvents.h"
 
 static std::unique_ptr<Platform> s_platform;
 
@@ -180,6 +198,158 @@ static std::unique_ptr<Platform> GetPlatform(const optparse::Values& options)
   return nullptr;
 }
 
+#ifdef _WIN32
+static double FileTimeToSeconds(const FILETIME& time)
+{
+  // FILETIME is in units of 100 nanoseconds
+  return ((u64(time.dwHighDateTime) << 32) | time.dwLowDateTime) / 10000000.0;
+}
+#endif
+
+static double GetThreadCPUTime()
+{
+#ifdef _WIN32
+  FILETIME creation, exit, kernel, user;
+  if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+    return 0.0;
+  return FileTimeToSeconds(kernel) + FileTimeToSeconds(user);
+#else
+  timespec time;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0)
+    return 0.0;
+  return time.tv_sec + time.tv_nsec / 1e9;
+#endif
+}
+
+static double GetProcessCPUTime()
+{
+#ifdef _WIN32
+  FILETIME creation, exit, kernel, user;
+  if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+    return 0.0;
+  return FileTimeToSeconds(kernel) + FileTimeToSeconds(user);
+#else
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0.0;
+  return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6 + usage.ru_stime.tv_sec +
+         usage.ru_stime.tv_usec / 1e6;
+#endif
+}
+
+namespace
+{
+// Runs a fixed number of emulated fields and measures how long they took. The measurement starts at
+// the first field, so that booting isn't included.
+class Benchmark
+{
+public:
+  explicit Benchmark(u64 field_count) : m_field_count(field_count)
+  {
+    m_field_times_ms.reserve(field_count);
+  }
+
+  void Start()
+  {
+    m_end_field_hook = VIEndFieldEvent::Register([this] { OnEndField(); }, "Benchmark");
+  }
+
+  // Must only be called once the CPU thread has stopped
+  void PrintResults() const
+  {
+    const double host_seconds = std::chrono::duration<double>(m_end_time - m_start_time).count();
+    const double emulated_seconds = double(m_end_ticks - m_start_ticks) / m_ticks_per_second;
+
+    std::vector<double> field_times_ms = m_field_times_ms;
+    std::sort(field_times_ms.begin(), field_times_ms.end());
+    const auto percentile = [&field_times_ms](double p) {
+      if (field_times_ms.empty())
+        return 0.0;
+      const size_t rank = static_cast<size_t>(std::ceil(p * field_times_ms.size()));
+      return field_times_ms[std::max<size_t>(rank, 1) - 1];
+    };
+
+    const u64 gpu_frames = m_end_gpu_frames - m_start_gpu_frames;
+    const double gpu_ms_avg =
+        gpu_frames ? DT_ms(m_end_gpu_time - m_start_gpu_time).count() / gpu_frames : 0.0;
+
+    fmt::print("{{\"fields\": {}, \"completed\": {}, \"emulated_seconds\": {:.3f}, "
+               "\"host_seconds\": {:.3f}, \"speed\": {:.3f}, \"cpu_thread_cpu_seconds\": {:.3f}, "
+               "\"process_cpu_seconds\": {:.3f}, \"field_ms_p50\": {:.3f}, "
+               "\"field_ms_p90\": {:.3f}, \"field_ms_p99\": {:.3f}, \"field_ms_max\": {:.3f}, "
+               "\"gpu_frames\": {}, \"gpu_ms_avg\": {:.3f}}}\n",
+               m_fields_run, m_fields_run == m_field_count, emulated_seconds, host_seconds,
+               host_seconds > 0.0 ? emulated_seconds / host_seconds : 0.0,
+               m_end_thread_cpu_time - m_start_thread_cpu_time,
+               m_end_process_cpu_time - m_start_process_cpu_time, percentile(0.5),
+               percentile(0.9), percentile(0.99), percentile(1.0), gpu_frames, gpu_ms_avg);
+  }
+
+private:
+  // Called on the CPU thread
+  void OnEndField()
+  {
+    auto& system = Core::System::GetInstance();
+
+    if (!m_started)
+    {
+      m_started = true;
+      m_ticks_per_second = system.GetSystemTimers().GetTicksPerSecond();
+      m_start_ticks = system.GetCoreTiming().GetTicks();
+      m_start_thread_cpu_time = GetThreadCPUTime();
+      m_start_process_cpu_time = GetProcessCPUTime();
+      m_start_time = std::chrono::steady_clock::now();
+      std::tie(m_start_gpu_frames, m_start_gpu_time) = g_perf_metrics.GetGPUFrameTimeTotal();
+      m_end_time = m_start_time;
+    }
+    else if (m_fields_run < m_field_count)
+    {
+      ++m_fields_run;
+    }
+    else
+    {
+      return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (m_fields_run != 0)
+      m_field_times_ms.push_back(DT_ms(now - m_end_time).count());
+
+    m_end_ticks = system.GetCoreTiming().GetTicks();
+    m_end_thread_cpu_time = GetThreadCPUTime();
+    m_end_process_cpu_time = GetProcessCPUTime();
+    m_end_time = now;
+    std::tie(m_end_gpu_frames, m_end_gpu_time) = g_perf_metrics.GetGPUFrameTimeTotal();
+
+    if (m_fields_run == m_field_count)
+      s_platform->Stop();
+  }
+
+  Common::EventHook m_end_field_hook;
+
+  const u64 m_field_count;
+  u64 m_fields_run = 0;
+  bool m_started = false;
+
+  u32 m_ticks_per_second = 1;
+  u64 m_start_ticks = 0;
+  u64 m_end_ticks = 0;
+  double m_start_thread_cpu_time = 0.0;
+  double m_end_thread_cpu_time = 0.0;
+  double m_start_process_cpu_time = 0.0;
+  double m_end_process_cpu_time = 0.0;
+  std::chrono::steady_clock::time_point m_start_time;
+  std::chrono::steady_clock::time_point m_end_time;
+  u64 m_start_gpu_frames = 0;
+  u64 m_end_gpu_frames = 0;
+  DT m_start_gpu_time{};
+  DT m_end_gpu_time{};
+
+  // Host time between consecutive fields
+  std::vector<double> m_field_times_ms;
+};
+}  // namespace
+
 #ifdef _WIN32
 #define main app_main
 #endif
@@ -211,6 +381,22 @@ int main(int argc, char* argv[])
             "macos"
 #endif
       });
+  parser->add_option("--benchmark")
+      .type("int")
+      .action("store")
+      .metavar("<fields>")
+      .help("Run the given number of emulated fields without limiting the speed, then print the "
+            "timings as JSON and exit. Combine with the headless platform and the Null video "
+            "backend to leave out presentation, or boot a FIFO log (.dff) with a fixed video "
+            "backend and internal resolution to compare GPU performance.");
+  parser->add_option("--movie-verify-until")
+      .type("int")
+      .action("store")
+      .metavar("<frame>")
+      .help("Play back the movie given with --movie without limiting the speed until the given "
+            "frame, compare memory checksums against the movie's keyframes on the way, then exit "
+            "with a nonzero status if any of them differ. Boot from a keyframe with --save_state "
+            "to verify just one segment, so that segments can be checked by parallel instances.");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
@@ -285,6 +471,64 @@ int main(int argc, char* argv[])
     return 1;
   }
 
+  auto& movie = Core::System::GetInstance().GetMovie();
+  if (options.is_set("movie"))
+  {
+    std::optional<std::string> movie_savestate_path;
+    if (!movie.PlayInput(static_cast<const char*>(options.get("movie")), &movie_savestate_path))
+    {
+      fprintf(stderr, "Could not play the specified movie\n");
+      return 1;
+    }
+    if (!save_state_path)
+    {
+      boot->boot_session_data.SetSavestateData(std::move(movie_savestate_path),
+                                               DeleteSavestateAfterBoot::No);
+    }
+  }
+
+  Common::EventHook verify_hook;
+  if (options.is_set("movie_verify_until"))
+  {
+    if (!movie.IsPlayingInput())
+    {
+      fprintf(stderr, "Verifying a movie requires playing one with --movie.\n");
+      return 1;
+    }
+
+    const int last_frame = static_cast<int>(options.get("movie_verify_until"));
+    if (last_frame < 0)
+    {
+      fprintf(stderr, "The frame to verify until must not be negative.\n");
+      return 1;
+    }
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+    verify_hook = VIEndFieldEvent::Register(
+        [&movie, last_frame] {
+          if (!movie.IsPlayingInput() || movie.GetCurrentFrame() >= static_cast<u64>(last_frame))
+            s_platform->Stop();
+        },
+        "MovieVerify");
+  }
+
+  std::unique_ptr<Benchmark> benchmark;
+  if (options.is_set("benchmark"))
+  {
+    const int field_count = static_cast<int>(options.get("benchmark"));
+    if (field_count <= 0)
+    {
+      fprintf(stderr, "The number of benchmark fields must be positive.\n");
+      return 1;
+    }
+
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+    Config::SetCurrent(Config::GFX_VSYNC, false);
+    // Backends with timestamp queries then report GPU frame times.
+    Config::SetCurrent(Config::GFX_SHOW_GPU_TIMES, true);
+    benchmark = std::make_unique<Benchmark>(field_count);
+    benchmark->Start();
+  }
+
   Core::AddOnStateChangedCallback([](Core::State state) {
     if (state == Core::State::Uninitialized)
       s_platform->Stop();
@@ -319,8 +563,18 @@ int main(int argc, char* argv[])
   Core::Stop(Core::System::GetInstance());
 
   Core::Shutdown(Core::System::GetInstance());
+  if (benchmark)
+    benchmark->PrintResults();
   s_platform.reset();
 
+  if (verify_hook)
+  {
+    const u32 mismatches = movie.GetKeyframeMismatchCount();
+    fmt::print("{{\"frames\": {}, \"keyframe_mismatches\": {}}}\n", movie.GetCurrentFrame(),
+               mismatches);
+    return mismatches == 0 ? 0 : 1;
+  }
+
   return 0;
 }
 
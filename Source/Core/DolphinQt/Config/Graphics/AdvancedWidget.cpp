@@ -63,6 +63,10 @@ void AdvancedWidget::CreateWidgets()
   m_show_graphs = new ConfigBool(tr("Show Performance Graphs"), Config::GFX_SHOW_GRAPHS);
   m_show_speed = new ConfigBool(tr("Show % Speed"), Config::GFX_SHOW_SPEED);
   m_show_speed_colors = new ConfigBool(tr("Show Speed Colors"), Config::GFX_SHOW_SPEED_COLORS);
+  m_show_audio_latency = new ConfigBool(tr("Show Audio Latency"), Config::GFX_SHOW_AUDIO_LATENCY);
+  m_show_present_latency =
+      new ConfigBool(tr("Show Present Latency"), Config::GFX_SHOW_PRESENT_LATENCY);
+  m_show_gpu_times = new ConfigBool(tr("Show GPU Times"), Config::GFX_SHOW_GPU_TIMES);
   m_perf_samp_window = new ConfigInteger(0, 10000, Config::GFX_PERF_SAMP_WINDOW, 100);
   m_perf_samp_window->SetTitle(tr("Performance Sample Window (ms)"));
   m_log_render_time =
@@ -78,6 +82,9 @@ void AdvancedWidget::CreateWidgets()
   performance_layout->addWidget(m_perf_samp_window, 3, 1);
   performance_layout->addWidget(m_log_render_time, 4, 0);
   performance_layout->addWidget(m_show_speed_colors, 4, 1);
+  performance_layout->addWidget(m_show_audio_latency, 5, 0);
+  performance_layout->addWidget(m_show_present_latency, 5, 1);
+  performance_layout->addWidget(m_show_gpu_times, 5, 1);
 
   // Debugging
   auto* debugging_box = new QGroupBox(tr("Debugging"));
@@ -283,6 +290,19 @@ void AdvancedWidget::AddDescriptions()
       QT_TR_NOOP("Changes the color of the FPS counter depending on emulation speed."
                  "<br><br><dolphin_emphasis>If unsure, leave this "
                  "checked.</dolphin_emphasis>");
+  static const char TR_SHOW_AUDIO_LATENCY_DESCRIPTION[] =
+      QT_TR_NOOP("Shows the amount of audio the mixer is currently buffering, and how often the "
+                 "audio output ran out of samples.<br><br><dolphin_emphasis>If unsure, leave this "
+                 "unchecked.</dolphin_emphasis>");
+  static const char TR_SHOW_GPU_TIMES_DESCRIPTION[] =
+      QT_TR_NOOP("Shows how long the GPU spent on EFB draws, EFB copies, XFB copies, "
+                 "post-processing and presentation in each frame.<br><br>Only supported by the "
+                 "OpenGL backend.<br><br><dolphin_emphasis>If unsure, leave this "
+                 "unchecked.</dolphin_emphasis>");
+  static const char TR_SHOW_PRESENT_LATENCY_DESCRIPTION[] =
+      QT_TR_NOOP("Shows how long presenting the last frame took, from the start of drawing it "
+                 "to the screen until the window system accepted it.<br><br><dolphin_emphasis>If "
+                 "unsure, leave this unchecked.</dolphin_emphasis>");
   static const char TR_PERF_SAMP_WINDOW_DESCRIPTION[] =
       QT_TR_NOOP("The amount of time the FPS and VPS counters will sample over."
                  "<br><br>The higher the value, the more stable the FPS/VPS counter will be, "
@@ -433,6 +453,9 @@ void AdvancedWidget::AddDescriptions()
   m_show_speed->SetDescription(tr(TR_SHOW_SPEED_DESCRIPTION));
   m_log_render_time->SetDescription(tr(TR_LOG_RENDERTIME_DESCRIPTION));
   m_show_speed_colors->SetDescription(tr(TR_SHOW_SPEED_COLORS_DESCRIPTION));
+  m_show_audio_latency->SetDescription(tr(TR_SHOW_AUDIO_LATENCY_DESCRIPTION));
+  m_show_present_latency->SetDescription(tr(TR_SHOW_PRESENT_LATENCY_DESCRIPTION));
+  m_show_gpu_times->SetDescription(tr(TR_SHOW_GPU_TIMES_DESCRIPTION));
 
   m_enable_wireframe->SetDescription(tr(TR_WIREFRAME_DESCRIPTION));
   m_show_statistics->SetDescription(tr(TR_SHOW_STATS_DESCRIPTION));
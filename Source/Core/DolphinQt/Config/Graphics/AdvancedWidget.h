@@ -42,6 +42,9 @@ private:
   ConfigBool* m_show_graphs;
   ConfigBool* m_show_speed;
   ConfigBool* m_show_speed_colors;
+  ConfigBool* m_show_audio_latency;
+  ConfigBool* m_show_present_latency;
+  ConfigBool* m_show_gpu_times;
   ConfigInteger* m_perf_samp_window;
   ConfigBool* m_log_render_time;
 
@@ -74,6 +74,8 @@ void GeneralWidget::CreateWidgets()
   m_adapter_combo = new ToolTipComboBox;
   m_enable_vsync = new ConfigBool(tr("V-Sync"), Config::GFX_VSYNC);
   m_enable_fullscreen = new ConfigBool(tr("Start in Fullscreen"), Config::MAIN_FULLSCREEN);
+  m_low_latency_present =
+      new ConfigBool(tr("Low Latency Presentation"), Config::GFX_LOW_LATENCY_PRESENT);
 
   m_video_box->setLayout(m_video_layout);
 
@@ -98,6 +100,7 @@ void GeneralWidget::CreateWidgets()
 
   m_video_layout->addWidget(m_enable_vsync, 5, 0);
   m_video_layout->addWidget(m_enable_fullscreen, 5, 1, 1, -1);
+  m_video_layout->addWidget(m_low_latency_present, 6, 0);
 
   // Other
   auto* m_options_box = new QGroupBox(tr("Other"));
@@ -222,6 +225,8 @@ void GeneralWidget::OnEmulationStateChanged(bool running)
   m_backend_combo->setEnabled(!running);
   m_render_main_window->setEnabled(!running);
   m_enable_fullscreen->setEnabled(!running);
+  m_low_latency_present->setEnabled(!running &&
+                                    g_Config.backend_info.bSupportsLowLatencyPresent);
 
   const bool supports_adapters = !g_Config.backend_info.Adapters.empty();
   m_adapter_combo->setEnabled(!running && supports_adapters);
@@ -276,6 +281,11 @@ void GeneralWidget::AddDescriptions()
       "if emulation speed is below 100%.<br><br><dolphin_emphasis>If unsure, leave "
       "this "
       "unchecked.</dolphin_emphasis>");
+  static const char TR_LOW_LATENCY_PRESENT_DESCRIPTION[] = QT_TR_NOOP(
+      "Waits after presenting each frame until the display has picked it up, so that no more "
+      "than one frame is ever queued. Reduces display latency at the cost of some "
+      "throughput.<br><br>Only supported by the Direct3D backends.<br><br><dolphin_emphasis>If "
+      "unsure, leave this unchecked.</dolphin_emphasis>");
   static const char TR_SHOW_NETPLAY_PING_DESCRIPTION[] = QT_TR_NOOP(
       "Shows the player's maximum ping while playing on "
       "NetPlay.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
@@ -326,6 +336,8 @@ void GeneralWidget::AddDescriptions()
 
   m_enable_fullscreen->SetDescription(tr(TR_FULLSCREEN_DESCRIPTION));
 
+  m_low_latency_present->SetDescription(tr(TR_LOW_LATENCY_PRESENT_DESCRIPTION));
+
   m_show_ping->SetDescription(tr(TR_SHOW_NETPLAY_PING_DESCRIPTION));
 
   m_autoadjust_window_size->SetDescription(tr(TR_AUTOSIZE_DESCRIPTION));
@@ -362,6 +374,8 @@ void GeneralWidget::OnBackendChanged(const QString& backend_name)
 
   m_adapter_combo->setCurrentIndex(g_Config.iAdapter);
   m_adapter_combo->setEnabled(supports_adapters && !Core::IsRunning());
+  m_low_latency_present->setEnabled(g_Config.backend_info.bSupportsLowLatencyPresent &&
+                                    !Core::IsRunning());
 
   static constexpr char TR_ADAPTER_AVAILABLE_DESCRIPTION[] =
       QT_TR_NOOP("Selects a hardware adapter to use.<br><br>"
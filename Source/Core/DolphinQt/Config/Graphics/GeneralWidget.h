@@ -48,6 +48,7 @@ private:
   ConfigInteger* m_custom_aspect_height;
   ConfigBool* m_enable_vsync;
   ConfigBool* m_enable_fullscreen;
+  ConfigBool* m_low_latency_present;
 
   // Options
   ConfigBool* m_show_ping;
@@ -93,10 +93,13 @@ void HacksWidget::CreateWidgets()
   m_immediate_xfb = new ConfigBool(tr("Immediately Present XFB"), Config::GFX_HACK_IMMEDIATE_XFB);
   m_skip_duplicate_xfbs =
       new ConfigBool(tr("Skip Presenting Duplicate Frames"), Config::GFX_HACK_SKIP_DUPLICATE_XFBS);
+  m_frame_skip =
+      new ConfigBool(tr("Skip Presenting Frames When Behind"), Config::GFX_HACK_FRAME_SKIP);
 
   xfb_layout->addWidget(m_store_xfb_copies);
   xfb_layout->addWidget(m_immediate_xfb);
   xfb_layout->addWidget(m_skip_duplicate_xfbs);
+  xfb_layout->addWidget(m_frame_skip);
 
   // Other
   auto* other_box = new QGroupBox(tr("Other"));
@@ -265,6 +268,12 @@ void HacksWidget::AddDescriptions()
       "option as well as enabling V-Sync for optimal frame pacing.<br><br><dolphin_emphasis>If "
       "unsure, leave this "
       "checked.</dolphin_emphasis>");
+  static const char TR_FRAME_SKIP_DESCRIPTION[] = QT_TR_NOOP(
+      "Skips presenting up to two frames in a row while emulation runs slower than the "
+      "selected speed. Everything the game can observe is still emulated, so this only saves "
+      "the time spent on post-processing and displaying frames.<br><br>This may help low-end "
+      "devices keep game logic and audio at full speed, at the cost of a choppier "
+      "image.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
   static const char TR_GPU_DECODING_DESCRIPTION[] = QT_TR_NOOP(
       "Enables texture decoding using the GPU instead of the CPU.<br><br>This may result in "
       "performance gains in some scenarios, or on systems where the CPU is the "
@@ -304,6 +313,7 @@ void HacksWidget::AddDescriptions()
   m_store_xfb_copies->SetDescription(tr(TR_STORE_XFB_TO_TEXTURE_DESCRIPTION));
   m_immediate_xfb->SetDescription(tr(TR_IMMEDIATE_XFB_DESCRIPTION));
   m_skip_duplicate_xfbs->SetDescription(tr(TR_SKIP_DUPLICATE_XFBS_DESCRIPTION));
+  m_frame_skip->SetDescription(tr(TR_FRAME_SKIP_DESCRIPTION));
   m_gpu_texture_decoding->SetDescription(tr(TR_GPU_DECODING_DESCRIPTION));
   m_fast_depth_calculation->SetDescription(tr(TR_FAST_DEPTH_CALC_DESCRIPTION));
   m_disable_bounding_box->SetDescription(tr(TR_DISABLE_BOUNDINGBOX_DESCRIPTION));
@@ -37,6 +37,7 @@ private:
   ConfigBool* m_store_xfb_copies;
   ConfigBool* m_immediate_xfb;
   ConfigBool* m_skip_duplicate_xfbs;
+  ConfigBool* m_frame_skip;
 
   // Other
   ConfigBool* m_fast_depth_calculation;
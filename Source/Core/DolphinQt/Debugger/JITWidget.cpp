@@ -13,6 +13,7 @@
 
 #include "Common/GekkoDisassembler.h"
 #include "Core/Core.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/System.h"
 #include "UICommon/Disassembler.h"
@@ -174,13 +175,17 @@ void JITWidget::Update()
 
   if (analyzer.Analyze(ppc_addr, &code_block, &code_buffer, code_buffer.size()) != 0xFFFFFFFF)
   {
+    const auto& jit_interface = Core::System::GetInstance().GetJitInterface();
     std::string ppc_disasm_str;
     auto ppc_disasm = std::back_inserter(ppc_disasm_str);
     for (u32 i = 0; i < code_block.m_num_instructions; i++)
     {
       const PPCAnalyst::CodeOp& op = code_buffer[i];
       const std::string opcode = Common::GekkoDisassembler::Disassemble(op.inst.hex, op.address);
-      fmt::format_to(ppc_disasm, "{:08x} {}\n", op.address, opcode);
+      fmt::format_to(ppc_disasm, "{:08x} {}", op.address, opcode);
+      if (const u32 faults = jit_interface.GetFastmemFaultCount(op.address); faults != 0)
+        fmt::format_to(ppc_disasm, " ({} fastmem faults)", faults);
+      fmt::format_to(ppc_disasm, "\n");
     }
 
     // Add stats to the end of the ppc box since it's generally the shortest.
@@ -5,6 +5,7 @@
 
 #include <cinttypes>
 #include <future>
+#include <limits>
 
 #include <QAction>
 #include <QActionGroup>
@@ -22,6 +23,7 @@
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/StringUtil.h"
+#include "Common/TraceProfiler.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/Boot/Boot.h"
@@ -163,6 +165,8 @@ void MenuBar::OnEmulationStateChanged(Core::State state)
   m_jit_log_coverage->setEnabled(!running);
   m_jit_search_instruction->setEnabled(running);
   m_jit_write_cache_log_dump->setEnabled(running && jit_exists);
+  m_sampling_profiler_write->setEnabled(running);
+  m_code_coverage_write->setEnabled(running);
 
   // Symbols
   m_symbols->setEnabled(running);
@@ -203,6 +207,24 @@ void MenuBar::OnDebugModeToggled(bool enabled)
   }
 }
 
+void MenuBar::SeekMovieToFrame()
+{
+  auto& movie = Core::System::GetInstance().GetMovie();
+  bool ok = false;
+  const int frame = QInputDialog::getInt(this, tr("Seek to Frame"), tr("Frame:"),
+                                         static_cast<int>(movie.GetCurrentFrame()), 0,
+                                         std::numeric_limits<int>::max(), 1, &ok);
+  if (!ok)
+    return;
+
+  if (!movie.SeekToFrame(static_cast<u64>(frame)))
+  {
+    ModalMessageBox::warning(this, tr("Error"),
+                             tr("Seeking requires a movie being played back, and a keyframe at or "
+                                "before the frame when seeking backwards."));
+  }
+}
+
 void MenuBar::OnWriteJitBlockLogDump()
 {
   const std::string filename = fmt::format("{}{}.txt", File::GetUserPath(D_DUMPDEBUG_JITBLOCKS_IDX),
@@ -227,6 +249,61 @@ void MenuBar::OnWriteJitBlockLogDump()
   }
 }
 
+void MenuBar::OnWriteSamplingProfile()
+{
+  const std::string filename = fmt::format("{}{}_samples.txt", File::GetUserPath(D_DUMPDEBUG_IDX),
+                                           SConfig::GetInstance().GetGameID());
+  File::IOFile f(filename, "w");
+  if (!f)
+  {
+    ModalMessageBox::warning(
+        this, tr("Error"),
+        tr("Failed to open \"%1\" for writing.").arg(QString::fromStdString(filename)));
+    return;
+  }
+  auto& system = Core::System::GetInstance();
+  auto& power_pc = system.GetPowerPC();
+  power_pc.GetSamplingProfiler().Write(Core::CPUThreadGuard{system}, power_pc.GetSymbolDB(),
+                                       f.GetHandle());
+  ModalMessageBox::information(this, tr("Success"),
+                               tr("Wrote to \"%1\".").arg(QString::fromStdString(filename)));
+}
+
+void MenuBar::OnWriteCodeCoverage()
+{
+  const std::string filename = fmt::format("{}{}_coverage.txt", File::GetUserPath(D_DUMPDEBUG_IDX),
+                                           SConfig::GetInstance().GetGameID());
+  File::IOFile f(filename, "w");
+  if (!f)
+  {
+    ModalMessageBox::warning(
+        this, tr("Error"),
+        tr("Failed to open \"%1\" for writing.").arg(QString::fromStdString(filename)));
+    return;
+  }
+  auto& system = Core::System::GetInstance();
+  auto& power_pc = system.GetPowerPC();
+  power_pc.GetCodeCoverage().Write(Core::CPUThreadGuard{system}, power_pc.GetSymbolDB(),
+                                   f.GetHandle());
+  ModalMessageBox::information(this, tr("Success"),
+                               tr("Wrote to \"%1\".").arg(QString::fromStdString(filename)));
+}
+
+void MenuBar::OnWriteTrace()
+{
+  const std::string filename = fmt::format("{}{}_trace.json", File::GetUserPath(D_DUMPDEBUG_IDX),
+                                           SConfig::GetInstance().GetGameID());
+  if (!Common::TraceProfiler::WriteChromeTrace(filename))
+  {
+    ModalMessageBox::warning(
+        this, tr("Error"),
+        tr("Failed to open \"%1\" for writing.").arg(QString::fromStdString(filename)));
+    return;
+  }
+  ModalMessageBox::information(this, tr("Success"),
+                               tr("Wrote to \"%1\".").arg(QString::fromStdString(filename)));
+}
+
 void MenuBar::AddFileMenu()
 {
   QMenu* file_menu = addMenu(tr("&File"));
@@ -802,6 +879,7 @@ void MenuBar::AddMovieMenu()
   connect(m_recording_read_only, &QAction::toggled,
           [](bool value) { Core::System::GetInstance().GetMovie().SetReadOnly(value); });
 
+  movie_menu->addAction(tr("Seek to Frame..."), this, &MenuBar::SeekMovieToFrame);
   movie_menu->addAction(tr("TAS Input"), this, [this] { emit ShowTASInput(); });
 
   movie_menu->addSeparator();
@@ -930,6 +1008,32 @@ void MenuBar::AddJITMenu()
   m_jit_write_cache_log_dump =
       m_jit->addAction(tr("Write JIT Block Log Dump"), this, &MenuBar::OnWriteJitBlockLogDump);
 
+  m_sampling_profiler_enable = m_jit->addAction(tr("Enable Guest Sampling Profiler"));
+  m_sampling_profiler_enable->setCheckable(true);
+  m_sampling_profiler_enable->setChecked(Config::Get(Config::MAIN_DEBUG_ENABLE_SAMPLING_PROFILER));
+  connect(m_sampling_profiler_enable, &QAction::toggled, [](bool enabled) {
+    Config::SetBaseOrCurrent(Config::MAIN_DEBUG_ENABLE_SAMPLING_PROFILER, enabled);
+  });
+  m_sampling_profiler_write = m_jit->addAction(tr("Write Guest Sampling Profile"), this,
+                                               &MenuBar::OnWriteSamplingProfile);
+
+  m_code_coverage_enable = m_jit->addAction(tr("Enable Guest Code Coverage"));
+  m_code_coverage_enable->setCheckable(true);
+  m_code_coverage_enable->setChecked(Config::Get(Config::MAIN_DEBUG_ENABLE_CODE_COVERAGE));
+  connect(m_code_coverage_enable, &QAction::toggled, [](bool enabled) {
+    Config::SetBaseOrCurrent(Config::MAIN_DEBUG_ENABLE_CODE_COVERAGE, enabled);
+  });
+  m_code_coverage_write =
+      m_jit->addAction(tr("Write Guest Code Coverage"), this, &MenuBar::OnWriteCodeCoverage);
+
+  m_trace_profiler_enable = m_jit->addAction(tr("Enable Timeline Trace"));
+  m_trace_profiler_enable->setCheckable(true);
+  m_trace_profiler_enable->setChecked(Config::Get(Config::MAIN_DEBUG_ENABLE_TRACE_PROFILER));
+  connect(m_trace_profiler_enable, &QAction::toggled, [](bool enabled) {
+    Config::SetBaseOrCurrent(Config::MAIN_DEBUG_ENABLE_TRACE_PROFILER, enabled);
+  });
+  m_jit->addAction(tr("Write Timeline Trace"), this, &MenuBar::OnWriteTrace);
+
   m_jit->addSeparator();
 
   m_jit_off = m_jit->addAction(tr("JIT Off (JIT Core)"));
@@ -185,7 +185,11 @@ private:
   void OnRecordingStatusChanged(bool recording);
   void OnReadOnlyModeChanged(bool read_only);
   void OnDebugModeToggled(bool enabled);
+  void SeekMovieToFrame();
   void OnWriteJitBlockLogDump();
+  void OnWriteSamplingProfile();
+  void OnWriteCodeCoverage();
+  void OnWriteTrace();
 
   QString GetSignatureSelector() const;
 
@@ -271,6 +275,11 @@ private:
   QAction* m_jit_search_instruction;
   QAction* m_jit_profile_blocks;
   QAction* m_jit_write_cache_log_dump;
+  QAction* m_sampling_profiler_enable;
+  QAction* m_sampling_profiler_write;
+  QAction* m_code_coverage_enable;
+  QAction* m_code_coverage_write;
+  QAction* m_trace_profiler_enable;
   QAction* m_jit_off;
   QAction* m_jit_loadstore_off;
   QAction* m_jit_loadstore_lbzx_off;
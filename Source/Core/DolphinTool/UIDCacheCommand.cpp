@@ -0,0 +1,146 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/UIDCacheCommand.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/PipelineUIDCache.h"
+
+namespace DolphinTool
+{
+// The merged UIDs of each game, by game ID.
+using UIDCacheMap = std::map<std::string, std::vector<VideoCommon::SerializedGXPipelineUid>>;
+
+static std::vector<std::string> FindUIDCaches(const std::string& path)
+{
+  if (File::IsDirectory(path))
+    return Common::DoFileSearch({path}, {".uidcache"});
+
+  return {path};
+}
+
+static bool MergeUIDCache(UIDCacheMap* caches, const std::string& path, bool verbose)
+{
+  std::string game_id;
+  if (!SplitPath(path, nullptr, &game_id, nullptr) || game_id.empty())
+  {
+    fmt::print(std::cerr, "Error: Unable to get the game ID of {}\n", path);
+    return false;
+  }
+
+  std::vector<VideoCommon::SerializedGXPipelineUid> uids;
+  if (!VideoCommon::ReadPipelineUIDCache(path, &uids))
+  {
+    fmt::print(std::cerr, "Warning: Skipping {}, it is invalid or from another version\n", path);
+    return false;
+  }
+
+  const size_t added = VideoCommon::MergePipelineUIDs(&(*caches)[game_id], uids);
+  if (verbose)
+    fmt::print(std::cout, "{}: {} UIDs, {} new\n", path, uids.size(), added);
+
+  return true;
+}
+
+int UIDCacheCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: uidcache [options]... [FILE|DIRECTORY]...");
+
+  parser.description(
+      "Merges pipeline UID caches (.uidcache files) from the cache directories of other installs, "
+      "removing duplicate UIDs. Setting SharedUIDCachePath in GFX.ini to the output directory "
+      "makes Dolphin compile all of the merged pipelines when a game starts.");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Path to the directory to write the merged caches to. Caches which already exist "
+            "there are merged as well.")
+      .metavar("DIRECTORY");
+
+  parser.add_option("-v", "--verbose")
+      .action("store_true")
+      .help("Optional. Print the number of UIDs read from every file.");
+
+  const optparse::Values& options = parser.parse_args(args);
+  const std::vector<std::string> inputs = parser.args();
+
+  // Validate options
+  std::string output_path = options["output"];
+  if (output_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No output set\n");
+    return EXIT_FAILURE;
+  }
+  if (inputs.empty())
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+
+  if (output_path.back() != '/')
+    output_path += '/';
+  if (!File::IsDirectory(output_path) && !File::CreateFullPath(output_path))
+  {
+    fmt::print(std::cerr, "Error: Unable to create the output directory\n");
+    return EXIT_FAILURE;
+  }
+
+  const bool verbose = options.is_set_by_user("verbose");
+  UIDCacheMap caches;
+  size_t skipped_count = 0;
+
+  // Start with the existing caches, so the output can be updated with new installs over time.
+  for (const std::string& path : FindUIDCaches(output_path))
+  {
+    if (!MergeUIDCache(&caches, path, verbose))
+      skipped_count++;
+  }
+
+  for (const std::string& input : inputs)
+  {
+    if (!File::Exists(input))
+    {
+      fmt::print(std::cerr, "Error: {} does not exist\n", input);
+      return EXIT_FAILURE;
+    }
+
+    for (const std::string& path : FindUIDCaches(input))
+    {
+      if (!MergeUIDCache(&caches, path, verbose))
+        skipped_count++;
+    }
+  }
+
+  for (const auto& [game_id, uids] : caches)
+  {
+    const std::string filename = VideoCommon::GetPipelineUIDCacheFileName(output_path, game_id);
+    if (!VideoCommon::WritePipelineUIDCache(filename, uids))
+    {
+      fmt::print(std::cerr, "Error: Unable to write {}\n", filename);
+      return EXIT_FAILURE;
+    }
+
+    fmt::print(std::cout, "{}: {} UIDs\n", game_id, uids.size());
+  }
+
+  if (skipped_count != 0)
+    fmt::print(std::cerr, "Skipped {} files which could not be read\n", skipped_count);
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -45,6 +45,11 @@ public:
 
   bool IsSuppressed(Device::Input* input) const
   {
+    // This is checked for every bound input on every poll, and there usually aren't any
+    // suppressions, so avoid the lookups in that case.
+    if (m_suppressions.empty())
+      return false;
+
     // Input is suppressed if it exists in the map at all.
     return m_suppressions.lower_bound({input, nullptr}) !=
            m_suppressions.lower_bound({input + 1, nullptr});
@@ -252,7 +257,7 @@ public:
 
   ControlState GetValue() const override
   {
-    if (s_hotkey_suppressions.IsSuppressed(m_input))
+    if (!m_input || s_hotkey_suppressions.IsSuppressed(m_input))
       return 0;
     return GetValueIgnoringSuppression();
   }
@@ -448,6 +453,21 @@ private:
   const ControlState m_value{};
 };
 
+// Operations on literals are folded into a single literal, so that they aren't evaluated on every
+// poll. Assignments are kept, since they are usually meant to be evaluated for their side effect.
+static std::unique_ptr<Expression> MakeBinaryExpression(TokenType op,
+                                                        std::unique_ptr<Expression>&& lhs,
+                                                        std::unique_ptr<Expression>&& rhs)
+{
+  auto expr = std::make_unique<BinaryExpression>(op, std::move(lhs), std::move(rhs));
+  if (op != TOK_ASSIGN && dynamic_cast<const LiteralReal*>(expr->lhs.get()) &&
+      dynamic_cast<const LiteralReal*>(expr->rhs.get()))
+  {
+    return std::make_unique<LiteralReal>(expr->GetValue());
+  }
+  return expr;
+}
+
 static ParseResult MakeLiteralExpression(const Token& token)
 {
   ControlState val{};
@@ -892,7 +912,7 @@ private:
         return rhs;
       }
 
-      expr = std::make_unique<BinaryExpression>(tok.type, std::move(expr), std::move(rhs.expr));
+      expr = MakeBinaryExpression(tok.type, std::move(expr), std::move(rhs.expr));
     }
 
     return ParseResult::MakeSuccessfulResult(std::move(expr));
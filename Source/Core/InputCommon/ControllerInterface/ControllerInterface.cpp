@@ -343,15 +343,25 @@ void ControllerInterface::UpdateInput()
   std::vector<std::weak_ptr<ciface::Core::Device>> devices_to_remove;
 
   {
-    // TODO: if we are an emulation input channel, we should probably always lock.
     // Prefer outdated values over blocking UI or CPU thread (this avoids short but noticeable frame
-    // drops)
+    // drops). However, if the emulation is only racing another input update, wait for it to finish
+    // rather than dropping this poll: the wait is short, and a dropped poll means the game reads
+    // input which is up to a whole poll interval old (and relative inputs lose a delta).
     if (!m_devices_mutex.try_lock())
-      return;
+    {
+      const auto channel = GetCurrentInputChannel();
+      const bool is_emulation_channel = channel == ciface::InputChannel::SerialInterface ||
+                                        channel == ciface::InputChannel::Bluetooth;
+      if (!is_emulation_channel || !m_is_updating_input)
+        return;
+
+      m_devices_mutex.lock();
+    }
 
     std::lock_guard lk_devices(m_devices_mutex, std::adopt_lock);
 
     tls_is_updating_devices = true;
+    m_is_updating_input = true;
 
     for (auto& backend : m_input_backends)
       backend->UpdateInput(devices_to_remove);
@@ -364,6 +374,7 @@ void ControllerInterface::UpdateInput()
         devices_to_remove.push_back(d);
     }
 
+    m_is_updating_input = false;
     tls_is_updating_devices = false;
   }
 
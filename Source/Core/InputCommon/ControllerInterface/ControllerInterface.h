@@ -138,6 +138,8 @@ private:
   WindowSystemInfo m_wsi;
   std::atomic<float> m_aspect_ratio_adjustment = 1;
   std::atomic<bool> m_requested_mouse_centering = false;
+  // Whether m_devices_mutex is held by UpdateInput, which only holds it for a short time
+  std::atomic<bool> m_is_updating_input = false;
 
   std::vector<std::unique_ptr<ciface::InputBackend>> m_input_backends;
 };
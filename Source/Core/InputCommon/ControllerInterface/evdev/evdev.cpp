@@ -476,6 +476,7 @@ InputBackend::~InputBackend()
 bool evdevDevice::AddNode(std::string devnode, int fd, libevdev* dev)
 {
   m_nodes.emplace_back(Node{std::move(devnode), fd, dev});
+  m_poll_fds.push_back(pollfd{fd, POLLIN, 0});
 
   // Take on the alphabetically first name.
   const auto potential_new_name = StripWhitespace(libevdev_get_name(dev));
@@ -688,8 +689,18 @@ Core::DeviceRemoval evdevDevice::UpdateInput()
   // Run through all evdev events
   // libevdev will keep track of the actual controller state internally which can be queried
   // later with libevdev_fetch_event_value()
-  for (auto& node : m_nodes)
+  // Each read is a syscall, so first check which nodes actually have events with a single poll()
+  // and skip the idle ones. Draining a node below also empties libevdev's internal queue.
+  if (poll(m_poll_fds.data(), m_poll_fds.size(), 0) <= 0)
+    return Core::DeviceRemoval::Keep;
+
+  for (std::size_t i = 0; i != m_nodes.size(); ++i)
   {
+    // Errors and hang-ups are still passed on to libevdev, like before.
+    if (m_poll_fds[i].revents == 0)
+      continue;
+
+    auto& node = m_nodes[i];
     int rc = LIBEVDEV_READ_STATUS_SUCCESS;
     while (rc >= 0)
     {
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <libevdev/libevdev.h>
+#include <poll.h>
 #include <string>
 #include <vector>
 
@@ -99,6 +100,9 @@ private:
 
   std::vector<Node> m_nodes;
 
+  // One entry per node, in the same order, so all of them can be checked with a single poll().
+  std::vector<pollfd> m_poll_fds;
+
   InputBackend& m_input_backend;
 };
 }  // namespace ciface::evdev
@@ -13,6 +13,8 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <mutex>
 #include <optional>
 
@@ -164,6 +166,142 @@ static std::optional<Config::ConfigChangedCallbackID> s_config_callback_id = std
 static bool s_is_adapter_wanted = false;
 static std::array<bool, SerialInterface::MAX_SI_CHANNELS> s_config_rumble_enabled{};
 
+#if GCADAPTER_USE_LIBUSB_IMPLEMENTATION
+// Several read transfers are kept in flight, so that one is always queued when the adapter sends
+// its next report. With a single blocking transfer, a report which arrived while the previous one
+// was being processed had to wait for the following poll of the endpoint.
+constexpr size_t NUM_READ_TRANSFERS = 3;
+
+struct ReadTransfer
+{
+  libusb_transfer* transfer = nullptr;
+  std::array<u8, CONTROLLER_INPUT_PAYLOAD_EXPECTED_SIZE> buffer{};
+  std::atomic<bool> in_flight = false;
+};
+
+static Common::Event s_read_transfer_done;
+static Common::Flag s_read_io_error;
+
+// Only accessed from the transfer callback, and by the read thread once no transfers are left
+static std::chrono::steady_clock::time_point s_last_report_time;
+static u64 s_report_count = 0;
+static std::chrono::steady_clock::duration s_max_report_interval{};
+
+static void LIBUSB_CALL ReadTransferCallback(libusb_transfer* transfer)
+{
+  auto* const read_transfer = static_cast<ReadTransfer*>(transfer->user_data);
+
+  switch (transfer->status)
+  {
+  case LIBUSB_TRANSFER_COMPLETED:
+  {
+    const auto now = std::chrono::steady_clock::now();
+    if (s_report_count++ != 0)
+      s_max_report_interval = std::max(s_max_report_interval, now - s_last_report_time);
+    s_last_report_time = now;
+
+    ProcessInputPayload(transfer->buffer, transfer->actual_length);
+    break;
+  }
+  case LIBUSB_TRANSFER_TIMED_OUT:
+  case LIBUSB_TRANSFER_CANCELLED:
+    break;
+  default:
+    ERROR_LOG_FMT(CONTROLLERINTERFACE, "Read: transfer failed with status {}",
+                  static_cast<int>(transfer->status));
+    if (transfer->status == LIBUSB_TRANSFER_ERROR)
+      s_read_io_error.Set();
+    break;
+  }
+
+  const bool resubmit = transfer->status != LIBUSB_TRANSFER_CANCELLED &&
+                        transfer->status != LIBUSB_TRANSFER_NO_DEVICE &&
+                        s_read_adapter_thread_running.IsSet() && !s_read_io_error.IsSet();
+  if (resubmit && libusb_submit_transfer(transfer) == LIBUSB_SUCCESS)
+    return;
+
+  read_transfer->in_flight = false;
+  s_read_transfer_done.Set();
+}
+
+static void ReadWithTransfers()
+{
+  std::array<ReadTransfer, NUM_READ_TRANSFERS> transfers;
+  for (ReadTransfer& read_transfer : transfers)
+  {
+    read_transfer.transfer = libusb_alloc_transfer(0);
+    if (!read_transfer.transfer)
+      continue;
+
+    libusb_fill_interrupt_transfer(read_transfer.transfer, s_handle, s_endpoint_in,
+                                   read_transfer.buffer.data(), int(read_transfer.buffer.size()),
+                                   ReadTransferCallback, &read_transfer, USB_TIMEOUT_MS);
+  }
+
+  s_report_count = 0;
+  s_max_report_interval = {};
+  const auto start_time = std::chrono::steady_clock::now();
+
+  while (s_read_adapter_thread_running.IsSet())
+  {
+    if (s_read_io_error.TestAndClear())
+    {
+      // s_read_adapter_thread_running is cleared by the joiner, not the stopper.
+
+      // Reset the device, which may trigger a replug.
+      const int error = libusb_reset_device(s_handle);
+      ERROR_LOG_FMT(CONTROLLERINTERFACE, "Read: libusb_reset_device: {}",
+                    LibusbUtils::ErrorWrap(error));
+
+      // If error is nonzero, try fixing it next loop iteration. We can't easily return
+      // and cleanup program state without getting another thread to call Reset().
+    }
+
+    for (ReadTransfer& read_transfer : transfers)
+    {
+      if (!read_transfer.transfer || read_transfer.in_flight)
+        continue;
+
+      read_transfer.in_flight = true;
+      const int error = libusb_submit_transfer(read_transfer.transfer);
+      if (error != LIBUSB_SUCCESS)
+      {
+        read_transfer.in_flight = false;
+        ERROR_LOG_FMT(CONTROLLERINTERFACE, "Read: libusb_submit_transfer failed: {}",
+                      LibusbUtils::ErrorWrap(error));
+        if (error == LIBUSB_ERROR_IO)
+          s_read_io_error.Set();
+      }
+    }
+
+    s_read_transfer_done.WaitFor(std::chrono::milliseconds(USB_TIMEOUT_MS));
+  }
+
+  for (ReadTransfer& read_transfer : transfers)
+  {
+    if (read_transfer.in_flight)
+      libusb_cancel_transfer(read_transfer.transfer);
+  }
+  for (ReadTransfer& read_transfer : transfers)
+  {
+    while (read_transfer.in_flight)
+      s_read_transfer_done.WaitFor(std::chrono::milliseconds(USB_TIMEOUT_MS));
+    libusb_free_transfer(read_transfer.transfer);
+  }
+  s_read_io_error.Clear();
+
+  if (s_report_count != 0)
+  {
+    const auto elapsed = std::chrono::steady_clock::now() - start_time;
+    NOTICE_LOG_FMT(CONTROLLERINTERFACE,
+                   "GCAdapter received {} reports, average interval {:.3f} ms, maximum {:.3f} ms",
+                   s_report_count,
+                   std::chrono::duration<double, std::milli>(elapsed).count() / s_report_count,
+                   std::chrono::duration<double, std::milli>(s_max_report_interval).count());
+  }
+}
+#endif
+
 static void ReadThreadFunc()
 {
   Common::SetCurrentThreadName("GCAdapter Read Thread");
@@ -200,35 +338,11 @@ static void ReadThreadFunc()
   // Reset rumble once on initial reading
   ResetRumble();
 
-  while (s_read_adapter_thread_running.IsSet())
-  {
 #if GCADAPTER_USE_LIBUSB_IMPLEMENTATION
-    std::array<u8, CONTROLLER_INPUT_PAYLOAD_EXPECTED_SIZE> input_buffer;
-
-    int payload_size = 0;
-    int error = libusb_interrupt_transfer(s_handle, s_endpoint_in, input_buffer.data(),
-                                          int(input_buffer.size()), &payload_size, USB_TIMEOUT_MS);
-    if (error != LIBUSB_SUCCESS)
-    {
-      ERROR_LOG_FMT(CONTROLLERINTERFACE, "Read: libusb_interrupt_transfer failed: {}",
-                    LibusbUtils::ErrorWrap(error));
-    }
-    if (error == LIBUSB_ERROR_IO)
-    {
-      // s_read_adapter_thread_running is cleared by the joiner, not the stopper.
-
-      // Reset the device, which may trigger a replug.
-      error = libusb_reset_device(s_handle);
-      ERROR_LOG_FMT(CONTROLLERINTERFACE, "Read: libusb_reset_device: {}",
-                    LibusbUtils::ErrorWrap(error));
-
-      // If error is nonzero, try fixing it next loop iteration. We can't easily return
-      // and cleanup program state without getting another thread to call Reset().
-    }
-
-    ProcessInputPayload(input_buffer.data(), payload_size);
-
+  ReadWithTransfers();
 #elif GCADAPTER_USE_ANDROID_IMPLEMENTATION
+  while (s_read_adapter_thread_running.IsSet())
+  {
     const int payload_size = env->CallStaticIntMethod(s_adapter_class, input_func);
     jbyte* const java_data = env->GetByteArrayElements(*java_controller_payload, nullptr);
 
@@ -241,10 +355,10 @@ static void ReadThreadFunc()
       first_read = false;
       s_fd = env->CallStaticIntMethod(s_adapter_class, getfd_func);
     }
-#endif
 
     Common::YieldCPU();
   }
+#endif
 
   // Terminate the write thread on leaving
   if (s_write_adapter_thread_running.TestAndClear())
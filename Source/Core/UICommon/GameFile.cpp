@@ -322,6 +322,7 @@ void GameFile::DoState(PointerWrap& p)
   p.Do(m_revision);
   p.Do(m_disc_number);
   p.Do(m_apploader_date);
+  p.Do(m_sync_hash);
 
   p.Do(m_custom_name);
   p.Do(m_custom_description);
@@ -609,6 +610,20 @@ static std::optional<Common::SHA1::Digest> MixHash(const std::optional<Common::S
 }
 
 Common::SHA1::Digest GameFile::GetSyncHash() const
+{
+  if (m_sync_hash)
+    return *m_sync_hash;
+
+  return ComputeSyncHash();
+}
+
+void GameFile::CacheSyncHash()
+{
+  if (m_valid && m_blob_type != DiscIO::BlobType::MOD_DESCRIPTOR)
+    m_sync_hash = ComputeSyncHash();
+}
+
+Common::SHA1::Digest GameFile::ComputeSyncHash() const
 {
   std::optional<Common::SHA1::Digest> hash;
 
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <map>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -83,9 +84,9 @@ public:
   u8 GetDiscNumber() const { return m_disc_number; }
   std::string GetNetPlayName(const Core::TitleDatabase& title_database) const;
 
-  // This function is slow
+  // This function is slow unless CacheSyncHash has been called
   std::array<u8, 20> GetSyncHash() const;
-  // This function is slow
+  // This function is slow unless CacheSyncHash has been called
   NetPlay::SyncIdentifier GetSyncIdentifier() const;
   // This function is slow if all of game_id, revision, disc_number, is_datel are identical
   NetPlay::SyncIdentifierComparison
@@ -122,6 +123,9 @@ public:
   void DefaultCoverCommit();
   bool CustomCoverChanged();
   void CustomCoverCommit();
+  // Computes the sync hash once so that it can be stored in the game list cache. Skipped for mod
+  // descriptors, since the files they refer to can change.
+  void CacheSyncHash();
 
 private:
   DiscIO::Language GetConfigLanguage() const;
@@ -134,6 +138,7 @@ private:
   bool ReadXMLMetadata(const std::string& path);
   bool ReadPNGBanner(const std::string& path);
   bool TryLoadGameModDescriptorBanner();
+  std::array<u8, 20> ComputeSyncHash() const;
 
   // IMPORTANT: Nearly all data members must be save/restored in DoState.
   // If anything is changed, make sure DoState handles it properly and
@@ -169,6 +174,7 @@ private:
   u16 m_revision{};
   u8 m_disc_number{};
   std::string m_apploader_date;
+  std::optional<std::array<u8, 20>> m_sync_hash;
 
   std::string m_custom_name;
   std::string m_custom_description;
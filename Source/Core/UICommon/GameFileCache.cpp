@@ -4,12 +4,15 @@
 #include "UICommon/GameFileCache.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -19,6 +22,7 @@
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/Thread.h"
 
 #include "DiscIO/DirectoryBlob.h"
 
@@ -26,7 +30,14 @@
 
 namespace UICommon
 {
-static constexpr u32 CACHE_REVISION = 24;  // Last changed in PR 11557
+static constexpr u32 CACHE_REVISION = 25;  // Last changed when caching sync hashes
+static constexpr size_t MAX_SCAN_THREADS = 8;
+
+static size_t GetScanThreadCount()
+{
+  // Scanning waits on storage more than on the CPU, so use a few threads even on small CPUs
+  return std::clamp<size_t>(std::thread::hardware_concurrency(), 2, MAX_SCAN_THREADS);
+}
 
 std::vector<std::string> FindAllGamePaths(const std::vector<std::string>& directories_to_scan,
                                           bool recursive_scan)
@@ -131,22 +142,76 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
 
   // Now that the previous loop has run, game_paths only contains paths that
   // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const std::string& path : game_paths)
+  // Creating a GameFile means opening the file and reading its headers and banner, which mostly
+  // consists of waiting for storage, so the new files are scanned by several threads at once.
+  // The NetPlay sync hash is computed at the same time so that it never has to be computed again.
+  // The callbacks are still called on this thread.
+  const std::vector<std::string> new_paths(game_paths.begin(), game_paths.end());
+  const size_t thread_count = std::min(new_paths.size(), GetScanThreadCount());
+
+  std::mutex scanned_mutex;
+  std::condition_variable scanned_cv;
+  std::vector<std::shared_ptr<GameFile>> scanned_files;
+  size_t finished_threads = 0;
+  std::atomic<size_t> next_path_index = 0;
+
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count);
+  for (size_t i = 0; i < thread_count; ++i)
   {
-    if (processing_halted)
-      break;
+    threads.emplace_back([&] {
+      Common::SetCurrentThreadName("Game list scanner");
+      Common::SetCurrentThreadQoS(Common::ThreadQoS::Background);
+
+      while (!processing_halted)
+      {
+        const size_t index = next_path_index++;
+        if (index >= new_paths.size())
+          break;
+
+        auto file = std::make_shared<GameFile>(new_paths[index]);
+        file->CacheSyncHash();
+        std::lock_guard lk(scanned_mutex);
+        scanned_files.push_back(std::move(file));
+        scanned_cv.notify_one();
+      }
+
+      std::lock_guard lk(scanned_mutex);
+      ++finished_threads;
+      scanned_cv.notify_one();
+    });
+  }
 
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
+  std::vector<std::shared_ptr<GameFile>> files_to_add;
+  bool all_threads_finished = thread_count == 0;
+  while (!all_threads_finished)
+  {
     {
-      if (game_added_to_cache)
-        game_added_to_cache(file);
+      std::unique_lock lk(scanned_mutex);
+      scanned_cv.wait(lk, [&] {
+        all_threads_finished = finished_threads == thread_count;
+        return all_threads_finished || !scanned_files.empty();
+      });
+      std::swap(files_to_add, scanned_files);
+    }
 
-      cache_changed = true;
-      m_cached_files.push_back(std::move(file));
+    for (std::shared_ptr<GameFile>& file : files_to_add)
+    {
+      if (file->IsValid())
+      {
+        if (game_added_to_cache)
+          game_added_to_cache(file);
+
+        cache_changed = true;
+        m_cached_files.push_back(std::move(file));
+      }
     }
+    files_to_add.clear();
   }
 
+  for (std::thread& thread : threads)
+    thread.join();
+
   return cache_changed;
 }
 
@@ -5,9 +5,11 @@
 
 #include <algorithm>
 #include <memory>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
 
 #include <mz_compat.h>
-#include <mz_os.h>
 
 #include "Common/CommonPaths.h"
 #include "Common/FileSearch.h"
@@ -24,6 +26,20 @@ namespace ResourcePack
 {
 constexpr char TEXTURE_PATH[] = HIRES_TEXTURES_DIR DIR_SEP;
 
+// Packs can contain tens of thousands of textures, so avoid searching their lists linearly.
+static std::unordered_set<std::string_view>
+GetProvidedTextures(const std::vector<ResourcePack*>& packs, bool installed_only)
+{
+  std::unordered_set<std::string_view> textures;
+  for (const ResourcePack* pack : packs)
+  {
+    if (installed_only && !IsInstalled(*pack))
+      continue;
+    textures.insert(pack->GetTextures().begin(), pack->GetTextures().end());
+  }
+  return textures;
+}
+
 ResourcePack::ResourcePack(const std::string& path) : m_path(path)
 {
   auto file = unzOpen(path.c_str());
@@ -87,6 +103,7 @@ ResourcePack::ResourcePack(const std::string& path) : m_path(path)
     unz_file_info64 texture_info{};
     unzGetCurrentFileInfo64(file, &texture_info, filename.data(), static_cast<u16>(filename.size()),
                             nullptr, 0, nullptr, 0);
+    TruncateToCString(&filename);
 
     if (filename.compare(0, 9, "textures/") != 0 || texture_info.uncompressed_size == 0)
       continue;
@@ -153,43 +170,28 @@ bool ResourcePack::Install(const std::string& path)
   if (unzGoToFirstFile(file) != MZ_OK)
     return false;
 
-  std::string texture_zip_path;
+  const std::unordered_set<std::string_view> own_textures(m_textures.begin(), m_textures.end());
+  // Check if a higher priority pack already provides a given texture, don't overwrite it
+  const auto higher_priority_textures = GetProvidedTextures(GetHigherPriorityPacks(*this), false);
+
+  std::vector<char> texture_zip_path(UINT16_MAX + 1);
+  std::vector<u8> data;
   do
   {
-    texture_zip_path.resize(UINT16_MAX + 1, '\0');
     unz_file_info64 texture_info{};
     if (unzGetCurrentFileInfo64(file, &texture_info, texture_zip_path.data(), UINT16_MAX, nullptr,
                                 0, nullptr, 0) != MZ_OK)
     {
       return false;
     }
-    TruncateToCString(&texture_zip_path);
 
-    const std::string texture_zip_path_prefix = "textures/";
-    if (!texture_zip_path.starts_with(texture_zip_path_prefix))
+    constexpr std::string_view texture_zip_path_prefix = "textures/";
+    const std::string_view texture_zip_path_view(texture_zip_path.data());
+    if (!texture_zip_path_view.starts_with(texture_zip_path_prefix))
       continue;
-    const std::string texture_name = texture_zip_path.substr(texture_zip_path_prefix.size());
+    const std::string texture(texture_zip_path_view.substr(texture_zip_path_prefix.size()));
 
-    auto texture_it = std::find_if(
-        m_textures.cbegin(), m_textures.cend(), [&texture_name](const std::string& texture) {
-          return mz_path_compare_wc(texture.c_str(), texture_name.c_str(), 1) == MZ_OK;
-        });
-    if (texture_it == m_textures.cend())
-      continue;
-    const auto texture = *texture_it;
-
-    // Check if a higher priority pack already provides a given texture, don't overwrite it
-    bool provided_by_other_pack = false;
-    for (const auto& pack : GetHigherPriorityPacks(*this))
-    {
-      if (std::find(pack->GetTextures().begin(), pack->GetTextures().end(), texture) !=
-          pack->GetTextures().end())
-      {
-        provided_by_other_pack = true;
-        break;
-      }
-    }
-    if (provided_by_other_pack)
+    if (!own_textures.contains(texture) || higher_priority_textures.contains(texture))
       continue;
 
     const std::string texture_path = path + TEXTURE_PATH + texture;
@@ -204,8 +206,8 @@ bool ResourcePack::Install(const std::string& path)
     }
 
     const size_t data_size = static_cast<size_t>(texture_info.uncompressed_size);
-    auto data = std::make_unique<u8[]>(data_size);
-    if (!Common::ReadFileFromZip(file, data.get(), data_size))
+    data.resize(data_size);
+    if (!Common::ReadFileFromZip(file, data.data(), data_size))
     {
       m_error = "Failed to read texture " + texture;
       return false;
@@ -217,7 +219,7 @@ bool ResourcePack::Install(const std::string& path)
       m_error = "Failed to open " + texture;
       return false;
     }
-    if (!out.WriteBytes(data.get(), data_size))
+    if (!out.WriteBytes(data.data(), data_size))
     {
       m_error = "Failed to write " + texture;
       return false;
@@ -240,25 +242,16 @@ bool ResourcePack::Uninstall(const std::string& path)
 
   SetInstalled(*this, false);
 
+  // Check if a higher priority pack already provides a given texture, don't delete it
+  const auto higher_priority_textures = GetProvidedTextures(GetHigherPriorityPacks(*this), true);
+
   for (const auto& texture : m_textures)
   {
-    bool provided_by_other_pack = false;
-
-    // Check if a higher priority pack already provides a given texture, don't delete it
-    for (const auto& pack : GetHigherPriorityPacks(*this))
-    {
-      if (::ResourcePack::IsInstalled(*pack) &&
-          std::find(pack->GetTextures().begin(), pack->GetTextures().end(), texture) !=
-              pack->GetTextures().end())
-      {
-        provided_by_other_pack = true;
-        break;
-      }
-    }
-
-    if (provided_by_other_pack)
+    if (higher_priority_textures.contains(texture))
       continue;
 
+    bool provided_by_other_pack = false;
+
     // Check if a lower priority pack provides a given texture - if so, install it.
     for (auto& pack : lower)
     {
@@ -133,6 +133,11 @@ void PerfQuery::FlushResults()
     FlushOne();
 }
 
+void PerfQuery::PollResults()
+{
+  WeakFlush();
+}
+
 void PerfQuery::WeakFlush()
 {
   while (!IsFlushed())
@@ -143,16 +148,11 @@ void PerfQuery::WeakFlush()
     HRESULT hr = D3D::context->GetData(entry.query.Get(), &result, sizeof(result),
                                        D3D11_ASYNC_GETDATA_DONOTFLUSH);
 
+    // The result is available now, so FlushOne won't have to wait for it. Going through it also
+    // accumulates the result and accounts for multisampling, like a full flush does.
     if (hr == S_OK)
     {
-      // NOTE: Reported pixel metrics should be referenced to native resolution
-      const u64 native_res_result = result * EFB_WIDTH / g_framebuffer_manager->GetEFBWidth() *
-                                    EFB_HEIGHT / g_framebuffer_manager->GetEFBHeight();
-      m_results[entry.query_group].store(static_cast<u32>(native_res_result),
-                                         std::memory_order_relaxed);
-
-      m_query_read_pos = (m_query_read_pos + 1) % m_query_buffer.size();
-      m_query_count.fetch_sub(1, std::memory_order_relaxed);
+      FlushOne();
     }
     else
     {
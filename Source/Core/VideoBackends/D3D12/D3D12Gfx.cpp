@@ -35,7 +35,7 @@ Gfx::Gfx(std::unique_ptr<SwapChain> swap_chain, float backbuffer_scale)
 
   for (u32 i = 0; i < VideoCommon::MAX_PIXEL_SHADER_SAMPLERS; i++)
   {
-    m_state.textures[i].ptr = g_dx_context->GetNullSRVDescriptor().cpu_handle.ptr;
+    m_state.textures.handles[i].ptr = g_dx_context->GetNullSRVDescriptor().cpu_handle.ptr;
     m_state.samplers.states[i] = RenderState::GetPointSamplerState();
   }
 }
@@ -161,7 +161,8 @@ void Gfx::SetPipeline(const AbstractPipeline* pipeline)
       m_dirty_bits |= DirtyState_RootSignature | DirtyState_PS_CBV | DirtyState_VS_CBV |
                       DirtyState_GS_CBV | DirtyState_SRV_Descriptor |
                       DirtyState_Sampler_Descriptor | DirtyState_UAV_Descriptor |
-                      DirtyState_VS_SRV_Descriptor | DirtyState_PS_CUS_CBV;
+                      DirtyState_VS_SRV_Descriptor | DirtyState_PS_CUS_CBV |
+                      DirtyState_BaseVertex;
     }
     if (dx_pipeline->UseIntegerRTV() != m_state.using_integer_rtv)
     {
@@ -244,10 +245,10 @@ void Gfx::SetScissorRect(const MathUtil::Rectangle<int>& rc)
 void Gfx::SetTexture(u32 index, const AbstractTexture* texture)
 {
   const DXTexture* dxtex = static_cast<const DXTexture*>(texture);
-  if (m_state.textures[index].ptr == dxtex->GetSRVDescriptor().cpu_handle.ptr)
+  if (m_state.textures.handles[index].ptr == dxtex->GetSRVDescriptor().cpu_handle.ptr)
     return;
 
-  m_state.textures[index].ptr = dxtex->GetSRVDescriptor().cpu_handle.ptr;
+  m_state.textures.handles[index].ptr = dxtex->GetSRVDescriptor().cpu_handle.ptr;
   if (dxtex)
     dxtex->TransitionToState(D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
 
@@ -282,9 +283,9 @@ void Gfx::UnbindTexture(const AbstractTexture* texture)
       static_cast<const DXTexture*>(texture)->GetSRVDescriptor().cpu_handle;
   for (u32 i = 0; i < VideoCommon::MAX_PIXEL_SHADER_SAMPLERS; i++)
   {
-    if (m_state.textures[i].ptr == srv_shadow_descriptor.ptr)
+    if (m_state.textures.handles[i].ptr == srv_shadow_descriptor.ptr)
     {
-      m_state.textures[i].ptr = g_dx_context->GetNullSRVDescriptor().cpu_handle.ptr;
+      m_state.textures.handles[i].ptr = g_dx_context->GetNullSRVDescriptor().cpu_handle.ptr;
       m_dirty_bits |= DirtyState_Textures;
     }
   }
@@ -327,10 +328,16 @@ void Gfx::DrawIndexed(u32 base_index, u32 num_indices, u32 base_vertex)
   if (!ApplyState())
     return;
 
-  // DX12 is great and doesn't include the base vertex in SV_VertexID
-  if (UsesDynamicVertexLoader(m_current_pipeline))
+  // DX12 is great and doesn't include the base vertex in SV_VertexID. Root constants persist
+  // until the root signature changes, so most batches can skip setting it again.
+  if (UsesDynamicVertexLoader(m_current_pipeline) &&
+      ((m_dirty_bits & DirtyState_BaseVertex) || m_state.base_vertex != base_vertex))
+  {
     g_dx_context->GetCommandList()->SetGraphicsRoot32BitConstant(
         ROOT_PARAMETER_BASE_VERTEX_CONSTANT, base_vertex, 0);
+    m_state.base_vertex = base_vertex;
+    m_dirty_bits &= ~DirtyState_BaseVertex;
+  }
   g_dx_context->GetCommandList()->DrawIndexedInstanced(num_indices, 1, base_index, base_vertex, 0);
 }
 
@@ -458,10 +465,10 @@ void Gfx::SetConstantBuffer(u32 index, D3D12_GPU_VIRTUAL_ADDRESS address)
 
 void Gfx::SetTextureDescriptor(u32 index, D3D12_CPU_DESCRIPTOR_HANDLE handle)
 {
-  if (m_state.textures[index].ptr == handle.ptr)
+  if (m_state.textures.handles[index].ptr == handle.ptr)
     return;
 
-  m_state.textures[index].ptr = handle.ptr;
+  m_state.textures.handles[index].ptr = handle.ptr;
   m_dirty_bits |= DirtyState_Textures;
 }
 
@@ -658,18 +665,12 @@ void Gfx::UpdateDescriptorTables()
 
 bool Gfx::UpdateSRVDescriptorTable()
 {
-  static constexpr std::array<UINT, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> src_sizes = {
-      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
-  DescriptorHandle dst_base_handle;
-  const UINT dst_handle_sizes = VideoCommon::MAX_PIXEL_SHADER_SAMPLERS;
-  if (!g_dx_context->GetDescriptorAllocator()->Allocate(VideoCommon::MAX_PIXEL_SHADER_SAMPLERS,
-                                                        &dst_base_handle))
+  if (!g_dx_context->GetDescriptorAllocator()->GetTextureGroupHandle(m_state.textures,
+                                                                     &m_state.srv_descriptor_base))
+  {
     return false;
+  }
 
-  g_dx_context->GetDevice()->CopyDescriptors(
-      1, &dst_base_handle.cpu_handle, &dst_handle_sizes, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS,
-      m_state.textures.data(), src_sizes.data(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-  m_state.srv_descriptor_base = dst_base_handle.gpu_handle;
   m_dirty_bits = (m_dirty_bits & ~DirtyState_Textures) | DirtyState_SRV_Descriptor;
   return true;
 }
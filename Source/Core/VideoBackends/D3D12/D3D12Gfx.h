@@ -124,6 +124,7 @@ private:
     DirtyState_DescriptorHeaps = (1 << 20),
     DirtyState_VS_SRV = (1 << 21),
     DirtyState_VS_SRV_Descriptor = (1 << 22),
+    DirtyState_BaseVertex = (1 << 23),
 
     DirtyState_All =
         DirtyState_Framebuffer | DirtyState_Pipeline | DirtyState_Textures | DirtyState_Samplers |
@@ -132,7 +133,8 @@ private:
         DirtyState_GS_CBV | DirtyState_SRV_Descriptor | DirtyState_Sampler_Descriptor |
         DirtyState_UAV_Descriptor | DirtyState_VertexBuffer | DirtyState_IndexBuffer |
         DirtyState_PrimitiveTopology | DirtyState_RootSignature | DirtyState_ComputeRootSignature |
-        DirtyState_DescriptorHeaps | DirtyState_VS_SRV | DirtyState_VS_SRV_Descriptor
+        DirtyState_DescriptorHeaps | DirtyState_VS_SRV | DirtyState_VS_SRV_Descriptor |
+        DirtyState_BaseVertex
   };
 
   void CheckForSwapChainChanges();
@@ -158,7 +160,7 @@ private:
     ID3D12RootSignature* root_signature = nullptr;
     DXShader* compute_shader = nullptr;
     std::array<D3D12_GPU_VIRTUAL_ADDRESS, 4> constant_buffers = {};
-    std::array<D3D12_CPU_DESCRIPTOR_HANDLE, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> textures = {};
+    TextureDescriptorSet textures = {};
     D3D12_CPU_DESCRIPTOR_HANDLE vs_srv = {};
     D3D12_CPU_DESCRIPTOR_HANDLE ps_uav = {};
     SamplerStateSet samplers = {};
@@ -173,6 +175,7 @@ private:
     D3D12_VERTEX_BUFFER_VIEW vertex_buffer = {};
     D3D12_INDEX_BUFFER_VIEW index_buffer = {};
     D3D12_PRIMITIVE_TOPOLOGY primitive_topology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+    u32 base_vertex = 0;
     bool using_integer_rtv = false;
   } m_state;
   u32 m_dirty_bits = DirtyState_All;
@@ -139,6 +139,11 @@ void PerfQuery::FlushResults()
     PartialFlush(true, true);
 }
 
+void PerfQuery::PollResults()
+{
+  ReadbackQueries(false);
+}
+
 bool PerfQuery::IsFlushed() const
 {
   return m_query_count.load(std::memory_order_relaxed) == 0;
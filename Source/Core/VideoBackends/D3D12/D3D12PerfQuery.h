@@ -25,6 +25,7 @@ public:
   void ResetQuery() override;
   u32 GetQueryResult(PerfQueryType type) override;
   void FlushResults() override;
+  void PollResults() override;
   bool IsFlushed() const override;
 
 private:
@@ -43,9 +44,10 @@ private:
   void PartialFlush(bool resolve, bool blocking);
 
   // when testing in SMS: 64 was too small, 128 was ok
+  // Sized to hold a few frames of queries, so that results can be polled without blocking.
   // TODO: This should be size_t, but the base class uses u32s
   using PerfQueryDataType = u64;
-  static const u32 PERF_QUERY_BUFFER_SIZE = 512;
+  static const u32 PERF_QUERY_BUFFER_SIZE = 2048;
   std::array<ActiveQuery, PERF_QUERY_BUFFER_SIZE> m_query_buffer = {};
   u32 m_unresolved_queries = 0;
   u32 m_query_resolve_pos = 0;
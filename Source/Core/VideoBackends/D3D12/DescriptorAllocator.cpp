@@ -44,9 +44,50 @@ bool DescriptorAllocator::Allocate(u32 num_handles, DescriptorHandle* out_base_h
   return true;
 }
 
+bool DescriptorAllocator::GetTextureGroupHandle(const TextureDescriptorSet& tds,
+                                                D3D12_GPU_DESCRIPTOR_HANDLE* handle)
+{
+  auto it = m_texture_map.find(tds);
+  if (it != m_texture_map.end())
+  {
+    *handle = it->second;
+    return true;
+  }
+
+  DescriptorHandle allocation;
+  if (!Allocate(VideoCommon::MAX_PIXEL_SHADER_SAMPLERS, &allocation))
+    return false;
+
+  static constexpr std::array<UINT, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> source_sizes = {
+      {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}};
+  g_dx_context->GetDevice()->CopyDescriptors(
+      1, &allocation.cpu_handle, &VideoCommon::MAX_PIXEL_SHADER_SAMPLERS,
+      VideoCommon::MAX_PIXEL_SHADER_SAMPLERS, tds.handles, source_sizes.data(),
+      D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+  *handle = allocation.gpu_handle;
+  m_texture_map.emplace(tds, allocation.gpu_handle);
+  return true;
+}
+
 void DescriptorAllocator::Reset()
 {
   m_current_offset = 0;
+  m_texture_map.clear();
+}
+
+bool operator==(const TextureDescriptorSet& lhs, const TextureDescriptorSet& rhs)
+{
+  return std::memcmp(lhs.handles, rhs.handles, sizeof(lhs.handles)) == 0;
+}
+
+bool operator!=(const TextureDescriptorSet& lhs, const TextureDescriptorSet& rhs)
+{
+  return std::memcmp(lhs.handles, rhs.handles, sizeof(lhs.handles)) != 0;
+}
+
+bool operator<(const TextureDescriptorSet& lhs, const TextureDescriptorSet& rhs)
+{
+  return std::memcmp(lhs.handles, rhs.handles, sizeof(lhs.handles)) < 0;
 }
 
 bool operator==(const SamplerStateSet& lhs, const SamplerStateSet& rhs)
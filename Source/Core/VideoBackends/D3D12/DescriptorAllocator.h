@@ -9,6 +9,15 @@
 
 namespace DX12
 {
+struct TextureDescriptorSet final
+{
+  D3D12_CPU_DESCRIPTOR_HANDLE handles[VideoCommon::MAX_PIXEL_SHADER_SAMPLERS];
+};
+
+bool operator==(const TextureDescriptorSet& lhs, const TextureDescriptorSet& rhs);
+bool operator!=(const TextureDescriptorSet& lhs, const TextureDescriptorSet& rhs);
+bool operator<(const TextureDescriptorSet& lhs, const TextureDescriptorSet& rhs);
+
 class DescriptorAllocator
 {
 public:
@@ -21,6 +30,12 @@ public:
   bool Create(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type, u32 num_descriptors);
 
   bool Allocate(u32 num_handles, DescriptorHandle* out_base_handle);
+
+  // Returns a table containing copies of the given texture descriptors. Tables are shared between
+  // identical sets until the allocator is reset, which is safe since descriptors are only freed
+  // once the command list which may reference them has completed.
+  bool GetTextureGroupHandle(const TextureDescriptorSet& tds, D3D12_GPU_DESCRIPTOR_HANDLE* handle);
+
   void Reset();
 
 protected:
@@ -31,6 +46,9 @@ protected:
 
   D3D12_CPU_DESCRIPTOR_HANDLE m_heap_base_cpu = {};
   D3D12_GPU_DESCRIPTOR_HANDLE m_heap_base_gpu = {};
+
+private:
+  std::map<TextureDescriptorSet, D3D12_GPU_DESCRIPTOR_HANDLE> m_texture_map;
 };
 
 struct SamplerStateSet final
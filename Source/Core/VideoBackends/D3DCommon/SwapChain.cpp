@@ -58,8 +58,16 @@ bool SwapChain::WantsHDR()
 
 u32 SwapChain::GetSwapChainFlags() const
 {
+  u32 flags = 0;
+
   // This flag is necessary if we want to use a flip-model swapchain without locking the framerate
-  return m_allow_tearing_supported ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0;
+  if (m_allow_tearing_supported)
+    flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
+
+  if (m_frame_latency_waitable)
+    flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+
+  return flags;
 }
 
 bool SwapChain::CreateSwapChain(bool stereo, bool hdr)
@@ -80,6 +88,7 @@ bool SwapChain::CreateSwapChain(bool stereo, bool hdr)
   if (SUCCEEDED(hr))
   {
     m_allow_tearing_supported = IsTearingSupported(dxgi_factory2.Get());
+    m_frame_latency_waitable = g_ActiveConfig.bLowLatencyPresent;
 
     DXGI_SWAP_CHAIN_DESC1 swap_chain_desc = {};
     swap_chain_desc.Width = m_width;
@@ -133,6 +142,7 @@ bool SwapChain::CreateSwapChain(bool stereo, bool hdr)
     desc.Flags = 0;
 
     m_allow_tearing_supported = false;
+    m_frame_latency_waitable = false;
     hr = m_dxgi_factory->CreateSwapChain(m_d3d_device.Get(), &desc, &m_swap_chain);
   }
 
@@ -150,6 +160,18 @@ bool SwapChain::CreateSwapChain(bool stereo, bool hdr)
 
   m_stereo = stereo;
 
+  if (m_frame_latency_waitable)
+  {
+    Microsoft::WRL::ComPtr<IDXGISwapChain2> swap_chain2;
+    hr = m_swap_chain->QueryInterface(IID_PPV_ARGS(&swap_chain2));
+    if (SUCCEEDED(hr))
+      hr = swap_chain2->SetMaximumFrameLatency(1);
+    if (SUCCEEDED(hr))
+      m_frame_latency_wait_object = swap_chain2->GetFrameLatencyWaitableObject();
+    else
+      WARN_LOG_FMT(VIDEO, "Failed to set up frame latency waiting: {}", Common::HRWrap(hr));
+  }
+
   if (hdr)
   {
     // Only try to activate HDR here, to avoid failing when creating the swapchain
@@ -199,6 +221,12 @@ void SwapChain::DestroySwapChain()
   if (m_swap_chain && GetFullscreenState(m_swap_chain.Get()))
     m_swap_chain->SetFullscreenState(FALSE, nullptr);
 
+  if (m_frame_latency_wait_object)
+  {
+    CloseHandle(m_frame_latency_wait_object);
+    m_frame_latency_wait_object = nullptr;
+  }
+
   m_swap_chain.Reset();
 }
 
@@ -309,6 +337,11 @@ bool SwapChain::Present()
     return false;
   }
 
+  // Block until the frame has been picked up, instead of letting the next one be rendered from
+  // inputs which will be several frames old by the time it is displayed.
+  if (m_frame_latency_wait_object)
+    WaitForSingleObjectEx(m_frame_latency_wait_object, 1000, TRUE);
+
   return true;
 }
 
@@ -42,7 +42,8 @@ public:
   // Checks for loss of exclusive fullscreen.
   bool CheckForFullscreenChange();
 
-  // Presents the swap chain to the screen.
+  // Presents the swap chain to the screen. In low latency mode, this also waits until the swap
+  // chain is ready to accept the next frame, so that no more than one frame is ever queued.
   virtual bool Present();
 
   bool ChangeSurface(void* native_handle);
@@ -71,6 +72,8 @@ protected:
   bool m_stereo = false;
   bool m_hdr = false;
   bool m_allow_tearing_supported = false;
+  bool m_frame_latency_waitable = false;
+  HANDLE m_frame_latency_wait_object = nullptr;
   bool m_has_fullscreen = false;
   bool m_fullscreen_request = false;
 };
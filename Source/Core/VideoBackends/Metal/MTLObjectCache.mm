@@ -8,6 +8,8 @@
 #include <optional>
 
 #include "Common/Assert.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
 #include "VideoBackends/Metal/MTLPipeline.h"
@@ -16,6 +18,7 @@
 
 #include "VideoCommon/AbstractPipeline.h"
 #include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/ShaderGenCommon.h"
 #include "VideoCommon/VertexShaderGen.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -379,6 +382,123 @@ public:
   std::map<const Shader*, std::vector<PipelineID>> m_shaders;
   std::array<u32, 3> m_pipeline_counter;
 
+  // Compiled pipeline binaries are kept in an archive on disk, so the driver doesn't have to
+  // recompile them from MSL on every launch.
+  std::mutex m_archive_mtx;
+  MRCOwned<id<MTLBinaryArchive>> m_archive API_AVAILABLE(macos(11.0), ios(14.0));
+  std::string m_archive_filename;
+  bool m_archive_dirty = false;
+
+  Internal()
+  {
+    if (!g_ActiveConfig.bShaderCache)
+      return;
+    if (@available(macOS 11, iOS 14, *))
+      LoadBinaryArchive();
+  }
+
+  ~Internal()
+  {
+    if (@available(macOS 11, iOS 14, *))
+      SaveBinaryArchive();
+  }
+
+  void LoadBinaryArchive() API_AVAILABLE(macos(11.0), ios(14.0))
+  {
+    @autoreleasepool
+    {
+      m_archive_filename =
+          GetDiskShaderCacheFileName(APIType::Metal, "BinaryArchive", false, false);
+      auto desc = MRCTransfer([MTLBinaryArchiveDescriptor new]);
+      NSError* err = nullptr;
+      if (File::Exists(m_archive_filename))
+      {
+        NSString* path = [NSString stringWithUTF8String:m_archive_filename.c_str()];
+        [desc setUrl:[NSURL fileURLWithPath:path]];
+        m_archive = MRCTransfer([g_device newBinaryArchiveWithDescriptor:desc error:&err]);
+        if (m_archive)
+          return;
+        // Most likely made by a different OS or driver version, just start over
+        WARN_LOG_FMT(VIDEO, "Failed to load pipeline archive {}: {}", m_archive_filename,
+                     [[err localizedDescription] UTF8String]);
+        File::Delete(m_archive_filename);
+        [desc setUrl:nil];
+        err = nullptr;
+      }
+      m_archive = MRCTransfer([g_device newBinaryArchiveWithDescriptor:desc error:&err]);
+      if (!m_archive)
+      {
+        WARN_LOG_FMT(VIDEO, "Failed to create pipeline archive: {}",
+                     [[err localizedDescription] UTF8String]);
+      }
+    }
+  }
+
+  void SaveBinaryArchive() API_AVAILABLE(macos(11.0), ios(14.0))
+  {
+    std::lock_guard<std::mutex> lock(m_archive_mtx);
+    if (!m_archive || !m_archive_dirty)
+      return;
+    @autoreleasepool
+    {
+      NSURL* url =
+          [NSURL fileURLWithPath:[NSString stringWithUTF8String:m_archive_filename.c_str()]];
+      NSError* err = nullptr;
+      if (![m_archive serializeToURL:url error:&err])
+      {
+        WARN_LOG_FMT(VIDEO, "Failed to save pipeline archive {}: {}", m_archive_filename,
+                     [[err localizedDescription] UTF8String]);
+      }
+      m_archive_dirty = false;
+    }
+  }
+
+  id<MTLRenderPipelineState> NewPipelineState(MTLRenderPipelineDescriptor* desc,
+                                              MTLRenderPipelineReflection** reflection,
+                                              NSError** err)
+  {
+    if (@available(macOS 11, iOS 14, *))
+    {
+      if (id<MTLBinaryArchive> archive = m_archive)
+      {
+        // Try the archive first, and only compile (and add to the archive) if it's not there
+        [desc setBinaryArchives:@[ archive ]];
+        const MTLPipelineOption options =
+            MTLPipelineOptionArgumentInfo | MTLPipelineOptionFailOnBinaryArchiveMiss;
+        id<MTLRenderPipelineState> pipe = [g_device newRenderPipelineStateWithDescriptor:desc
+                                                                                 options:options
+                                                                              reflection:reflection
+                                                                                   error:nullptr];
+        if (pipe)
+          return pipe;
+        *reflection = nullptr;
+      }
+    }
+    id<MTLRenderPipelineState> pipe =
+        [g_device newRenderPipelineStateWithDescriptor:desc
+                                               options:MTLPipelineOptionArgumentInfo
+                                            reflection:reflection
+                                                 error:err];
+    if (@available(macOS 11, iOS 14, *))
+    {
+      if (pipe && m_archive)
+      {
+        std::lock_guard<std::mutex> lock(m_archive_mtx);
+        NSError* archive_err = nullptr;
+        if ([m_archive addRenderPipelineFunctionsWithDescriptor:desc error:&archive_err])
+        {
+          m_archive_dirty = true;
+        }
+        else
+        {
+          WARN_LOG_FMT(VIDEO, "Failed to add pipeline to archive: {}",
+                       [[archive_err localizedDescription] UTF8String]);
+        }
+      }
+    }
+    return pipe;
+  }
+
   StoredPipeline CreatePipeline(const AbstractPipelineConfig& config)
   {
     @autoreleasepool
@@ -438,11 +558,7 @@ public:
         [desc setStencilAttachmentPixelFormat:Util::FromAbstract(fs.depth_texture_format)];
       NSError* err = nullptr;
       MTLRenderPipelineReflection* reflection = nullptr;
-      id<MTLRenderPipelineState> pipe =
-          [g_device newRenderPipelineStateWithDescriptor:desc
-                                                 options:MTLPipelineOptionArgumentInfo
-                                              reflection:&reflection
-                                                   error:&err];
+      id<MTLRenderPipelineState> pipe = NewPipelineState(desc, &reflection, &err);
       if (err)
       {
         PanicAlertFmt("Failed to compile pipeline for {} and {}: {}",
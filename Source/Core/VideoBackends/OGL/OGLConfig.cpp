@@ -3,9 +3,11 @@
 
 #include "VideoBackends/OGL/OGLConfig.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <string>
 #include <string_view>
+#include <thread>
 
 #include "Common/Assert.h"
 #include "Common/GL/GLContext.h"
@@ -694,6 +696,13 @@ bool PopulateConfig(GLContext* m_main_gl_context)
   g_Config.backend_info.bSupportsBackgroundCompiling =
       !DriverDetails::HasBug(DriverDetails::BUG_SHARED_CONTEXT_SHADER_COMPILATION);
 
+  // Let the driver compile and link shaders on its own threads, which also speeds up the links
+  // done synchronously on the GPU thread.
+  g_ogl_config.bSupportsParallelShaderCompile =
+      GLExtensions::Supports("GL_KHR_parallel_shader_compile");
+  if (g_ogl_config.bSupportsParallelShaderCompile)
+    glMaxShaderCompilerThreadsKHR(std::max(std::thread::hardware_concurrency(), 1u));
+
   // Program binaries are supported on GL4.1+, ARB_get_program_binary, or ES3.
   if (supports_glsl_cache)
   {
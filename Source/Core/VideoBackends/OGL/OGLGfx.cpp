@@ -6,6 +6,7 @@
 #include "Common/GL/GLContext.h"
 #include "Common/GL/GLExtensions/GLExtensions.h"
 #include "Common/Logging/LogManager.h"
+#include "Common/TraceProfiler.h"
 
 #include "Core/Config/GraphicsSettings.h"
 
@@ -19,10 +20,12 @@
 #include "VideoCommon/AsyncShaderCompiler.h"
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/VideoConfig.h"
 
 #include <algorithm>
+#include <chrono>
 #include <string_view>
 
 namespace OGL
@@ -192,6 +195,9 @@ OGLGfx::OGLGfx(std::unique_ptr<GLContext> main_gl_context, float backbuffer_scal
   glGenFramebuffers(1, &m_shared_read_framebuffer);
   glGenFramebuffers(1, &m_shared_draw_framebuffer);
 
+  m_supports_gpu_timestamps =
+      !m_main_gl_context->IsGLES() && GLExtensions::Supports("GL_ARB_timer_query");
+
   if (g_ActiveConfig.backend_info.bSupportsPrimitiveRestart)
     GLUtil::EnablePrimitiveRestart(m_main_gl_context.get());
 
@@ -200,6 +206,15 @@ OGLGfx::OGLGfx(std::unique_ptr<GLContext> main_gl_context, float backbuffer_scal
 
 OGLGfx::~OGLGfx()
 {
+  ReleaseGPUTimestamps(m_gpu_timestamps);
+  for (const auto& timestamps : m_pending_gpu_timestamps)
+    ReleaseGPUTimestamps(timestamps);
+  if (!m_free_gpu_timestamp_queries.empty())
+  {
+    glDeleteQueries(static_cast<GLsizei>(m_free_gpu_timestamp_queries.size()),
+                    m_free_gpu_timestamp_queries.data());
+  }
+
   glDeleteFramebuffers(1, &m_shared_draw_framebuffer);
   glDeleteFramebuffers(1, &m_shared_read_framebuffer);
 }
@@ -433,6 +448,103 @@ void OGLGfx::PresentBackbuffer()
   m_main_gl_context->Swap();
 }
 
+void OGLGfx::InsertGPUTimestamp(GPUTimingPass pass)
+{
+  if (!m_supports_gpu_timestamps)
+    return;
+
+  GLuint query;
+  if (m_free_gpu_timestamp_queries.empty())
+  {
+    glGenQueries(1, &query);
+  }
+  else
+  {
+    query = m_free_gpu_timestamp_queries.back();
+    m_free_gpu_timestamp_queries.pop_back();
+  }
+
+  glQueryCounter(query, GL_TIMESTAMP);
+  m_gpu_timestamps.push_back({query, pass});
+}
+
+void OGLGfx::ResolveGPUTimestamps()
+{
+  // A few frames in flight is normal. Beyond that the results would be too stale to be useful.
+  static constexpr size_t MAX_PENDING_FRAMES = 8;
+
+  if (!m_gpu_timestamps.empty())
+  {
+    m_pending_gpu_timestamps.push_back(std::move(m_gpu_timestamps));
+    m_gpu_timestamps.clear();
+  }
+
+  while (m_pending_gpu_timestamps.size() > MAX_PENDING_FRAMES)
+  {
+    ReleaseGPUTimestamps(m_pending_gpu_timestamps.front());
+    m_pending_gpu_timestamps.pop_front();
+  }
+
+  // Timestamps complete in order, so a frame is done once its last query is. Never wait on one.
+  while (!m_pending_gpu_timestamps.empty())
+  {
+    const auto& timestamps = m_pending_gpu_timestamps.front();
+    GLint available = GL_FALSE;
+    glGetQueryObjectiv(timestamps.back().query, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+      break;
+
+    ReadGPUTimestamps(timestamps);
+    ReleaseGPUTimestamps(timestamps);
+    m_pending_gpu_timestamps.pop_front();
+  }
+}
+
+void OGLGfx::ReadGPUTimestamps(const std::vector<GPUTimestamp>& timestamps)
+{
+  if (timestamps.size() < 2)
+    return;
+
+  const bool trace = Common::TraceProfiler::IsEnabled();
+  if (trace && !m_gpu_timestamp_offset)
+  {
+    // Line the GPU clock up with the trace clock once. Drift over a capture is negligible.
+    GLint64 gpu_now;
+    glGetInteger64v(GL_TIMESTAMP, &gpu_now);
+    m_gpu_timestamp_offset = static_cast<s64>(Common::TraceProfiler::GetTimestamp()) - gpu_now;
+  }
+
+  GPUTimingPassMap<DT> times{};
+  GLuint64 begin;
+  glGetQueryObjectui64v(timestamps[0].query, GL_QUERY_RESULT, &begin);
+  for (size_t i = 1; i < timestamps.size(); ++i)
+  {
+    GLuint64 end;
+    glGetQueryObjectui64v(timestamps[i].query, GL_QUERY_RESULT, &end);
+
+    const GPUTimingPass pass = timestamps[i - 1].pass;
+    if (pass != GPUTimingPass::Idle && end > begin)
+    {
+      times[pass] += std::chrono::nanoseconds(end - begin);
+      if (trace)
+      {
+        Common::TraceProfiler::RecordGPUZone(GPU_TIMING_PASS_NAMES[pass],
+                                             begin + *m_gpu_timestamp_offset,
+                                             end + *m_gpu_timestamp_offset);
+      }
+    }
+    begin = end;
+  }
+
+  g_perf_metrics.SetGPUPassTimes(times);
+}
+
+void OGLGfx::ReleaseGPUTimestamps(const std::vector<GPUTimestamp>& timestamps)
+{
+  for (const GPUTimestamp& timestamp : timestamps)
+    m_free_gpu_timestamp_queries.push_back(timestamp.query);
+}
+
 void OGLGfx::OnConfigChanged(u32 bits)
 {
   AbstractGfx::OnConfigChanged(bits);
@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <deque>
+#include <optional>
+#include <vector>
+
 #include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/Constants.h"
 
@@ -92,10 +96,23 @@ public:
 
   SurfaceInfo GetSurfaceInfo() const override;
 
+protected:
+  void InsertGPUTimestamp(GPUTimingPass pass) override;
+  void ResolveGPUTimestamps() override;
+
 private:
+  struct GPUTimestamp
+  {
+    u32 query;
+    GPUTimingPass pass;
+  };
+
   void CheckForSurfaceChange();
   void CheckForSurfaceResize();
 
+  void ReadGPUTimestamps(const std::vector<GPUTimestamp>& timestamps);
+  void ReleaseGPUTimestamps(const std::vector<GPUTimestamp>& timestamps);
+
   void ApplyRasterizationState(const RasterizationState state);
   void ApplyDepthState(const DepthState state);
   void ApplyBlendingState(const BlendingState state);
@@ -112,6 +129,13 @@ private:
   u32 m_shared_read_framebuffer = 0;
   u32 m_shared_draw_framebuffer = 0;
   float m_backbuffer_scale;
+
+  // Timestamps of the frame being recorded, followed by the frames the GPU hasn't finished yet.
+  bool m_supports_gpu_timestamps = false;
+  std::vector<GPUTimestamp> m_gpu_timestamps;
+  std::deque<std::vector<GPUTimestamp>> m_pending_gpu_timestamps;
+  std::vector<u32> m_free_gpu_timestamp_queries;
+  std::optional<s64> m_gpu_timestamp_offset;
 };
 
 inline OGLGfx* GetOGLGfx()
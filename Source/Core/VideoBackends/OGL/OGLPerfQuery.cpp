@@ -184,6 +184,11 @@ void PerfQueryGL::FlushResults()
     FlushOne();
 }
 
+void PerfQueryGL::PollResults()
+{
+  WeakFlush();
+}
+
 PerfQueryGLESNV::PerfQueryGLESNV()
 {
   for (ActiveQuery& query : m_query_buffer)
@@ -281,4 +286,9 @@ void PerfQueryGLESNV::FlushResults()
     FlushOne();
 }
 
+void PerfQueryGLESNV::PollResults()
+{
+  WeakFlush();
+}
+
 }  // namespace OGL
@@ -55,6 +55,7 @@ public:
   void EnableQuery(PerfQueryGroup group) override;
   void DisableQuery(PerfQueryGroup group) override;
   void FlushResults() override;
+  void PollResults() override;
 
 private:
   void WeakFlush();
@@ -73,6 +74,7 @@ public:
   void EnableQuery(PerfQueryGroup group) override;
   void DisableQuery(PerfQueryGroup group) override;
   void FlushResults() override;
+  void PollResults() override;
 
 private:
   void WeakFlush();
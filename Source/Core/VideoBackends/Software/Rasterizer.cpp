@@ -4,11 +4,21 @@
 #include "VideoBackends/Software/Rasterizer.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/Thread.h"
+
+#include "Core/Config/GraphicsSettings.h"
 
 #include "VideoBackends/Software/EfbInterface.h"
 #include "VideoBackends/Software/NativeVertexFormat.h"
@@ -25,6 +35,12 @@ namespace Rasterizer
 {
 static constexpr int BLOCK_SIZE = 2;
 
+// Tiles are made of whole 2x2 blocks, so the LOD of a block never depends on which tile it is in.
+static constexpr int TILE_SIZE = 32;
+static_assert(TILE_SIZE % BLOCK_SIZE == 0);
+static constexpr int NUM_TILES_X = (static_cast<int>(EFB_WIDTH) + TILE_SIZE - 1) / TILE_SIZE;
+static constexpr int NUM_TILES_Y = (static_cast<int>(EFB_HEIGHT) + TILE_SIZE - 1) / TILE_SIZE;
+
 struct SlopeContext
 {
   SlopeContext(const OutputVertexData* v0, const OutputVertexData* v1, const OutputVertexData* v2,
@@ -96,21 +112,115 @@ struct Slope
   }
 };
 
-static Slope ZSlope;
-static Slope WSlope;
-static Slope ColorSlopes[2][4];
-static Slope TexSlopes[8][3];
+// Everything needed to draw a triangle once its vertices are gone.
+struct Triangle
+{
+  Slope ZSlope;
+  Slope WSlope;
+  Slope ColorSlopes[2][4];
+  Slope TexSlopes[8][3];
+
+  // Half-edge constants and deltas, in 28.4 fixed point
+  s32 C1, C2, C3;
+  s32 DX12, DX23, DX31;
+  s32 DY12, DY23, DY31;
+
+  // Bounding rectangle, clipped to the scissor
+  s32 minx, maxx, miny, maxy;
+};
+
+// The state of one thread that draws pixels.
+struct RasterContext
+{
+  Tev tev;
+  RasterBlock rasterBlock;
+  int rasterized_pixels = 0;
+};
 
-static Tev tev;
-static RasterBlock rasterBlock;
+static Slope ZSlope;
 
 static std::vector<BPFunctions::ScissorRect> scissors;
 
+// Context 0 belongs to the GPU thread, the others to the workers.
+static std::vector<std::unique_ptr<RasterContext>> s_contexts;
+
+// With more than one rasterizer thread, the triangles of a draw call are binned into the tiles
+// that they touch and the tiles are drawn in parallel when the draw call is flushed. Each tile
+// draws its triangles in submission order, so the output is identical to drawing them serially.
+static bool s_binning_enabled = false;
+static std::vector<Triangle> s_triangles;
+static std::array<std::vector<u32>, NUM_TILES_X * NUM_TILES_Y> s_bins;
+static std::vector<u32> s_active_tiles;
+static std::atomic<u32> s_next_tile = 0;
+
+static std::vector<std::thread> s_workers;
+static std::mutex s_work_mutex;
+static std::condition_variable s_work_cv;
+static std::condition_variable s_done_cv;
+static u64 s_work_generation = 0;
+static u32 s_busy_workers = 0;
+static bool s_workers_exit = false;
+
+static void DrawTiles(RasterContext& context);
+
+static void WorkerThread(RasterContext* context)
+{
+  Common::SetCurrentThreadName("SW Rasterizer");
+
+  u64 generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock lk(s_work_mutex);
+      s_work_cv.wait(lk, [&] { return s_workers_exit || s_work_generation != generation; });
+      if (s_workers_exit)
+        return;
+      generation = s_work_generation;
+    }
+
+    DrawTiles(*context);
+
+    std::lock_guard lk(s_work_mutex);
+    if (--s_busy_workers == 0)
+      s_done_cv.notify_one();
+  }
+}
+
 void Init()
 {
   // The other slopes are set each for each primitive drawn, but zfreeze means that the z slope
   // needs to be set to an (untested) default value.
   ZSlope = Slope();
+
+  const int num_threads = std::max(Config::Get(Config::GFX_SW_RASTERIZER_THREADS), 1);
+  s_binning_enabled = num_threads > 1;
+
+  s_contexts.clear();
+  for (int i = 0; i < num_threads; i++)
+    s_contexts.push_back(std::make_unique<RasterContext>());
+
+  s_workers_exit = false;
+  for (int i = 1; i < num_threads; i++)
+    s_workers.emplace_back(WorkerThread, s_contexts[i].get());
+}
+
+void Shutdown()
+{
+  {
+    std::lock_guard lk(s_work_mutex);
+    s_workers_exit = true;
+  }
+  s_work_cv.notify_all();
+
+  for (std::thread& worker : s_workers)
+    worker.join();
+  s_workers.clear();
+
+  s_triangles.clear();
+  for (u32 tile : s_active_tiles)
+    s_bins[tile].clear();
+  s_active_tiles.clear();
+  s_contexts.clear();
 }
 
 void ScissorChanged()
@@ -142,14 +252,18 @@ static inline int iround(float x)
 
 void SetTevKonstColors()
 {
-  tev.SetKonstColors();
+  for (auto& context : s_contexts)
+    context->tev.SetKonstColors();
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+static void Draw(RasterContext& context, const Triangle& tri, s32 x, s32 y, s32 xi, s32 yi)
 {
-  INCSTAT(g_stats.this_frame.rasterized_pixels);
+  INCSTAT(context.rasterized_pixels);
+
+  Tev& tev = context.tev;
+  const RasterBlock& rasterBlock = context.rasterBlock;
 
-  s32 z = (s32)std::clamp<float>(ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
+  s32 z = (s32)std::clamp<float>(tri.ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
 
   if (bpmem.GetEmulatedZ() == EmulatedZ::Early)
   {
@@ -164,7 +278,7 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
     EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
   }
 
-  RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+  const RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
 
   tev.Position[0] = x;
   tev.Position[1] = y;
@@ -175,7 +289,7 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   {
     for (int comp = 0; comp < 4; comp++)
     {
-      u16 color = (u16)ColorSlopes[i][comp].GetValue(x, y);
+      u16 color = (u16)tri.ColorSlopes[i][comp].GetValue(x, y);
 
       // clamp color value to 0
       u16 mask = ~(color >> 8);
@@ -207,7 +321,8 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   tev.Draw();
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(const RasterBlock& rasterBlock, s32* lodp, bool* linear,
+                                u32 texmap, u32 texcoord)
 {
   auto texUnit = bpmem.tex.GetUnit(texmap);
 
@@ -218,9 +333,9 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 
   float sDelta, tDelta;
 
-  float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
-  float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
-  float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
+  const float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
+  const float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
+  const float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
 
   float dudx = fabsf(uv00[0] - uv10[0]);
   float dvdx = fabsf(uv00[1] - uv10[1]);
@@ -258,7 +373,7 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   *lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(RasterBlock& rasterBlock, const Triangle& tri, s32 blockX, s32 blockY)
 {
   for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
   {
@@ -269,19 +384,19 @@ static void BuildBlock(s32 blockX, s32 blockY)
       s32 x = xi + blockX;
       s32 y = yi + blockY;
 
-      float invW = 1.0f / WSlope.GetValue(x, y);
+      float invW = 1.0f / tri.WSlope.GetValue(x, y);
       pixel.InvW = invW;
 
       // tex coords
       for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
       {
         float projection = invW;
-        float q = TexSlopes[i][2].GetValue(x, y) * invW;
+        float q = tri.TexSlopes[i][2].GetValue(x, y) * invW;
         if (q != 0.0f)
           projection = invW / q;
 
-        pixel.Uv[i][0] = TexSlopes[i][0].GetValue(x, y) * projection;
-        pixel.Uv[i][1] = TexSlopes[i][1].GetValue(x, y) * projection;
+        pixel.Uv[i][0] = tri.TexSlopes[i][0].GetValue(x, y) * projection;
+        pixel.Uv[i][1] = tri.TexSlopes[i][1].GetValue(x, y) * projection;
       }
     }
   }
@@ -291,7 +406,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
     u32 texmap = bpmem.tevindref.getTexMap(i);
     u32 texcoord = bpmem.tevindref.getTexCoord(i);
 
-    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+    CalculateLOD(rasterBlock, &rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap,
+                 texcoord);
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -303,7 +419,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
       u32 texmap = order.getTexMap(stageOdd);
       u32 texcoord = order.getTexCoord(stageOdd);
 
-      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+      CalculateLOD(rasterBlock, &rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap,
+                   texcoord);
     }
   }
 }
@@ -320,9 +437,10 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
   }
 }
 
-static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
-                                  const OutputVertexData* v2,
-                                  const BPFunctions::ScissorRect& scissor)
+// Returns false if the triangle is rejected by the scissor test.
+static bool SetupTriangle(const OutputVertexData* v0, const OutputVertexData* v1,
+                          const OutputVertexData* v2, const BPFunctions::ScissorRect& scissor,
+                          Triangle* tri)
 {
   // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
   // zfreeze depends on it
@@ -349,15 +467,6 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   const s32 DY23 = Y2 - Y3;
   const s32 DY31 = Y3 - Y1;
 
-  // Fixed-pos32 deltas
-  const s32 FDX12 = DX12 * 16;
-  const s32 FDX23 = DX23 * 16;
-  const s32 FDX31 = DX31 * 16;
-
-  const s32 FDY12 = DY12 * 16;
-  const s32 FDY23 = DY23 * 16;
-  const s32 FDY31 = DY31 * 16;
-
   // Bounding rectangle
   s32 minx = (std::min(std::min(X1, X2), X3) + 0xF) >> 4;
   s32 maxx = (std::max(std::max(X1, X2), X3) + 0xF) >> 4;
@@ -376,7 +485,9 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   maxy = std::min(maxy, scissor.rect.bottom);
 
   if (minx >= maxx || miny >= maxy)
-    return;
+    return false;
+
+  tri->ZSlope = ZSlope;
 
   // Set up the remaining slopes
   const SlopeContext ctx(v0, v1, v2, (X1 + 0xF) >> 4, (Y1 + 0xF) >> 4, scissor.x_off,
@@ -384,20 +495,23 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
 
   float w[3] = {1.0f / v0->projectedPosition.w, 1.0f / v1->projectedPosition.w,
                 1.0f / v2->projectedPosition.w};
-  WSlope = Slope(w[0], w[1], w[2], ctx);
+  tri->WSlope = Slope(w[0], w[1], w[2], ctx);
 
   for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
   {
     for (int comp = 0; comp < 4; comp++)
-      ColorSlopes[i][comp] = Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    {
+      tri->ColorSlopes[i][comp] =
+          Slope(v0->color[i][comp], v1->color[i][comp], v2->color[i][comp], ctx);
+    }
   }
 
   for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
   {
     for (int comp = 0; comp < 3; comp++)
     {
-      TexSlopes[i][comp] = Slope(v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1],
-                                 v2->texCoords[i][comp] * w[2], ctx);
+      tri->TexSlopes[i][comp] = Slope(v0->texCoords[i][comp] * w[0], v1->texCoords[i][comp] * w[1],
+                                      v2->texCoords[i][comp] * w[2], ctx);
     }
   }
 
@@ -414,6 +528,56 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   if (DY31 < 0 || (DY31 == 0 && DX31 > 0))
     C3++;
 
+  tri->C1 = C1;
+  tri->C2 = C2;
+  tri->C3 = C3;
+  tri->DX12 = DX12;
+  tri->DX23 = DX23;
+  tri->DX31 = DX31;
+  tri->DY12 = DY12;
+  tri->DY23 = DY23;
+  tri->DY31 = DY31;
+  tri->minx = minx;
+  tri->maxx = maxx;
+  tri->miny = miny;
+  tri->maxy = maxy;
+  return true;
+}
+
+// Draws the part of the triangle that lies within the given rectangle. The rectangle must be
+// aligned to the 2x2 blocks.
+static void RasterizeTriangle(RasterContext& context, const Triangle& tri, s32 clip_left,
+                              s32 clip_top, s32 clip_right, s32 clip_bottom)
+{
+  const s32 minx = std::max(tri.minx, clip_left);
+  const s32 maxx = std::min(tri.maxx, clip_right);
+  const s32 miny = std::max(tri.miny, clip_top);
+  const s32 maxy = std::min(tri.maxy, clip_bottom);
+
+  if (minx >= maxx || miny >= maxy)
+    return;
+
+  const s32 C1 = tri.C1;
+  const s32 C2 = tri.C2;
+  const s32 C3 = tri.C3;
+
+  const s32 DX12 = tri.DX12;
+  const s32 DX23 = tri.DX23;
+  const s32 DX31 = tri.DX31;
+
+  const s32 DY12 = tri.DY12;
+  const s32 DY23 = tri.DY23;
+  const s32 DY31 = tri.DY31;
+
+  // Fixed-pos32 deltas
+  const s32 FDX12 = DX12 * 16;
+  const s32 FDX23 = DX23 * 16;
+  const s32 FDX31 = DX31 * 16;
+
+  const s32 FDY12 = DY12 * 16;
+  const s32 FDY23 = DY23 * 16;
+  const s32 FDY31 = DY31 * 16;
+
   // Start in corner of 2x2 block
   s32 block_minx = minx & ~(BLOCK_SIZE - 1);
   s32 block_miny = miny & ~(BLOCK_SIZE - 1);
@@ -455,7 +619,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
       if (a == 0x0 || b == 0x0 || c == 0x0)
         continue;
 
-      BuildBlock(x, y);
+      BuildBlock(context.rasterBlock, tri, x, y);
 
       // Accept whole block when totally covered
       // We still need to check min/max x/y because of the scissor
@@ -465,7 +629,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
         {
           for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
           {
-            Draw(x + ix, y + iy, ix, iy);
+            Draw(context, tri, x + ix, y + iy, ix, iy);
           }
         }
       }
@@ -488,7 +652,7 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
               // This check enforces the scissor rectangle, since it might not be aligned with the
               // blocks
               if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy)
-                Draw(x + ix, y + iy, ix, iy);
+                Draw(context, tri, x + ix, y + iy, ix, iy);
             }
 
             CX1 -= FDY12;
@@ -505,6 +669,96 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   }
 }
 
+static void BinTriangle(const Triangle& tri)
+{
+  const u32 index = static_cast<u32>(s_triangles.size());
+  s_triangles.push_back(tri);
+
+  for (s32 tile_y = tri.miny / TILE_SIZE; tile_y <= (tri.maxy - 1) / TILE_SIZE; tile_y++)
+  {
+    for (s32 tile_x = tri.minx / TILE_SIZE; tile_x <= (tri.maxx - 1) / TILE_SIZE; tile_x++)
+    {
+      const u32 tile = static_cast<u32>(tile_y * NUM_TILES_X + tile_x);
+      if (s_bins[tile].empty())
+        s_active_tiles.push_back(tile);
+      s_bins[tile].push_back(index);
+    }
+  }
+}
+
+static void DrawTiles(RasterContext& context)
+{
+  const u32 num_tiles = static_cast<u32>(s_active_tiles.size());
+
+  for (u32 i = s_next_tile.fetch_add(1, std::memory_order_relaxed); i < num_tiles;
+       i = s_next_tile.fetch_add(1, std::memory_order_relaxed))
+  {
+    const u32 tile = s_active_tiles[i];
+    const s32 left = static_cast<s32>(tile % NUM_TILES_X) * TILE_SIZE;
+    const s32 top = static_cast<s32>(tile / NUM_TILES_X) * TILE_SIZE;
+
+    for (const u32 index : s_bins[tile])
+      RasterizeTriangle(context, s_triangles[index], left, top, left + TILE_SIZE, top + TILE_SIZE);
+  }
+}
+
+static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
+                                  const OutputVertexData* v2,
+                                  const BPFunctions::ScissorRect& scissor)
+{
+  Triangle tri;
+  if (!SetupTriangle(v0, v1, v2, scissor, &tri))
+    return;
+
+  if (s_binning_enabled)
+    BinTriangle(tri);
+  else
+    RasterizeTriangle(*s_contexts[0], tri, 0, 0, EFB_WIDTH, EFB_HEIGHT);
+}
+
+void Flush()
+{
+  if (!s_triangles.empty())
+  {
+    s_next_tile.store(0, std::memory_order_relaxed);
+
+    if (s_active_tiles.size() == 1)
+    {
+      DrawTiles(*s_contexts[0]);
+    }
+    else
+    {
+      {
+        std::lock_guard lk(s_work_mutex);
+        s_busy_workers = static_cast<u32>(s_workers.size());
+        s_work_generation++;
+      }
+      s_work_cv.notify_all();
+
+      // The GPU thread draws tiles too rather than waiting idly.
+      DrawTiles(*s_contexts[0]);
+
+      std::unique_lock lk(s_work_mutex);
+      s_done_cv.wait(lk, [] { return s_busy_workers == 0; });
+    }
+
+    for (u32 tile : s_active_tiles)
+      s_bins[tile].clear();
+    s_active_tiles.clear();
+    s_triangles.clear();
+  }
+
+  for (auto& context : s_contexts)
+  {
+    ADDSTAT(g_stats.this_frame.rasterized_pixels, context->rasterized_pixels);
+    ADDSTAT(g_stats.this_frame.tev_pixels_in, context->tev.TevPixelsIn);
+    ADDSTAT(g_stats.this_frame.tev_pixels_out, context->tev.TevPixelsOut);
+    context->rasterized_pixels = 0;
+    context->tev.TevPixelsIn = 0;
+    context->tev.TevPixelsOut = 0;
+  }
+}
+
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2)
 {
@@ -10,8 +10,13 @@ struct OutputVertexData;
 namespace Rasterizer
 {
 void Init();
+void Shutdown();
 void ScissorChanged();
 
+// Draws all triangles that were binned since the last flush. Called at the end of every draw
+// call, so EFB copies, EFB access and bounding box reads always see the finished draw.
+void Flush();
+
 void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
                   const OutputVertexData* v2, s32 x_off, s32 y_off);
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
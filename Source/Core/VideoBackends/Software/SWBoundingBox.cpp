@@ -3,8 +3,9 @@
 
 #include "VideoBackends/Software/SWBoundingBox.h"
 
-#include <algorithm>
 #include <array>
+#include <atomic>
+#include <functional>
 
 #include "Common/CommonTypes.h"
 
@@ -12,31 +13,37 @@ namespace BBoxManager
 {
 namespace
 {
-// Current bounding box coordinates.
-std::array<u16, 4> s_coordinates{};
+// Current bounding box coordinates. Atomic since the rasterizer may draw several tiles at once.
+std::array<std::atomic<u16>, 4> s_coordinates{};
+
+template <typename Compare>
+void UpdateCoordinate(Coordinate coordinate, u16 value, Compare compare)
+{
+  std::atomic<u16>& current = s_coordinates[static_cast<u32>(coordinate)];
+  u16 old_value = current.load(std::memory_order_relaxed);
+  while (compare(value, old_value) &&
+         !current.compare_exchange_weak(old_value, value, std::memory_order_relaxed))
+  {
+  }
+}
 }  // Anonymous namespace
 
 u16 GetCoordinate(Coordinate coordinate)
 {
-  return s_coordinates[static_cast<u32>(coordinate)];
+  return s_coordinates[static_cast<u32>(coordinate)].load(std::memory_order_relaxed);
 }
 
 void SetCoordinate(Coordinate coordinate, u16 value)
 {
-  s_coordinates[static_cast<u32>(coordinate)] = value;
+  s_coordinates[static_cast<u32>(coordinate)].store(value, std::memory_order_relaxed);
 }
 
 void Update(u16 left, u16 right, u16 top, u16 bottom)
 {
-  const u16 new_left = std::min(left, GetCoordinate(Coordinate::Left));
-  const u16 new_right = std::max(right, GetCoordinate(Coordinate::Right));
-  const u16 new_top = std::min(top, GetCoordinate(Coordinate::Top));
-  const u16 new_bottom = std::max(bottom, GetCoordinate(Coordinate::Bottom));
-
-  SetCoordinate(Coordinate::Left, new_left);
-  SetCoordinate(Coordinate::Right, new_right);
-  SetCoordinate(Coordinate::Top, new_top);
-  SetCoordinate(Coordinate::Bottom, new_bottom);
+  UpdateCoordinate(Coordinate::Left, left, std::less<u16>());
+  UpdateCoordinate(Coordinate::Right, right, std::greater<u16>());
+  UpdateCoordinate(Coordinate::Top, top, std::less<u16>());
+  UpdateCoordinate(Coordinate::Bottom, bottom, std::greater<u16>());
 }
 
 }  // namespace BBoxManager
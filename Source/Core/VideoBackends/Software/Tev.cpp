@@ -23,6 +23,12 @@
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #ifdef _DEBUG
 #define ALLOW_TEV_DUMPS 1
 #else
@@ -87,6 +93,72 @@ void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
 
 void Tev::DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
 {
+  const u8 lshift = s_ScaleLShiftLUT[cc.scale];
+  const u8 rshift = s_ScaleRShiftLUT[cc.scale];
+  const s32 round = (cc.scale == TevScale::Divide2) ? 0 : (cc.op == TevOp::Sub) ? 127 : 128;
+  const s32 bias = s_BiasLUT[cc.bias];
+  const bool subtract = cc.op == TevOp::Sub;
+
+#if defined(_M_X86_64) || defined(_M_ARM_64)
+  // All three color channels use the same combiner settings, so they are evaluated together, one
+  // channel per lane. The layout matches TevColor (ABGR); the alpha lane is computed as well but
+  // is left untouched in the destination register.
+  s16 result[4];
+
+#if defined(_M_X86_64)
+  // SSE2 has no 32-bit multiply, but all of a, b and c fit in 16 bits, so a * (256 - c) + b * c
+  // is done with a single multiply-add of (a, b) and (256 - c, c) pairs.
+  const __m128i a = _mm_setr_epi32(0, inputs[BLU_C].a, inputs[GRN_C].a, inputs[RED_C].a);
+  const __m128i b = _mm_setr_epi32(0, inputs[BLU_C].b, inputs[GRN_C].b, inputs[RED_C].b);
+  const __m128i c = _mm_setr_epi32(0, inputs[BLU_C].c, inputs[GRN_C].c, inputs[RED_C].c);
+  const __m128i d = _mm_setr_epi32(0, inputs[BLU_C].d, inputs[GRN_C].d, inputs[RED_C].d);
+  const __m128i lshift_count = _mm_cvtsi32_si128(lshift);
+
+  const __m128i c_adj = _mm_add_epi32(c, _mm_srli_epi32(c, 7));
+  const __m128i ab = _mm_or_si128(a, _mm_slli_epi32(b, 16));
+  const __m128i weights =
+      _mm_or_si128(_mm_sub_epi32(_mm_set1_epi32(256), c_adj), _mm_slli_epi32(c_adj, 16));
+
+  __m128i temp = _mm_madd_epi16(ab, weights);
+  temp = _mm_sll_epi32(temp, lshift_count);
+  temp = _mm_srai_epi32(_mm_add_epi32(temp, _mm_set1_epi32(round)), 8);
+  if (subtract)
+    temp = _mm_sub_epi32(_mm_setzero_si128(), temp);
+
+  __m128i sum = _mm_sll_epi32(_mm_add_epi32(d, _mm_set1_epi32(bias)), lshift_count);
+  sum = _mm_sra_epi32(_mm_add_epi32(sum, temp), _mm_cvtsi32_si128(rshift));
+
+  // The results always fit in 16 bits, so saturating is the same as truncating here.
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(result), _mm_packs_epi32(sum, sum));
+#else
+  const s32 a_values[4] = {0, inputs[BLU_C].a, inputs[GRN_C].a, inputs[RED_C].a};
+  const s32 b_values[4] = {0, inputs[BLU_C].b, inputs[GRN_C].b, inputs[RED_C].b};
+  const s32 c_values[4] = {0, inputs[BLU_C].c, inputs[GRN_C].c, inputs[RED_C].c};
+  const s32 d_values[4] = {0, inputs[BLU_C].d, inputs[GRN_C].d, inputs[RED_C].d};
+  const int32x4_t a = vld1q_s32(a_values);
+  const int32x4_t b = vld1q_s32(b_values);
+  const int32x4_t c = vld1q_s32(c_values);
+  const int32x4_t d = vld1q_s32(d_values);
+
+  const int32x4_t c_adj = vaddq_s32(c, vshrq_n_s32(c, 7));
+
+  int32x4_t temp = vmulq_s32(a, vsubq_s32(vdupq_n_s32(256), c_adj));
+  temp = vmlaq_s32(temp, b, c_adj);
+  temp = vshlq_s32(temp, vdupq_n_s32(lshift));
+  temp = vshrq_n_s32(vaddq_s32(temp, vdupq_n_s32(round)), 8);
+  if (subtract)
+    temp = vnegq_s32(temp);
+
+  int32x4_t sum = vshlq_s32(vaddq_s32(d, vdupq_n_s32(bias)), vdupq_n_s32(lshift));
+  sum = vshlq_s32(vaddq_s32(sum, temp), vdupq_n_s32(-rshift));
+
+  vst1_s16(result, vmovn_s32(sum));
+#endif
+
+  Reg[cc.dest].b = result[BLU_C];
+  Reg[cc.dest].g = result[GRN_C];
+  Reg[cc.dest].r = result[RED_C];
+#else
   for (int i = BLU_C; i <= RED_C; i++)
   {
     const InputRegType& InputReg = inputs[i];
@@ -94,16 +166,17 @@ void Tev::DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const Inpu
     const u16 c = InputReg.c + (InputReg.c >> 7);
 
     s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
-    temp <<= s_ScaleLShiftLUT[cc.scale];
-    temp += (cc.scale == TevScale::Divide2) ? 0 : (cc.op == TevOp::Sub) ? 127 : 128;
+    temp <<= lshift;
+    temp += round;
     temp >>= 8;
-    temp = cc.op == TevOp::Sub ? -temp : temp;
+    temp = subtract ? -temp : temp;
 
-    s32 result = ((InputReg.d + s_BiasLUT[cc.bias]) << s_ScaleLShiftLUT[cc.scale]) + temp;
-    result = result >> s_ScaleRShiftLUT[cc.scale];
+    s32 result = ((InputReg.d + bias) << lshift) + temp;
+    result = result >> rshift;
 
     Reg[cc.dest][i] = result;
   }
+#endif
 }
 
 void Tev::DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
@@ -397,7 +470,7 @@ void Tev::Draw()
   ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
   ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_in);
+  INCSTAT(TevPixelsIn);
 
   auto& system = Core::System::GetInstance();
   auto& pixel_shader_manager = system.GetPixelShaderManager();
@@ -679,7 +752,7 @@ void Tev::Draw()
   BBoxManager::Update(static_cast<u16>(Position[0] & ~1), static_cast<u16>(Position[0] | 1),
                       static_cast<u16>(Position[1] & ~1), static_cast<u16>(Position[1] | 1));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_out);
+  INCSTAT(TevPixelsOut);
   EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
 
   EfbInterface::BlendTev(Position[0], Position[1], output);
@@ -221,6 +221,10 @@ public:
   s32 TextureLod[16]{};
   bool TextureLinear[16]{};
 
+  // Pixel statistics, collected per Tev so that several threads can draw at once.
+  int TevPixelsIn = 0;
+  int TevPixelsOut = 0;
+
   enum
   {
     ALP_C,
@@ -15,6 +15,10 @@
 
 namespace Vulkan
 {
+static constexpr VkCommandBufferBeginInfo COMMAND_BUFFER_BEGIN_INFO = {
+    VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO, nullptr,
+    VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, nullptr};
+
 CommandBufferManager::CommandBufferManager(bool use_threaded_submission)
     : m_use_threaded_submission(use_threaded_submission)
 {
@@ -222,6 +226,7 @@ VkDescriptorSet CommandBufferManager::AllocateDescriptorSet(VkDescriptorSetLayou
 bool CommandBufferManager::CreateSubmitThread()
 {
   m_submit_thread.Reset("VK submission thread", [this](PendingCommandBufferSubmit submit) {
+    EndCommandBuffers(submit.command_buffer_index);
     SubmitCommandBuffer(submit.command_buffer_index, submit.present_swap_chain,
                         submit.present_image_index);
     CmdBufferResources& resources = m_command_buffers[submit.command_buffer_index];
@@ -304,18 +309,7 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
                                                VkSwapchainKHR present_swap_chain,
                                                uint32_t present_image_index)
 {
-  // End the current command buffer.
   CmdBufferResources& resources = GetCurrentCmdBufferResources();
-  for (VkCommandBuffer command_buffer : resources.command_buffers)
-  {
-    VkResult res = vkEndCommandBuffer(command_buffer);
-    if (res != VK_SUCCESS)
-    {
-      LOG_VULKAN_ERROR(res, "vkEndCommandBuffer failed: ");
-      PanicAlertFmt("Failed to end command buffer: {} ({})", VkResultToString(res),
-                    static_cast<int>(res));
-    }
-  }
 
   // Submitting off-thread?
   if (m_use_threaded_submission && submit_on_worker_thread && !wait_for_completion)
@@ -329,6 +323,7 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
     WaitForWorkerThreadIdle();
 
     // Pass through to normal submission path.
+    EndCommandBuffers(m_current_cmd_buffer);
     SubmitCommandBuffer(m_current_cmd_buffer, present_swap_chain, present_image_index);
     if (wait_for_completion)
       WaitForCommandBufferCompletion(m_current_cmd_buffer);
@@ -483,15 +478,11 @@ void CommandBufferManager::BeginCommandBuffer()
   if (res != VK_SUCCESS)
     LOG_VULKAN_ERROR(res, "vkResetCommandPool failed: ");
 
-  // Enable commands to be recorded to the two buffers again.
-  VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO, nullptr,
-                                         VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, nullptr};
-  for (VkCommandBuffer command_buffer : resources.command_buffers)
-  {
-    res = vkBeginCommandBuffer(command_buffer, &begin_info);
-    if (res != VK_SUCCESS)
-      LOG_VULKAN_ERROR(res, "vkBeginCommandBuffer failed: ");
-  }
+  // Enable commands to be recorded to the draw buffer again. Most command buffers never use the
+  // init buffer, so it is only started when something is recorded to it.
+  res = vkBeginCommandBuffer(resources.command_buffers[1], &COMMAND_BUFFER_BEGIN_INFO);
+  if (res != VK_SUCCESS)
+    LOG_VULKAN_ERROR(res, "vkBeginCommandBuffer failed: ");
 
   // Reset upload command buffer state
   resources.init_command_buffer_used = false;
@@ -501,6 +492,33 @@ void CommandBufferManager::BeginCommandBuffer()
   m_current_cmd_buffer = next_buffer_index;
 }
 
+void CommandBufferManager::BeginInitCommandBuffer()
+{
+  CmdBufferResources& resources = GetCurrentCmdBufferResources();
+  VkResult res = vkBeginCommandBuffer(resources.command_buffers[0], &COMMAND_BUFFER_BEGIN_INFO);
+  if (res != VK_SUCCESS)
+    LOG_VULKAN_ERROR(res, "vkBeginCommandBuffer failed: ");
+
+  resources.init_command_buffer_used = true;
+}
+
+void CommandBufferManager::EndCommandBuffers(u32 command_buffer_index)
+{
+  // This may be executed on the worker thread, so don't modify any state of the manager class.
+  CmdBufferResources& resources = m_command_buffers[command_buffer_index];
+  for (size_t i = resources.init_command_buffer_used ? 0 : 1; i < resources.command_buffers.size();
+       i++)
+  {
+    VkResult res = vkEndCommandBuffer(resources.command_buffers[i]);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkEndCommandBuffer failed: ");
+      PanicAlertFmt("Failed to end command buffer: {} ({})", VkResultToString(res),
+                    static_cast<int>(res));
+    }
+  }
+}
+
 void CommandBufferManager::DeferBufferViewDestruction(VkBufferView object)
 {
   CmdBufferResources& cmd_buffer_resources = GetCurrentCmdBufferResources();
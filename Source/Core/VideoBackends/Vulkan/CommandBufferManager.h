@@ -36,7 +36,8 @@ public:
   VkCommandBuffer GetCurrentInitCommandBuffer()
   {
     CmdBufferResources& cmd_buffer_resources = GetCurrentCmdBufferResources();
-    cmd_buffer_resources.init_command_buffer_used = true;
+    if (!cmd_buffer_resources.init_command_buffer_used)
+      BeginInitCommandBuffer();
     return cmd_buffer_resources.command_buffers[0];
   }
   VkCommandBuffer GetCurrentCommandBuffer() const
@@ -104,6 +105,11 @@ private:
   void SubmitCommandBuffer(u32 command_buffer_index, VkSwapchainKHR present_swap_chain,
                            u32 present_image_index);
   void BeginCommandBuffer();
+  void BeginInitCommandBuffer();
+
+  // Ends recording of the command buffers which were used. With threaded submission, this is done
+  // on the worker thread, as some drivers do a noticeable amount of work here.
+  void EndCommandBuffers(u32 command_buffer_index);
 
   VkDescriptorPool CreateDescriptorPool(u32 descriptor_sizes);
 
@@ -93,4 +93,9 @@ constexpr u32 TEXTURE_UPLOAD_BUFFER_SIZE = 32 * 1024 * 1024;
 // large anyway, so it's only really an issue for HD texture packs, and memory is not
 // a limiting factor in these scenarios anyway.
 constexpr u32 STAGING_TEXTURE_UPLOAD_THRESHOLD = 1024 * 1024 * 4;
+
+// Sampled textures up to this size are sub-allocated from a dedicated pool with blocks of the
+// given size, see VulkanContext::CreateAllocator().
+constexpr u32 SMALL_TEXTURE_MAX_SIZE = 1024 * 1024;
+constexpr u32 SMALL_TEXTURE_POOL_BLOCK_SIZE = 16 * 1024 * 1024;
 }  // namespace Vulkan
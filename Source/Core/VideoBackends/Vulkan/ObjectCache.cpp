@@ -32,6 +32,7 @@ ObjectCache::ObjectCache() = default;
 
 ObjectCache::~ObjectCache()
 {
+  DestroyPipelineLibraryCache();
   DestroyPipelineCache();
   DestroySamplers();
   DestroyPipelineLayouts();
@@ -216,6 +217,17 @@ bool ObjectCache::CreateDescriptorSetLayouts()
     create_infos[DESCRIPTOR_SET_LAYOUT_STANDARD_UNIFORM_BUFFERS].bindingCount--;
   }
 
+  // Sampler bindings change far more often than anything else, so push them directly into the
+  // command buffer when we can. Push descriptor sets can't contain dynamic buffers, and a pipeline
+  // layout can only contain one of them, so the sampler sets are the only candidates.
+  if (g_vulkan_context->SupportsPushDescriptors())
+  {
+    create_infos[DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS].flags |=
+        VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+    create_infos[DESCRIPTOR_SET_LAYOUT_UTILITY_SAMPLERS].flags |=
+        VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+  }
+
   // Remove the dynamic vertex loader's buffer if it'll never be needed
   if (!g_ActiveConfig.backend_info.bSupportsDynamicVertexLoader)
     create_infos[DESCRIPTOR_SET_LAYOUT_STANDARD_SHADER_STORAGE_BUFFERS].bindingCount--;
@@ -507,6 +519,42 @@ void ObjectCache::DestroyRenderPassCache()
   m_render_pass_cache.clear();
 }
 
+VkPipeline ObjectCache::GetPipelineLibrary(const PipelineLibraryKey& key)
+{
+  std::lock_guard guard(m_pipeline_library_mutex);
+  auto it = m_pipeline_library_cache.find(key);
+  return it != m_pipeline_library_cache.end() ? it->second : VK_NULL_HANDLE;
+}
+
+VkPipeline ObjectCache::AddPipelineLibrary(const PipelineLibraryKey& key, VkPipeline library)
+{
+  std::lock_guard guard(m_pipeline_library_mutex);
+  auto [it, inserted] = m_pipeline_library_cache.emplace(key, library);
+  if (!inserted)
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), library, nullptr);
+
+  return it->second;
+}
+
+void ObjectCache::ClearPipelineLibraries(VkShaderModule module)
+{
+  std::lock_guard guard(m_pipeline_library_mutex);
+  std::erase_if(m_pipeline_library_cache, [module](const auto& it) {
+    if (std::get<1>(it.first) != module && std::get<2>(it.first) != module)
+      return false;
+
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), it.second, nullptr);
+    return true;
+  });
+}
+
+void ObjectCache::DestroyPipelineLibraryCache()
+{
+  for (auto& it : m_pipeline_library_cache)
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), it.second, nullptr);
+  m_pipeline_library_cache.clear();
+}
+
 class PipelineCacheReadCallback : public Common::LinearDiskCacheReader<u32, u8>
 {
 public:
@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -65,6 +66,16 @@ public:
   // Pipeline cache. Used when creating pipelines for drivers to store compiled programs.
   VkPipelineCache GetPipelineCache() const { return m_pipeline_cache; }
 
+  // Graphics pipeline library cache. Keyed by the part of the pipeline, the shader modules, and
+  // the packed render states which go into that part. Safe to call from multiple threads.
+  using PipelineLibraryKey = std::tuple<u32, VkShaderModule, VkShaderModule, u32, u32, const void*>;
+  VkPipeline GetPipelineLibrary(const PipelineLibraryKey& key);
+  // Takes ownership of the library. If another thread got there first, the existing library is
+  // returned and the new one is destroyed.
+  VkPipeline AddPipelineLibrary(const PipelineLibraryKey& key, VkPipeline library);
+  // Destroys all libraries built from the module. Call before the module itself is destroyed.
+  void ClearPipelineLibraries(VkShaderModule module);
+
   // Clear sampler cache, use when anisotropy mode changes
   // WARNING: Ensure none of the objects from here are in use when calling
   void ClearSamplerCache();
@@ -83,6 +94,7 @@ private:
   bool CreateStaticSamplers();
   void DestroySamplers();
   void DestroyRenderPassCache();
+  void DestroyPipelineLibraryCache();
   bool CreatePipelineCache();
   bool LoadPipelineCache();
   bool ValidatePipelineCache(const u8* data, size_t data_length);
@@ -105,6 +117,10 @@ private:
   using RenderPassCacheKey = std::tuple<VkFormat, VkFormat, u32, VkAttachmentLoadOp, std::size_t>;
   std::map<RenderPassCacheKey, VkRenderPass> m_render_pass_cache;
 
+  // Pipeline library cache
+  std::map<PipelineLibraryKey, VkPipeline> m_pipeline_library_cache;
+  std::mutex m_pipeline_library_mutex;
+
   // pipeline cache
   VkPipelineCache m_pipeline_cache = VK_NULL_HANDLE;
   std::string m_pipeline_cache_filename;
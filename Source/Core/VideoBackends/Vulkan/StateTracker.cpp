@@ -146,7 +146,13 @@ void StateTracker::SetPipeline(const VKPipeline* pipeline)
   m_pipeline = pipeline;
   m_dirty_flags |= DIRTY_FLAG_PIPELINE;
   if (new_usage)
+  {
     m_dirty_flags |= DIRTY_FLAG_DESCRIPTOR_SETS;
+
+    // Pushed descriptors are lost when the layout changes, so they have to be written again.
+    if (g_vulkan_context->SupportsPushDescriptors())
+      m_dirty_flags |= DIRTY_FLAG_GX_SAMPLERS | DIRTY_FLAG_UTILITY_BINDINGS;
+  }
 }
 
 void StateTracker::SetComputeShader(const VKShader* shader)
@@ -483,6 +489,7 @@ void StateTracker::UpdateGXDescriptorSet()
 
   const bool needs_gs_ubo = g_ActiveConfig.backend_info.bSupportsGeometryShaders ||
                             g_ActiveConfig.UseVSForLinePointExpand();
+  const bool push_samplers = g_vulkan_context->SupportsPushDescriptors();
 
   if (m_dirty_flags & DIRTY_FLAG_GX_UBOS || m_gx_descriptor_sets[0] == VK_NULL_HANDLE)
   {
@@ -517,7 +524,27 @@ void StateTracker::UpdateGXDescriptorSet()
     m_dirty_flags = (m_dirty_flags & ~DIRTY_FLAG_GX_UBOS) | DIRTY_FLAG_DESCRIPTOR_SETS;
   }
 
-  if (m_dirty_flags & DIRTY_FLAG_GX_SAMPLERS || m_gx_descriptor_sets[1] == VK_NULL_HANDLE)
+  if (push_samplers)
+  {
+    if (m_dirty_flags & DIRTY_FLAG_GX_SAMPLERS)
+    {
+      const VkWriteDescriptorSet write = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                                          nullptr,
+                                          VK_NULL_HANDLE,
+                                          0,
+                                          0,
+                                          static_cast<u32>(VideoCommon::MAX_PIXEL_SHADER_SAMPLERS),
+                                          VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                          m_bindings.samplers.data(),
+                                          nullptr,
+                                          nullptr};
+      vkCmdPushDescriptorSetKHR(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                                VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(),
+                                1, 1, &write);
+      m_dirty_flags &= ~DIRTY_FLAG_GX_SAMPLERS;
+    }
+  }
+  else if (m_dirty_flags & DIRTY_FLAG_GX_SAMPLERS || m_gx_descriptor_sets[1] == VK_NULL_HANDLE)
   {
     m_gx_descriptor_sets[1] = g_command_buffer_mgr->AllocateDescriptorSet(
         g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS));
@@ -573,7 +600,23 @@ void StateTracker::UpdateGXDescriptorSet()
   if (num_writes > 0)
     vkUpdateDescriptorSets(g_vulkan_context->GetDevice(), num_writes, writes.data(), 0, nullptr);
 
-  if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS)
+  if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS && push_samplers)
+  {
+    // The sampler set sits between the UBO and SSBO sets, and is pushed rather than bound.
+    vkCmdBindDescriptorSets(
+        g_command_buffer_mgr->GetCurrentCommandBuffer(), VK_PIPELINE_BIND_POINT_GRAPHICS,
+        m_pipeline->GetVkPipelineLayout(), 0, 1, m_gx_descriptor_sets.data(),
+        needs_gs_ubo ? NUM_UBO_DESCRIPTOR_SET_BINDINGS : (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1),
+        m_bindings.gx_ubo_offsets.data());
+    if (needs_ssbo)
+    {
+      vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                              VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 2,
+                              1, &m_gx_descriptor_sets[2], 0, nullptr);
+    }
+    m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_GX_UBO_OFFSETS);
+  }
+  else if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS)
   {
     vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
                             VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
@@ -600,6 +643,7 @@ void StateTracker::UpdateUtilityDescriptorSet()
   // Max number of updates - UBO, Samplers, TexelBuffer
   std::array<VkWriteDescriptorSet, 3> dswrites;
   u32 writes = 0;
+  const bool push_samplers = g_vulkan_context->SupportsPushDescriptors();
 
   // Allocate descriptor sets.
   if (m_dirty_flags & DIRTY_FLAG_UTILITY_UBO || m_utility_descriptor_sets[0] == VK_NULL_HANDLE)
@@ -621,7 +665,26 @@ void StateTracker::UpdateUtilityDescriptorSet()
     m_dirty_flags = (m_dirty_flags & ~DIRTY_FLAG_UTILITY_UBO) | DIRTY_FLAG_DESCRIPTOR_SETS;
   }
 
-  if (m_dirty_flags & DIRTY_FLAG_UTILITY_BINDINGS || m_utility_descriptor_sets[1] == VK_NULL_HANDLE)
+  if (push_samplers)
+  {
+    if (m_dirty_flags & DIRTY_FLAG_UTILITY_BINDINGS)
+    {
+      const std::array<VkWriteDescriptorSet, 2> push_writes{{
+          {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, nullptr, VK_NULL_HANDLE, 0, 0,
+           NUM_UTILITY_PIXEL_SAMPLERS, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+           m_bindings.samplers.data(), nullptr, nullptr},
+          {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, nullptr, VK_NULL_HANDLE, 8, 0, 1,
+           VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, nullptr, nullptr,
+           m_bindings.texel_buffers.data()},
+      }};
+      vkCmdPushDescriptorSetKHR(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                                VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(),
+                                1, static_cast<u32>(push_writes.size()), push_writes.data());
+      m_dirty_flags &= ~DIRTY_FLAG_UTILITY_BINDINGS;
+    }
+  }
+  else if (m_dirty_flags & DIRTY_FLAG_UTILITY_BINDINGS ||
+           m_utility_descriptor_sets[1] == VK_NULL_HANDLE)
   {
     m_utility_descriptor_sets[1] = g_command_buffer_mgr->AllocateDescriptorSet(
         g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_UTILITY_SAMPLERS));
@@ -655,10 +718,11 @@ void StateTracker::UpdateUtilityDescriptorSet()
 
   if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS)
   {
+    // The pushed sampler set doesn't need to be bound.
     vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
                             VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            NUM_UTILITY_DESCRIPTOR_SETS, m_utility_descriptor_sets.data(), 1,
-                            &m_bindings.utility_ubo_offset);
+                            push_samplers ? 1 : NUM_UTILITY_DESCRIPTOR_SETS,
+                            m_utility_descriptor_sets.data(), 1, &m_bindings.utility_ubo_offset);
     m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_UTILITY_UBO_OFFSET);
   }
   else if (m_dirty_flags & DIRTY_FLAG_UTILITY_UBO_OFFSET)
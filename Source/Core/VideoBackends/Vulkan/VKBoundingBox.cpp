@@ -37,7 +37,7 @@ bool VKBoundingBox::Initialize()
   return true;
 }
 
-std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
+void VKBoundingBox::CopyToReadbackBuffer()
 {
   // Can't be done within a render pass.
   StateTracker::GetInstance()->EndRenderPass();
@@ -63,6 +63,11 @@ std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
       VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
   m_readback_buffer->FlushGPUCache(g_command_buffer_mgr->GetCurrentCommandBuffer(),
                                    VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+}
+
+std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
+{
+  CopyToReadbackBuffer();
 
   // Wait until these commands complete.
   VKGfx::GetInstance()->ExecuteCommandBuffer(false, true);
@@ -77,6 +82,26 @@ std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
   return values;
 }
 
+bool VKBoundingBox::QueueRead()
+{
+  // The copy is submitted along with the rest of the current command buffer.
+  CopyToReadbackBuffer();
+  m_queued_read_fence_counter = g_command_buffer_mgr->GetCurrentFenceCounter();
+  return true;
+}
+
+std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> VKBoundingBox::PollRead()
+{
+  if (g_command_buffer_mgr->GetCompletedFenceCounter() < m_queued_read_fence_counter)
+    return std::nullopt;
+
+  // A synchronous read since then may have overwritten the buffer, but only with newer values.
+  m_readback_buffer->InvalidateCPUCache();
+  std::array<BBoxType, NUM_BBOX_VALUES> values;
+  m_readback_buffer->Read(0, values.data(), BUFFER_SIZE, false);
+  return values;
+}
+
 void VKBoundingBox::Write(u32 index, std::span<const BBoxType> values)
 {
   // We can't issue vkCmdUpdateBuffer within a render pass.
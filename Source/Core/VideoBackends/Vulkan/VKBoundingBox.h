@@ -27,10 +27,13 @@ public:
 protected:
   std::vector<BBoxType> Read(u32 index, u32 length) override;
   void Write(u32 index, std::span<const BBoxType> values) override;
+  bool QueueRead() override;
+  std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> PollRead() override;
 
 private:
   bool CreateGPUBuffer();
   bool CreateReadbackBuffer();
+  void CopyToReadbackBuffer();
 
   VkBuffer m_gpu_buffer = VK_NULL_HANDLE;
   VmaAllocation m_gpu_allocation = VK_NULL_HANDLE;
@@ -38,6 +41,9 @@ private:
   static constexpr size_t BUFFER_SIZE = sizeof(BBoxType) * NUM_BBOX_VALUES;
 
   std::unique_ptr<StagingBuffer> m_readback_buffer;
+
+  // Fence counter of the command buffer containing the last queued asynchronous copy.
+  u64 m_queued_read_fence_counter = 0;
 };
 
 }  // namespace Vulkan
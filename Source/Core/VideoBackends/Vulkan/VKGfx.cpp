@@ -19,6 +19,7 @@
 #include "VideoBackends/Vulkan/CommandBufferManager.h"
 #include "VideoBackends/Vulkan/ObjectCache.h"
 #include "VideoBackends/Vulkan/StateTracker.h"
+#include "VideoBackends/Vulkan/VKPerfQuery.h"
 #include "VideoBackends/Vulkan/VKPipeline.h"
 #include "VideoBackends/Vulkan/VKShader.h"
 #include "VideoBackends/Vulkan/VKSwapChain.h"
@@ -303,6 +304,10 @@ void VKGfx::PresentBackbuffer()
   // End drawing to backbuffer
   StateTracker::GetInstance()->EndRenderPass();
 
+  // Copy this command buffer's query results out with it, see PerfQuery::ResolveQueries.
+  if (PerfQuery* perf_query = PerfQuery::GetInstance())
+    perf_query->ResolveQueries();
+
   // Transition the backbuffer to PRESENT_SRC to ensure all commands drawing
   // to it have finished before present.
   m_swap_chain->GetCurrentTexture()->TransitionToLayout(
@@ -336,6 +341,9 @@ void VKGfx::ExecuteCommandBuffer(bool submit_off_thread, bool wait_for_completio
 {
   StateTracker::GetInstance()->EndRenderPass();
 
+  if (PerfQuery* perf_query = PerfQuery::GetInstance())
+    perf_query->ResolveQueries();
+
   g_command_buffer_mgr->SubmitCommandBuffer(submit_off_thread, wait_for_completion);
 
   StateTracker::GetInstance()->InvalidateCachedState();
@@ -12,6 +12,7 @@
 #include "Common/MsgHandler.h"
 
 #include "VideoBackends/Vulkan/CommandBufferManager.h"
+#include "VideoBackends/Vulkan/StagingBuffer.h"
 #include "VideoBackends/Vulkan/StateTracker.h"
 #include "VideoBackends/Vulkan/VKGfx.h"
 #include "VideoBackends/Vulkan/VulkanContext.h"
@@ -37,6 +38,12 @@ bool PerfQuery::Initialize()
     return false;
   }
 
+  if (!CreateReadbackBuffer())
+  {
+    PanicAlertFmt("Failed to create query readback buffer");
+    return false;
+  }
+
   // Vulkan requires query pools to be reset after creation
   ResetQuery();
 
@@ -49,7 +56,11 @@ void PerfQuery::EnableQuery(PerfQueryGroup group)
   // Otherwise, try to keep half of them available.
   const u32 query_count = m_query_count.load(std::memory_order_relaxed);
   if (query_count > m_query_buffer.size() / 2)
-    PartialFlush(query_count == PERF_QUERY_BUFFER_SIZE);
+  {
+    const bool do_resolve = m_unresolved_queries > m_query_buffer.size() / 2;
+    const bool blocking = query_count == PERF_QUERY_BUFFER_SIZE;
+    PartialFlush(do_resolve, blocking);
+  }
 
   // Ensure command buffer is ready to go before beginning the query, that way we don't submit
   // a buffer with open queries.
@@ -58,7 +69,7 @@ void PerfQuery::EnableQuery(PerfQueryGroup group)
   if (group == PQG_ZCOMP_ZCOMPLOC || group == PQG_ZCOMP)
   {
     ActiveQuery& entry = m_query_buffer[m_query_next_pos];
-    DEBUG_ASSERT(!entry.has_value);
+    DEBUG_ASSERT(!entry.has_value && !entry.resolved);
     entry.has_value = true;
     entry.query_group = group;
 
@@ -78,17 +89,17 @@ void PerfQuery::DisableQuery(PerfQueryGroup group)
   if (group == PQG_ZCOMP_ZCOMPLOC || group == PQG_ZCOMP)
   {
     vkCmdEndQuery(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool, m_query_next_pos);
-    ActiveQuery& entry = m_query_buffer[m_query_next_pos];
-    entry.fence_counter = g_command_buffer_mgr->GetCurrentFenceCounter();
-
     m_query_next_pos = (m_query_next_pos + 1) % PERF_QUERY_BUFFER_SIZE;
     m_query_count.fetch_add(1, std::memory_order_relaxed);
+    m_unresolved_queries++;
   }
 }
 
 void PerfQuery::ResetQuery()
 {
   m_query_count.store(0, std::memory_order_relaxed);
+  m_unresolved_queries = 0;
+  m_query_resolve_pos = 0;
   m_query_readback_pos = 0;
   m_query_next_pos = 0;
   for (size_t i = 0; i < m_results.size(); ++i)
@@ -129,11 +140,16 @@ u32 PerfQuery::GetQueryResult(PerfQueryType type)
 void PerfQuery::FlushResults()
 {
   if (!IsFlushed())
-    PartialFlush(true);
+    PartialFlush(true, true);
 
   ASSERT(IsFlushed());
 }
 
+void PerfQuery::PollResults()
+{
+  ReadbackQueries(false);
+}
+
 bool PerfQuery::IsFlushed() const
 {
   return m_query_count.load(std::memory_order_relaxed) == 0;
@@ -160,24 +176,87 @@ bool PerfQuery::CreateQueryPool()
   return true;
 }
 
-void PerfQuery::ReadbackQueries()
+bool PerfQuery::CreateReadbackBuffer()
+{
+  m_readback_buffer = StagingBuffer::Create(STAGING_BUFFER_TYPE_READBACK,
+                                            PERF_QUERY_BUFFER_SIZE * sizeof(PerfQueryDataType),
+                                            VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+  return m_readback_buffer && m_readback_buffer->Map();
+}
+
+void PerfQuery::ResolveQueries()
+{
+  if (m_unresolved_queries == 0)
+    return;
+
+  // Do we need to split the resolve as it's wrapping around?
+  if ((m_query_resolve_pos + m_unresolved_queries) > PERF_QUERY_BUFFER_SIZE)
+    ResolveQueries(PERF_QUERY_BUFFER_SIZE - m_query_resolve_pos);
+
+  ResolveQueries(m_unresolved_queries);
+}
+
+void PerfQuery::ResolveQueries(u32 query_count)
 {
-  const u64 completed_fence_counter = g_command_buffer_mgr->GetCompletedFenceCounter();
+  DEBUG_ASSERT(m_unresolved_queries >= query_count &&
+               (m_query_resolve_pos + query_count) <= PERF_QUERY_BUFFER_SIZE);
 
-  // Need to save these since ProcessResults will modify them.
+  // Copy the results to the readback buffer. The queries can be reset right away, the copy is
+  // ordered before the reset.
+  StateTracker::GetInstance()->EndRenderPass();
+  const VkCommandBuffer command_buffer = g_command_buffer_mgr->GetCurrentCommandBuffer();
+  m_readback_buffer->PrepareForGPUWrite(command_buffer, VK_ACCESS_TRANSFER_WRITE_BIT,
+                                        VK_PIPELINE_STAGE_TRANSFER_BIT);
+  vkCmdCopyQueryPoolResults(command_buffer, m_query_pool, m_query_resolve_pos, query_count,
+                            m_readback_buffer->GetBuffer(),
+                            m_query_resolve_pos * sizeof(PerfQueryDataType),
+                            sizeof(PerfQueryDataType), VK_QUERY_RESULT_WAIT_BIT);
+  vkCmdResetQueryPool(command_buffer, m_query_pool, m_query_resolve_pos, query_count);
+  m_readback_buffer->FlushGPUCache(command_buffer, VK_ACCESS_TRANSFER_WRITE_BIT,
+                                   VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+  // Flag all queries as available, but with a fence that has to be completed first
+  for (u32 i = 0; i < query_count; i++)
+  {
+    ActiveQuery& entry = m_query_buffer[m_query_resolve_pos + i];
+    DEBUG_ASSERT(entry.has_value && !entry.resolved);
+    entry.fence_counter = g_command_buffer_mgr->GetCurrentFenceCounter();
+    entry.resolved = true;
+  }
+  m_query_resolve_pos = (m_query_resolve_pos + query_count) % PERF_QUERY_BUFFER_SIZE;
+  m_unresolved_queries -= query_count;
+}
+
+void PerfQuery::ReadbackQueries(bool blocking)
+{
+  u64 completed_fence_counter = g_command_buffer_mgr->GetCompletedFenceCounter();
+
+  // Need to save these since AccumulateQueriesFromBuffer will modify them.
   const u32 outstanding_queries = m_query_count.load(std::memory_order_relaxed);
   u32 readback_count = 0;
   for (u32 i = 0; i < outstanding_queries; i++)
   {
     u32 index = (m_query_readback_pos + readback_count) % PERF_QUERY_BUFFER_SIZE;
     const ActiveQuery& entry = m_query_buffer[index];
-    if (entry.fence_counter > completed_fence_counter)
+    if (!entry.resolved)
       break;
 
+    if (entry.fence_counter > completed_fence_counter)
+    {
+      // Query result isn't ready yet. Wait if blocking, otherwise we can't do any more yet.
+      if (!blocking)
+        break;
+
+      ASSERT(entry.fence_counter != g_command_buffer_mgr->GetCurrentFenceCounter());
+      g_command_buffer_mgr->WaitForFenceCounter(entry.fence_counter);
+      completed_fence_counter = g_command_buffer_mgr->GetCompletedFenceCounter();
+    }
+
     // If this wrapped around, we need to flush the entries before the end of the buffer.
     if (index < m_query_readback_pos)
     {
-      ReadbackQueries(readback_count);
+      AccumulateQueriesFromBuffer(readback_count);
       DEBUG_ASSERT(m_query_readback_pos == 0);
       readback_count = 0;
     }
@@ -186,26 +265,17 @@ void PerfQuery::ReadbackQueries()
   }
 
   if (readback_count > 0)
-    ReadbackQueries(readback_count);
+    AccumulateQueriesFromBuffer(readback_count);
 }
 
-void PerfQuery::ReadbackQueries(u32 query_count)
+void PerfQuery::AccumulateQueriesFromBuffer(u32 query_count)
 {
   // Should be at maximum query_count queries pending.
   ASSERT(query_count <= m_query_count.load(std::memory_order_relaxed) &&
          (m_query_readback_pos + query_count) <= PERF_QUERY_BUFFER_SIZE);
 
-  // Read back from the GPU.
-  VkResult res = vkGetQueryPoolResults(
-      g_vulkan_context->GetDevice(), m_query_pool, m_query_readback_pos, query_count,
-      query_count * sizeof(PerfQueryDataType), m_query_result_buffer.data(),
-      sizeof(PerfQueryDataType), VK_QUERY_RESULT_WAIT_BIT);
-  if (res != VK_SUCCESS)
-    LOG_VULKAN_ERROR(res, "vkGetQueryPoolResults failed: ");
-
-  StateTracker::GetInstance()->EndRenderPass();
-  vkCmdResetQueryPool(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool,
-                      m_query_readback_pos, query_count);
+  m_readback_buffer->InvalidateCPUCache(m_query_readback_pos * sizeof(PerfQueryDataType),
+                                        query_count * sizeof(PerfQueryDataType));
 
   // Remove pending queries.
   for (u32 i = 0; i < query_count; i++)
@@ -216,10 +286,15 @@ void PerfQuery::ReadbackQueries(u32 query_count)
     // Should have a fence associated with it (waiting for a result).
     DEBUG_ASSERT(entry.fence_counter != 0);
     entry.fence_counter = 0;
+    entry.resolved = false;
     entry.has_value = false;
 
+    PerfQueryDataType result;
+    std::memcpy(&result, m_readback_buffer->GetMapPointer() + index * sizeof(PerfQueryDataType),
+                sizeof(result));
+
     // NOTE: Reported pixel metrics should be referenced to native resolution
-    u64 native_res_result = static_cast<u64>(m_query_result_buffer[i]) * EFB_WIDTH /
+    u64 native_res_result = static_cast<u64>(result) * EFB_WIDTH /
                             g_framebuffer_manager->GetEFBWidth() * EFB_HEIGHT /
                             g_framebuffer_manager->GetEFBHeight();
     if (g_ActiveConfig.iMultisamples > 1)
@@ -232,15 +307,12 @@ void PerfQuery::ReadbackQueries(u32 query_count)
   m_query_count.fetch_sub(query_count, std::memory_order_relaxed);
 }
 
-void PerfQuery::PartialFlush(bool blocking)
+void PerfQuery::PartialFlush(bool resolve, bool blocking)
 {
-  // Submit a command buffer in the background if the front query is not bound to one.
-  if (blocking || m_query_buffer[m_query_readback_pos].fence_counter ==
-                      g_command_buffer_mgr->GetCurrentFenceCounter())
-  {
-    VKGfx::GetInstance()->ExecuteCommandBuffer(true, blocking);
-  }
+  // Submit a command buffer if there are unresolved queries (to write them to the buffer).
+  if (resolve && m_unresolved_queries > 0)
+    VKGfx::GetInstance()->ExecuteCommandBuffer(true, false);
 
-  ReadbackQueries();
+  ReadbackQueries(blocking);
 }
 }  // namespace Vulkan
@@ -12,6 +12,8 @@
 
 namespace Vulkan
 {
+class StagingBuffer;
+
 class PerfQuery : public PerfQueryBase
 {
 public:
@@ -21,12 +23,14 @@ public:
   static PerfQuery* GetInstance() { return static_cast<PerfQuery*>(g_perf_query.get()); }
 
   bool Initialize() override;
+  void ResolveQueries();
 
   void EnableQuery(PerfQueryGroup group) override;
   void DisableQuery(PerfQueryGroup group) override;
   void ResetQuery() override;
   u32 GetQueryResult(PerfQueryType type) override;
   void FlushResults() override;
+  void PollResults() override;
   bool IsFlushed() const override;
 
 private:
@@ -34,26 +38,34 @@ private:
   using PerfQueryDataType = u32;
 
   // when testing in SMS: 64 was too small, 128 was ok
+  // Sized to hold a few frames of queries, so that results can be polled without blocking.
   // TODO: This should be size_t, but the base class uses u32s
-  static const u32 PERF_QUERY_BUFFER_SIZE = 512;
+  static const u32 PERF_QUERY_BUFFER_SIZE = 2048;
 
   struct ActiveQuery
   {
     u64 fence_counter;
     PerfQueryGroup query_group;
     bool has_value;
+    bool resolved;
   };
 
   bool CreateQueryPool();
-  void ReadbackQueries();
-  void ReadbackQueries(u32 query_count);
-  void PartialFlush(bool blocking);
+  bool CreateReadbackBuffer();
+  void ResolveQueries(u32 query_count);
+  void ReadbackQueries(bool blocking);
+  void AccumulateQueriesFromBuffer(u32 query_count);
+  void PartialFlush(bool resolve, bool blocking);
 
   VkQueryPool m_query_pool = VK_NULL_HANDLE;
+  u32 m_unresolved_queries = 0;
+  u32 m_query_resolve_pos = 0;
   u32 m_query_readback_pos = 0;
   u32 m_query_next_pos = 0;
   std::array<ActiveQuery, PERF_QUERY_BUFFER_SIZE> m_query_buffer = {};
-  std::array<PerfQueryDataType, PERF_QUERY_BUFFER_SIZE> m_query_result_buffer = {};
+
+  // Results are copied here in one batch per command buffer, see ResolveQueries.
+  std::unique_ptr<StagingBuffer> m_readback_buffer;
 };
 
 }  // namespace Vulkan
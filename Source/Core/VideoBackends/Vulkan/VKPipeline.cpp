@@ -3,6 +3,7 @@
 
 #include "VideoBackends/Vulkan/VKPipeline.h"
 
+#include <algorithm>
 #include <array>
 
 #include "Common/Assert.h"
@@ -240,6 +241,137 @@ GetVulkanColorBlendState(const BlendingState& state,
   return vk_state;
 }
 
+#ifdef VK_EXT_graphics_pipeline_library
+// Parts of a pipeline which can be compiled separately with VK_EXT_graphics_pipeline_library.
+enum PipelineLibraryPart : u32
+{
+  PIPELINE_LIBRARY_VERTEX_INPUT,
+  PIPELINE_LIBRARY_PRE_RASTERIZATION,
+  PIPELINE_LIBRARY_FRAGMENT_SHADER,
+  PIPELINE_LIBRARY_FRAGMENT_OUTPUT,
+  NUM_PIPELINE_LIBRARY_PARTS
+};
+
+static VkPipeline GetPipelineLibrary(const ObjectCache::PipelineLibraryKey& key,
+                                     VkGraphicsPipelineCreateInfo info,
+                                     VkGraphicsPipelineLibraryFlagsEXT flags)
+{
+  VkPipeline library = g_object_cache->GetPipelineLibrary(key);
+  if (library != VK_NULL_HANDLE)
+    return library;
+
+  const VkGraphicsPipelineLibraryCreateInfoEXT library_info = {
+      VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT, nullptr, flags};
+  info.pNext = &library_info;
+  info.flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR;
+
+  VkResult res = vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(),
+                                           g_object_cache->GetPipelineCache(), 1, &info, nullptr,
+                                           &library);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateGraphicsPipelines (library) failed: ");
+    return VK_NULL_HANDLE;
+  }
+
+  return g_object_cache->AddPipelineLibrary(key, library);
+}
+
+// Builds the pipeline out of separately compiled libraries, so that a state change which only
+// touches one part of the pipeline reuses the other parts and only needs a fast link.
+static VkPipeline CreateLinkedPipeline(const AbstractPipelineConfig& config,
+                                       const VkGraphicsPipelineCreateInfo& pipeline_info)
+{
+  const VkShaderModule vs = static_cast<const VKShader*>(config.vertex_shader)->GetShaderModule();
+  const VkShaderModule gs =
+      config.geometry_shader ?
+          static_cast<const VKShader*>(config.geometry_shader)->GetShaderModule() :
+          VK_NULL_HANDLE;
+  const VkShaderModule ps = static_cast<const VKShader*>(config.pixel_shader)->GetShaderModule();
+  const u32 fb_state = config.framebuffer_state.hex;
+
+  // The input assembly state only depends on the primitive type, the vertex input state on the
+  // vertex format.
+  VkGraphicsPipelineCreateInfo vertex_input_info = {};
+  vertex_input_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+  vertex_input_info.pVertexInputState = pipeline_info.pVertexInputState;
+  vertex_input_info.pInputAssemblyState = pipeline_info.pInputAssemblyState;
+  vertex_input_info.basePipelineIndex = -1;
+
+  VkGraphicsPipelineCreateInfo pre_rasterization_info = vertex_input_info;
+  pre_rasterization_info.pVertexInputState = nullptr;
+  pre_rasterization_info.pInputAssemblyState = nullptr;
+  pre_rasterization_info.stageCount = pipeline_info.stageCount - 1;
+  pre_rasterization_info.pStages = pipeline_info.pStages;
+  pre_rasterization_info.pViewportState = pipeline_info.pViewportState;
+  pre_rasterization_info.pRasterizationState = pipeline_info.pRasterizationState;
+  pre_rasterization_info.pDynamicState = pipeline_info.pDynamicState;
+  pre_rasterization_info.layout = pipeline_info.layout;
+  pre_rasterization_info.renderPass = pipeline_info.renderPass;
+
+  // The pixel shader is always the last stage.
+  VkGraphicsPipelineCreateInfo fragment_shader_info = vertex_input_info;
+  fragment_shader_info.pVertexInputState = nullptr;
+  fragment_shader_info.pInputAssemblyState = nullptr;
+  fragment_shader_info.stageCount = 1;
+  fragment_shader_info.pStages = &pipeline_info.pStages[pipeline_info.stageCount - 1];
+  fragment_shader_info.pMultisampleState = pipeline_info.pMultisampleState;
+  fragment_shader_info.pDepthStencilState = pipeline_info.pDepthStencilState;
+  fragment_shader_info.layout = pipeline_info.layout;
+  fragment_shader_info.renderPass = pipeline_info.renderPass;
+
+  VkGraphicsPipelineCreateInfo fragment_output_info = vertex_input_info;
+  fragment_output_info.pVertexInputState = nullptr;
+  fragment_output_info.pInputAssemblyState = nullptr;
+  fragment_output_info.pMultisampleState = pipeline_info.pMultisampleState;
+  fragment_output_info.pColorBlendState = pipeline_info.pColorBlendState;
+  fragment_output_info.renderPass = pipeline_info.renderPass;
+
+  const std::array<VkPipeline, NUM_PIPELINE_LIBRARY_PARTS> libraries = {
+      GetPipelineLibrary({PIPELINE_LIBRARY_VERTEX_INPUT, VK_NULL_HANDLE, VK_NULL_HANDLE,
+                          static_cast<u32>(config.rasterization_state.primitive.Value()), 0,
+                          config.vertex_format},
+                         vertex_input_info,
+                         VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT),
+      GetPipelineLibrary({PIPELINE_LIBRARY_PRE_RASTERIZATION, vs, gs,
+                          config.rasterization_state.hex, fb_state, nullptr},
+                         pre_rasterization_info,
+                         VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT),
+      GetPipelineLibrary({PIPELINE_LIBRARY_FRAGMENT_SHADER, ps, VK_NULL_HANDLE,
+                          config.depth_state.hex, fb_state, nullptr},
+                         fragment_shader_info,
+                         VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT),
+      GetPipelineLibrary({PIPELINE_LIBRARY_FRAGMENT_OUTPUT, VK_NULL_HANDLE, VK_NULL_HANDLE,
+                          config.blending_state.hex, fb_state, nullptr},
+                         fragment_output_info,
+                         VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT),
+  };
+  if (std::ranges::find(libraries, VK_NULL_HANDLE) != libraries.end())
+    return VK_NULL_HANDLE;
+
+  const VkPipelineLibraryCreateInfoKHR library_info = {
+      VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR, nullptr,
+      static_cast<u32>(libraries.size()), libraries.data()};
+  VkGraphicsPipelineCreateInfo link_info = {};
+  link_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+  link_info.pNext = &library_info;
+  link_info.layout = pipeline_info.layout;
+  link_info.basePipelineIndex = -1;
+
+  VkPipeline pipeline;
+  VkResult res =
+      vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), g_object_cache->GetPipelineCache(),
+                                1, &link_info, nullptr, &pipeline);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateGraphicsPipelines (link) failed: ");
+    return VK_NULL_HANDLE;
+  }
+
+  return pipeline;
+}
+#endif
+
 std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& config)
 {
   DEBUG_ASSERT(config.vertex_shader && config.pixel_shader);
@@ -416,6 +548,20 @@ std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& con
       -1                     // int32_t                                          basePipelineIndex
   };
 
+#ifdef VK_EXT_graphics_pipeline_library
+  // Only specialized GX pipelines are worth splitting up, as there are few utility pipelines and
+  // the ubershader pipelines are compiled ahead of time.
+  if (config.usage == AbstractPipelineUsage::GX &&
+      g_vulkan_context->SupportsGraphicsPipelineLibrary())
+  {
+    VkPipeline pipeline = CreateLinkedPipeline(config, pipeline_info);
+    if (pipeline != VK_NULL_HANDLE)
+      return std::make_unique<VKPipeline>(config, pipeline, pipeline_layout, config.usage);
+
+    // Fall back to a monolithic pipeline.
+  }
+#endif
+
   VkPipeline pipeline;
   VkResult res =
       vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), g_object_cache->GetPipelineCache(),
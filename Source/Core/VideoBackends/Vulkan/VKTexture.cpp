@@ -98,8 +98,25 @@ std::unique_ptr<VKTexture> VKTexture::Create(const TextureConfig& tex_config, st
 
   VkImage image = VK_NULL_HANDLE;
   VmaAllocation alloc = VK_NULL_HANDLE;
-  VkResult res = vmaCreateImage(g_vulkan_context->GetMemoryAllocator(), &image_info,
-                                &alloc_create_info, &image, &alloc, nullptr);
+  VkResult res = VK_ERROR_FEATURE_NOT_PRESENT;
+
+  // Small sampled textures (i.e. most of the texture cache) go into their own pool. This fails if
+  // the pool's memory type doesn't suit the image, in which case we use the default pools.
+  const size_t approx_size = tex_config.GetStride() * tex_config.height * tex_config.layers;
+  if (!tex_config.IsRenderTarget() && !tex_config.IsComputeImage() &&
+      approx_size <= SMALL_TEXTURE_MAX_SIZE &&
+      g_vulkan_context->GetSmallTexturePool() != VK_NULL_HANDLE)
+  {
+    VmaAllocationCreateInfo pool_alloc_create_info = alloc_create_info;
+    pool_alloc_create_info.pool = g_vulkan_context->GetSmallTexturePool();
+    res = vmaCreateImage(g_vulkan_context->GetMemoryAllocator(), &image_info,
+                         &pool_alloc_create_info, &image, &alloc, nullptr);
+  }
+  if (res != VK_SUCCESS)
+  {
+    res = vmaCreateImage(g_vulkan_context->GetMemoryAllocator(), &image_info, &alloc_create_info,
+                         &image, &alloc, nullptr);
+  }
   if (res != VK_SUCCESS)
   {
     LOG_VULKAN_ERROR(res, "vmaCreateImage failed: ");
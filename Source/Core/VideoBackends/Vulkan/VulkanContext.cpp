@@ -42,6 +42,8 @@ VulkanContext::VulkanContext(VkInstance instance, VkPhysicalDevice physical_devi
 
 VulkanContext::~VulkanContext()
 {
+  if (m_small_texture_pool != VK_NULL_HANDLE)
+    vmaDestroyPool(m_allocator, m_small_texture_pool);
   if (m_allocator != VK_NULL_HANDLE)
     vmaDestroyAllocator(m_allocator);
   if (m_device != VK_NULL_HANDLE)
@@ -596,6 +598,18 @@ bool VulkanContext::SelectDeviceExtensions(bool enable_surface)
   AddExtension(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME, false);
   AddExtension(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, false);
 
+  // VK_KHR_push_descriptor lets us write sampler bindings into the command buffer, instead of
+  // allocating and updating a new descriptor set every time they change.
+  if (AddExtension(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME, false))
+    INFO_LOG_FMT(VIDEO, "Using VK_KHR_push_descriptor for sampler bindings.");
+
+#ifdef VK_EXT_graphics_pipeline_library
+  // VK_EXT_graphics_pipeline_library lets us compile the parts of a pipeline separately, and link
+  // them quickly when only some of the state changes.
+  if (AddExtension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME, false))
+    AddExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME, false);
+#endif
+
   return true;
 }
 
@@ -755,6 +769,23 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
 
   device_info.pEnabledFeatures = &m_device_features;
 
+#ifdef VK_EXT_graphics_pipeline_library
+  // The graphics pipeline library feature has to be queried and enabled through the pNext chain.
+  VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT pipeline_library_features = {};
+  pipeline_library_features.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+  if (vkGetPhysicalDeviceFeatures2 &&
+      SupportsDeviceExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME))
+  {
+    VkPhysicalDeviceFeatures2 features_2 = {};
+    features_2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    features_2.pNext = &pipeline_library_features;
+    vkGetPhysicalDeviceFeatures2(m_physical_device, &features_2);
+    if (pipeline_library_features.graphicsPipelineLibrary)
+      device_info.pNext = &pipeline_library_features;
+  }
+#endif
+
   // Enable debug layer on debug builds
   if (enable_validation_layer)
   {
@@ -773,6 +804,15 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   if (!LoadVulkanDeviceFunctions(m_device))
     return false;
 
+  m_supports_push_descriptors = vkCmdPushDescriptorSetKHR != nullptr &&
+                                SupportsDeviceExtension(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+#ifdef VK_EXT_graphics_pipeline_library
+  m_supports_graphics_pipeline_library =
+      pipeline_library_features.graphicsPipelineLibrary == VK_TRUE;
+  if (m_supports_graphics_pipeline_library)
+    INFO_LOG_FMT(VIDEO, "Using VK_EXT_graphics_pipeline_library for GX pipelines.");
+#endif
+
   // Grab the graphics and present queues.
   vkGetDeviceQueue(m_device, m_graphics_queue_family_index, 0, &m_graphics_queue);
   if (surface)
@@ -807,6 +847,43 @@ bool VulkanContext::CreateAllocator(u32 vk_api_version)
     return false;
   }
 
+  // The texture cache creates and destroys lots of small textures. Sub-allocate them from their
+  // own blocks, so they don't fragment the blocks used by render targets and buffers. The memory
+  // type is picked with a representative texture, VKTexture::Create() falls back to the default
+  // pools for textures which can't use it.
+  VkImageCreateInfo image_info = {};
+  image_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+  image_info.imageType = VK_IMAGE_TYPE_2D;
+  image_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+  image_info.extent = {1, 1, 1};
+  image_info.mipLevels = 1;
+  image_info.arrayLayers = 1;
+  image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+  image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+  image_info.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+                     VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+  image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+  image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+  VmaAllocationCreateInfo alloc_create_info = {};
+  alloc_create_info.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
+
+  u32 memory_type_index;
+  res = vmaFindMemoryTypeIndexForImageInfo(m_allocator, &image_info, &alloc_create_info,
+                                           &memory_type_index);
+  if (res == VK_SUCCESS)
+  {
+    VmaPoolCreateInfo pool_info = {};
+    pool_info.memoryTypeIndex = memory_type_index;
+    pool_info.blockSize = SMALL_TEXTURE_POOL_BLOCK_SIZE;
+    res = vmaCreatePool(m_allocator, &pool_info, &m_small_texture_pool);
+  }
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "Failed to create small texture pool: ");
+    m_small_texture_pool = VK_NULL_HANDLE;
+  }
+
   return true;
 }
 
@@ -83,6 +83,8 @@ public:
   }
   u32 GetShaderSubgroupSize() const { return m_shader_subgroup_size; }
   bool SupportsShaderSubgroupOperations() const { return m_supports_shader_subgroup_operations; }
+  bool SupportsPushDescriptors() const { return m_supports_push_descriptors; }
+  bool SupportsGraphicsPipelineLibrary() const { return m_supports_graphics_pipeline_library; }
 
   // Helpers for getting constants
   VkDeviceSize GetUniformBufferAlignment() const
@@ -106,6 +108,8 @@ public:
   bool SupportsExclusiveFullscreen(const WindowSystemInfo& wsi, VkSurfaceKHR surface);
 
   VmaAllocator GetMemoryAllocator() const { return m_allocator; }
+  // Pool for small sampled textures, may be null. See CreateAllocator().
+  VmaPool GetSmallTexturePool() const { return m_small_texture_pool; }
 
 #ifdef WIN32
   // Returns the platform-specific exclusive fullscreen structure.
@@ -128,6 +132,7 @@ private:
   VkPhysicalDevice m_physical_device = VK_NULL_HANDLE;
   VkDevice m_device = VK_NULL_HANDLE;
   VmaAllocator m_allocator = VK_NULL_HANDLE;
+  VmaPool m_small_texture_pool = VK_NULL_HANDLE;
 
   VkQueue m_graphics_queue = VK_NULL_HANDLE;
   u32 m_graphics_queue_family_index = 0;
@@ -143,6 +148,8 @@ private:
 
   u32 m_shader_subgroup_size = 1;
   bool m_supports_shader_subgroup_operations = false;
+  bool m_supports_push_descriptors = false;
+  bool m_supports_graphics_pipeline_library = false;
 
   std::vector<std::string> m_device_extensions;
 };
@@ -4,6 +4,7 @@
 #include "VideoCommon/AbstractGfx.h"
 
 #include "Common/Assert.h"
+#include "Common/TraceProfiler.h"
 
 #include "VideoCommon/AbstractFramebuffer.h"
 #include "VideoCommon/AbstractTexture.h"
@@ -157,6 +158,24 @@ AbstractGfx::ConvertFramebufferRectangle(const MathUtil::Rectangle<int>& rect, u
   return ret;
 }
 
+void AbstractGfx::SetGPUTimingPass(GPUTimingPass pass)
+{
+  if (!m_gpu_timing_enabled || pass == m_gpu_timing_pass)
+    return;
+
+  m_gpu_timing_pass = pass;
+  InsertGPUTimestamp(pass);
+}
+
+void AbstractGfx::EndGPUTimingFrame()
+{
+  // The final timestamp closes the last pass of the frame.
+  SetGPUTimingPass(GPUTimingPass::Idle);
+  ResolveGPUTimestamps();
+
+  m_gpu_timing_enabled = g_ActiveConfig.bShowGPUTimes || Common::TraceProfiler::IsEnabled();
+}
+
 std::unique_ptr<VideoCommon::AsyncShaderCompiler> AbstractGfx::CreateAsyncShaderCompiler()
 {
   return std::make_unique<VideoCommon::AsyncShaderCompiler>();
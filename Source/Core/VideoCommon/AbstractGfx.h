@@ -6,6 +6,7 @@
 #include "Common/HookableEvent.h"
 #include "Common/MathUtil.h"
 
+#include "VideoCommon/GPUTiming.h"
 #include "VideoCommon/RenderState.h"
 
 #include <array>
@@ -143,6 +144,12 @@ public:
   virtual void Flush() {}
   virtual void WaitForGPUIdle() {}
 
+  // Enters a new GPU pass. Backends with timestamp queries write one at every pass change while
+  // GPU times are shown or a trace is being recorded. EndGPUTimingFrame() is called once per
+  // presented frame, and reports the times of finished frames without waiting on the GPU.
+  void SetGPUTimingPass(GPUTimingPass pass);
+  void EndGPUTimingFrame();
+
   // For opengl's glDrawBuffer
   virtual void SelectLeftBuffer() {}
   virtual void SelectRightBuffer() {}
@@ -167,9 +174,15 @@ public:
   virtual SurfaceInfo GetSurfaceInfo() const = 0;
 
 protected:
+  virtual void InsertGPUTimestamp(GPUTimingPass pass) {}
+  virtual void ResolveGPUTimestamps() {}
+
   AbstractFramebuffer* m_current_framebuffer = nullptr;
   const AbstractPipeline* m_current_pipeline = nullptr;
 
+  bool m_gpu_timing_enabled = false;
+  GPUTimingPass m_gpu_timing_pass = GPUTimingPass::Idle;
+
 private:
   Common::EventHook m_config_changed;
 };
@@ -23,6 +23,19 @@ bool CustomAsset::Load()
   return load_information.m_bytes_loaded != 0;
 }
 
+std::size_t CustomAsset::Unload()
+{
+  UnloadImpl();
+
+  // Reset the loaded time as well, so that anything which cached the asset without its data
+  // notices when it is loaded again
+  std::lock_guard lk(m_info_lock);
+  const std::size_t bytes_unloaded = m_bytes_loaded;
+  m_bytes_loaded = 0;
+  m_last_loaded_time = {};
+  return bytes_unloaded;
+}
+
 CustomAssetLibrary::TimeType CustomAsset::GetLastWriteTime() const
 {
   return m_owning_library->GetLastAssetWriteTime(m_asset_id);
@@ -3,7 +3,14 @@
 
 #include "VideoCommon/Assets/CustomAssetLoader.h"
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "Common/Config/Config.h"
 #include "Common/MemoryUtil.h"
+#include "Common/Thread.h"
+#include "Core/Config/GraphicsSettings.h"
 #include "VideoCommon/Assets/CustomAssetLibrary.h"
 
 namespace VideoCommon
@@ -12,11 +19,21 @@ void CustomAssetLoader::Init()
 {
   m_asset_monitor_thread_shutdown.Clear();
 
-  const size_t sys_mem = Common::MemPhysical();
-  const size_t recommended_min_mem = 2 * size_t(1024 * 1024 * 1024);
-  // keep 2GB memory for system stability if system RAM is 4GB+ - use half of memory in other cases
-  m_max_memory_available =
-      (sys_mem / 2 < recommended_min_mem) ? (sys_mem / 2) : (sys_mem - recommended_min_mem);
+  // The budget is configured in MiB, with 0 picking one based on the system memory
+  const int memory_budget_mib = Config::Get(Config::GFX_CUSTOM_ASSET_MEMORY_BUDGET);
+  if (memory_budget_mib > 0)
+  {
+    m_max_memory_available = static_cast<size_t>(memory_budget_mib) * 1024 * 1024;
+  }
+  else
+  {
+    const size_t sys_mem = Common::MemPhysical();
+    const size_t recommended_min_mem = 2 * size_t(1024 * 1024 * 1024);
+    // keep 2GB memory for system stability if system RAM is 4GB+ - use half of memory in other
+    // cases
+    m_max_memory_available =
+        (sys_mem / 2 < recommended_min_mem) ? (sys_mem / 2) : (sys_mem - recommended_min_mem);
+  }
 
   m_asset_monitor_thread = std::thread([this]() {
     Common::SetCurrentThreadName("Asset monitor");
@@ -29,40 +46,26 @@ void CustomAssetLoader::Init()
 
       std::this_thread::sleep_for(TIME_BETWEEN_ASSET_MONITOR_CHECKS);
 
+      // Keep the assets alive until the lock is released, so that an asset going out of scope
+      // can't remove itself from the map while it is being iterated
+      std::vector<std::shared_ptr<CustomAsset>> assets;
       std::lock_guard lk(m_asset_load_lock);
-      for (auto& [asset_id, asset_to_monitor] : m_assets_to_monitor)
+      for (auto& [asset_id, usage] : m_asset_usage)
       {
-        if (auto ptr = asset_to_monitor.lock())
+        if (usage.state != AssetState::Loaded)
+          continue;
+
+        if (auto ptr = usage.asset.lock())
         {
           const auto write_time = ptr->GetLastWriteTime();
           if (write_time > ptr->GetLastLoadedTime())
           {
+            const std::size_t old_memory_size = ptr->GetByteSizeInMemory();
             (void)ptr->Load();
+            m_total_bytes_loaded -= old_memory_size;
+            m_total_bytes_loaded += ptr->GetByteSizeInMemory();
           }
-        }
-      }
-    }
-  });
-
-  m_asset_load_thread.Reset("Custom Asset Loader", [this](std::weak_ptr<CustomAsset> asset) {
-    if (auto ptr = asset.lock())
-    {
-      if (m_memory_exceeded)
-        return;
-
-      if (ptr->Load())
-      {
-        std::lock_guard lk(m_asset_load_lock);
-        const std::size_t asset_memory_size = ptr->GetByteSizeInMemory();
-        m_total_bytes_loaded += asset_memory_size;
-        m_assets_to_monitor.try_emplace(ptr->GetAssetId(), ptr);
-        if (m_total_bytes_loaded > m_max_memory_available)
-        {
-          ERROR_LOG_FMT(VIDEO,
-                        "Asset memory exceeded with asset '{}', future assets won't load until "
-                        "memory is available.",
-                        ptr->GetAssetId());
-          m_memory_exceeded = true;
+          assets.push_back(std::move(ptr));
         }
       }
     }
@@ -71,12 +74,126 @@ void CustomAssetLoader::Init()
 
 void CustomAssetLoader ::Shutdown()
 {
-  m_asset_load_thread.Shutdown(true);
+  m_asset_load_tasks.Cancel();
 
   m_asset_monitor_thread_shutdown.Set();
   m_asset_monitor_thread.join();
-  m_assets_to_monitor.clear();
+
+  std::lock_guard lk(m_asset_load_lock);
+  if (m_request_hits != 0 || m_request_misses != 0)
+  {
+    INFO_LOG_FMT(VIDEO, "Custom assets: {} requests were loaded, {} were not, {} assets evicted",
+                 m_request_hits, m_request_misses, m_evicted_assets);
+  }
+  m_asset_usage.clear();
   m_total_bytes_loaded = 0;
+  m_request_hits = 0;
+  m_request_misses = 0;
+  m_evicted_assets = 0;
+}
+
+void CustomAssetLoader::QueueLoad(std::weak_ptr<CustomAsset> asset)
+{
+  m_asset_load_tasks.Run([this, asset = std::move(asset)] { LoadAsset(asset); });
+}
+
+void CustomAssetLoader::LoadAsset(const std::weak_ptr<CustomAsset>& asset)
+{
+  auto ptr = asset.lock();
+  if (!ptr)
+    return;
+
+  {
+    // Skip assets which were loaded or replaced while waiting in the queue
+    std::lock_guard lk(m_asset_load_lock);
+    const auto it = m_asset_usage.find(ptr->GetAssetId());
+    if (it == m_asset_usage.end() || it->second.state != AssetState::LoadPending ||
+        it->second.asset.lock() != ptr)
+    {
+      return;
+    }
+  }
+
+  const bool loaded = ptr->Load();
+
+  std::lock_guard lk(m_asset_load_lock);
+  const auto it = m_asset_usage.find(ptr->GetAssetId());
+  if (it == m_asset_usage.end() || it->second.asset.lock() != ptr)
+    return;
+
+  if (!loaded)
+  {
+    // Don't retry assets that failed to load on every request
+    it->second.state = AssetState::LoadFailed;
+    return;
+  }
+
+  it->second.state = AssetState::Loaded;
+  m_total_bytes_loaded += ptr->GetByteSizeInMemory();
+  if (m_total_bytes_loaded > m_max_memory_available)
+    EvictAssets(ptr->GetAssetId());
+}
+
+bool CustomAssetLoader::RequestAsset(const std::shared_ptr<CustomAsset>& asset)
+{
+  std::lock_guard lk(m_asset_load_lock);
+  AssetUsage& usage = m_asset_usage[asset->GetAssetId()];
+  if (usage.asset.lock() != asset)
+    usage = AssetUsage{asset};
+
+  usage.last_use = ++m_use_count;
+  switch (usage.state)
+  {
+  case AssetState::Loaded:
+    m_request_hits++;
+    return false;
+  case AssetState::LoadPending:
+    m_request_misses++;
+    return false;
+  case AssetState::LoadFailed:
+    return false;
+  case AssetState::Unloaded:
+    break;
+  }
+
+  m_request_misses++;
+  usage.state = AssetState::LoadPending;
+  return true;
+}
+
+void CustomAssetLoader::EvictAssets(const CustomAssetLibrary::AssetID& asset_id)
+{
+  // Evict down to a low watermark, so that loading assets at the limit doesn't need to search
+  // for the least recently used assets on every load
+  const std::size_t target_bytes = m_max_memory_available - m_max_memory_available / 8;
+
+  std::vector<std::pair<u64, AssetUsage*>> candidates;
+  for (auto& [id, usage] : m_asset_usage)
+  {
+    if (usage.state == AssetState::Loaded && id != asset_id)
+      candidates.emplace_back(usage.last_use, &usage);
+  }
+  std::sort(candidates.begin(), candidates.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+  for (const auto& [last_use, usage] : candidates)
+  {
+    if (m_total_bytes_loaded <= target_bytes)
+      break;
+
+    usage->state = AssetState::Unloaded;
+    if (auto ptr = usage->asset.lock())
+    {
+      m_total_bytes_loaded -= ptr->Unload();
+      m_evicted_assets++;
+    }
+  }
+
+  if (m_total_bytes_loaded > m_max_memory_available)
+  {
+    WARN_LOG_FMT(VIDEO, "Asset memory exceeded with asset '{}' even after evicting all others",
+                 asset_id);
+  }
 }
 
 std::shared_ptr<GameTextureAsset>
@@ -9,9 +9,10 @@
 #include <mutex>
 #include <thread>
 
+#include "Common/CommonTypes.h"
 #include "Common/Flag.h"
 #include "Common/Logging/Log.h"
-#include "Common/WorkQueueThread.h"
+#include "Common/TaskPool.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/MaterialAsset.h"
 #include "VideoCommon/Assets/MeshAsset.h"
@@ -65,26 +66,62 @@ private:
     {
       auto shared = it->second.lock();
       if (shared)
+      {
+        // The asset may have been evicted since it was last requested
+        if (RequestAsset(shared))
+          QueueLoad(shared);
         return shared;
+      }
     }
     std::shared_ptr<AssetType> ptr(new AssetType(std::move(library), asset_id), [&](AssetType* a) {
       {
         std::lock_guard lk(m_asset_load_lock);
         m_total_bytes_loaded -= a->GetByteSizeInMemory();
-        m_assets_to_monitor.erase(a->GetAssetId());
-        if (m_max_memory_available >= m_total_bytes_loaded && m_memory_exceeded)
-        {
-          INFO_LOG_FMT(VIDEO, "Asset memory went below limit, new assets can begin loading.");
-          m_memory_exceeded = false;
-        }
+
+        // A new asset with the same id may have been requested already
+        const auto usage_it = m_asset_usage.find(a->GetAssetId());
+        if (usage_it != m_asset_usage.end() && usage_it->second.asset.expired())
+          m_asset_usage.erase(usage_it);
       }
       delete a;
     });
     it->second = ptr;
-    m_asset_load_thread.Push(it->second);
+    RequestAsset(ptr);
+    QueueLoad(ptr);
     return ptr;
   }
 
+  enum class AssetState
+  {
+    Unloaded,
+    LoadPending,
+    Loaded,
+    LoadFailed,
+  };
+
+  struct AssetUsage
+  {
+    std::weak_ptr<CustomAsset> asset;
+    AssetState state = AssetState::Unloaded;
+
+    // The value of 'm_use_count' when the asset was last requested
+    u64 last_use = 0;
+  };
+
+  // Marks the asset as the most recently used one
+  // Returns true if the asset needs to be queued for loading
+  bool RequestAsset(const std::shared_ptr<CustomAsset>& asset);
+
+  // Loads the asset on the shared task pool. Loads of different assets can run concurrently, an
+  // asset is only queued again once the previous load has finished.
+  void QueueLoad(std::weak_ptr<CustomAsset> asset);
+  void LoadAsset(const std::weak_ptr<CustomAsset>& asset);
+
+  // Unloads the least recently used assets until the memory used by assets is below the
+  // low watermark of the budget, 'asset_id' is never unloaded
+  // Note: expects 'm_asset_load_lock' to be held
+  void EvictAssets(const CustomAssetLibrary::AssetID& asset_id);
+
   static constexpr auto TIME_BETWEEN_ASSET_MONITOR_CHECKS = std::chrono::milliseconds{500};
 
   std::map<CustomAssetLibrary::AssetID, std::weak_ptr<GameTextureAsset>> m_game_textures;
@@ -96,13 +133,19 @@ private:
 
   std::size_t m_total_bytes_loaded = 0;
   std::size_t m_max_memory_available = 0;
-  std::atomic_bool m_memory_exceeded = false;
 
-  std::map<CustomAssetLibrary::AssetID, std::weak_ptr<CustomAsset>> m_assets_to_monitor;
+  // Every asset that was requested and is still alive, loaded assets are also monitored for
+  // changes
+  std::map<CustomAssetLibrary::AssetID, AssetUsage> m_asset_usage;
+  u64 m_use_count = 0;
+
+  u64 m_request_hits = 0;
+  u64 m_request_misses = 0;
+  u64 m_evicted_assets = 0;
 
   // Use a recursive mutex to handle the scenario where an asset goes out of scope while
   // iterating over the assets to monitor which calls the lock above in 'LoadOrCreateAsset'
   std::recursive_mutex m_asset_load_lock;
-  Common::WorkQueueThread<std::weak_ptr<CustomAsset>> m_asset_load_thread;
+  Common::TaskGroup m_asset_load_tasks;
 };
 }  // namespace VideoCommon
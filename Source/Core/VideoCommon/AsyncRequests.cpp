@@ -31,31 +31,30 @@ void AsyncRequests::PullEventsInternal()
   std::unique_lock<std::mutex> lock(m_mutex);
   m_empty.Set();
 
-  while (!m_queue.empty())
+  Event e;
+  while (!m_queue.Empty())
   {
-    Event e = m_queue.front();
+    e = m_queue.Front();
 
     // try to merge as many efb pokes as possible
     // it's a bit hacky, but some games render a complete frame in this way
     if ((e.type == Event::EFB_POKE_COLOR || e.type == Event::EFB_POKE_Z))
     {
       m_merged_efb_pokes.clear();
-      Event first_event = m_queue.front();
+      Event first_event = m_queue.Front();
       const auto t = first_event.type == Event::EFB_POKE_COLOR ? EFBAccessType::PokeColor :
                                                                  EFBAccessType::PokeZ;
 
       do
       {
-        e = m_queue.front();
+        m_queue.TryPop(e);
 
         EfbPokeData d;
         d.data = e.efb_poke.data;
         d.x = e.efb_poke.x;
         d.y = e.efb_poke.y;
         m_merged_efb_pokes.push_back(d);
-
-        m_queue.pop();
-      } while (!m_queue.empty() && m_queue.front().type == first_event.type);
+      } while (!m_queue.Empty() && m_queue.Front().type == first_event.type);
 
       lock.unlock();
       g_renderer->PokeEFB(t, m_merged_efb_pokes.data(), m_merged_efb_pokes.size());
@@ -67,7 +66,7 @@ void AsyncRequests::PullEventsInternal()
     HandleEvent(e);
     lock.lock();
 
-    m_queue.pop();
+    m_queue.TryPop(e);
   }
 
   if (m_wake_me_up_again)
@@ -93,20 +92,31 @@ void AsyncRequests::PushEvent(const AsyncRequests::Event& event, bool blocking)
   if (!m_enable)
     return;
 
-  m_queue.push(event);
-
   auto& system = Core::System::GetInstance();
+  if (!m_queue.TryPush(event))
+  {
+    m_wake_me_up_again = true;
+    system.GetFifo().RunGpu();
+    m_cond.wait(lock, [this] { return m_queue.Size() < m_queue.GetCapacity() || !m_enable; });
+    if (!m_enable)
+      return;
+    m_queue.TryPush(event);
+    // The GPU thread reset these when it drained the queue.
+    m_empty.Clear();
+    m_wake_me_up_again |= blocking;
+  }
+
   system.GetFifo().RunGpu();
   if (blocking)
   {
-    m_cond.wait(lock, [this] { return m_queue.empty(); });
+    m_cond.wait(lock, [this] { return m_queue.Empty(); });
   }
 }
 
 void AsyncRequests::WaitForEmptyQueue()
 {
   std::unique_lock<std::mutex> lock(m_mutex);
-  m_cond.wait(lock, [this] { return m_queue.empty(); });
+  m_cond.wait(lock, [this] { return m_queue.Empty(); });
 }
 
 void AsyncRequests::SetEnable(bool enable)
@@ -117,8 +127,7 @@ void AsyncRequests::SetEnable(bool enable)
   if (!enable)
   {
     // flush the queue on disabling
-    while (!m_queue.empty())
-      m_queue.pop();
+    m_queue.Clear();
     if (m_wake_me_up_again)
       m_cond.notify_all();
   }
@@ -5,11 +5,11 @@
 
 #include <condition_variable>
 #include <mutex>
-#include <queue>
 #include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Flag.h"
+#include "Common/SPSCQueue.h"
 
 struct EfbPokeData;
 class PointerWrap;
@@ -99,7 +99,9 @@ private:
   static AsyncRequests s_singleton;
 
   Common::Flag m_empty;
-  std::queue<Event> m_queue;
+  // Pushes and pops are serialized by m_mutex, so this being single producer doesn't matter here.
+  // Pushing waits for the GPU thread to drain the queue when it is full.
+  Common::BoundedSPSCQueue<Event, 1024> m_queue;
   std::mutex m_mutex;
   std::condition_variable m_cond;
 
@@ -4,6 +4,7 @@
 #include "VideoCommon/AsyncShaderCompiler.h"
 
 #include <thread>
+#include <vector>
 
 #include "Common/Assert.h"
 #include "Common/Logging/Log.h"
@@ -35,12 +36,36 @@ void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority)
   }
   else
   {
-    std::lock_guard<std::mutex> guard(m_pending_work_lock);
-    m_pending_work.emplace(priority, std::move(item));
+    {
+      std::lock_guard<std::mutex> guard(m_pending_work_lock);
+      m_pending_work[priority].push_back(std::move(item));
+      m_pending_work_count++;
+    }
+
+    // Notify after unlocking, so the woken worker doesn't immediately block on the lock again.
     m_worker_thread_wake.notify_one();
   }
 }
 
+size_t AsyncShaderCompiler::CancelPendingWork(u32 min_priority)
+{
+  // Destroy the work items after unlocking, as workers need the lock to pick up the next item.
+  std::vector<std::deque<WorkItemPtr>> cancelled_work;
+  size_t cancelled_count = 0;
+  {
+    std::lock_guard<std::mutex> guard(m_pending_work_lock);
+    for (auto iter = m_pending_work.lower_bound(min_priority); iter != m_pending_work.end();)
+    {
+      cancelled_count += iter->second.size();
+      cancelled_work.push_back(std::move(iter->second));
+      iter = m_pending_work.erase(iter);
+    }
+    m_pending_work_count -= cancelled_count;
+  }
+
+  return cancelled_count;
+}
+
 void AsyncShaderCompiler::RetrieveWorkItems()
 {
   std::deque<WorkItemPtr> completed_work;
@@ -91,7 +116,7 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
     // Safe to hold both locks here, since nowhere else does.
     std::lock_guard<std::mutex> pending_guard(m_pending_work_lock);
     std::lock_guard<std::mutex> completed_guard(m_completed_work_lock);
-    total_items = m_completed_work.size() + m_pending_work.size() + m_busy_workers.load() + 1;
+    total_items = m_completed_work.size() + m_pending_work_count + m_busy_workers.load() + 1;
   }
 
   // Update progress while the compiles complete.
@@ -105,7 +130,7 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
       std::lock_guard<std::mutex> pending_guard(m_pending_work_lock);
       if (m_pending_work.empty() && !m_busy_workers.load())
         break;
-      remaining_items = m_pending_work.size();
+      remaining_items = m_pending_work_count;
     }
 
     progress_callback(total_items - remaining_items, total_items);
@@ -219,14 +244,19 @@ void AsyncShaderCompiler::WorkerThreadRun()
   std::unique_lock<std::mutex> pending_lock(m_pending_work_lock);
   while (!m_exit_flag.IsSet())
   {
-    m_worker_thread_wake.wait(pending_lock);
+    // Work may have been queued before this worker started waiting, so check before sleeping.
+    m_worker_thread_wake.wait(pending_lock,
+                              [this] { return !m_pending_work.empty() || m_exit_flag.IsSet(); });
 
     while (!m_pending_work.empty() && !m_exit_flag.IsSet())
     {
       m_busy_workers++;
-      auto iter = m_pending_work.begin();
-      WorkItemPtr item(std::move(iter->second));
-      m_pending_work.erase(iter);
+      auto lane = m_pending_work.begin();
+      WorkItemPtr item(std::move(lane->second.front()));
+      lane->second.pop_front();
+      if (lane->second.empty())
+        m_pending_work.erase(lane);
+      m_pending_work_count--;
       pending_lock.unlock();
 
       if (item->Compile())
@@ -5,6 +5,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
 #include <deque>
 #include <functional>
 #include <map>
@@ -43,8 +44,13 @@ public:
   }
 
   // Queues a new work item to the compiler threads. The lower the priority, the sooner
-  // this work item will be compiled, relative to the other work items.
+  // this work item will be compiled, relative to the other work items. Work items with the
+  // same priority are compiled in the order they were queued.
   void QueueWorkItem(WorkItemPtr item, u32 priority);
+
+  // Drops all work items with a priority of at least min_priority which haven't been started by a
+  // worker yet. Retrieve() is never called for them. Returns the number of dropped items.
+  size_t CancelPendingWork(u32 min_priority = 0);
   void RetrieveWorkItems();
   bool HasPendingWork();
   bool HasCompletedWork();
@@ -74,9 +80,10 @@ private:
   std::vector<std::thread> m_worker_threads;
   std::atomic_bool m_worker_thread_start_result{false};
 
-  // A multimap is used to store the work items. We can't use a priority_queue here, because
-  // there's no way to obtain a non-const reference, which we need for the unique_ptr.
-  std::multimap<u32, WorkItemPtr> m_pending_work;
+  // Work items are kept in one FIFO lane per priority, as only a handful of priorities are
+  // used. Empty lanes are removed, so the first lane always holds the next item to compile.
+  std::map<u32, std::deque<WorkItemPtr>> m_pending_work;
+  size_t m_pending_work_count = 0;
   std::mutex m_pending_work_lock;
   std::condition_variable m_worker_thread_wake;
   std::atomic_size_t m_busy_workers{0};
@@ -4,6 +4,7 @@
 #include "VideoCommon/BPStructs.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstring>
 #include <string>
@@ -79,19 +80,6 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
   ----------------------------------------------------------------------------------------------------------------
   */
 
-  if (((s32*)&bpmem)[bp.address] == bp.newvalue)
-  {
-    if (!(bp.address == BPMEM_TRIGGER_EFB_COPY || bp.address == BPMEM_CLEARBBOX1 ||
-          bp.address == BPMEM_CLEARBBOX2 || bp.address == BPMEM_SETDRAWDONE ||
-          bp.address == BPMEM_PE_TOKEN_ID || bp.address == BPMEM_PE_TOKEN_INT_ID ||
-          bp.address == BPMEM_LOADTLUT0 || bp.address == BPMEM_LOADTLUT1 ||
-          bp.address == BPMEM_TEXINVALIDATE || bp.address == BPMEM_PRELOAD_MODE ||
-          bp.address == BPMEM_CLEAR_PIXEL_PERF))
-    {
-      return;
-    }
-  }
-
   FlushPipeline();
 
   ((u32*)&bpmem)[bp.address] = bp.newvalue;
@@ -779,11 +767,22 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
                bp.newvalue);
 }
 
+// Registers which trigger an action every time they are written, even if the value is unchanged.
+static constexpr std::array<bool, 256> s_bp_trigger_registers = [] {
+  std::array<bool, 256> table{};
+  for (const u8 reg :
+       {BPMEM_TRIGGER_EFB_COPY, BPMEM_CLEARBBOX1, BPMEM_CLEARBBOX2, BPMEM_SETDRAWDONE,
+        BPMEM_PE_TOKEN_ID, BPMEM_PE_TOKEN_INT_ID, BPMEM_LOADTLUT0, BPMEM_LOADTLUT1,
+        BPMEM_TEXINVALIDATE, BPMEM_PRELOAD_MODE, BPMEM_CLEAR_PIXEL_PERF})
+  {
+    table[reg] = true;
+  }
+  return table;
+}();
+
 // Call browser: OpcodeDecoding.cpp RunCallback::OnBP()
 void LoadBPReg(u8 reg, u32 value, int cycles_into_future)
 {
-  auto& system = Core::System::GetInstance();
-
   int oldval = ((u32*)&bpmem)[reg];
   int newval = (oldval & ~bpmem.bpMask) | (value & bpmem.bpMask);
   int changes = (oldval ^ newval) & 0xFFFFFF;
@@ -794,6 +793,12 @@ void LoadBPReg(u8 reg, u32 value, int cycles_into_future)
   if (reg != BPMEM_BP_MASK)
     bpmem.bpMask = 0xFFFFFF;
 
+  // Games often rewrite long runs of registers with the values they already hold. Those need
+  // neither a flush nor any state updates, so skip them before dispatching on the register.
+  if (oldval == newval && !s_bp_trigger_registers[reg])
+    return;
+
+  auto& system = Core::System::GetInstance();
   BPWritten(system.GetPixelShaderManager(), system.GetXFStateManager(),
             system.GetGeometryShaderManager(), bp, cycles_into_future);
 }
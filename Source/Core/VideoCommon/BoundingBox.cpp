@@ -72,15 +72,47 @@ void BoundingBox::Readback()
   m_is_valid = true;
 }
 
+bool BoundingBox::AsyncReadback()
+{
+  if (m_async_read_pending)
+  {
+    const auto read_values = PollRead();
+    if (!read_values)
+      return m_has_async_values;
+
+    m_async_values = *read_values;
+    m_async_read_pending = false;
+    m_has_async_values = true;
+  }
+
+  // Pick up the draws since the last readback for the next read.
+  m_async_read_pending = QueueRead();
+  return m_has_async_values;
+}
+
 u16 BoundingBox::Get(u32 index)
 {
   ASSERT(index < NUM_BBOX_VALUES);
 
-  if (!g_ActiveConfig.bBBoxEnable || !g_ActiveConfig.backend_info.bSupportsBBox)
+  if (!g_ActiveConfig.bBBoxEnable)
+    return m_bounding_box_fallback[index];
+
+  if (g_ActiveConfig.bBBoxCPUEstimate && m_estimate_valid[index])
+    return static_cast<u16>(m_estimate_values[index]);
+
+  if (!g_ActiveConfig.backend_info.bSupportsBBox)
     return m_bounding_box_fallback[index];
 
   if (!m_is_valid)
+  {
+    if (g_ActiveConfig.bBBoxAsyncReadback && AsyncReadback())
+    {
+      // Values written since the last draw haven't reached the GPU yet, so they are exact.
+      return static_cast<u16>(m_dirty[index] ? m_values[index] : m_async_values[index]);
+    }
+
     Readback();
+  }
 
   return static_cast<u16>(m_values[index]);
 }
@@ -89,6 +121,12 @@ void BoundingBox::Set(u32 index, u16 value)
 {
   ASSERT(index < NUM_BBOX_VALUES);
 
+  if (g_ActiveConfig.bBBoxEnable)
+  {
+    m_estimate_values[index] = value;
+    m_estimate_valid[index] = true;
+  }
+
   if (!g_ActiveConfig.bBBoxEnable || !g_ActiveConfig.backend_info.bSupportsBBox)
   {
     m_bounding_box_fallback[index] = value;
@@ -102,6 +140,19 @@ void BoundingBox::Set(u32 index, u16 value)
   m_dirty[index] = true;
 }
 
+void BoundingBox::UpdateEstimate(BBoxType left, BBoxType right, BBoxType top, BBoxType bottom)
+{
+  m_estimate_values[0] = std::min(m_estimate_values[0], left);
+  m_estimate_values[1] = std::max(m_estimate_values[1], right);
+  m_estimate_values[2] = std::min(m_estimate_values[2], top);
+  m_estimate_values[3] = std::max(m_estimate_values[3], bottom);
+}
+
+void BoundingBox::InvalidateEstimate()
+{
+  m_estimate_valid.fill(false);
+}
+
 // FIXME: This may not work correctly if we're in the middle of a draw.
 // We should probably ensure that state saves only happen on frame boundaries.
 // Nonetheless, it has been designed to be as safe as possible.
@@ -113,6 +164,11 @@ void BoundingBox::DoState(PointerWrap& p)
   p.DoArray(m_dirty);
   p.Do(m_is_valid);
 
+  // Neither of these is saved, so start over with synchronous reads and GPU values.
+  m_async_read_pending = false;
+  m_has_async_values = false;
+  InvalidateEstimate();
+
   // We handle saving the backend values specially rather than using Readback() and Flush() so that
   // we don't mess up the current cache state
   std::vector<BBoxType> backend_values(NUM_BBOX_VALUES);
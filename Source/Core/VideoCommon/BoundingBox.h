@@ -5,6 +5,7 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 #include <span>
 #include <vector>
 
@@ -31,6 +32,12 @@ public:
   u16 Get(u32 index);
   void Set(u32 index, u16 value);
 
+  // CPU-side estimate, which is served instead of the GPU values as long as every draw since the
+  // game last wrote a register was simple enough to be estimated. Only used when the
+  // Hacks/BBoxCPUEstimate setting is enabled; see VertexManagerBase::UpdateBoundingBoxEstimate.
+  void UpdateEstimate(BBoxType left, BBoxType right, BBoxType top, BBoxType bottom);
+  void InvalidateEstimate();
+
   void DoState(PointerWrap& p);
 
   // Initialize, Read, and Write are only safe to call if the backend supports bounding box,
@@ -41,8 +48,15 @@ protected:
   virtual std::vector<BBoxType> Read(u32 index, u32 length) = 0;
   virtual void Write(u32 index, std::span<const BBoxType> values) = 0;
 
+  // Asynchronous readback, used when the Hacks/BBoxAsyncReadback setting is enabled. QueueRead
+  // copies the current values to host-visible memory without waiting and returns false if the
+  // backend can't do that, and PollRead returns the copied values once the GPU is done.
+  virtual bool QueueRead() { return false; }
+  virtual std::optional<std::array<BBoxType, NUM_BBOX_VALUES>> PollRead() { return std::nullopt; }
+
 private:
   void Readback();
+  bool AsyncReadback();
 
   bool m_is_active = false;
 
@@ -50,6 +64,15 @@ private:
   std::array<bool, NUM_BBOX_VALUES> m_dirty = {};
   bool m_is_valid = true;
 
+  // Values of the last finished asynchronous readback. These lag behind the GPU by at least one
+  // read, which games that read the registers every frame tolerate.
+  std::array<BBoxType, NUM_BBOX_VALUES> m_async_values = {};
+  bool m_async_read_pending = false;
+  bool m_has_async_values = false;
+
+  std::array<BBoxType, NUM_BBOX_VALUES> m_estimate_values = {};
+  std::array<bool, NUM_BBOX_VALUES> m_estimate_valid = {};
+
   // Nintendo's SDK seems to write "default" bounding box values before every draw (1023 0 1023 0
   // are the only values encountered so far, which happen to be the extents allowed by the BP
   // registers) to reset the registers for comparison in the pixel engine, and presumably to detect
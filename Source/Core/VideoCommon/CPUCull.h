@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "Common/MathUtil.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -14,6 +15,10 @@ public:
   void Init();
   bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
                             const u8* src, u32 count);
+  // Computes the extents of the vertices after the viewport transform, or returns false if any of
+  // them is on or behind the camera plane.
+  bool GetScreenBounds(VertexLoaderBase* loader, const u8* src, u32 count,
+                       MathUtil::Rectangle<float>* bounds);
 
   struct alignas(16) TransformedVertex
   {
@@ -24,6 +29,8 @@ public:
   using CullFunction = bool (*)(const CPUCull::TransformedVertex*, int);
 
 private:
+  void TransformVertices(VertexLoaderBase* loader, const u8* src, u32 count);
+
   template <typename T>
   struct BufferDeleter
   {
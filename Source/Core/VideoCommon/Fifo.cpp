@@ -13,6 +13,7 @@
 #include "Common/FPURoundMode.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/TraceProfiler.h"
 
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
@@ -62,6 +63,7 @@ void FifoManager::DoState(PointerWrap& p)
     // We're good and paused, right?
     m_video_buffer_seen_ptr = m_video_buffer_pp_read_ptr = m_video_buffer_read_ptr;
   }
+  m_video_buffer_synced_write_ptr = nullptr;
 
   p.Do(m_sync_ticks);
   p.Do(m_syncing_suspended);
@@ -111,6 +113,7 @@ void FifoManager::Shutdown()
   m_video_buffer_pp_read_ptr = nullptr;
   m_video_buffer_read_ptr = nullptr;
   m_video_buffer_seen_ptr = nullptr;
+  m_video_buffer_synced_write_ptr = nullptr;
   m_fifo_aux_write_ptr = nullptr;
   m_fifo_aux_read_ptr = nullptr;
 
@@ -150,6 +153,14 @@ void FifoManager::SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
 {
   if (m_use_deterministic_gpu_thread)
   {
+    // EFB accesses have to be ordered against the commands queued before them, which the GPU
+    // thread has already finished if nothing was queued since the last sync.
+    if ((reason == SyncGPUReason::EFBPoke || reason == SyncGPUReason::EFBPeek) &&
+        m_video_buffer_write_ptr == m_video_buffer_synced_write_ptr)
+    {
+      return;
+    }
+
     m_gpu_mainloop.Wait();
     if (!m_gpu_mainloop.IsRunning())
       return;
@@ -181,6 +192,8 @@ void FifoManager::SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
       m_video_buffer_read_ptr = m_video_buffer;
       m_video_buffer_seen_ptr = write_ptr;
     }
+
+    m_video_buffer_synced_write_ptr = m_video_buffer_write_ptr;
   }
 }
 
@@ -236,6 +249,33 @@ void FifoManager::ReadDataFromFifo(u32 read_ptr)
   m_video_buffer_write_ptr += GPFifo::GATHER_PIPE_SIZE;
 }
 
+// Decodes the FIFO chunk at read_ptr, along with any incomplete command left over from earlier
+// chunks. The CPU doesn't overwrite a chunk before the read pointer has moved past it, so when
+// nothing is left over, the chunk is decoded straight out of emulated memory and only an
+// incomplete command at its end is copied to m_video_buffer.
+void FifoManager::DecodeDataFromFifo(u32 read_ptr, u32* cycles)
+{
+  if (m_video_buffer_read_ptr == m_video_buffer_write_ptr)
+  {
+    auto& memory = m_system.GetMemory();
+    u8* const chunk = memory.GetPointerForRange(read_ptr, GPFifo::GATHER_PIPE_SIZE);
+    if (chunk != nullptr)
+    {
+      u8* const chunk_end = chunk + GPFifo::GATHER_PIPE_SIZE;
+      const u8* const chunk_read_ptr = OpcodeDecoder::RunFifo(DataReader(chunk, chunk_end), cycles);
+      const size_t remaining = chunk_end - chunk_read_ptr;
+      std::memcpy(m_video_buffer, chunk_read_ptr, remaining);
+      m_video_buffer_read_ptr = m_video_buffer;
+      m_video_buffer_write_ptr = m_video_buffer + remaining;
+      return;
+    }
+  }
+
+  ReadDataFromFifo(read_ptr);
+  m_video_buffer_read_ptr =
+      OpcodeDecoder::RunFifo(DataReader(m_video_buffer_read_ptr, m_video_buffer_write_ptr), cycles);
+}
+
 // The deterministic_gpu_thread version.
 void FifoManager::ReadDataFromFifoOnCPU(u32 read_ptr)
 {
@@ -279,12 +319,20 @@ void FifoManager::ResetVideoBuffer()
   m_video_buffer_write_ptr = m_video_buffer;
   m_video_buffer_seen_ptr = m_video_buffer;
   m_video_buffer_pp_read_ptr = m_video_buffer;
+  m_video_buffer_synced_write_ptr = nullptr;
   m_fifo_aux_write_ptr = m_fifo_aux_data;
   m_fifo_aux_read_ptr = m_fifo_aux_data;
 }
 
 // Description: Main FIFO update loop
 // Purpose: Keep the Core HW updated about the CPU-GPU distance
+//
+// Decoding and drawing can't be split into separate threads here: every command updates the
+// global BP/CP/XF state which the following draws are built from, and the CPU thread can observe
+// the read pointer at any command (PE tokens, finish interrupts, breakpoints). The split that is
+// possible is the deterministic GPU thread mode, where the CPU thread runs the preprocessing pass
+// (g_preprocess_vertex_loaders) ahead of this loop. The backends that can, move their command
+// submission to a worker thread of their own.
 void FifoManager::RunGpuLoop()
 {
   AsyncRequests::GetInstance()->SetEnable(true);
@@ -299,6 +347,8 @@ void FifoManager::RunGpuLoop()
         if (!m_emu_running_state.IsSet())
           return;
 
+        TRACE_ZONE("GPU loop");
+
         if (m_use_deterministic_gpu_thread)
         {
           // All the fifo/CP stuff is on the CPU.  We just need to run the opcode decoder.
@@ -329,7 +379,7 @@ void FifoManager::RunGpuLoop()
 
             u32 cyclesExecuted = 0;
             u32 readPtr = fifo.CPReadPointer.load(std::memory_order_relaxed);
-            ReadDataFromFifo(readPtr);
+            DecodeDataFromFifo(readPtr, &cyclesExecuted);
 
             if (readPtr == fifo.CPEnd.load(std::memory_order_relaxed))
               readPtr = fifo.CPBase.load(std::memory_order_relaxed);
@@ -345,8 +395,6 @@ void FifoManager::RunGpuLoop()
                        distance);
 
             u8* write_ptr = m_video_buffer_write_ptr;
-            m_video_buffer_read_ptr = OpcodeDecoder::RunFifo(
-                DataReader(m_video_buffer_read_ptr, write_ptr), &cyclesExecuted);
 
             fifo.CPReadPointer.store(readPtr, std::memory_order_relaxed);
             fifo.CPReadWriteDistance.fetch_sub(GPFifo::GATHER_PIPE_SIZE, std::memory_order_seq_cst);
@@ -463,10 +511,8 @@ int FifoManager::RunGpuOnCpu(int ticks)
         Common::FPU::LoadDefaultSIMDState();
         reset_simd_state = true;
       }
-      ReadDataFromFifo(fifo.CPReadPointer.load(std::memory_order_relaxed));
       u32 cycles = 0;
-      m_video_buffer_read_ptr = OpcodeDecoder::RunFifo(
-          DataReader(m_video_buffer_read_ptr, m_video_buffer_write_ptr), &cycles);
+      DecodeDataFromFifo(fifo.CPReadPointer.load(std::memory_order_relaxed), &cycles);
       available_ticks -= cycles;
     }
 
@@ -529,6 +575,7 @@ void FifoManager::UpdateWantDeterminism(bool want)
     {
       // These haven't been updated in non-deterministic mode.
       m_video_buffer_seen_ptr = m_video_buffer_pp_read_ptr = m_video_buffer_read_ptr;
+      m_video_buffer_synced_write_ptr = nullptr;
       CopyPreprocessCPStateFromMain();
       VertexLoaderManager::MarkAllDirty();
     }
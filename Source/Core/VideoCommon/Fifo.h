@@ -32,6 +32,7 @@ enum class SyncGPUReason
   Other,
   Wraparound,
   EFBPoke,
+  EFBPeek,
   PerfQuery,
   BBox,
   Swap,
@@ -58,6 +59,8 @@ public:
   bool UseSyncGPU() const { return m_config_sync_gpu; }
 
   // In deterministic GPU thread mode this waits for the GPU to be done with pending work.
+  // EFB accesses skip the wait if no commands were queued since the last one, so runs of pokes
+  // don't round-trip through the GPU thread one at a time.
   void SyncGPU(SyncGPUReason reason, bool may_move_read_ptr = true);
 
   // In single core mode, this runs the GPU for a single slice.
@@ -78,6 +81,7 @@ public:
 private:
   void RefreshConfig();
   void ReadDataFromFifo(u32 read_ptr);
+  void DecodeDataFromFifo(u32 read_ptr, u32* cycles);
   void ReadDataFromFifoOnCPU(u32 read_ptr);
   int RunGpuOnCpu(int ticks);
   int WaitForGpuThread(int ticks);
@@ -106,6 +110,9 @@ private:
   std::atomic<u8*> m_video_buffer_write_ptr = nullptr;
   std::atomic<u8*> m_video_buffer_seen_ptr = nullptr;
   u8* m_video_buffer_pp_read_ptr = nullptr;
+  // Deterministic GPU thread mode only: the write_ptr as of the last completed SyncGPU, owned by
+  // the CPU thread. Everything before it has already been processed by the GPU thread.
+  u8* m_video_buffer_synced_write_ptr = nullptr;
   // The read_ptr is always owned by the GPU thread.  In normal mode, so is the
   // write_ptr, despite it being atomic.  In deterministic GPU thread mode,
   // things get a bit more complicated:
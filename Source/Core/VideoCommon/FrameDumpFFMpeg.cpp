@@ -18,6 +18,7 @@ extern "C" {
 #include <libavcodec/avcodec.h>
 #include <libavformat/avformat.h>
 #include <libavutil/error.h>
+#include <libavutil/hwcontext.h>
 #include <libavutil/log.h>
 #include <libavutil/mathematics.h>
 #include <libavutil/opt.h>
@@ -51,6 +52,14 @@ struct FrameDumpContext
   AVFrame* scaled_frame = nullptr;
   SwsContext* sws = nullptr;
 
+  // Format the frames are converted to in system memory.
+  AVPixelFormat sw_pix_fmt = AV_PIX_FMT_NONE;
+
+  // Used to upload the converted frames for encoders which need them in GPU memory.
+  AVBufferRef* hw_device = nullptr;
+  AVBufferRef* hw_frames = nullptr;
+  AVFrame* hw_frame = nullptr;
+
   s64 last_pts = AV_NOPTS_VALUE;
 
   int width = 0;
@@ -158,6 +167,74 @@ std::string AVErrorString(int error)
   return fmt::format("{:8x} {}", (u32)error, &msg[0]);
 }
 
+// Returns the type of device an encoder needs its frames to be uploaded to, or
+// AV_HWDEVICE_TYPE_NONE if it takes frames in system memory. Hardware encoders which accept
+// system memory frames (like NVENC) do the upload themselves, so this only applies to the ones
+// preferring a hardware pixel format (like VAAPI and VideoToolbox).
+AVHWDeviceType GetHWDeviceTypeForEncoder(const AVCodec* codec)
+{
+  if (!codec->pix_fmts || codec->pix_fmts[0] == AV_PIX_FMT_NONE)
+    return AV_HWDEVICE_TYPE_NONE;
+
+  const AVPixFmtDescriptor* const desc = av_pix_fmt_desc_get(codec->pix_fmts[0]);
+  if (!desc || !(desc->flags & AV_PIX_FMT_FLAG_HWACCEL))
+    return AV_HWDEVICE_TYPE_NONE;
+
+  for (int i = 0;; ++i)
+  {
+    const AVCodecHWConfig* const config = avcodec_get_hw_config(codec, i);
+    if (!config)
+      return AV_HWDEVICE_TYPE_NONE;
+
+    if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_FRAMES_CTX) &&
+        config->pix_fmt == codec->pix_fmts[0])
+    {
+      return config->device_type;
+    }
+  }
+}
+
+bool CreateHWFramesContext(FrameDumpContext* context, const AVCodec* codec,
+                           AVHWDeviceType device_type)
+{
+  const char* const device_name = av_hwdevice_get_type_name(device_type);
+  if (const int error =
+          av_hwdevice_ctx_create(&context->hw_device, device_type, nullptr, nullptr, 0))
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not create {} device: {}", device_name, AVErrorString(error));
+    return false;
+  }
+
+  context->hw_frames = av_hwframe_ctx_alloc(context->hw_device);
+  context->hw_frame = av_frame_alloc();
+  if (!context->hw_frames || !context->hw_frame)
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not allocate {} frames", device_name);
+    return false;
+  }
+
+  auto* const frames = reinterpret_cast<AVHWFramesContext*>(context->hw_frames->data);
+  frames->format = codec->pix_fmts[0];
+  frames->sw_format = context->sw_pix_fmt;
+  frames->width = context->width;
+  frames->height = context->height;
+  // Some devices need a fixed pool. Leave room for the frames the encoder holds on to.
+  frames->initial_pool_size = 20;
+
+  if (const int error = av_hwframe_ctx_init(context->hw_frames))
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not initialize {} frames with pixel format {}: {}",
+                  device_name, av_get_pix_fmt_name(context->sw_pix_fmt), AVErrorString(error));
+    return false;
+  }
+
+  context->codec->hw_frames_ctx = av_buffer_ref(context->hw_frames);
+  context->codec->pix_fmt = frames->format;
+
+  INFO_LOG_FMT(FRAMEDUMP, "Uploading frames to {} for encoding", device_name);
+  return true;
+}
+
 }  // namespace
 
 bool FFMpegFrameDump::Start(int w, int h, u64 start_ticks)
@@ -265,6 +342,8 @@ bool FFMpegFrameDump::CreateVideoFile()
   m_context->codec->gop_size = 1;
   m_context->codec->level = 1;
 
+  const AVHWDeviceType hw_device_type = GetHWDeviceTypeForEncoder(codec);
+
   AVPixelFormat pix_fmt = AV_PIX_FMT_NONE;
 
   const std::string& pixel_format_string = g_Config.sDumpPixelFormat;
@@ -277,7 +356,10 @@ bool FFMpegFrameDump::CreateVideoFile()
 
   if (pix_fmt == AV_PIX_FMT_NONE)
   {
-    if (m_context->codec->codec_id == AV_CODEC_ID_FFV1)
+    // NV12 is the format hardware encoders universally support for uploads.
+    if (hw_device_type != AV_HWDEVICE_TYPE_NONE)
+      pix_fmt = AV_PIX_FMT_NV12;
+    else if (m_context->codec->codec_id == AV_CODEC_ID_FFV1)
       pix_fmt = AV_PIX_FMT_BGR0;
     else if (m_context->codec->codec_id == AV_CODEC_ID_UTVIDEO)
       pix_fmt = AV_PIX_FMT_GBRP;
@@ -285,8 +367,15 @@ bool FFMpegFrameDump::CreateVideoFile()
       pix_fmt = AV_PIX_FMT_YUV420P;
   }
 
+  m_context->sw_pix_fmt = pix_fmt;
   m_context->codec->pix_fmt = pix_fmt;
 
+  if (hw_device_type != AV_HWDEVICE_TYPE_NONE &&
+      !CreateHWFramesContext(m_context.get(), codec, hw_device_type))
+  {
+    return false;
+  }
+
   if (m_context->codec->codec_id == AV_CODEC_ID_UTVIDEO)
     av_opt_set_int(m_context->codec->priv_data, "pred", 3, 0);  // median
 
@@ -302,7 +391,7 @@ bool FFMpegFrameDump::CreateVideoFile()
   m_context->src_frame = av_frame_alloc();
   m_context->scaled_frame = av_frame_alloc();
 
-  m_context->scaled_frame->format = m_context->codec->pix_fmt;
+  m_context->scaled_frame->format = m_context->sw_pix_fmt;
   m_context->scaled_frame->width = m_context->width;
   m_context->scaled_frame->height = m_context->height;
 
@@ -387,17 +476,33 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
   // Convert image from RGBA to desired pixel format.
   m_context->sws = sws_getCachedContext(
       m_context->sws, frame.width, frame.height, pix_fmt, m_context->width, m_context->height,
-      m_context->codec->pix_fmt, SWS_BICUBIC, nullptr, nullptr, nullptr);
+      m_context->sw_pix_fmt, SWS_BICUBIC, nullptr, nullptr, nullptr);
   if (m_context->sws)
   {
     sws_scale(m_context->sws, m_context->src_frame->data, m_context->src_frame->linesize, 0,
               frame.height, m_context->scaled_frame->data, m_context->scaled_frame->linesize);
   }
 
+  AVFrame* encode_frame = m_context->scaled_frame;
+  if (m_context->hw_frames)
+  {
+    // The encoder keeps references to the frames it still needs, so take a new one from the pool.
+    av_frame_unref(m_context->hw_frame);
+    int error = av_hwframe_get_buffer(m_context->hw_frames, m_context->hw_frame, 0);
+    if (error == 0)
+      error = av_hwframe_transfer_data(m_context->hw_frame, m_context->scaled_frame, 0);
+    if (error < 0)
+    {
+      ERROR_LOG_FMT(FRAMEDUMP, "Error while uploading video: {}", AVErrorString(error));
+      return;
+    }
+    encode_frame = m_context->hw_frame;
+  }
+
   m_context->last_pts = pts;
-  m_context->scaled_frame->pts = pts;
+  encode_frame->pts = pts;
 
-  if (const int error = avcodec_send_frame(m_context->codec, m_context->scaled_frame))
+  if (const int error = avcodec_send_frame(m_context->codec, encode_frame))
   {
     ERROR_LOG_FMT(FRAMEDUMP, "Error while encoding video: {}", AVErrorString(error));
     return;
@@ -470,8 +575,11 @@ void FFMpegFrameDump::CloseVideoFile()
 {
   av_frame_free(&m_context->src_frame);
   av_frame_free(&m_context->scaled_frame);
+  av_frame_free(&m_context->hw_frame);
 
   avcodec_free_context(&m_context->codec);
+  av_buffer_unref(&m_context->hw_frames);
+  av_buffer_unref(&m_context->hw_device);
 
   if (m_context->format)
     avio_closep(&m_context->format->pb);
@@ -21,17 +21,15 @@
 // The video encoder needs the image to be a multiple of x samples.
 static constexpr int VIDEO_ENCODER_LCM = 4;
 
-static bool DumpFrameToPNG(const FrameData& frame, const std::string& file_name)
-{
-  return Common::ConvertRGBAToRGBAndSavePNG(file_name, frame.data, frame.width, frame.height,
-                                            frame.stride,
-                                            Config::Get(Config::GFX_PNG_COMPRESSION_LEVEL));
-}
-
 FrameDumper::FrameDumper()
 {
-  m_frame_end_handle =
-      AfterFrameEvent::Register([this](Core::System&) { FlushFrameDump(); }, "FrameDumper");
+  m_frame_end_handle = AfterFrameEvent::Register(
+      [this](Core::System&) {
+        // Shutdown frame dumping if it is no longer active.
+        if (!IsFrameDumping())
+          ShutdownFrameDumping();
+      },
+      "FrameDumper");
 }
 
 FrameDumper::~FrameDumper()
@@ -62,13 +60,17 @@ void FrameDumper::DumpCurrentFrame(const AbstractTexture* src_texture,
     copy_rect = src_texture->GetRect();
   }
 
-  if (!CheckFrameDumpReadbackTexture(target_width, target_height))
+  // Send the oldest frames to the encoder, so that a readback is free for this one.
+  SendReadbacksToEncoder(MAX_PENDING_READBACKS - 1);
+
+  const u32 index = (m_first_pending_readback + m_pending_readback_count) % m_readbacks.size();
+  Readback& readback = m_readbacks[index];
+  if (!CheckFrameDumpReadbackTexture(readback.texture, target_width, target_height))
     return;
 
-  m_frame_dump_readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
-                                                 m_frame_dump_readback_texture->GetRect());
-  m_last_frame_state = m_ffmpeg_dump.FetchState(ticks, frame_number);
-  m_frame_dump_needs_flush = true;
+  readback.texture->CopyFromTexture(src_texture, copy_rect, 0, 0, readback.texture->GetRect());
+  readback.state = m_ffmpeg_dump.FetchState(ticks, frame_number);
+  m_pending_readback_count++;
 }
 
 bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
@@ -99,9 +101,9 @@ bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_heigh
   return true;
 }
 
-bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height)
+bool FrameDumper::CheckFrameDumpReadbackTexture(std::unique_ptr<AbstractStagingTexture>& rbtex,
+                                                 u32 target_width, u32 target_height)
 {
-  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_texture;
   if (rbtex && rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
     return true;
 
@@ -118,37 +120,40 @@ bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_hei
 
 void FrameDumper::FlushFrameDump()
 {
-  if (!m_frame_dump_needs_flush)
-    return;
-
-  // Ensure dumping thread is done with output texture before swapping.
-  FinishFrameData();
-
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
+  SendReadbacksToEncoder(0);
+}
 
-  // Queue encoding of the last frame dumped.
-  auto& output = m_frame_dump_output_texture;
-  output->Flush();
-  if (output->Map())
-  {
-    DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
-                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
-  }
-  else
+void FrameDumper::SendReadbacksToEncoder(u32 max_pending)
+{
+  while (m_pending_readback_count > max_pending)
   {
-    ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
+    // Ensure dumping thread is done with the previous output texture before replacing it.
+    FinishFrameData();
+
+    m_output_readback = m_first_pending_readback;
+    m_first_pending_readback = (m_first_pending_readback + 1) % m_readbacks.size();
+    m_pending_readback_count--;
+
+    // Queue encoding of the oldest frame dumped.
+    const Readback& readback = m_readbacks[m_output_readback];
+    AbstractStagingTexture* output = readback.texture.get();
+    output->Flush();
+    if (output->Map())
+    {
+      DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
+                    output->GetConfig().height, static_cast<int>(output->GetMappedStride()),
+                    readback.state);
+    }
+    else
+    {
+      ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
+    }
   }
-
-  m_frame_dump_needs_flush = false;
-
-  // Shutdown frame dumping if it is no longer active.
-  if (!IsFrameDumping())
-    ShutdownFrameDumping();
 }
 
 void FrameDumper::ShutdownFrameDumping()
 {
-  // Ensure the last queued readback has been sent to the encoder.
+  // Ensure all queued readbacks have been sent to the encoder.
   FlushFrameDump();
 
   if (!m_frame_dump_thread_running.IsSet())
@@ -165,13 +170,15 @@ void FrameDumper::ShutdownFrameDumping()
   m_frame_dump_render_framebuffer.reset();
   m_frame_dump_render_texture.reset();
 
-  m_frame_dump_readback_texture.reset();
-  m_frame_dump_output_texture.reset();
+  for (Readback& readback : m_readbacks)
+    readback.texture.reset();
+
+  FinishImageEncodes();
 }
 
-void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
+void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride, const FrameState& state)
 {
-  m_frame_dump_data = FrameData{data, w, h, stride, m_last_frame_state};
+  m_frame_dump_data = FrameData{data, w, h, stride, state};
 
   if (!m_frame_dump_thread_running.IsSet())
   {
@@ -194,7 +201,7 @@ void FrameDumper::FinishFrameData()
   m_frame_dump_done.Wait();
   m_frame_dump_frame_running = false;
 
-  m_frame_dump_output_texture->Unmap();
+  m_readbacks[m_output_readback].texture->Unmap();
 }
 
 void FrameDumper::FrameDumpThreadFunc()
@@ -227,12 +234,10 @@ void FrameDumper::FrameDumpThreadFunc()
     {
       std::lock_guard<std::mutex> lk(m_screenshot_lock);
 
-      if (DumpFrameToPNG(frame, m_screenshot_name))
-        OSD::AddMessage("Screenshot saved to " + m_screenshot_name);
+      QueueImageEncode(frame, std::move(m_screenshot_name), true);
 
       // Reset settings
       m_screenshot_name.clear();
-      m_screenshot_completed.Set();
     }
 
     if (Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES))
@@ -335,10 +340,62 @@ bool FrameDumper::StartFrameDumpToImage(const FrameData&)
 
 void FrameDumper::DumpFrameToImage(const FrameData& frame)
 {
-  DumpFrameToPNG(frame, GetFrameDumpNextImageFileName());
+  QueueImageEncode(frame, GetFrameDumpNextImageFileName(), false);
   m_frame_dump_image_counter++;
 }
 
+void FrameDumper::QueueImageEncode(const FrameData& frame, std::string filename,
+                                   bool is_screenshot)
+{
+  {
+    std::unique_lock lk(m_image_encode_lock);
+    m_image_encode_cv.wait(lk,
+                           [this] { return m_queued_image_encodes < MAX_QUEUED_IMAGE_ENCODES; });
+    m_queued_image_encodes++;
+  }
+
+  if (!m_image_encoders_started)
+  {
+    for (auto& encoder : m_image_encoders)
+      encoder.Reset("Image Encoder", [this](ImageEncodeJob job) { EncodeImage(std::move(job)); });
+    m_image_encoders_started = true;
+  }
+
+  ImageEncodeJob job{.filename = std::move(filename),
+                     .width = frame.width,
+                     .height = frame.height,
+                     .stride = frame.stride,
+                     .compression_level = Config::Get(Config::GFX_PNG_COMPRESSION_LEVEL),
+                     .is_screenshot = is_screenshot};
+  job.data.assign(frame.data, frame.data + static_cast<size_t>(frame.stride) * frame.height);
+
+  m_image_encoders[m_next_image_encoder].Push(std::move(job));
+  m_next_image_encoder = (m_next_image_encoder + 1) % NUM_IMAGE_ENCODERS;
+}
+
+void FrameDumper::EncodeImage(ImageEncodeJob job)
+{
+  const bool saved =
+      Common::ConvertRGBAToRGBAndSavePNG(job.filename, job.data.data(), job.width, job.height,
+                                         job.stride, job.compression_level);
+  if (job.is_screenshot)
+  {
+    if (saved)
+      OSD::AddMessage("Screenshot saved to " + job.filename);
+    m_screenshot_completed.Set();
+  }
+
+  std::lock_guard lk(m_image_encode_lock);
+  m_queued_image_encodes--;
+  m_image_encode_cv.notify_all();
+}
+
+void FrameDumper::FinishImageEncodes()
+{
+  std::unique_lock lk(m_image_encode_lock);
+  m_image_encode_cv.wait(lk, [this] { return m_queued_image_encodes == 0; });
+}
+
 void FrameDumper::SaveScreenshot(std::string filename)
 {
   std::lock_guard<std::mutex> lk(m_screenshot_lock);
@@ -3,11 +3,18 @@
 
 #pragma once
 
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
 #include "Common/MathUtil.h"
 #include "Common/Thread.h"
+#include "Common/WorkQueueThread.h"
 
 #include "VideoCommon/FrameDumpFFMpeg.h"
 #include "VideoCommon/VideoEvents.h"
@@ -47,20 +54,44 @@ private:
   bool StartFrameDumpToImage(const FrameData&);
   void DumpFrameToImage(const FrameData&);
 
+  struct ImageEncodeJob
+  {
+    std::string filename;
+    std::vector<u8> data;
+    int width;
+    int height;
+    int stride;
+    int compression_level;
+    bool is_screenshot;
+  };
+
+  // Copies the frame and queues it to be saved as a PNG on one of the image encoders. Blocks while
+  // MAX_QUEUED_IMAGE_ENCODES frames are already queued.
+  void QueueImageEncode(const FrameData& frame, std::string filename, bool is_screenshot);
+  // Called on the image encoder threads.
+  void EncodeImage(ImageEncodeJob job);
+
   void ShutdownFrameDumping();
 
+  // Sends the oldest readbacks to the encoder until at most max_pending are left in flight.
+  void SendReadbacksToEncoder(u32 max_pending);
+
   // Checks that the frame dump render texture exists and is the correct size.
   bool CheckFrameDumpRenderTexture(u32 target_width, u32 target_height);
 
-  // Checks that the frame dump readback texture exists and is the correct size.
-  bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
+  // Checks that the given frame dump readback texture exists and is the correct size.
+  bool CheckFrameDumpReadbackTexture(std::unique_ptr<AbstractStagingTexture>& texture,
+                                     u32 target_width, u32 target_height);
 
   // Asynchronously encodes the specified pointer of frame data to the frame dump.
-  void DumpFrameData(const u8* data, int w, int h, int stride);
+  void DumpFrameData(const u8* data, int w, int h, int stride, const FrameState& state);
 
   // Ensures all encoded frames have been written to the output file.
   void FinishFrameData();
 
+  // Ensures all queued images have been saved.
+  void FinishImageEncodes();
+
   std::thread m_frame_dump_thread;
   Common::Flag m_frame_dump_thread_running;
 
@@ -70,9 +101,6 @@ private:
   // Set by frame dump thread on frame completion.
   Common::Event m_frame_dump_done;
 
-  // Holds emulation state during the last swap when dumping.
-  FrameState m_last_frame_state;
-
   // Communication of frame between video and dump threads.
   FrameData m_frame_dump_data;
 
@@ -80,12 +108,23 @@ private:
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
-  // Set when readback texture holds a frame that needs to be dumped.
-  bool m_frame_dump_needs_flush = false;
-  // Set when thread is processing output texture.
+  // Ring of readback textures. Mapping a readback waits for the GPU to finish the copy, so up to
+  // MAX_PENDING_READBACKS frames are kept in flight before the oldest is sent to the encoder. One
+  // more texture is owned by the frame dump thread while it encodes.
+  static constexpr u32 MAX_PENDING_READBACKS = 2;
+  struct Readback
+  {
+    std::unique_ptr<AbstractStagingTexture> texture;
+    // Emulation state at the time the frame was copied.
+    FrameState state;
+  };
+  std::array<Readback, MAX_PENDING_READBACKS + 1> m_readbacks;
+  // Index of the oldest readback which hasn't been sent to the encoder yet.
+  u32 m_first_pending_readback = 0;
+  u32 m_pending_readback_count = 0;
+  // Index of the readback the frame dump thread is processing, set while it is running.
+  u32 m_output_readback = 0;
+  // Set when thread is processing the output readback.
   bool m_frame_dump_frame_running = false;
 
   // Used to generate screenshot names.
@@ -99,6 +138,19 @@ private:
   std::mutex m_screenshot_lock;
   std::string m_screenshot_name;
 
+  // PNG encoding is slower than producing frames, so screenshots and image dumps are encoded on a
+  // few separate threads. This lets the frame dump thread release its readback texture right away
+  // instead of stalling presentation while a frame is compressed.
+  static constexpr u32 NUM_IMAGE_ENCODERS = 2;
+  static constexpr u32 MAX_QUEUED_IMAGE_ENCODES = 8;
+  std::mutex m_image_encode_lock;
+  std::condition_variable m_image_encode_cv;
+  u32 m_queued_image_encodes = 0;
+  u32 m_next_image_encoder = 0;
+  bool m_image_encoders_started = false;
+  // Declared last, so that the threads are stopped before anything they use is destroyed.
+  std::array<Common::WorkQueueThread<ImageEncodeJob>, NUM_IMAGE_ENCODERS> m_image_encoders;
+
   Common::EventHook m_frame_end_handle;
 };
 
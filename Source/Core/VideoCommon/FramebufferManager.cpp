@@ -3,13 +3,17 @@
 
 #include "VideoCommon/FramebufferManager.h"
 
-#include <fmt/format.h>
+#include <algorithm>
+#include <cmath>
 #include <memory>
 
+#include <fmt/format.h>
+
 #include "Common/ChunkFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Core/Config/GraphicsSettings.h"
+#include "Core/HW/VideoInterface.h"
 #include "Core/System.h"
 #include "VideoCommon/AbstractFramebuffer.h"
 #include "VideoCommon/AbstractGfx.h"
@@ -20,8 +24,10 @@
 #include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/FramebufferShaderGen.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Present.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -210,16 +216,30 @@ float FramebufferManager::EFBToScaledYf(float y) const
   return y * ((float)GetEFBHeight() / (float)EFB_HEIGHT);
 }
 
-std::tuple<u32, u32> FramebufferManager::CalculateTargetSize()
+u32 FramebufferManager::GetConfiguredEFBScale() const
 {
-  if (g_ActiveConfig.iEFBScale == EFB_SCALE_AUTO_INTEGRAL)
-    m_efb_scale = g_presenter->AutoIntegralScale();
-  else
-    m_efb_scale = g_ActiveConfig.iEFBScale;
+  u32 scale = g_ActiveConfig.iEFBScale == EFB_SCALE_AUTO_INTEGRAL ?
+                  g_presenter->AutoIntegralScale() :
+                  static_cast<u32>(g_ActiveConfig.iEFBScale);
 
   const u32 max_size = g_ActiveConfig.backend_info.MaxTextureSize;
-  if (max_size < EFB_WIDTH * m_efb_scale)
-    m_efb_scale = max_size / EFB_WIDTH;
+  if (max_size < EFB_WIDTH * scale)
+    scale = max_size / EFB_WIDTH;
+
+  return scale;
+}
+
+std::tuple<u32, u32> FramebufferManager::CalculateTargetSize()
+{
+  m_efb_scale = GetConfiguredEFBScale();
+
+  if (g_ActiveConfig.bDynamicEFBScale && m_dynamic_efb_scale != 0)
+  {
+    if (m_dynamic_efb_scale >= m_efb_scale)
+      m_dynamic_efb_scale = 0;
+    else
+      m_efb_scale = m_dynamic_efb_scale;
+  }
 
   u32 new_efb_width = std::max(EFB_WIDTH * static_cast<int>(m_efb_scale), 1u);
   u32 new_efb_height = std::max(EFB_HEIGHT * static_cast<int>(m_efb_scale), 1u);
@@ -227,6 +247,72 @@ std::tuple<u32, u32> FramebufferManager::CalculateTargetSize()
   return std::make_tuple(new_efb_width, new_efb_height);
 }
 
+bool FramebufferManager::UpdateDynamicEFBScale()
+{
+  if (!g_ActiveConfig.bDynamicEFBScale)
+  {
+    // Go back to the configured scale.
+    const bool was_dynamic = m_dynamic_efb_scale != 0;
+    m_dynamic_efb_scale = 0;
+    return was_dynamic;
+  }
+
+  // Judge the scale by the average GPU time over this many frames.
+  static constexpr u64 SAMPLE_FRAMES = 60;
+
+  const auto [gpu_frames, gpu_time] = g_perf_metrics.GetGPUFrameTimeTotal();
+  if (gpu_frames < m_dynamic_efb_scale_gpu_frames)
+  {
+    // The performance metrics were reset.
+    m_dynamic_efb_scale_gpu_frames = gpu_frames;
+    m_dynamic_efb_scale_gpu_time = gpu_time;
+  }
+
+  // Backends which don't report GPU times never get past this.
+  if (gpu_frames - m_dynamic_efb_scale_gpu_frames < SAMPLE_FRAMES)
+    return false;
+
+  const double average_gpu_time =
+      DT_s(gpu_time - m_dynamic_efb_scale_gpu_time).count() /
+      static_cast<double>(gpu_frames - m_dynamic_efb_scale_gpu_frames);
+  m_dynamic_efb_scale_gpu_frames = gpu_frames;
+  m_dynamic_efb_scale_gpu_time = gpu_time;
+
+  // The time available for a frame. Games running below the refresh rate get several fields.
+  const double refresh_rate =
+      Core::System::GetInstance().GetVideoInterface().GetTargetRefreshRate();
+  const double fps = g_perf_metrics.GetFPS();
+  if (refresh_rate <= 0.0 || fps <= 0.0)
+    return false;
+  const double fields_per_frame = std::max(std::round(g_perf_metrics.GetVPS() / fps), 1.0);
+  const double budget = fields_per_frame / refresh_rate;
+
+  const u32 scale = static_cast<u32>(m_efb_scale);
+  const u32 min_scale = static_cast<u32>(std::max(g_ActiveConfig.iDynamicEFBScaleMin, 1));
+  const u32 max_scale = GetConfiguredEFBScale();
+  u32 new_scale = scale;
+  if (average_gpu_time > budget * 0.9 && scale > min_scale)
+  {
+    new_scale = scale - 1;
+  }
+  else if (scale < max_scale)
+  {
+    // The GPU time mostly grows with the number of pixels, so only go up if the next scale is
+    // expected to leave some headroom.
+    const double growth = static_cast<double>((scale + 1) * (scale + 1)) / (scale * scale);
+    if (average_gpu_time * growth < budget * 0.75)
+      new_scale = scale + 1;
+  }
+
+  if (new_scale == scale)
+    return false;
+
+  INFO_LOG_FMT(VIDEO, "Dynamic resolution: changing EFB scale from {}x to {}x ({:.2f}ms GPU time)",
+               scale, new_scale, average_gpu_time * 1000.0);
+  m_dynamic_efb_scale = new_scale < max_scale ? new_scale : 0;
+  return true;
+}
+
 bool FramebufferManager::CreateEFBFramebuffer()
 {
   auto [width, height] = CalculateTargetSize();
@@ -480,7 +566,13 @@ u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
 
   u32 tile_index;
   if (!IsEFBCacheTilePresent(false, x, y, &tile_index))
+  {
+    u32 value;
+    if (g_ActiveConfig.bEFBAccessDelayed && ReadDelayedEFBCache(false, x, y, tile_index, &value))
+      return value;
+
     PopulateEFBCache(false, tile_index);
+  }
 
   m_efb_color_cache.tiles[tile_index].frame_access_mask |= 1;
 
@@ -503,7 +595,13 @@ float FramebufferManager::PeekEFBDepth(u32 x, u32 y)
 
   u32 tile_index;
   if (!IsEFBCacheTilePresent(true, x, y, &tile_index))
+  {
+    float value;
+    if (g_ActiveConfig.bEFBAccessDelayed && ReadDelayedEFBCache(true, x, y, tile_index, &value))
+      return value;
+
     PopulateEFBCache(true, tile_index);
+  }
 
   m_efb_depth_cache.tiles[tile_index].frame_access_mask |= 1;
 
@@ -566,8 +664,14 @@ void FramebufferManager::InvalidatePeekCache(bool forced)
 {
   if (forced || m_efb_color_cache.out_of_date)
   {
+    if (forced)
+      m_efb_color_cache.delayed_tiles_present.clear();
+
     if (m_efb_color_cache.has_active_tiles)
     {
+      if (!forced && g_ActiveConfig.bEFBAccessDelayed)
+        KeepDelayedEFBCache(m_efb_color_cache);
+
       for (u32 i = 0; i < m_efb_color_cache.tiles.size(); i++)
       {
         m_efb_color_cache.tiles[i].present = false;
@@ -581,8 +685,14 @@ void FramebufferManager::InvalidatePeekCache(bool forced)
   }
   if (forced || m_efb_depth_cache.out_of_date)
   {
+    if (forced)
+      m_efb_depth_cache.delayed_tiles_present.clear();
+
     if (m_efb_depth_cache.has_active_tiles)
     {
+      if (!forced && g_ActiveConfig.bEFBAccessDelayed)
+        KeepDelayedEFBCache(m_efb_depth_cache);
+
       for (u32 i = 0; i < m_efb_depth_cache.tiles.size(); i++)
       {
         m_efb_depth_cache.tiles[i].present = false;
@@ -609,6 +719,7 @@ void FramebufferManager::FlagPeekCacheAsOutOfDate()
 
 void FramebufferManager::EndOfFrame()
 {
+  m_efb_cache_frame_count++;
   for (u32 i = 0; i < m_efb_color_cache.tiles.size(); i++)
   {
     m_efb_color_cache.tiles[i].frame_access_mask <<= 1;
@@ -771,6 +882,8 @@ void FramebufferManager::DestroyReadbackFramebuffer()
 {
   auto DestroyCache = [](EFBCacheData& data) {
     data.readback_texture.reset();
+    data.delayed_readback_texture.reset();
+    data.delayed_tiles_present.clear();
     data.framebuffer.reset();
     data.texture.reset();
     data.needs_refresh = false;
@@ -841,6 +954,7 @@ void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index, bool async
   // Wait until the copy is complete.
   if (!async)
   {
+    INCSTAT(g_stats.this_frame.num_efb_peek_stalls);
     data.readback_texture->Flush();
     data.needs_flush = false;
   }
@@ -853,6 +967,51 @@ void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index, bool async
   data.tiles[tile_index].present = true;
 }
 
+void FramebufferManager::KeepDelayedEFBCache(EFBCacheData& data)
+{
+  if (!data.delayed_readback_texture)
+  {
+    data.delayed_readback_texture = g_gfx->CreateStagingTexture(
+        StagingTextureType::Mutable, data.readback_texture->GetConfig());
+    if (!data.delayed_readback_texture)
+      return;
+  }
+
+  // Swap the readbacks instead of copying, the current one is repopulated by the next refresh.
+  // Tiles with copies in flight are flushed before they are read from the delayed readback.
+  std::swap(data.readback_texture, data.delayed_readback_texture);
+  data.delayed_tiles_present.resize(data.tiles.size());
+  for (u32 i = 0; i < data.tiles.size(); i++)
+    data.delayed_tiles_present[i] = data.tiles[i].present;
+  data.delayed_frame = m_efb_cache_frame_count;
+  data.delayed_needs_flush = data.needs_flush;
+  data.needs_flush = false;
+}
+
+bool FramebufferManager::ReadDelayedEFBCache(bool depth, u32 x, u32 y, u32 tile_index, void* value)
+{
+  // Only serve data which is at most one frame old, as older data is unlikely to be accurate
+  // enough for the effects which depend on peeks.
+  EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
+  if (tile_index >= data.delayed_tiles_present.size() || !data.delayed_tiles_present[tile_index] ||
+      m_efb_cache_frame_count - data.delayed_frame > 1)
+  {
+    return false;
+  }
+
+  if (data.delayed_needs_flush)
+  {
+    data.delayed_readback_texture->Flush();
+    data.delayed_needs_flush = false;
+  }
+
+  // Mark the tile as accessed, so the next refresh repopulates it without stalling.
+  data.tiles[tile_index].frame_access_mask |= 1;
+  data.delayed_readback_texture->ReadTexel(x, y, value);
+  INCSTAT(g_stats.this_frame.num_efb_peeks_delayed);
+  return true;
+}
+
 void FramebufferManager::ClearEFB(const MathUtil::Rectangle<int>& rc, bool color_enable,
                                   bool alpha_enable, bool z_enable, u32 color, u32 z)
 {
@@ -959,6 +1118,14 @@ void FramebufferManager::PokeEFBColor(u32 x, u32 y, u32 color)
   u32 tile_index;
   if (IsEFBCacheTilePresent(false, x, y, &tile_index))
     m_efb_color_cache.readback_texture->WriteTexel(x, y, &color);
+
+  // The delayed readback can only be written once its copies have completed.
+  EFBCacheData& data = m_efb_color_cache;
+  if (tile_index < data.delayed_tiles_present.size() && data.delayed_tiles_present[tile_index] &&
+      !data.delayed_needs_flush)
+  {
+    data.delayed_readback_texture->WriteTexel(x, y, &color);
+  }
 }
 
 void FramebufferManager::PokeEFBDepth(u32 x, u32 y, float depth)
@@ -977,6 +1144,14 @@ void FramebufferManager::PokeEFBDepth(u32 x, u32 y, float depth)
   u32 tile_index;
   if (IsEFBCacheTilePresent(true, x, y, &tile_index))
     m_efb_depth_cache.readback_texture->WriteTexel(x, y, &depth);
+
+  // The delayed readback can only be written once its copies have completed.
+  EFBCacheData& data = m_efb_depth_cache;
+  if (tile_index < data.delayed_tiles_present.size() && data.delayed_tiles_present[tile_index] &&
+      !data.delayed_needs_flush)
+  {
+    data.delayed_readback_texture->WriteTexel(x, y, &depth);
+  }
 }
 
 void FramebufferManager::CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x,
@@ -90,6 +90,10 @@ public:
   // Recreate EFB framebuffers, call when the EFB size (IR) changes.
   void RecreateEFBFramebuffer();
 
+  // With dynamic resolution enabled, picks the EFB scale for the following frames from the GPU
+  // time of the recent ones. Returns true if the EFB has to be recreated at a new scale.
+  bool UpdateDynamicEFBScale();
+
   // Recompile shaders, use when MSAA mode changes.
   void RecompileShaders();
 
@@ -158,6 +162,13 @@ protected:
     bool has_active_tiles;
     bool needs_refresh;
     bool needs_flush;
+
+    // Previous readback, kept when the cache is invalidated for delayed EFB access. Peeks of tiles
+    // which are not present in the current readback are served from it instead of stalling.
+    std::unique_ptr<AbstractStagingTexture> delayed_readback_texture;
+    std::vector<bool> delayed_tiles_present;
+    u64 delayed_frame;
+    bool delayed_needs_flush;
   };
 
   bool CreateEFBFramebuffer();
@@ -182,6 +193,8 @@ protected:
   bool IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* tile_index) const;
   MathUtil::Rectangle<int> GetEFBCacheTileRect(u32 tile_index) const;
   void PopulateEFBCache(bool depth, u32 tile_index, bool async = false);
+  void KeepDelayedEFBCache(EFBCacheData& data);
+  bool ReadDelayedEFBCache(bool depth, u32 x, u32 y, u32 tile_index, void* value);
 
   void CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x, u32 y, float z,
                           u32 color);
@@ -189,12 +202,19 @@ protected:
   void DrawPokeVertices(const EFBPokeVertex* vertices, u32 vertex_count,
                         const AbstractPipeline* pipeline);
 
+  u32 GetConfiguredEFBScale() const;
   std::tuple<u32, u32> CalculateTargetSize();
 
   void DoLoadState(PointerWrap& p);
   void DoSaveState(PointerWrap& p);
 
   float m_efb_scale = 1.0f;
+
+  // EFB scale chosen by dynamic resolution, or 0 to use the configured one. It is always clamped
+  // to the configured scale, which acts as the upper bound.
+  u32 m_dynamic_efb_scale = 0;
+  u64 m_dynamic_efb_scale_gpu_frames = 0;
+  DT m_dynamic_efb_scale_gpu_time{};
   PixelFormat m_prev_efb_format;
 
   std::unique_ptr<AbstractTexture> m_efb_color_texture;
@@ -226,6 +246,8 @@ protected:
   u32 m_efb_cache_tile_row_stride = 1;
   EFBCacheData m_efb_color_cache = {};
   EFBCacheData m_efb_depth_cache = {};
+  // Number of frames presented, used to limit how old delayed EFB access data can be.
+  u64 m_efb_cache_frame_count = 0;
 
   // EFB clear pipelines
   // Indexed by [color_write_enabled][alpha_write_enabled][depth_write_enabled]
@@ -0,0 +1,26 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+#include "Common/EnumMap.h"
+
+// Coarse categories of GPU work, timed with timestamp queries on backends which support them.
+// A pass lasts from the point it is entered until the next pass change.
+enum class GPUTimingPass : u8
+{
+  Idle,
+  EFBDraw,
+  EFBCopy,
+  XFBCopy,
+  PostProcessing,
+  Present,
+};
+
+template <typename T>
+using GPUTimingPassMap = Common::EnumMap<T, GPUTimingPass::Present>;
+
+constexpr GPUTimingPassMap<const char*> GPU_TIMING_PASS_NAMES{
+    "Idle", "EFB draw", "EFB copy", "XFB copy", "Post-processing", "Present",
+};
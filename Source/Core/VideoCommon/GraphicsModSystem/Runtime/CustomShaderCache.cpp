@@ -2,9 +2,29 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "VideoCommon/GraphicsModSystem/Runtime/CustomShaderCache.h"
+
+#include <xxhash.h>
+
+#include "Common/Logging/Log.h"
+
 #include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/VideoConfig.h"
 
+namespace
+{
+u64 GetCustomShadersHash(const CustomShaderInstance& custom_shaders)
+{
+  u64 hash = 0;
+  for (const CustomPixelShader& shader : custom_shaders.pixel_contents.shaders)
+  {
+    hash = XXH3_64bits_withSeed(shader.custom_shader.data(), shader.custom_shader.size(), hash);
+    hash = XXH3_64bits_withSeed(shader.material_uniform_block.data(),
+                                shader.material_uniform_block.size(), hash);
+  }
+  return hash;
+}
+}  // namespace
+
 CustomShaderCache::CustomShaderCache()
 {
   m_api_type = g_ActiveConfig.backend_info.api_type;
@@ -16,6 +36,8 @@ CustomShaderCache::CustomShaderCache()
   m_async_uber_shader_compiler = g_gfx->CreateAsyncShaderCompiler();
   m_async_uber_shader_compiler->StartWorkerThreads(1);  // TODO
 
+  LoadCaches();
+
   m_frame_end_handler = AfterFrameEvent::Register([this](Core::System&) { RetrieveAsyncShaders(); },
                                                   "RetrieveAsyncShaders");
 }
@@ -27,6 +49,8 @@ CustomShaderCache::~CustomShaderCache()
 
   if (m_async_uber_shader_compiler)
     m_async_uber_shader_compiler->StopWorkerThreads();
+
+  ClearCaches();
 }
 
 void CustomShaderCache::RetrieveAsyncShaders()
@@ -52,6 +76,90 @@ void CustomShaderCache::Reload()
   m_uber_ps_cache = {};
   m_pipeline_cache = {};
   m_uber_pipeline_cache = {};
+
+  // The file names depend on the host config, so the disk caches have to be reopened.
+  ClearCaches();
+  LoadCaches();
+}
+
+template <typename Uid>
+void CustomShaderCache::LoadDiskShaderCache(DiskShaderCache<Uid>& cache, const char* type)
+{
+  class CacheReader : public Common::LinearDiskCacheReader<DiskCacheKey<Uid>, u8>
+  {
+  public:
+    CacheReader(DiskShaderCache<Uid>& cache_) : cache(cache_) {}
+    void Read(const DiskCacheKey<Uid>& key, const u8* value, u32 value_size) override
+    {
+      auto shader = g_gfx->CreateShaderFromBinary(ShaderStage::Pixel, value, value_size);
+      if (shader)
+        cache.shaders[key] = std::move(shader);
+    }
+
+  private:
+    DiskShaderCache<Uid>& cache;
+  };
+
+  std::string filename = GetDiskShaderCacheFileName(m_api_type, type, true, true);
+  CacheReader reader(cache);
+  const u32 count = cache.disk_cache.OpenAndRead(filename, reader);
+  INFO_LOG_FMT(VIDEO, "Loaded {} cached custom shaders from {}", count, filename);
+}
+
+template <typename Uid>
+void CustomShaderCache::ClearDiskShaderCache(DiskShaderCache<Uid>& cache)
+{
+  cache.disk_cache.Sync();
+  cache.disk_cache.Close();
+  cache.shaders.clear();
+}
+
+template <typename Uid>
+std::unique_ptr<AbstractShader>
+CustomShaderCache::TakeDiskShader(DiskShaderCache<Uid>& cache, const Uid& uid,
+                                  const CustomShaderInstance& custom_shaders)
+{
+  if (cache.shaders.empty())
+    return nullptr;
+
+  const auto it = cache.shaders.find({uid, GetCustomShadersHash(custom_shaders)});
+  if (it == cache.shaders.end())
+    return nullptr;
+
+  auto shader = std::move(it->second);
+  cache.shaders.erase(it);
+  return shader;
+}
+
+template <typename Uid>
+void CustomShaderCache::AppendDiskShader(DiskShaderCache<Uid>& cache, const Uid& uid,
+                                         const CustomShaderInstance& custom_shaders,
+                                         const AbstractShader& shader)
+{
+  if (!g_ActiveConfig.bShaderCache || !g_ActiveConfig.backend_info.bSupportsShaderBinaries)
+    return;
+
+  const auto binary = shader.GetBinary();
+  if (binary.empty())
+    return;
+
+  const DiskCacheKey<Uid> key{uid, GetCustomShadersHash(custom_shaders)};
+  cache.disk_cache.Append(key, binary.data(), static_cast<u32>(binary.size()));
+}
+
+void CustomShaderCache::LoadCaches()
+{
+  if (!g_ActiveConfig.bShaderCache || !g_ActiveConfig.backend_info.bSupportsShaderBinaries)
+    return;
+
+  LoadDiskShaderCache(m_ps_disk_cache, "custom-ps");
+  LoadDiskShaderCache(m_uber_ps_disk_cache, "custom-uber-ps");
+}
+
+void CustomShaderCache::ClearCaches()
+{
+  ClearDiskShaderCache(m_ps_disk_cache);
+  ClearDiskShaderCache(m_uber_ps_disk_cache);
 }
 
 std::optional<const AbstractPipeline*>
@@ -286,6 +394,9 @@ void CustomShaderCache::QueuePixelShaderCompile(const PixelShaderUid& uid,
 
     void Retrieve() override
     {
+      if (m_shader)
+        m_shader_cache->AppendDiskShader(m_shader_cache->m_ps_disk_cache, m_uid, m_custom_shaders,
+                                         *m_shader);
       m_shader_cache->NotifyPixelShaderFinished(m_iter, std::move(m_shader));
     }
 
@@ -298,6 +409,12 @@ void CustomShaderCache::QueuePixelShaderCompile(const PixelShaderUid& uid,
   };
 
   auto list_iter = m_ps_cache.InsertElement(uid, custom_shaders);
+  if (auto shader = TakeDiskShader(m_ps_disk_cache, uid, custom_shaders))
+  {
+    NotifyPixelShaderFinished(list_iter, std::move(shader));
+    return;
+  }
+
   auto work_item = m_async_shader_compiler->CreateWorkItem<PixelShaderWorkItem>(
       this, uid, custom_shaders, list_iter);
   m_async_shader_compiler->QueueWorkItem(std::move(work_item), 0);
@@ -324,6 +441,9 @@ void CustomShaderCache::QueuePixelShaderCompile(const UberShader::PixelShaderUid
 
     void Retrieve() override
     {
+      if (m_shader)
+        m_shader_cache->AppendDiskShader(m_shader_cache->m_uber_ps_disk_cache, m_uid,
+                                         m_custom_shaders, *m_shader);
       m_shader_cache->NotifyPixelShaderFinished(m_iter, std::move(m_shader));
     }
 
@@ -336,6 +456,12 @@ void CustomShaderCache::QueuePixelShaderCompile(const UberShader::PixelShaderUid
   };
 
   auto list_iter = m_uber_ps_cache.InsertElement(uid, custom_shaders);
+  if (auto shader = TakeDiskShader(m_uber_ps_disk_cache, uid, custom_shaders))
+  {
+    NotifyPixelShaderFinished(list_iter, std::move(shader));
+    return;
+  }
+
   auto work_item = m_async_uber_shader_compiler->CreateWorkItem<PixelShaderWorkItem>(
       this, uid, custom_shaders, list_iter);
   m_async_uber_shader_compiler->QueueWorkItem(std::move(work_item), 0);
@@ -11,6 +11,9 @@
 #include <string>
 #include <string_view>
 
+#include "Common/CommonTypes.h"
+#include "Common/LinearDiskCache.h"
+
 #include "VideoCommon/AbstractPipeline.h"
 #include "VideoCommon/AbstractShader.h"
 #include "VideoCommon/AsyncShaderCompiler.h"
@@ -43,7 +46,8 @@ public:
   // Retrieves all pending shaders/pipelines from the async compiler.
   void RetrieveAsyncShaders();
 
-  // Reloads/recreates all shaders and pipelines.
+  // Reloads/recreates all shaders and pipelines. Shaders from the disk cache are recreated
+  // immediately, so they are ready by the time a draw needs them.
   void Reload();
 
   // The optional will be empty if this pipeline is now background compiling.
@@ -108,11 +112,54 @@ private:
     }
   };
 
+  // Custom shaders are identified on disk by a hash of their contents, as the contents themselves
+  // are not stored.
+#pragma pack(push, 1)
+  template <typename Uid>
+  struct DiskCacheKey
+  {
+    Uid uid;
+    u64 custom_shaders_hash;
+
+    bool operator<(const DiskCacheKey& other) const
+    {
+      if (custom_shaders_hash != other.custom_shaders_hash)
+        return custom_shaders_hash < other.custom_shaders_hash;
+      return uid < other.uid;
+    }
+  };
+#pragma pack(pop)
+
+  template <typename Uid>
+  struct DiskShaderCache
+  {
+    Common::LinearDiskCache<DiskCacheKey<Uid>, u8> disk_cache;
+    // Shaders created from the disk cache which haven't been requested yet.
+    std::map<DiskCacheKey<Uid>, std::unique_ptr<AbstractShader>> shaders;
+  };
+
+  template <typename Uid>
+  void LoadDiskShaderCache(DiskShaderCache<Uid>& cache, const char* type);
+  template <typename Uid>
+  void ClearDiskShaderCache(DiskShaderCache<Uid>& cache);
+  template <typename Uid>
+  std::unique_ptr<AbstractShader> TakeDiskShader(DiskShaderCache<Uid>& cache, const Uid& uid,
+                                                 const CustomShaderInstance& custom_shaders);
+  template <typename Uid>
+  void AppendDiskShader(DiskShaderCache<Uid>& cache, const Uid& uid,
+                        const CustomShaderInstance& custom_shaders, const AbstractShader& shader);
+
+  void LoadCaches();
+  void ClearCaches();
+
   Cache<PixelShaderUid, AbstractShader> m_ps_cache;
   Cache<UberShader::PixelShaderUid, AbstractShader> m_uber_ps_cache;
   Cache<VideoCommon::GXPipelineUid, AbstractPipeline> m_pipeline_cache;
   Cache<VideoCommon::GXUberPipelineUid, AbstractPipeline> m_uber_pipeline_cache;
 
+  DiskShaderCache<PixelShaderUid> m_ps_disk_cache;
+  DiskShaderCache<UberShader::PixelShaderUid> m_uber_ps_disk_cache;
+
   using PipelineIterator = Cache<VideoCommon::GXPipelineUid, AbstractPipeline>::CacheList::iterator;
   using UberPipelineIterator =
       Cache<VideoCommon::GXUberPipelineUid, AbstractPipeline>::CacheList::iterator;
@@ -3,12 +3,14 @@
 
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
 
+#include <set>
 #include <string>
 #include <string_view>
 #include <variant>
 
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
+#include "Common/TraceProfiler.h"
 #include "Common/VariantUtil.h"
 
 #include "Core/ConfigManager.h"
@@ -23,59 +25,78 @@
 
 std::unique_ptr<GraphicsModManager> g_graphics_mod_manager;
 
+// Trace zones need names which outlive the trace, so the names of actions are kept around for the
+// rest of the session.
+static const char* GetActionTraceName(std::string_view mod_title, std::string_view action_name)
+{
+  static std::set<std::string> s_names;
+  return s_names.insert(fmt::format("Graphics mod {}: {}", mod_title, action_name))
+      .first->c_str();
+}
+
 class GraphicsModManager::DecoratedAction final : public GraphicsModAction
 {
 public:
-  DecoratedAction(std::unique_ptr<GraphicsModAction> action, GraphicsModConfig mod)
-      : m_action_impl(std::move(action)), m_mod(std::move(mod))
+  DecoratedAction(std::unique_ptr<GraphicsModAction> action, GraphicsModConfig mod,
+                  std::string_view action_name)
+      : m_action_impl(std::move(action)), m_mod(std::move(mod)),
+        m_trace_name(GetActionTraceName(m_mod.m_title, action_name))
   {
   }
   void OnDrawStarted(GraphicsModActionData::DrawStarted* draw_started) override
   {
     if (!m_mod.m_enabled)
       return;
+    TRACE_ZONE(m_trace_name);
     m_action_impl->OnDrawStarted(draw_started);
   }
   void OnEFB(GraphicsModActionData::EFB* efb) override
   {
     if (!m_mod.m_enabled)
       return;
+    TRACE_ZONE(m_trace_name);
     m_action_impl->OnEFB(efb);
   }
   void OnProjection(GraphicsModActionData::Projection* projection) override
   {
     if (!m_mod.m_enabled)
       return;
+    TRACE_ZONE(m_trace_name);
     m_action_impl->OnProjection(projection);
   }
   void OnProjectionAndTexture(GraphicsModActionData::Projection* projection) override
   {
     if (!m_mod.m_enabled)
       return;
+    TRACE_ZONE(m_trace_name);
     m_action_impl->OnProjectionAndTexture(projection);
   }
   void OnTextureLoad(GraphicsModActionData::TextureLoad* texture_load) override
   {
     if (!m_mod.m_enabled)
       return;
+    TRACE_ZONE(m_trace_name);
     m_action_impl->OnTextureLoad(texture_load);
   }
   void OnTextureCreate(GraphicsModActionData::TextureCreate* texture_create) override
   {
     if (!m_mod.m_enabled)
       return;
+    TRACE_ZONE(m_trace_name);
     m_action_impl->OnTextureCreate(texture_create);
   }
   void OnFrameEnd() override
   {
     if (!m_mod.m_enabled)
       return;
+    TRACE_ZONE(m_trace_name);
     m_action_impl->OnFrameEnd();
   }
 
 private:
   std::unique_ptr<GraphicsModAction> m_action_impl;
   GraphicsModConfig m_mod;
+  const char* m_trace_name;
 };
 
 bool GraphicsModManager::Initialize()
@@ -118,12 +139,16 @@ const std::vector<GraphicsModAction*>&
 GraphicsModManager::GetProjectionTextureActions(ProjectionType projection_type,
                                                 const std::string& texture_name) const
 {
-  const auto lookup = fmt::format("{}_{}", texture_name, static_cast<int>(projection_type));
-  if (const auto it = m_projection_texture_target_to_actions.find(lookup);
-      it != m_projection_texture_target_to_actions.end())
-  {
+  // Most draws use textures which no mod targets, so avoid hashing their names if possible
+  if (m_projection_texture_target_to_actions.empty())
+    return m_default;
+
+  const auto texture_it = m_projection_texture_target_to_actions.find(texture_name);
+  if (texture_it == m_projection_texture_target_to_actions.end())
+    return m_default;
+
+  if (const auto it = texture_it->second.find(projection_type); it != texture_it->second.end())
     return it->second;
-  }
 
   return m_default;
 }
@@ -131,6 +156,9 @@ GraphicsModManager::GetProjectionTextureActions(ProjectionType projection_type,
 const std::vector<GraphicsModAction*>&
 GraphicsModManager::GetDrawStartedActions(const std::string& texture_name) const
 {
+  if (m_draw_started_target_to_actions.empty())
+    return m_default;
+
   if (const auto it = m_draw_started_target_to_actions.find(texture_name);
       it != m_draw_started_target_to_actions.end())
   {
@@ -143,6 +171,9 @@ GraphicsModManager::GetDrawStartedActions(const std::string& texture_name) const
 const std::vector<GraphicsModAction*>&
 GraphicsModManager::GetTextureLoadActions(const std::string& texture_name) const
 {
+  if (m_load_texture_target_to_actions.empty())
+    return m_default;
+
   if (const auto it = m_load_texture_target_to_actions.find(texture_name);
       it != m_load_texture_target_to_actions.end())
   {
@@ -155,6 +186,9 @@ GraphicsModManager::GetTextureLoadActions(const std::string& texture_name) const
 const std::vector<GraphicsModAction*>&
 GraphicsModManager::GetTextureCreateActions(const std::string& texture_name) const
 {
+  if (m_create_texture_target_to_actions.empty())
+    return m_default;
+
   if (const auto it = m_create_texture_target_to_actions.find(texture_name);
       it != m_create_texture_target_to_actions.end())
   {
@@ -176,7 +210,7 @@ const std::vector<GraphicsModAction*>& GraphicsModManager::GetEFBActions(const F
 
 const std::vector<GraphicsModAction*>& GraphicsModManager::GetXFBActions(const FBInfo& xfb) const
 {
-  if (const auto it = m_efb_target_to_actions.find(xfb); it != m_efb_target_to_actions.end())
+  if (const auto it = m_xfb_target_to_actions.find(xfb); it != m_xfb_target_to_actions.end())
   {
     return it->second;
   }
@@ -252,7 +286,8 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
         {
           return nullptr;
         }
-        return std::make_unique<DecoratedAction>(std::move(action), std::move(mod_config));
+        return std::make_unique<DecoratedAction>(std::move(action), std::move(mod_config),
+                                                 action_name);
       };
 
       const auto internal_group = fmt::format("{}.{}", mod.m_title, feature.m_group);
@@ -289,10 +324,9 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
                 [&](const ProjectionTarget& the_target) {
                   if (the_target.m_texture_info_string)
                   {
-                    const auto lookup = fmt::format("{}_{}", *the_target.m_texture_info_string,
-                                                    static_cast<int>(the_target.m_projection_type));
-                    m_projection_texture_target_to_actions[lookup].push_back(
-                        m_actions.back().get());
+                    m_projection_texture_target_to_actions[*the_target.m_texture_info_string]
+                                                          [the_target.m_projection_type]
+                                                              .push_back(m_actions.back().get());
                   }
                   else
                   {
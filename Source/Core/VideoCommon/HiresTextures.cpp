@@ -176,13 +176,15 @@ std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_in
   if (base_filename == "")
     return nullptr;
 
+  auto& system = Core::System::GetInstance();
   if (auto iter = s_hires_texture_cache.find(base_filename); iter != s_hires_texture_cache.end())
   {
+    // Request the asset again, so the loader knows it is in use and reloads it if it was evicted
+    system.GetCustomAssetLoader().LoadGameTexture(base_filename, s_file_library);
     return iter->second;
   }
   else
   {
-    auto& system = Core::System::GetInstance();
     auto hires_texture = std::make_shared<HiresTexture>(
         has_arb_mipmaps,
         system.GetCustomAssetLoader().LoadGameTexture(base_filename, s_file_library));
@@ -7,6 +7,12 @@
 #include <cstddef>
 #include <cstring>
 
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -16,6 +22,132 @@ namespace
 {
 constexpr u16 s_primitive_restart = UINT16_MAX;
 
+// Markers for the index patterns below. Other pattern entries are vertex offsets.
+constexpr u16 PATTERN_CENTER = UINT16_MAX - 1;
+constexpr u16 PATTERN_RESTART = UINT16_MAX;
+
+/**
+ * Writes num_blocks repetitions of an index pattern, eight indices per SIMD store.
+ *
+ * The pattern holds the indices of one block as offsets from the first vertex of the block, and
+ * every block starts block_vertices after the previous one. PATTERN_CENTER stands for the fan
+ * center, and PATTERN_RESTART for the primitive restart index; these don't move between blocks.
+ */
+template <size_t N>
+u16* WriteIndexBlocks(u16* index_ptr, const std::array<u16, N>& pattern, u32 block_vertices,
+                      u32 num_blocks, u32 index, u32 center)
+{
+  static_assert(N % 8 == 0, "Patterns must fill whole vectors");
+  constexpr size_t num_vectors = N / 8;
+
+  if (num_blocks == 0)
+    return index_ptr;
+
+  // Lanes with a fixed value don't step between blocks.
+  std::array<u16, N> first;
+  std::array<u16, N> step;
+  for (size_t i = 0; i < N; i++)
+  {
+    if (pattern[i] == PATTERN_CENTER || pattern[i] == PATTERN_RESTART)
+    {
+      first[i] = pattern[i] == PATTERN_CENTER ? static_cast<u16>(center) : s_primitive_restart;
+      step[i] = 0;
+    }
+    else
+    {
+      first[i] = static_cast<u16>(index + pattern[i]);
+      step[i] = static_cast<u16>(block_vertices);
+    }
+  }
+
+#if defined(_M_X86_64)
+  std::array<__m128i, num_vectors> current;
+  std::array<__m128i, num_vectors> increment;
+  for (size_t i = 0; i < num_vectors; i++)
+  {
+    current[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&first[i * 8]));
+    increment[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&step[i * 8]));
+  }
+
+  for (u32 block = 0; block < num_blocks; block++)
+  {
+    for (size_t i = 0; i < num_vectors; i++)
+    {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(index_ptr), current[i]);
+      current[i] = _mm_add_epi16(current[i], increment[i]);
+      index_ptr += 8;
+    }
+  }
+#elif defined(_M_ARM_64)
+  std::array<uint16x8_t, num_vectors> current;
+  std::array<uint16x8_t, num_vectors> increment;
+  for (size_t i = 0; i < num_vectors; i++)
+  {
+    current[i] = vld1q_u16(&first[i * 8]);
+    increment[i] = vld1q_u16(&step[i * 8]);
+  }
+
+  for (u32 block = 0; block < num_blocks; block++)
+  {
+    for (size_t i = 0; i < num_vectors; i++)
+    {
+      vst1q_u16(index_ptr, current[i]);
+      current[i] = vaddq_u16(current[i], increment[i]);
+      index_ptr += 8;
+    }
+  }
+#else
+  for (u32 block = 0; block < num_blocks; block++)
+  {
+    for (size_t i = 0; i < N; i++)
+    {
+      *index_ptr++ = first[i];
+      first[i] += step[i];
+    }
+  }
+#endif
+
+  return index_ptr;
+}
+
+constexpr u16 C = PATTERN_CENTER;
+constexpr u16 R = PATTERN_RESTART;
+
+// 8 triangles
+constexpr std::array<u16, 24> s_list_pattern = {
+    0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11,  //
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+};
+// 2 triangles
+constexpr std::array<u16, 8> s_list_pattern_pr = {0, 1, 2, R, 3, 4, 5, R};
+// 8 triangles, alternating the winding
+constexpr std::array<u16, 24> s_strip_pattern = {
+    0, 1, 2, 1, 3, 2, 2, 3, 4, 3, 5, 4,  //
+    4, 5, 6, 5, 7, 6, 6, 7, 8, 7, 9, 8,
+};
+// 8 vertices
+constexpr std::array<u16, 8> s_strip_pattern_pr = {0, 1, 2, 3, 4, 5, 6, 7};
+// 8 triangles
+constexpr std::array<u16, 24> s_fan_pattern = {
+    C, 0, 1, C, 1, 2, C, 2, 3, C, 3, 4,  //
+    C, 4, 5, C, 5, 6, C, 6, 7, C, 7, 8,
+};
+// 4 groups of 3 triangles
+constexpr std::array<u16, 24> s_fan_pattern_pr = {
+    0, 1, C, 2, 3, R, 3, 4,  C,  5,  6,  R,  //
+    6, 7, C, 8, 9, R, 9, 10, C, 11, 12, R,
+};
+// 4 quads
+constexpr std::array<u16, 24> s_quads_pattern = {
+    0, 1, 2,  0, 2,  3,  4,  5,  6,  4,  6,  7,  //
+    8, 9, 10, 8, 10, 11, 12, 13, 14, 12, 14, 15,
+};
+// 8 quads
+constexpr std::array<u16, 40> s_quads_pattern_pr = {
+    1,  2,  0,  3,  R, 5,  6,  4,  7,  R, 9,  10, 8,  11, R, 13, 14, 12, 15, R,  //
+    17, 18, 16, 19, R, 21, 22, 20, 23, R, 25, 26, 24, 27, R, 29, 30, 28, 31, R,
+};
+
 template <bool pr>
 u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 {
@@ -30,7 +162,22 @@ u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 template <bool pr>
 u16* AddList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 2; i < num_verts; i += 3)
+  const u32 num_triangles = num_verts / 3;
+  u32 i = 2;
+  if constexpr (pr)
+  {
+    const u32 num_blocks = num_triangles / 2;
+    index_ptr = WriteIndexBlocks(index_ptr, s_list_pattern_pr, 6, num_blocks, index, 0);
+    i += num_blocks * 6;
+  }
+  else
+  {
+    const u32 num_blocks = num_triangles / 8;
+    index_ptr = WriteIndexBlocks(index_ptr, s_list_pattern, 24, num_blocks, index, 0);
+    i += num_blocks * 24;
+  }
+
+  for (; i < num_verts; i += 3)
   {
     index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - 1, index + i);
   }
@@ -42,7 +189,9 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
   if constexpr (pr)
   {
-    for (u32 i = 0; i < num_verts; ++i)
+    const u32 num_blocks = num_verts / 8;
+    index_ptr = WriteIndexBlocks(index_ptr, s_strip_pattern_pr, 8, num_blocks, index, 0);
+    for (u32 i = num_blocks * 8; i < num_verts; ++i)
     {
       *index_ptr++ = index + i;
     }
@@ -50,8 +199,12 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
   }
   else
   {
+    // Blocks hold an even number of triangles, so the winding starts over after them.
+    const u32 num_blocks = num_verts > 2 ? (num_verts - 2) / 8 : 0;
+    index_ptr = WriteIndexBlocks(index_ptr, s_strip_pattern, 8, num_blocks, index, 0);
+
     bool wind = false;
-    for (u32 i = 2; i < num_verts; ++i)
+    for (u32 i = 2 + num_blocks * 8; i < num_verts; ++i)
     {
       index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - !wind, index + i - wind);
 
@@ -87,6 +240,10 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 
   if constexpr (pr)
   {
+    const u32 num_blocks = num_verts > 2 ? (num_verts - 2) / 12 : 0;
+    index_ptr = WriteIndexBlocks(index_ptr, s_fan_pattern_pr, 12, num_blocks, index + 1, index);
+    i += num_blocks * 12;
+
     for (; i + 3 <= num_verts; i += 3)
     {
       *index_ptr++ = index + i - 1;
@@ -106,6 +263,12 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
       *index_ptr++ = s_primitive_restart;
     }
   }
+  else
+  {
+    const u32 num_blocks = num_verts > 2 ? (num_verts - 2) / 8 : 0;
+    index_ptr = WriteIndexBlocks(index_ptr, s_fan_pattern, 8, num_blocks, index + 1, index);
+    i += num_blocks * 8;
+  }
 
   for (; i < num_verts; ++i)
   {
@@ -135,6 +298,19 @@ template <bool pr>
 u16* AddQuads(u16* index_ptr, u32 num_verts, u32 index)
 {
   u32 i = 3;
+  if constexpr (pr)
+  {
+    const u32 num_blocks = num_verts / 32;
+    index_ptr = WriteIndexBlocks(index_ptr, s_quads_pattern_pr, 32, num_blocks, index, 0);
+    i += num_blocks * 32;
+  }
+  else
+  {
+    const u32 num_blocks = num_verts / 16;
+    index_ptr = WriteIndexBlocks(index_ptr, s_quads_pattern, 16, num_blocks, index, 0);
+    i += num_blocks * 16;
+  }
+
   for (; i < num_verts; i += 4)
   {
     if constexpr (pr)
@@ -60,6 +60,10 @@ public:
   // carefully!
   virtual void FlushResults() {}
 
+  // Accumulate the results of queries the host GPU has already finished, without waiting for the
+  // rest. Keeps the values returned without flushing (GFX_HACK_PERF_QUERIES_ASYNC_READBACK) fresh.
+  virtual void PollResults() {}
+
   // True if there are no further pending query results
   // NOTE: Called from CPU thread
   virtual bool IsFlushed() const { return true; }
@@ -22,6 +22,15 @@ void PerformanceMetrics::Reset()
   m_speed_counter.Reset();
 
   m_time_sleeping = DT::zero();
+  m_audio_underruns.store(0, std::memory_order_relaxed);
+  m_skipped_frames.store(0, std::memory_order_relaxed);
+  {
+    std::unique_lock lock(m_time_lock);
+    m_gpu_pass_times = {};
+    m_has_gpu_pass_times = false;
+    m_gpu_frame_count = 0;
+    m_gpu_frame_time_total = DT::zero();
+  }
   m_real_times.fill(Clock::now());
   m_cpu_times.fill(Core::System::GetInstance().GetCoreTiming().GetCPUTimePoint(0));
 }
@@ -52,6 +61,26 @@ void PerformanceMetrics::CountPerformanceMarker(Core::System& system, s64 cycles
   m_time_index += 1;
 }
 
+void PerformanceMetrics::CountAudioUnderrun()
+{
+  m_audio_underruns.fetch_add(1, std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::SetAudioLatency(DT latency)
+{
+  m_audio_latency.store(latency, std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::CountSkippedFrame()
+{
+  m_skipped_frames.fetch_add(1, std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::SetPresentLatency(DT latency)
+{
+  m_present_latency.store(latency, std::memory_order_relaxed);
+}
+
 double PerformanceMetrics::GetFPS() const
 {
   return m_fps_counter.GetHzAvg();
@@ -80,6 +109,48 @@ double PerformanceMetrics::GetLastSpeedDenominator() const
          Core::System::GetInstance().GetVideoInterface().GetTargetRefreshRate();
 }
 
+DT PerformanceMetrics::GetAudioLatency() const
+{
+  return m_audio_latency.load(std::memory_order_relaxed);
+}
+
+u32 PerformanceMetrics::GetAudioUnderruns() const
+{
+  return m_audio_underruns.load(std::memory_order_relaxed);
+}
+
+DT PerformanceMetrics::GetPresentLatency() const
+{
+  return m_present_latency.load(std::memory_order_relaxed);
+}
+
+u32 PerformanceMetrics::GetSkippedFrames() const
+{
+  return m_skipped_frames.load(std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::SetGPUPassTimes(const GPUTimingPassMap<DT>& times)
+{
+  std::unique_lock lock(m_time_lock);
+
+  // Smooth the per-frame times a little, otherwise the overlay is unreadable.
+  auto sample = times.begin();
+  for (DT& time : m_gpu_pass_times)
+  {
+    time = m_has_gpu_pass_times ? time + (*sample - time) / 8 : *sample;
+    m_gpu_frame_time_total += *sample;
+    ++sample;
+  }
+  m_has_gpu_pass_times = true;
+  ++m_gpu_frame_count;
+}
+
+std::pair<u64, DT> PerformanceMetrics::GetGPUFrameTimeTotal() const
+{
+  std::shared_lock lock(m_time_lock);
+  return {m_gpu_frame_count, m_gpu_frame_time_total};
+}
+
 void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
 {
   const float bg_alpha = 0.7f;
@@ -211,7 +282,8 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
 
   if (g_ActiveConfig.bShowFPS || g_ActiveConfig.bShowFTimes)
   {
-    int count = g_ActiveConfig.bShowFPS + 2 * g_ActiveConfig.bShowFTimes;
+    const bool show_skipped = g_ActiveConfig.bShowFPS && g_ActiveConfig.bFrameSkip;
+    int count = g_ActiveConfig.bShowFPS + show_skipped + 2 * g_ActiveConfig.bShowFTimes;
     float window_height = (12.f + 17.f * count) * backbuffer_scale;
 
     // Position in the top-right corner of the screen.
@@ -228,6 +300,8 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
     {
       if (g_ActiveConfig.bShowFPS)
         ImGui::TextColored(ImVec4(r, g, b, 1.0f), "FPS:%7.2lf", fps);
+      if (show_skipped)
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Skip:%6u", GetSkippedFrames());
       if (g_ActiveConfig.bShowFTimes)
       {
         ImGui::TextColored(ImVec4(r, g, b, 1.0f), "dt:%6.2lfms",
@@ -269,5 +343,94 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
     }
   }
 
+  if (g_ActiveConfig.bShowAudioLatency)
+  {
+    float window_height = 47.f * backbuffer_scale;
+
+    // Position in the top-right corner of the screen.
+    ImGui::SetNextWindowPos(ImVec2(window_x, window_y), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(window_width, window_height));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+
+    if (stack_vertically)
+      window_y += window_height + window_padding;
+    else
+      window_x -= window_width + window_padding;
+
+    if (ImGui::Begin("AudioStats", nullptr, imgui_flags))
+    {
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Audio:%4.0lfms",
+                         DT_ms(GetAudioLatency()).count());
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Drops:%5u", GetAudioUnderruns());
+      ImGui::End();
+    }
+  }
+
+  if (g_ActiveConfig.bShowPresentLatency)
+  {
+    float window_height = 30.f * backbuffer_scale;
+
+    // Position in the top-right corner of the screen.
+    ImGui::SetNextWindowPos(ImVec2(window_x, window_y), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(window_width, window_height));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+
+    if (stack_vertically)
+      window_y += window_height + window_padding;
+    else
+      window_x -= window_width + window_padding;
+
+    if (ImGui::Begin("PresentStats", nullptr, imgui_flags))
+    {
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Pres:%5.1lfms",
+                         DT_ms(GetPresentLatency()).count());
+      ImGui::End();
+    }
+  }
+
+  if (g_ActiveConfig.bShowGPUTimes)
+  {
+    // One line per pass except None, plus the total.
+    static constexpr GPUTimingPassMap<const char*> labels{
+        nullptr, "Draw", "EFB", "XFB", "Post", "Pres",
+    };
+    const float window_height = (12.f + 17.f * labels.size()) * backbuffer_scale;
+
+    // Position in the top-right corner of the screen.
+    ImGui::SetNextWindowPos(ImVec2(window_x, window_y), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(window_width, window_height));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+
+    if (stack_vertically)
+      window_y += window_height + window_padding;
+    else
+      window_x -= window_width + window_padding;
+
+    if (ImGui::Begin("GPUStats", nullptr, imgui_flags))
+    {
+      std::shared_lock lock(m_time_lock);
+      if (!m_has_gpu_pass_times)
+      {
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "GPU:   N/A");
+      }
+      else
+      {
+        DT total{};
+        for (const DT& time : m_gpu_pass_times)
+          total += time;
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "GPU:%6.2lfms", DT_ms(total).count());
+
+        auto time = m_gpu_pass_times.begin();
+        for (const char* label : labels)
+        {
+          if (label)
+            ImGui::TextColored(ImVec4(r, g, b, 1.0f), "%-4s:%5.2lfms", label, DT_ms(*time).count());
+          ++time;
+        }
+      }
+      ImGui::End();
+    }
+  }
+
   ImGui::PopStyleVar(2);
 }
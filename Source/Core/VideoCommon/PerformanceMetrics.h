@@ -4,9 +4,12 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <shared_mutex>
+#include <utility>
 
 #include "Common/CommonTypes.h"
+#include "VideoCommon/GPUTiming.h"
 #include "VideoCommon/PerformanceTracker.h"
 
 namespace Core
@@ -33,6 +36,22 @@ public:
   void CountThrottleSleep(DT sleep);
   void CountPerformanceMarker(Core::System& system, s64 cyclesLate);
 
+  // Called from audio threads
+  void CountAudioUnderrun();
+  void SetAudioLatency(DT latency);
+
+  // Called from the video thread when presenting a frame is skipped because emulation is behind.
+  void CountSkippedFrame();
+
+  // Called from the video thread after presenting a frame to the window system.
+  void SetPresentLatency(DT latency);
+
+  // Called from the video thread once the GPU timestamps of a frame are available.
+  void SetGPUPassTimes(const GPUTimingPassMap<DT>& times);
+
+  // The unsmoothed GPU time of every frame reported so far, and how many frames that covers.
+  std::pair<u64, DT> GetGPUFrameTimeTotal() const;
+
   // Getter Functions
   double GetFPS() const;
   double GetVPS() const;
@@ -41,6 +60,17 @@ public:
 
   double GetLastSpeedDenominator() const;
 
+  // The FIFO latency the mixer is currently aiming for, and the number of times it ran dry.
+  DT GetAudioLatency() const;
+  u32 GetAudioUnderruns() const;
+
+  // How long the last frame took from the start of presenting until the window system accepted
+  // it, including any waiting for the swap chain in low latency mode.
+  DT GetPresentLatency() const;
+
+  // The number of frames that weren't presented to help emulation keep up.
+  u32 GetSkippedFrames() const;
+
   // ImGui Functions
   void DrawImGuiStats(const float backbuffer_scale);
 
@@ -57,6 +87,17 @@ private:
   std::array<TimePoint, 256> m_real_times{};
   std::array<TimePoint, 256> m_cpu_times{};
   DT m_time_sleeping{};
+
+  std::atomic<DT> m_audio_latency{};
+  std::atomic<u32> m_audio_underruns{0};
+
+  std::atomic<DT> m_present_latency{};
+  std::atomic<u32> m_skipped_frames{0};
+
+  GPUTimingPassMap<DT> m_gpu_pass_times{};
+  bool m_has_gpu_pass_times = false;
+  u64 m_gpu_frame_count = 0;
+  DT m_gpu_frame_time_total{};
 };
 
 extern PerformanceMetrics g_perf_metrics;
@@ -0,0 +1,100 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/PipelineUIDCache.h"
+
+#include <cstring>
+#include <set>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+
+namespace VideoCommon
+{
+static constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
+static constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+
+std::string GetPipelineUIDCacheFileName(std::string_view directory, std::string_view game_id)
+{
+  if (!directory.empty() && directory.back() != '/')
+    return fmt::format("{}/{}.uidcache", directory, game_id);
+
+  return fmt::format("{}{}.uidcache", directory, game_id);
+}
+
+bool ReadPipelineUIDCache(File::IOFile& file, std::vector<SerializedGXPipelineUid>* uids)
+{
+  // Validate the version before reading entries.
+  u32 existing_magic;
+  u32 existing_version;
+  if (!file.ReadBytes(&existing_magic, sizeof(existing_magic)) ||
+      !file.ReadBytes(&existing_version, sizeof(existing_version)) ||
+      existing_magic != CACHE_FILE_MAGIC || existing_version != GX_PIPELINE_UID_VERSION)
+  {
+    return false;
+  }
+
+  // Ensure the expected size matches the actual size of the file. If it doesn't, it means the
+  // cache file may be corrupted, and we should not proceed with loading potentially garbage or
+  // invalid UIDs.
+  const u64 file_size = file.GetSize();
+  const size_t uid_count =
+      static_cast<size_t>(file_size - CACHE_HEADER_SIZE) / sizeof(SerializedGXPipelineUid);
+  const size_t expected_size = uid_count * sizeof(SerializedGXPipelineUid) + CACHE_HEADER_SIZE;
+  if (file_size != expected_size)
+    return false;
+
+  uids->reserve(uids->size() + uid_count);
+  for (size_t i = 0; i < uid_count; i++)
+  {
+    SerializedGXPipelineUid serialized_uid;
+    if (!file.ReadBytes(&serialized_uid, sizeof(serialized_uid)))
+      return false;
+
+    uids->push_back(serialized_uid);
+  }
+
+  return true;
+}
+
+bool ReadPipelineUIDCache(const std::string& filename, std::vector<SerializedGXPipelineUid>* uids)
+{
+  File::IOFile file(filename, "rb");
+  return file.IsOpen() && ReadPipelineUIDCache(file, uids);
+}
+
+bool WritePipelineUIDCacheHeader(File::IOFile& file)
+{
+  return file.WriteBytes(&CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC)) &&
+         file.WriteBytes(&GX_PIPELINE_UID_VERSION, sizeof(GX_PIPELINE_UID_VERSION));
+}
+
+bool WritePipelineUIDCache(const std::string& filename,
+                           std::span<const SerializedGXPipelineUid> uids)
+{
+  File::IOFile file(filename, "wb");
+  return file.IsOpen() && WritePipelineUIDCacheHeader(file) &&
+         file.WriteArray(uids.data(), uids.size());
+}
+
+size_t MergePipelineUIDs(std::vector<SerializedGXPipelineUid>* uids,
+                         std::span<const SerializedGXPipelineUid> other)
+{
+  // The serialized UIDs are packed and zero-initialized, so they can be compared bytewise.
+  const auto compare = [](const SerializedGXPipelineUid& lhs, const SerializedGXPipelineUid& rhs) {
+    return std::memcmp(&lhs, &rhs, sizeof(SerializedGXPipelineUid)) < 0;
+  };
+  std::set<SerializedGXPipelineUid, decltype(compare)> known(uids->begin(), uids->end(), compare);
+
+  const size_t old_size = uids->size();
+  for (const SerializedGXPipelineUid& uid : other)
+  {
+    if (known.insert(uid).second)
+      uids->push_back(uid);
+  }
+
+  return uids->size() - old_size;
+}
+}  // namespace VideoCommon
@@ -0,0 +1,44 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "VideoCommon/GXPipelineTypes.h"
+
+namespace File
+{
+class IOFile;
+}
+
+// Pipeline UID caches (.uidcache files) record the pipelines that a game has used, so that they
+// can be compiled before they are needed again. Unlike the shader caches, they don't depend on the
+// backend or the host, so the caches of several installs can be merged and shared between them.
+namespace VideoCommon
+{
+// Returns the path of the UID cache for a game in the given directory.
+std::string GetPipelineUIDCacheFileName(std::string_view directory, std::string_view game_id);
+
+// Reads all UIDs from a cache file, starting at the current position of the file. Returns false
+// if the file was written with a different UID version, or is truncated or corrupted. uids still
+// holds the UIDs which could be read before the error in that case.
+bool ReadPipelineUIDCache(File::IOFile& file, std::vector<SerializedGXPipelineUid>* uids);
+bool ReadPipelineUIDCache(const std::string& filename, std::vector<SerializedGXPipelineUid>* uids);
+
+// Writes the header identifying the cache file and UID version. UIDs follow directly after it.
+bool WritePipelineUIDCacheHeader(File::IOFile& file);
+
+// Replaces the file with a cache holding the given UIDs.
+bool WritePipelineUIDCache(const std::string& filename,
+                           std::span<const SerializedGXPipelineUid> uids);
+
+// Appends the UIDs from other which are not in uids yet, keeping their order. Returns the number
+// of UIDs which were added.
+size_t MergePipelineUIDs(std::vector<SerializedGXPipelineUid>* uids,
+                         std::span<const SerializedGXPipelineUid> other);
+}  // namespace VideoCommon
@@ -4,8 +4,12 @@
 #include "VideoCommon/PixelShaderGen.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
@@ -887,6 +891,8 @@ void WriteCustomShaderStructImpl(ShaderCode* out, u32 num_stages, bool per_pixel
 
 static void WriteStage(ShaderCode& out, const pixel_shader_uid_data* uid_data, int n,
                        APIType api_type, bool stereo, bool has_custom_shaders);
+static void WriteCachedStage(ShaderCode& out, const pixel_shader_uid_data* uid_data, int n,
+                             APIType api_type, bool stereo, bool has_custom_shaders);
 static void WriteTevRegular(ShaderCode& out, std::string_view components, TevBias bias, TevOp op,
                             bool clamp, TevScale scale);
 static void WriteAlphaTest(ShaderCode& out, const pixel_shader_uid_data* uid_data, APIType api_type,
@@ -1189,7 +1195,7 @@ ShaderCode GeneratePixelShaderCode(APIType api_type, const ShaderHostConfig& hos
   for (u32 i = 0; i < numStages; i++)
   {
     // Build the equation for this stage
-    WriteStage(out, uid_data, i, api_type, stereo, has_custom_shaders);
+    WriteCachedStage(out, uid_data, i, api_type, stereo, has_custom_shaders);
   }
 
   {
@@ -1812,6 +1818,44 @@ static void WriteStage(ShaderCode& out, const pixel_shader_uid_data* uid_data, i
   }
 }
 
+// Games tend to reuse the same few TEV stage configurations across many shaders, so the code
+// for each stage is kept around and appended as-is the next time that stage is generated.
+static void WriteCachedStage(ShaderCode& out, const pixel_shader_uid_data* uid_data, int n,
+                             APIType api_type, bool stereo, bool has_custom_shaders)
+{
+  // Everything WriteStage's output depends on. The uid data has its padding bits cleared, so the
+  // stage can be compared bytewise.
+  constexpr size_t stage_size = sizeof(uid_data->stagehash[0]);
+  using Key = std::array<u8, stage_size + 8>;
+  Key key{};
+  std::memcpy(key.data(), &uid_data->stagehash[n], stage_size);
+  key[stage_size + 0] = static_cast<u8>(n);
+  key[stage_size + 1] = static_cast<u8>(uid_data->genMode_numtexgens);
+  key[stage_size + 2] = static_cast<u8>(uid_data->genMode_numindstages);
+  key[stage_size + 3] = static_cast<u8>(api_type);
+  key[stage_size + 4] = stereo;
+  key[stage_size + 5] = has_custom_shaders;
+  key[stage_size + 6] = DriverDetails::HasBug(DriverDetails::BUG_BROKEN_BITWISE_OP_NEGATION);
+  key[stage_size + 7] = DriverDetails::HasBug(DriverDetails::BUG_BROKEN_VECTOR_BITWISE_AND);
+
+  // Shaders are generated on several threads at once, so each has its own cache.
+  static constexpr size_t MAX_CACHED_STAGES = 4096;
+  thread_local std::map<Key, std::string> s_stage_code;
+
+  if (const auto iter = s_stage_code.find(key); iter != s_stage_code.end())
+  {
+    out.Append(iter->second);
+    return;
+  }
+
+  const size_t start = out.GetBuffer().size();
+  WriteStage(out, uid_data, n, api_type, stereo, has_custom_shaders);
+
+  if (s_stage_code.size() >= MAX_CACHED_STAGES)
+    s_stage_code.clear();
+  s_stage_code.emplace(key, out.GetBuffer().substr(start));
+}
+
 static void WriteTevRegular(ShaderCode& out, std::string_view components, TevBias bias, TevOp op,
                             bool clamp, TevScale scale)
 {
@@ -178,8 +178,11 @@ void PixelShaderManager::SetConstants()
 void PixelShaderManager::SetTevColor(int index, int component, s32 value)
 {
   auto& c = constants.colors[index];
-  c[component] = value;
-  dirty = true;
+  if (c[component] != value)
+  {
+    c[component] = value;
+    dirty = true;
+  }
 
   PRIM_LOG("tev color{}: {} {} {} {}", index, c[0], c[1], c[2], c[3]);
 }
@@ -187,8 +190,11 @@ void PixelShaderManager::SetTevColor(int index, int component, s32 value)
 void PixelShaderManager::SetTevKonstColor(int index, int component, s32 value)
 {
   auto& c = constants.kcolors[index];
-  c[component] = value;
-  dirty = true;
+  if (c[component] != value)
+  {
+    c[component] = value;
+    dirty = true;
+  }
 
   // Konst for ubershaders. We build the whole array on cpu so the gpu can do a single indirect
   // access.
@@ -306,6 +312,9 @@ void PixelShaderManager::SetEfbScaleChanged(float scalex, float scaley)
 
 void PixelShaderManager::SetZSlope(float dfdx, float dfdy, float f0)
 {
+  if (constants.zslope[0] == dfdx && constants.zslope[1] == dfdy && constants.zslope[2] == f0)
+    return;
+
   constants.zslope[0] = dfdx;
   constants.zslope[1] = dfdy;
   constants.zslope[2] = f0;
@@ -102,6 +102,7 @@ void PostProcessingConfiguration::LoadShader(const std::string& shader)
 void PostProcessingConfiguration::LoadDefaultShader()
 {
   m_options.clear();
+  m_passes.clear();
   m_any_options_dirty = false;
   m_current_shader = "";
   m_current_shader_code = s_empty_pixel_shader;
@@ -115,6 +116,7 @@ void PostProcessingConfiguration::LoadOptions(const std::string& code)
   size_t configuration_end = code.find(config_end_delimiter);
 
   m_options.clear();
+  m_passes.clear();
   m_any_options_dirty = true;
 
   if (configuration_start == std::string::npos || configuration_end == std::string::npos)
@@ -181,6 +183,27 @@ void PostProcessingConfiguration::LoadOptions(const std::string& code)
 
   for (const auto& it : option_strings)
   {
+    if (it.m_type == "Pass")
+    {
+      Pass pass;
+      for (const auto& string_option : it.m_options)
+      {
+        if (string_option.first == "EntryPoint")
+          pass.entry_point = string_option.second;
+        else if (string_option.first == "OutputScale")
+          TryParse(string_option.second, &pass.output_scale);
+      }
+
+      if (pass.entry_point.empty() || !(pass.output_scale > 0.0f))
+      {
+        ERROR_LOG_FMT(VIDEO, "Ignoring post-processing pass with invalid entry point or scale");
+        continue;
+      }
+
+      m_passes.push_back(std::move(pass));
+      continue;
+    }
+
     ConfigurationOption option;
     option.m_dirty = true;
 
@@ -435,6 +458,7 @@ void PostProcessing::RecompileShader()
 
   m_default_pipeline.reset();
   m_pipeline.reset();
+  m_intermediate_passes.clear();
   m_default_pixel_shader.reset();
   m_pixel_shader.reset();
   m_default_vertex_shader.reset();
@@ -451,6 +475,8 @@ void PostProcessing::RecompilePipeline()
 {
   m_default_pipeline.reset();
   m_pipeline.reset();
+  for (IntermediatePass& pass : m_intermediate_passes)
+    pass.pipeline.reset();
   CompilePipeline();
 }
 
@@ -584,6 +610,12 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
     m_intermediary_color_texture.reset();
   }
 
+  if (final_pipeline && final_pipeline == m_pipeline.get() && !m_intermediate_passes.empty())
+  {
+    DrawIntermediatePasses(&src_rect, &src_tex, &src_layer,
+                           copy_all_layers ? src_tex->GetLayers() : 1, present_rect);
+  }
+
   // TODO: ideally we'd do the user selected post process pass in the intermediary buffer in linear
   // space (instead of gamma space), so the shaders could act more accurately (and sample in linear
   // space), though that would break the look of some of current post processes we have, and thus is
@@ -605,6 +637,59 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
   }
 }
 
+void PostProcessing::DrawIntermediatePasses(MathUtil::Rectangle<int>* src_rect,
+                                            const AbstractTexture** src_tex, int* src_layer,
+                                            u32 target_layers,
+                                            const MathUtil::Rectangle<int>& present_rect)
+{
+  AbstractFramebuffer* const previous_framebuffer = g_gfx->GetCurrentFramebuffer();
+
+  for (IntermediatePass& pass : m_intermediate_passes)
+  {
+    if (!pass.pipeline)
+      continue;
+
+    const u32 target_width =
+        std::max(static_cast<u32>(src_rect->GetWidth() * pass.output_scale + 0.5f), 1u);
+    const u32 target_height =
+        std::max(static_cast<u32>(src_rect->GetHeight() * pass.output_scale + 0.5f), 1u);
+
+    if (!pass.frame_buffer || !pass.color_texture ||
+        pass.color_texture->GetWidth() != target_width ||
+        pass.color_texture->GetHeight() != target_height ||
+        pass.color_texture->GetLayers() != target_layers)
+    {
+      const TextureConfig color_texture_config(
+          target_width, target_height, 1, target_layers, (*src_tex)->GetSamples(),
+          s_intermediary_buffer_format, AbstractTextureFlag_RenderTarget,
+          AbstractTextureType::Texture_2DArray);
+      pass.color_texture =
+          g_gfx->CreateTexture(color_texture_config, "Post process pass texture");
+      pass.frame_buffer = g_gfx->CreateFramebuffer(pass.color_texture.get(), nullptr);
+    }
+
+    g_gfx->SetFramebuffer(pass.frame_buffer.get());
+
+    FillUniformBuffer(*src_rect, *src_tex, *src_layer, g_gfx->GetCurrentFramebuffer()->GetRect(),
+                      present_rect, m_uniform_staging_buffer.data(), true, true);
+    g_vertex_manager->UploadUtilityUniforms(m_uniform_staging_buffer.data(),
+                                            static_cast<u32>(m_uniform_staging_buffer.size()));
+
+    g_gfx->SetViewportAndScissor(g_gfx->ConvertFramebufferRectangle(
+        pass.color_texture->GetRect(), pass.frame_buffer.get()));
+    g_gfx->SetPipeline(pass.pipeline.get());
+    g_gfx->Draw(0, 3);
+
+    *src_rect = pass.color_texture->GetRect();
+    *src_tex = pass.color_texture.get();
+    *src_layer = 0;
+    g_gfx->SetTexture(0, *src_tex);
+    g_gfx->SetTexture(1, *src_tex);
+  }
+
+  g_gfx->SetFramebuffer(previous_framebuffer);
+}
+
 std::string PostProcessing::GetUniformBufferHeader(bool user_post_process) const
 {
   std::ostringstream ss;
@@ -980,19 +1065,13 @@ bool PostProcessing::CompilePixelShader()
   }
 
   m_config.LoadShader(g_ActiveConfig.sPostProcessingShader);
-  m_pixel_shader = g_gfx->CreateShaderFromSource(
-      ShaderStage::Pixel, GetHeader(true) + m_config.GetShaderCode() + GetFooter(),
-      fmt::format("User post-processing pixel shader: {}", m_config.GetShader()));
-  if (!m_pixel_shader)
+  if (!CompileUserPixelShaders())
   {
     PanicAlertFmt("Failed to compile user post-processing shader {}", m_config.GetShader());
 
     // Use default shader.
     m_config.LoadDefaultShader();
-    m_pixel_shader = g_gfx->CreateShaderFromSource(
-        ShaderStage::Pixel, GetHeader(true) + m_config.GetShaderCode() + GetFooter(),
-        "Default user post-processing pixel shader");
-    if (!m_pixel_shader)
+    if (!CompileUserPixelShaders())
     {
       m_uniform_staging_buffer.resize(0);
       return false;
@@ -1003,6 +1082,53 @@ bool PostProcessing::CompilePixelShader()
   return true;
 }
 
+bool PostProcessing::CompileUserPixelShaders()
+{
+  m_intermediate_passes.clear();
+
+  const std::string name =
+      m_config.GetShader().empty() ?
+          "Default user post-processing pixel shader" :
+          fmt::format("User post-processing pixel shader: {}", m_config.GetShader());
+  const auto& passes = m_config.GetPasses();
+  if (passes.empty())
+  {
+    m_pixel_shader = g_gfx->CreateShaderFromSource(
+        ShaderStage::Pixel, GetHeader(true) + m_config.GetShaderCode() + GetFooter(), name);
+    return m_pixel_shader != nullptr;
+  }
+
+  const auto compile_pass = [&](const PostProcessingConfiguration::Pass& pass) {
+    return g_gfx->CreateShaderFromSource(ShaderStage::Pixel,
+                                         GetHeader(true) + m_config.GetShaderCode() +
+                                             fmt::format("\nvoid main() {{ {}(); }}\n",
+                                                         pass.entry_point) +
+                                             GetFooter(),
+                                         fmt::format("{} ({})", name, pass.entry_point));
+  };
+
+  for (auto it = passes.begin(); it != passes.end() - 1; ++it)
+  {
+    IntermediatePass& pass = m_intermediate_passes.emplace_back();
+    pass.output_scale = it->output_scale;
+    pass.pixel_shader = compile_pass(*it);
+    if (!pass.pixel_shader)
+    {
+      m_intermediate_passes.clear();
+      return false;
+    }
+  }
+
+  m_pixel_shader = compile_pass(passes.back());
+  if (!m_pixel_shader)
+  {
+    m_intermediate_passes.clear();
+    return false;
+  }
+
+  return true;
+}
+
 static bool UseGeometryShaderForPostProcess(bool is_intermediary_buffer)
 {
   // We only return true on stereo modes that need to copy
@@ -1062,6 +1188,20 @@ bool PostProcessing::CompilePipeline()
   if (!m_pipeline)
     return false;
 
+  // Intermediate passes render to the same kind of texture as the default pipeline does when the
+  // user shader runs after it.
+  config.geometry_shader = UseGeometryShaderForPostProcess(true) ?
+                               g_shader_cache->GetTexcoordGeometryShader() :
+                               nullptr;
+  config.framebuffer_state = RenderState::GetColorFramebufferState(s_intermediary_buffer_format);
+  for (IntermediatePass& pass : m_intermediate_passes)
+  {
+    config.pixel_shader = pass.pixel_shader.get();
+    pass.pipeline = g_gfx->CreatePipeline(config);
+    if (!pass.pipeline)
+      return false;
+  }
+
   return true;
 }
 }  // namespace VideoCommon
@@ -57,6 +57,16 @@ public:
 
   using ConfigMap = std::map<std::string, ConfigurationOption>;
 
+  // A pass of a multi-pass shader. Each pass calls its entry point instead of main(), and
+  // samples the output of the previous pass (or the source texture for the first pass).
+  struct Pass
+  {
+    std::string entry_point;
+    // Size of the output relative to the input of the pass. Ignored for the last pass, which
+    // always renders to the target.
+    float output_scale = 1.0f;
+  };
+
   PostProcessingConfiguration();
   virtual ~PostProcessingConfiguration();
 
@@ -74,6 +84,7 @@ public:
   const ConfigMap& GetOptions() const { return m_options; }
   ConfigMap& GetOptions() { return m_options; }
   const ConfigurationOption& GetOption(const std::string& option) { return m_options[option]; }
+  const std::vector<Pass>& GetPasses() const { return m_passes; }
   // For updating option's values
   void SetOptionf(const std::string& option, int index, float value);
   void SetOptioni(const std::string& option, int index, s32 value);
@@ -84,6 +95,7 @@ private:
   std::string m_current_shader;
   std::string m_current_shader_code;
   ConfigMap m_options;
+  std::vector<Pass> m_passes;
 
   void LoadOptions(const std::string& code);
   void LoadOptionsConfiguration();
@@ -119,8 +131,13 @@ protected:
 
   bool CompileVertexShader();
   bool CompilePixelShader();
+  bool CompileUserPixelShaders();
   bool CompilePipeline();
 
+  void DrawIntermediatePasses(MathUtil::Rectangle<int>* src_rect, const AbstractTexture** src_tex,
+                              int* src_layer, u32 target_layers,
+                              const MathUtil::Rectangle<int>& present_rect);
+
   size_t CalculateUniformsSize(bool user_post_process) const;
   void FillUniformBuffer(const MathUtil::Rectangle<int>& src, const AbstractTexture* src_tex,
                          int src_layer, const MathUtil::Rectangle<int>& dst,
@@ -145,6 +162,18 @@ protected:
   std::unique_ptr<AbstractPipeline> m_pipeline;
   std::vector<u8> m_uniform_staging_buffer;
 
+  // All passes of a multi-pass user shader but the last one, which uses m_pixel_shader and
+  // m_pipeline. Their outputs are kept around so they only need to be recreated on size changes.
+  struct IntermediatePass
+  {
+    float output_scale = 1.0f;
+    std::unique_ptr<AbstractShader> pixel_shader;
+    std::unique_ptr<AbstractPipeline> pipeline;
+    std::unique_ptr<AbstractTexture> color_texture;
+    std::unique_ptr<AbstractFramebuffer> frame_buffer;
+  };
+  std::vector<IntermediatePass> m_intermediate_passes;
+
   AbstractTextureFormat m_framebuffer_format = AbstractTextureFormat::Undefined;
 };
 }  // namespace VideoCommon
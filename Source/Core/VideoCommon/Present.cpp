@@ -4,7 +4,10 @@
 #include "VideoCommon/Present.h"
 
 #include "Common/ChunkFile.h"
+#include "Common/ScopeGuard.h"
 #include "Core/Config/GraphicsSettings.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/Host.h"
 #include "Core/System.h"
@@ -16,6 +19,7 @@
 #include "VideoCommon/FrameDumper.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/OnScreenUI.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/PostProcessing.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexManagerBase.h"
@@ -179,6 +183,12 @@ void Presenter::ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height,
 
   if (!is_duplicate || !g_ActiveConfig.bSkipPresentingDuplicateXFBs)
   {
+    if (ShouldSkipPresent())
+    {
+      g_perf_metrics.CountSkippedFrame();
+      return;
+    }
+
     Present();
     ProcessFrameDumping(ticks);
 
@@ -186,6 +196,36 @@ void Presenter::ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height,
   }
 }
 
+bool Presenter::ShouldSkipPresent()
+{
+  // Never hide more than this many frames in a row, so the displayed image keeps moving.
+  static constexpr u32 MAX_CONSECUTIVE_SKIPPED_PRESENTS = 2;
+  // How far below the target speed the host has to be before frames get skipped.
+  static constexpr double BEHIND_SCHEDULE_SPEED_RATIO = 0.97;
+
+  // Everything up to here - EFB copies, XFB copies and bounding box - has been emulated as usual,
+  // so skipping only saves the host the post-processing and presentation of the frame.
+  if (!g_ActiveConfig.bFrameSkip || g_frame_dumper->IsFrameDumping() ||
+      Core::GetIsThrottlerTempDisabled() ||
+      m_consecutive_skipped_presents >= MAX_CONSECUTIVE_SKIPPED_PRESENTS)
+  {
+    m_consecutive_skipped_presents = 0;
+    return false;
+  }
+
+  // With an unlimited speed there is no schedule to fall behind of.
+  const double target_speed = Config::Get(Config::MAIN_EMULATION_SPEED);
+  if (target_speed <= 0.0 ||
+      g_perf_metrics.GetMaxSpeed() >= target_speed * BEHIND_SCHEDULE_SPEED_RATIO)
+  {
+    m_consecutive_skipped_presents = 0;
+    return false;
+  }
+
+  ++m_consecutive_skipped_presents;
+  return true;
+}
+
 void Presenter::ImmediateSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks)
 {
   FetchXFB(xfb_addr, fb_width, fb_stride, fb_height, ticks);
@@ -771,6 +811,9 @@ void Presenter::Present()
 {
   m_present_count++;
 
+  // Also close the frame when nothing is presented, so that headless timestamps don't pile up.
+  Common::ScopeGuard gpu_timing_guard{[] { g_gfx->EndGPUTimingFrame(); }};
+
   if (g_gfx->IsHeadless() || (!m_onscreen_ui && !m_xfb_entry))
     return;
 
@@ -789,6 +832,8 @@ void Presenter::Present()
     return;
   }
 
+  const TimePoint present_start = Clock::now();
+
   // Since we use the common pipelines here and draw vertices if a batch is currently being
   // built by the vertex loader, we end up trampling over its pointer, as we share the buffer
   // with the loader, and it has not been unmapped yet. Force a pipeline flush to avoid this.
@@ -797,6 +842,7 @@ void Presenter::Present()
   UpdateDrawRectangle();
 
   g_gfx->BeginUtilityDrawing();
+  g_gfx->SetGPUTimingPass(GPUTimingPass::Present);
   g_gfx->BindBackbuffer({{0.0f, 0.0f, 0.0f, 1.0f}});
 
   // Render the XFB to the screen.
@@ -807,7 +853,9 @@ void Presenter::Present()
     auto render_source_rc = m_xfb_rect;
     AdjustRectanglesToFitBounds(&render_target_rc, &render_source_rc, m_backbuffer_width,
                                 m_backbuffer_height);
+    g_gfx->SetGPUTimingPass(GPUTimingPass::PostProcessing);
     RenderXFBToScreen(render_target_rc, m_xfb_entry->texture.get(), render_source_rc);
+    g_gfx->SetGPUTimingPass(GPUTimingPass::Present);
   }
 
   if (m_onscreen_ui)
@@ -821,6 +869,7 @@ void Presenter::Present()
     std::lock_guard<std::mutex> guard(m_swap_mutex);
     g_gfx->PresentBackbuffer();
   }
+  g_perf_metrics.SetPresentLatency(Clock::now() - present_start);
 
   if (m_xfb_entry)
   {
@@ -105,6 +105,9 @@ private:
 
   void ProcessFrameDumping(u64 ticks) const;
 
+  // Returns true if presenting the current frame should be skipped to help emulation catch up.
+  bool ShouldSkipPresent();
+
   void OnBackBufferSizeChanged();
 
   // Scales a raw XFB resolution to the target (display) aspect ratio,
@@ -156,6 +159,7 @@ private:
 
   u64 m_frame_count = 0;
   u64 m_present_count = 0;
+  u32 m_consecutive_skipped_presents = 0;
 
   // XFB tracking
   u64 m_last_xfb_ticks = 0;
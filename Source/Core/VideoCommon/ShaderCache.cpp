@@ -8,6 +8,7 @@
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/TraceProfiler.h"
 #include "Core/ConfigManager.h"
 
 #include "VideoCommon/AbstractGfx.h"
@@ -15,6 +16,7 @@
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/FramebufferShaderGen.h"
+#include "VideoCommon/PipelineUIDCache.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -77,6 +79,9 @@ void ShaderCache::InitializeShaderCache()
 
 void ShaderCache::Reload()
 {
+  // Anything which hasn't started compiling yet would be built with the old configuration, and is
+  // queued again by CompileMissingPipelines below.
+  m_async_shader_compiler->CancelPendingWork();
   WaitForAsyncCompiler();
   ClosePipelineUIDCache();
   ClearCaches();
@@ -84,12 +89,13 @@ void ShaderCache::Reload()
   if (!CompileSharedPipelines())
     PanicAlertFmt("Failed to compile shared pipelines after reload.");
 
+  // Switch to the precompiling shader configuration while we rebuild. This is done before loading
+  // the caches, as cached pipelines are created on the compiler threads.
+  m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderPrecompilerThreads());
+
   if (g_ActiveConfig.bShaderCache)
     LoadCaches();
 
-  // Switch to the precompiling shader configuration while we rebuild.
-  m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderPrecompilerThreads());
-
   // We don't need to explicitly recompile the individual ubershaders here, as the pipelines
   // UIDs are still be in the map. Therefore, when these are rebuilt, the shaders will also
   // be recompiled.
@@ -147,6 +153,22 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
   return {};
 }
 
+std::optional<const AbstractPipeline*>
+ShaderCache::GetUberPipelineForUidAsync(const GXUberPipelineUid& uid)
+{
+  auto it = m_gx_uber_pipeline_cache.find(uid);
+  if (it != m_gx_uber_pipeline_cache.end())
+  {
+    if (!it->second.second)
+      return it->second.first.get();
+    else
+      return {};
+  }
+
+  QueueUberPipelineCompile(uid, COMPILE_PRIORITY_UBERSHADER_PIPELINE);
+  return {};
+}
+
 const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineUid& uid)
 {
   auto it = m_gx_uber_pipeline_cache.find(uid);
@@ -279,60 +301,129 @@ template <typename KeyType, typename DiskKeyType, typename T>
 void ShaderCache::LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyType, u8>& disk_cache,
                                     APIType api_type, const char* type, bool include_gameid)
 {
+  using DiskCache = Common::LinearDiskCache<DiskKeyType, u8>;
+
+  class NullReader final : public Common::LinearDiskCacheReader<DiskKeyType, u8>
+  {
+  public:
+    void Read(const DiskKeyType& key, const u8* value, u32 value_size) override {}
+  };
+
+  struct LoadState
+  {
+    std::string filename;
+    bool discarded = false;
+  };
+
+  // Creating a pipeline from cache data can still take a while on some drivers, so this is done on
+  // the compiler threads, same as any other pipeline.
+  class CachedPipelineWorkItem final : public AsyncShaderCompiler::WorkItem
+  {
+  public:
+    CachedPipelineWorkItem(T& cache_, DiskCache& disk_cache_, std::shared_ptr<LoadState> state_,
+                           const KeyType& uid_, const DiskKeyType& disk_uid_,
+                           const AbstractPipelineConfig& config_, const u8* value, u32 value_size)
+        : cache(cache_), disk_cache(disk_cache_), state(std::move(state_)), uid(uid_),
+          disk_uid(disk_uid_), config(config_), cache_data(value, value + value_size)
+    {
+    }
+
+    bool Compile() override
+    {
+      pipeline = g_gfx->CreatePipeline(config, cache_data.data(), cache_data.size());
+      if (!pipeline)
+      {
+        cache_data_valid = false;
+        pipeline = g_gfx->CreatePipeline(config);
+      }
+      return true;
+    }
+
+    void Retrieve() override
+    {
+      // If any of the pipelines in the cache failed to create, it's likely because of a change of
+      // driver version, or system configuration. There's no point in keeping the old cache data
+      // around, so discard and recreate the disk cache, and write anything loaded from now on.
+      if (!cache_data_valid && !state->discarded)
+      {
+        WARN_LOG_FMT(VIDEO, "Failed to load one or more pipelines from cache '{}'. Discarding.",
+                     state->filename);
+        disk_cache.Close();
+        File::Delete(state->filename);
+        NullReader reader;
+        disk_cache.OpenAndRead(state->filename, reader);
+        state->discarded = true;
+      }
+
+      auto& entry = cache[uid];
+      entry.second = false;
+      if (entry.first || !pipeline)
+        return;
+
+      entry.first = std::move(pipeline);
+      if (state->discarded)
+      {
+        auto new_cache_data = entry.first->GetCacheData();
+        if (!new_cache_data.empty())
+        {
+          disk_cache.Append(disk_uid, new_cache_data.data(),
+                            static_cast<u32>(new_cache_data.size()));
+        }
+      }
+    }
+
+  private:
+    T& cache;
+    DiskCache& disk_cache;
+    std::shared_ptr<LoadState> state;
+    KeyType uid;
+    DiskKeyType disk_uid;
+    AbstractPipelineConfig config;
+    std::vector<u8> cache_data;
+    std::unique_ptr<AbstractPipeline> pipeline;
+    bool cache_data_valid = true;
+  };
+
   class CacheReader : public Common::LinearDiskCacheReader<DiskKeyType, u8>
   {
   public:
-    CacheReader(ShaderCache* this_ptr_, T& cache_) : this_ptr(this_ptr_), cache(cache_) {}
-    bool AnyFailed() const { return failed; }
+    CacheReader(ShaderCache* this_ptr_, T& cache_, DiskCache& disk_cache_,
+                std::shared_ptr<LoadState> state_)
+        : this_ptr(this_ptr_), cache(cache_), disk_cache(disk_cache_), state(std::move(state_))
+    {
+    }
     void Read(const DiskKeyType& key, const u8* value, u32 value_size) override
     {
       KeyType real_uid;
       UnserializePipelineUid(key, real_uid);
 
       // Skip those which are already compiled.
-      if (failed || cache.find(real_uid) != cache.end())
+      if (cache.find(real_uid) != cache.end())
         return;
 
       auto config = this_ptr->GetGXPipelineConfig(real_uid);
       if (!config)
         return;
 
-      auto pipeline = g_gfx->CreatePipeline(*config, value, value_size);
-      if (!pipeline)
-      {
-        // If any of the pipelines fail to create, consider the cache stale.
-        failed = true;
-        return;
-      }
-
-      auto& entry = cache[real_uid];
-      entry.first = std::move(pipeline);
-      entry.second = false;
+      auto wi = this_ptr->m_async_shader_compiler->CreateWorkItem<CachedPipelineWorkItem>(
+          cache, disk_cache, state, real_uid, key, *config, value, value_size);
+      this_ptr->m_async_shader_compiler->QueueWorkItem(std::move(wi),
+                                                       COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+      cache[real_uid].second = true;
     }
 
   private:
     ShaderCache* this_ptr;
     T& cache;
-    bool failed = false;
+    DiskCache& disk_cache;
+    std::shared_ptr<LoadState> state;
   };
 
-  std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
-  CacheReader reader(this, cache);
-  const u32 count = disk_cache.OpenAndRead(filename, reader);
-  INFO_LOG_FMT(VIDEO, "Loaded {} cached pipelines from {}", count, filename);
-
-  // If any of the pipelines in the cache failed to create, it's likely because of a change of
-  // driver version, or system configuration. In this case, when the UID cache picks up the pipeline
-  // later on, we'll write a duplicate entry to the pipeline cache. There's also no point in keeping
-  // the old cache data around, so discard and recreate the disk cache.
-  if (reader.AnyFailed())
-  {
-    WARN_LOG_FMT(VIDEO, "Failed to load one or more pipelines from cache '{}'. Discarding.",
-                 filename);
-    disk_cache.Close();
-    File::Delete(filename);
-    disk_cache.OpenAndRead(filename, reader);
-  }
+  auto state = std::make_shared<LoadState>();
+  state->filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
+  CacheReader reader(this, cache, disk_cache, state);
+  const u32 count = disk_cache.OpenAndRead(state->filename, reader);
+  INFO_LOG_FMT(VIDEO, "Loaded {} cached pipelines from {}", count, state->filename);
 }
 
 template <typename T, typename Y>
@@ -432,6 +523,7 @@ void ShaderCache::CompileMissingPipelines()
 
 std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexShaderUid& uid) const
 {
+  TRACE_ZONE("Shader compile");
   const ShaderCode source_code =
       GenerateVertexShaderCode(m_api_type, m_host_config, uid.GetUidData());
   return g_gfx->CreateShaderFromSource(ShaderStage::Vertex, source_code.GetBuffer());
@@ -440,6 +532,7 @@ std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexSha
 std::unique_ptr<AbstractShader>
 ShaderCache::CompileVertexUberShader(const UberShader::VertexShaderUid& uid) const
 {
+  TRACE_ZONE("Shader compile");
   const ShaderCode source_code =
       UberShader::GenVertexShader(m_api_type, m_host_config, uid.GetUidData());
   return g_gfx->CreateShaderFromSource(ShaderStage::Vertex, source_code.GetBuffer(),
@@ -448,6 +541,7 @@ ShaderCache::CompileVertexUberShader(const UberShader::VertexShaderUid& uid) con
 
 std::unique_ptr<AbstractShader> ShaderCache::CompilePixelShader(const PixelShaderUid& uid) const
 {
+  TRACE_ZONE("Shader compile");
   const ShaderCode source_code =
       GeneratePixelShaderCode(m_api_type, m_host_config, uid.GetUidData(), {});
   return g_gfx->CreateShaderFromSource(ShaderStage::Pixel, source_code.GetBuffer());
@@ -456,6 +550,7 @@ std::unique_ptr<AbstractShader> ShaderCache::CompilePixelShader(const PixelShade
 std::unique_ptr<AbstractShader>
 ShaderCache::CompilePixelUberShader(const UberShader::PixelShaderUid& uid) const
 {
+  TRACE_ZONE("Shader compile");
   const ShaderCode source_code =
       UberShader::GenPixelShader(m_api_type, m_host_config, uid.GetUidData(), {});
   return g_gfx->CreateShaderFromSource(ShaderStage::Pixel, source_code.GetBuffer(),
@@ -922,50 +1017,20 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
 
 void ShaderCache::LoadPipelineUIDCache()
 {
-  constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
-  constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
-  std::string filename =
-      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
+  const std::string& game_id = SConfig::GetInstance().GetGameID();
+  std::string filename = GetPipelineUIDCacheFileName(File::GetUserPath(D_CACHE_IDX), game_id);
   if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
   {
-    // If an existing case exists, validate the version before reading entries.
-    u32 existing_magic;
-    u32 existing_version;
-    bool uid_file_valid = false;
-    if (m_gx_pipeline_uid_cache_file.ReadBytes(&existing_magic, sizeof(existing_magic)) &&
-        m_gx_pipeline_uid_cache_file.ReadBytes(&existing_version, sizeof(existing_version)) &&
-        existing_magic == CACHE_FILE_MAGIC && existing_version == GX_PIPELINE_UID_VERSION)
-    {
-      // Ensure the expected size matches the actual size of the file. If it doesn't, it means
-      // the cache file may be corrupted, and we should not proceed with loading potentially
-      // garbage or invalid UIDs.
-      const u64 file_size = m_gx_pipeline_uid_cache_file.GetSize();
-      const size_t uid_count =
-          static_cast<size_t>(file_size - CACHE_HEADER_SIZE) / sizeof(SerializedGXPipelineUid);
-      const size_t expected_size = uid_count * sizeof(SerializedGXPipelineUid) + CACHE_HEADER_SIZE;
-      uid_file_valid = file_size == expected_size;
-      if (uid_file_valid)
-      {
-        for (size_t i = 0; i < uid_count; i++)
-        {
-          SerializedGXPipelineUid serialized_uid;
-          if (m_gx_pipeline_uid_cache_file.ReadBytes(&serialized_uid, sizeof(serialized_uid)))
-          {
-            // This just adds the pipeline to the map, it is compiled later.
-            AddSerializedGXPipelineUID(serialized_uid);
-          }
-          else
-          {
-            uid_file_valid = false;
-            break;
-          }
-        }
-      }
+    std::vector<SerializedGXPipelineUid> uids;
+    bool uid_file_valid = ReadPipelineUIDCache(m_gx_pipeline_uid_cache_file, &uids);
 
-      // We open the file for reading and writing, so we must seek to the end before writing.
-      if (uid_file_valid)
-        uid_file_valid = m_gx_pipeline_uid_cache_file.Seek(expected_size, File::SeekOrigin::Begin);
-    }
+    // This just adds the pipelines to the map, they are compiled later.
+    for (const SerializedGXPipelineUid& uid : uids)
+      AddSerializedGXPipelineUID(uid);
+
+    // We open the file for reading and writing, so we must seek to the end before writing.
+    if (uid_file_valid)
+      uid_file_valid = m_gx_pipeline_uid_cache_file.Seek(0, File::SeekOrigin::End);
 
     // If the file is invalid, close it. We re-open and truncate it below.
     if (!uid_file_valid)
@@ -978,9 +1043,7 @@ void ShaderCache::LoadPipelineUIDCache()
     if (m_gx_pipeline_uid_cache_file.Open(filename, "wb"))
     {
       // Write the version identifier.
-      m_gx_pipeline_uid_cache_file.WriteBytes(&CACHE_FILE_MAGIC, sizeof(GX_PIPELINE_UID_VERSION));
-      m_gx_pipeline_uid_cache_file.WriteBytes(&GX_PIPELINE_UID_VERSION,
-                                              sizeof(GX_PIPELINE_UID_VERSION));
+      WritePipelineUIDCacheHeader(m_gx_pipeline_uid_cache_file);
 
       // Write any current UIDs out to the file.
       // This way, if we load a UID cache where the data was incomplete (e.g. Dolphin crashed),
@@ -991,6 +1054,33 @@ void ShaderCache::LoadPipelineUIDCache()
   }
 
   INFO_LOG_FMT(VIDEO, "Read {} pipeline UIDs from {}", m_gx_pipeline_cache.size(), filename);
+
+  const std::string& shared_path = g_ActiveConfig.sSharedUIDCachePath;
+  if (!shared_path.empty())
+    ImportPipelineUIDCache(GetPipelineUIDCacheFileName(shared_path, game_id));
+}
+
+void ShaderCache::ImportPipelineUIDCache(const std::string& filename)
+{
+  if (!File::Exists(filename))
+    return;
+
+  std::vector<SerializedGXPipelineUid> uids;
+  if (!ReadPipelineUIDCache(filename, &uids))
+    WARN_LOG_FMT(VIDEO, "Pipeline UID cache {} is invalid or from another version", filename);
+
+  // Add the new UIDs to our own cache as well, so they are kept if the shared one goes away.
+  size_t imported_count = 0;
+  for (const SerializedGXPipelineUid& uid : uids)
+  {
+    if (AddSerializedGXPipelineUID(uid))
+    {
+      AppendSerializedGXPipelineUID(uid);
+      imported_count++;
+    }
+  }
+
+  INFO_LOG_FMT(VIDEO, "Imported {} new pipeline UIDs from {}", imported_count, filename);
 }
 
 void ShaderCache::ClosePipelineUIDCache()
@@ -999,27 +1089,33 @@ void ShaderCache::ClosePipelineUIDCache()
   m_gx_pipeline_uid_cache_file.Close();
 }
 
-void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
+bool ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
 {
   GXPipelineUid real_uid;
   UnserializePipelineUid(uid, real_uid);
 
   auto iter = m_gx_pipeline_cache.find(real_uid);
   if (iter != m_gx_pipeline_cache.end())
-    return;
+    return false;
 
   // Flag it as empty with a null pipeline object, for later compilation.
   auto& entry = m_gx_pipeline_cache[real_uid];
   entry.second = false;
+  return true;
 }
 
 void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
+{
+  SerializedGXPipelineUid disk_uid;
+  SerializePipelineUid(config, disk_uid);
+  AppendSerializedGXPipelineUID(disk_uid);
+}
+
+void ShaderCache::AppendSerializedGXPipelineUID(const SerializedGXPipelineUid& disk_uid)
 {
   if (!m_gx_pipeline_uid_cache_file.IsOpen())
     return;
 
-  SerializedGXPipelineUid disk_uid;
-  SerializePipelineUid(config, disk_uid);
   if (!m_gx_pipeline_uid_cache_file.WriteBytes(&disk_uid, sizeof(disk_uid)))
   {
     WARN_LOG_FMT(VIDEO, "Writing pipeline UID to cache failed, closing file.");
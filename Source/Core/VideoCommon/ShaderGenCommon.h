@@ -117,6 +117,9 @@ public:
     fmt::format_to(std::back_inserter(m_buffer), format, std::forward<Args>(args)...);
   }
 
+  // Appends already generated code verbatim.
+  void Append(std::string_view code) { m_buffer.append(code); }
+
 protected:
   std::string m_buffer;
 };
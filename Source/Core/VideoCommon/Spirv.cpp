@@ -3,17 +3,25 @@
 
 #include "VideoCommon/Spirv.h"
 
+#include <compare>
+#include <map>
+#include <mutex>
+
+#include <xxhash.h>
+
 // glslang includes
 #include "GlslangToSpv.h"
 #include "ResourceLimits.h"
 #include "disassemble.h"
 
 #include "Common/FileUtil.h"
+#include "Common/LinearDiskCache.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
 #include "Common/Version.h"
 
+#include "VideoCommon/ShaderGenCommon.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -42,10 +50,95 @@ const TBuiltInResource* GetCompilerResourceLimits()
   return &glslang::DefaultTBuiltInResource;
 }
 
+// Identifies the output of a CompileShaderToSPV call. The cache file's header holds the Dolphin
+// revision, so a new glslang version starts from an empty cache.
+struct CacheKey
+{
+  u64 source_hash_low = 0;
+  u64 source_hash_high = 0;
+  u32 source_size = 0;
+  u32 language_version = 0;
+  u8 stage = 0;
+  u8 api_type = 0;
+  u8 debug_info = 0;
+  u8 pad = 0;
+
+  auto operator<=>(const CacheKey&) const = default;
+};
+
+// Unlike the UID based shader caches, which only hold the shaders generated from the GX state,
+// this also covers utility shaders such as the EFB copy and post-processing ones, and shaders
+// whose source didn't change when a host config change invalidated the UID caches.
+class DiskCache final : public Common::LinearDiskCacheReader<CacheKey, SPIRV::CodeType>
+{
+public:
+  std::optional<SPIRV::CodeVector> Find(const CacheKey& key)
+  {
+    std::lock_guard lk(m_mutex);
+    if (!Open())
+      return std::nullopt;
+
+    const auto iter = m_code.find(key);
+    if (iter == m_code.end())
+      return std::nullopt;
+    return iter->second;
+  }
+
+  void Insert(const CacheKey& key, const SPIRV::CodeVector& code)
+  {
+    std::lock_guard lk(m_mutex);
+    if (!Open())
+      return;
+
+    if (m_code.try_emplace(key, code).second)
+      m_disk_cache.Append(key, code.data(), static_cast<u32>(code.size()));
+  }
+
+  void Close()
+  {
+    std::lock_guard lk(m_mutex);
+    if (!m_is_open)
+      return;
+
+    m_disk_cache.Sync();
+    m_disk_cache.Close();
+    m_code.clear();
+    m_is_open = false;
+  }
+
+  void Read(const CacheKey& key, const SPIRV::CodeType* value, u32 value_size) override
+  {
+    m_code.try_emplace(key, value, value + value_size);
+  }
+
+private:
+  bool Open()
+  {
+    if (m_is_open)
+      return true;
+    if (!g_ActiveConfig.bShaderCache)
+      return false;
+
+    const std::string filename =
+        GetDiskShaderCacheFileName(APIType::Nothing, "spirv", false, false, false);
+    const u32 count = m_disk_cache.OpenAndRead(filename, *this);
+    INFO_LOG_FMT(VIDEO, "Loaded {} cached SPIR-V shaders from {}", count, filename);
+    m_is_open = true;
+    return true;
+  }
+
+  std::mutex m_mutex;
+  bool m_is_open = false;
+  std::map<CacheKey, SPIRV::CodeVector> m_code;
+  Common::LinearDiskCache<CacheKey, SPIRV::CodeType> m_disk_cache;
+};
+
+DiskCache s_disk_cache;
+
 std::optional<SPIRV::CodeVector>
-CompileShaderToSPV(EShLanguage stage, APIType api_type,
-                   glslang::EShTargetLanguageVersion language_version, const char* stage_filename,
-                   std::string_view source)
+CompileShaderToSPVUncached(EShLanguage stage, APIType api_type,
+                           glslang::EShTargetLanguageVersion language_version,
+                           const char* stage_filename, std::string_view source)
 {
   if (!InitializeGlslang())
     return std::nullopt;
@@ -158,6 +251,31 @@ CompileShaderToSPV(EShLanguage stage, APIType api_type,
 
   return out_code;
 }
+
+std::optional<SPIRV::CodeVector>
+CompileShaderToSPV(EShLanguage stage, APIType api_type,
+                   glslang::EShTargetLanguageVersion language_version, const char* stage_filename,
+                   std::string_view source)
+{
+  const XXH128_hash_t source_hash = XXH3_128bits(source.data(), source.size());
+  CacheKey key;
+  key.source_hash_low = source_hash.low64;
+  key.source_hash_high = source_hash.high64;
+  key.source_size = static_cast<u32>(source.size());
+  key.language_version = static_cast<u32>(language_version);
+  key.stage = static_cast<u8>(stage);
+  key.api_type = static_cast<u8>(api_type);
+  key.debug_info = g_ActiveConfig.bEnableValidationLayer;
+
+  if (std::optional<SPIRV::CodeVector> code = s_disk_cache.Find(key))
+    return code;
+
+  std::optional<SPIRV::CodeVector> code =
+      CompileShaderToSPVUncached(stage, api_type, language_version, stage_filename, source);
+  if (code)
+    s_disk_cache.Insert(key, *code);
+  return code;
+}
 }  // namespace
 
 namespace SPIRV
@@ -185,4 +303,9 @@ std::optional<CodeVector> CompileComputeShader(std::string_view source_code, API
 {
   return CompileShaderToSPV(EShLangCompute, api_type, language_version, "cs", source_code);
 }
+
+void CloseDiskCache()
+{
+  s_disk_cache.Close();
+}
 }  // namespace SPIRV
@@ -34,4 +34,8 @@ std::optional<CodeVector> CompileFragmentShader(std::string_view source_code, AP
 // Compile a compute shader to SPIR-V.
 std::optional<CodeVector> CompileComputeShader(std::string_view source_code, APIType api_type,
                                                glslang::EShTargetLanguageVersion language_version);
+
+// Compiled shaders are kept in a disk cache keyed by their source, which is opened on first use
+// when the shader cache is enabled. Writes any pending entries out and releases the cache.
+void CloseDiskCache();
 }  // namespace SPIRV
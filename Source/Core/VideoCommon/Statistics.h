@@ -71,6 +71,8 @@ struct Statistics
 
     int num_efb_peeks = 0;
     int num_efb_pokes = 0;
+    int num_efb_peek_stalls = 0;
+    int num_efb_peeks_delayed = 0;
 
     int num_draw_done = 0;
     int num_token = 0;
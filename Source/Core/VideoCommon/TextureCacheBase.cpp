@@ -8,6 +8,7 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #if defined(_M_X86_64)
@@ -28,6 +29,7 @@
 
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/ConfigManager.h"
+#include "Core/Core.h"
 #include "Core/FifoPlayer/FifoPlayer.h"
 #include "Core/FifoPlayer/FifoRecorder.h"
 #include "Core/HW/Memmap.h"
@@ -37,6 +39,7 @@
 #include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/AbstractStagingTexture.h"
 #include "VideoCommon/Assets/CustomTextureData.h"
+#include "VideoCommon/AsyncShaderCompiler.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/FBInfo.h"
@@ -60,11 +63,26 @@ static const u64 TEXHASH_INVALID = 0;
 // Sonic the Fighters (inside Sonic Gems Collection) loops a 64 frames animation
 static const int TEXTURE_KILL_THRESHOLD = 64;
 static const int TEXTURE_POOL_KILL_THRESHOLD = 3;
+// EFB copy sizes often alternate between frames (e.g. bloom or shadow passes which only run every
+// few frames), so pooled render targets are kept around longer, within a VRAM budget.
+static const int TEXTURE_POOL_RENDER_TARGET_KILL_THRESHOLD = 30;
+static const size_t TEXTURE_POOL_RENDER_TARGET_BUDGET = 128 * 1024 * 1024;
+
+// Smaller textures are decoded faster than they could be handed to a worker thread.
+static const u32 ASYNC_DECODE_MIN_TEXELS = 128 * 128;
 
 static int xfb_count = 0;
 
 std::unique_ptr<TextureCacheBase> g_texture_cache;
 
+static u64 GetTextureHash(const u8* src, u32 len, u32 samples)
+{
+  if (g_ActiveConfig.texture_hash_function == TextureHashFunction::XXH3)
+    return Common::GetXXH3Hash64(src, len, samples);
+
+  return Common::GetHash64(src, len, samples);
+}
+
 TCacheEntry::TCacheEntry(std::unique_ptr<AbstractTexture> tex,
                          std::unique_ptr<AbstractFramebuffer> fb)
     : texture(std::move(tex)), framebuffer(std::move(fb))
@@ -99,6 +117,8 @@ TextureCacheBase::TextureCacheBase()
   TexDecoder_SetTexFmtOverlayOptions(m_backup_config.texfmt_overlay,
                                      m_backup_config.texfmt_overlay_center);
 
+  m_texture_decoder = std::make_unique<VideoCommon::AsyncShaderCompiler>();
+
   HiresTexture::Init();
 
   TMEM::InvalidateAll();
@@ -109,6 +129,9 @@ void TextureCacheBase::Shutdown()
   // Clear pending EFB copies first, so we don't try to flush them.
   m_pending_efb_copies.clear();
 
+  // Textures which are still being decoded are dropped along with their entries.
+  m_texture_decoder->StopWorkerThreads();
+
   HiresTexture::Shutdown();
 
   // For correctness, we need to invalidate textures before the gpu context starts shutting down.
@@ -129,6 +152,9 @@ bool TextureCacheBase::Initialize()
     return false;
   }
 
+  if (!m_texture_decoder->StartWorkerThreads(m_backup_config.texture_decoding_threads))
+    WARN_LOG_FMT(VIDEO, "Failed to start texture decoding threads, decoding synchronously.");
+
   return true;
 }
 
@@ -139,8 +165,10 @@ void TextureCacheBase::Invalidate()
 
   for (auto& bind : m_bound_textures)
     bind.reset();
-  m_textures_by_hash.clear();
+  m_textures_by_hash.Clear();
   m_textures_by_address.clear();
+  m_max_texture_size_in_bytes = 0;
+  m_palette_index_textures.clear();
 
   m_texture_pool.clear();
 }
@@ -158,6 +186,7 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
 
   // TODO: Invalidating texcache is really stupid in some of these cases
   if (config.iSafeTextureCache_ColorSamples != m_backup_config.color_samples ||
+      config.texture_hash_function != m_backup_config.texture_hash_function ||
       config.bTexFmtOverlayEnable != m_backup_config.texfmt_overlay ||
       config.bTexFmtOverlayCenter != m_backup_config.texfmt_overlay_center ||
       config.bHiresTextures != m_backup_config.hires_textures ||
@@ -171,6 +200,12 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
     TexDecoder_SetTexFmtOverlayOptions(config.bTexFmtOverlayEnable, config.bTexFmtOverlayCenter);
   }
 
+  if (config.GetTextureDecodingThreads() != m_backup_config.texture_decoding_threads)
+  {
+    WaitForTextureDecodes();
+    m_texture_decoder->ResizeWorkerThreads(config.GetTextureDecodingThreads());
+  }
+
   SetBackupConfig(config);
 }
 
@@ -214,6 +249,24 @@ void TextureCacheBase::Cleanup(int _frameCount)
     }
   }
 
+  // Textures may have been removed since the size of the largest one was last calculated.
+  m_max_texture_size_in_bytes = 0;
+  for (const auto& it : m_textures_by_address)
+    m_max_texture_size_in_bytes = std::max(m_max_texture_size_in_bytes, it.second->size_in_bytes);
+
+  for (auto index_iter = m_palette_index_textures.begin();
+       index_iter != m_palette_index_textures.end();)
+  {
+    RcTcacheEntry& entry = index_iter->second;
+    if (entry->frameCount == FRAMECOUNT_INVALID)
+      entry->frameCount = _frameCount;
+
+    if (_frameCount > TEXTURE_KILL_THRESHOLD + entry->frameCount)
+      index_iter = m_palette_index_textures.erase(index_iter);
+    else
+      ++index_iter;
+  }
+
   TexPool::iterator iter2 = m_texture_pool.begin();
   TexPool::iterator tcend2 = m_texture_pool.end();
   while (iter2 != tcend2)
@@ -222,7 +275,10 @@ void TextureCacheBase::Cleanup(int _frameCount)
     {
       iter2->second.frameCount = _frameCount;
     }
-    if (_frameCount > TEXTURE_POOL_KILL_THRESHOLD + iter2->second.frameCount)
+    const int kill_threshold = iter2->first.IsRenderTarget() ?
+                                   TEXTURE_POOL_RENDER_TARGET_KILL_THRESHOLD :
+                                   TEXTURE_POOL_KILL_THRESHOLD;
+    if (_frameCount > kill_threshold + iter2->second.frameCount)
     {
       iter2 = m_texture_pool.erase(iter2);
     }
@@ -231,6 +287,43 @@ void TextureCacheBase::Cleanup(int _frameCount)
       ++iter2;
     }
   }
+
+  TrimRenderTargetPool();
+}
+
+void TextureCacheBase::TrimRenderTargetPool()
+{
+  // Reused across frames, as this runs every frame.
+  std::vector<TexPool::iterator>& render_targets = m_render_targets_to_trim;
+  render_targets.clear();
+  size_t total_size = 0;
+  for (auto iter = m_texture_pool.begin(); iter != m_texture_pool.end(); ++iter)
+  {
+    if (!iter->first.IsRenderTarget())
+      continue;
+
+    render_targets.push_back(iter);
+    total_size += GetPooledTextureSize(iter->first);
+  }
+  if (total_size <= TEXTURE_POOL_RENDER_TARGET_BUDGET)
+    return;
+
+  // Free the render targets which have been in the pool the longest first.
+  std::ranges::sort(render_targets, {},
+                    [](const TexPool::iterator& iter) { return iter->second.frameCount; });
+  for (const TexPool::iterator& iter : render_targets)
+  {
+    if (total_size <= TEXTURE_POOL_RENDER_TARGET_BUDGET)
+      break;
+
+    total_size -= GetPooledTextureSize(iter->first);
+    m_texture_pool.erase(iter);
+  }
+}
+
+size_t TextureCacheBase::GetPooledTextureSize(const TextureConfig& config)
+{
+  return config.GetStride() * config.height * config.layers * config.samples;
 }
 
 bool TCacheEntry::OverlapsMemoryRange(u32 range_address, u32 range_size) const
@@ -247,6 +340,7 @@ bool TCacheEntry::OverlapsMemoryRange(u32 range_address, u32 range_size) const
 void TextureCacheBase::SetBackupConfig(const VideoConfig& config)
 {
   m_backup_config.color_samples = config.iSafeTextureCache_ColorSamples;
+  m_backup_config.texture_hash_function = config.texture_hash_function;
   m_backup_config.texfmt_overlay = config.bTexFmtOverlayEnable;
   m_backup_config.texfmt_overlay_center = config.bTexFmtOverlayCenter;
   m_backup_config.hires_textures = config.bHiresTextures;
@@ -256,6 +350,7 @@ void TextureCacheBase::SetBackupConfig(const VideoConfig& config)
   m_backup_config.gpu_texture_decoding = config.bEnableGPUTextureDecoding;
   m_backup_config.disable_vram_copies = config.bDisableCopyToVRAM;
   m_backup_config.arbitrary_mipmap_detection = config.bArbitraryMipmapDetection;
+  m_backup_config.texture_decoding_threads = config.GetTextureDecodingThreads();
   m_backup_config.graphics_mods = config.bGraphicMods;
   m_backup_config.graphics_mod_change_count =
       config.graphics_mod_config ? config.graphics_mod_config->GetChangeCount() : 0;
@@ -348,11 +443,65 @@ RcTcacheEntry TextureCacheBase::ApplyPaletteToEntry(RcTcacheEntry& entry, const
     g_gfx->EndUtilityDrawing();
   }
 
-  m_textures_by_address.emplace(decoded_entry->addr, decoded_entry);
+  AddToAddressCache(decoded_entry->addr, decoded_entry->size_in_bytes, decoded_entry);
 
   return decoded_entry;
 }
 
+bool TextureCacheBase::CanUsePaletteIndexTexture(const TextureInfo& texture_info) const
+{
+  // C14X2 indices don't fit in the 8-bit index textures, and the conversion only produces a single
+  // level. Custom textures are looked up by their palette, so leave those to the regular path.
+  const TextureFormat format = texture_info.GetTextureFormat();
+  return g_ActiveConfig.backend_info.bSupportsPaletteConversion &&
+         (format == TextureFormat::C4 || format == TextureFormat::C8) &&
+         texture_info.GetLevelCount() == 1 && !texture_info.IsFromTmem() &&
+         !g_ActiveConfig.bHiresTextures && !g_ActiveConfig.bGraphicMods &&
+         !g_ActiveConfig.bDumpTextures;
+}
+
+RcTcacheEntry TextureCacheBase::GetPaletteIndexTexture(const TextureInfo& texture_info,
+                                                       u64 base_hash)
+{
+  // C4 and C8 share their block layout with I4 and I8, and the palette conversion pipelines take
+  // their index from the red channel of an I4 or I8 texture.
+  const TextureFormat index_format =
+      texture_info.GetTextureFormat() == TextureFormat::C4 ? TextureFormat::I4 : TextureFormat::I8;
+  const u32 width = texture_info.GetRawWidth();
+  const u32 height = texture_info.GetRawHeight();
+  const PaletteIndexKey key{texture_info.GetRawAddress(), width, height, index_format, base_hash};
+  auto iter = m_palette_index_textures.find(key);
+  if (iter != m_palette_index_textures.end())
+  {
+    iter->second->frameCount = FRAMECOUNT_INVALID;
+    return iter->second;
+  }
+
+  const TextureConfig config(width, height, 1, 1, 1, AbstractTextureFormat::RGBA8, 0,
+                             AbstractTextureType::Texture_2DArray);
+  RcTcacheEntry entry = AllocateCacheEntry(config);
+  if (!entry)
+    return entry;
+
+  const u32 expanded_width = texture_info.GetExpandedWidth();
+  const u32 expanded_height = texture_info.GetExpandedHeight();
+  const size_t decoded_size = expanded_width * sizeof(u32) * expanded_height;
+  CheckTempSize(decoded_size);
+  TexDecoder_Decode(m_temp, texture_info.GetData(), expanded_width, expanded_height, index_format,
+                    nullptr, texture_info.GetTlutFormat());
+  entry->texture->Load(0, width, height, expanded_width, m_temp, decoded_size);
+
+  entry->SetGeneralParameters(texture_info.GetRawAddress(), texture_info.GetTextureSize(),
+                              TextureAndTLUTFormat(index_format, texture_info.GetTlutFormat()),
+                              false);
+  entry->SetDimensions(width, height, 1);
+  entry->SetHashes(base_hash, base_hash);
+  entry->SetNotCopy();
+  entry->frameCount = FRAMECOUNT_INVALID;
+  m_palette_index_textures.emplace(key, entry);
+  return entry;
+}
+
 RcTcacheEntry TextureCacheBase::ReinterpretEntry(const RcTcacheEntry& existing_entry,
                                                  TextureFormat new_format)
 {
@@ -394,7 +543,8 @@ RcTcacheEntry TextureCacheBase::ReinterpretEntry(const RcTcacheEntry& existing_e
   g_gfx->EndUtilityDrawing();
   reinterpreted_entry->texture->FinishedRendering();
 
-  m_textures_by_address.emplace(reinterpreted_entry->addr, reinterpreted_entry);
+  AddToAddressCache(reinterpreted_entry->addr, reinterpreted_entry->size_in_bytes,
+                    reinterpreted_entry);
 
   return reinterpreted_entry;
 }
@@ -564,6 +714,9 @@ void TextureCacheBase::DoState(PointerWrap& p)
   // Flush all pending XFB copies before either loading or saving.
   FlushEFBCopies();
 
+  // Textures are saved from the GPU, so their contents have to be complete.
+  WaitForTextureDecodes();
+
   p.Do(m_last_entry_id);
 
   if (p.IsWriteMode() || p.IsMeasureMode())
@@ -618,14 +771,13 @@ void TextureCacheBase::DoSaveState(PointerWrap& p)
         textures_by_address_list.emplace_back(it.first, id);
       }
     }
-    for (const auto& it : m_textures_by_hash)
-    {
-      if (ShouldSaveEntry(it.second))
+    m_textures_by_hash.ForEach([&](u64 hash, const RcTcacheEntry& entry) {
+      if (ShouldSaveEntry(entry))
       {
-        const u32 id = AddCacheEntryToMap(it.second);
-        textures_by_hash_list.emplace_back(it.first, id);
+        const u32 id = AddCacheEntryToMap(entry);
+        textures_by_hash_list.emplace_back(hash, id);
       }
-    }
+    });
     for (u32 i = 0; i < m_bound_textures.size(); i++)
     {
       const auto& tentry = m_bound_textures[i];
@@ -717,7 +869,6 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
     auto tex = DeserializeTexture(p);
     auto entry =
         std::make_shared<TCacheEntry>(std::move(tex->texture), std::move(tex->framebuffer));
-    entry->textures_by_hash_iter = m_textures_by_hash.end();
     entry->DoState(p);
     if (entry->texture && commit_state)
       id_map.emplace(i, entry);
@@ -748,7 +899,7 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     auto& entry = GetEntry(id);
     if (entry)
-      m_textures_by_address.emplace(addr, entry);
+      AddToAddressCache(addr, entry->size_in_bytes, entry);
   }
 
   // Fill in hash map.
@@ -762,7 +913,7 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     auto& entry = GetEntry(id);
     if (entry)
-      entry->textures_by_hash_iter = m_textures_by_hash.emplace(hash, entry);
+      AddToHashCache(hash, entry);
   }
 
   // Clear bound textures
@@ -791,6 +942,8 @@ void TextureCacheBase::OnFrameEnd()
   // copies.
   FlushEFBCopies();
 
+  RetrieveTextureDecodes();
+
   Cleanup(g_presenter->FrameCount());
 }
 
@@ -893,6 +1046,10 @@ RcTcacheEntry TextureCacheBase::DoPartialTextureUpdates(RcTcacheEntry& entry_to_
           }
         }
 
+        // The EFB copy has to be placed on top of the decoded texture, not the placeholder.
+        if (entry_to_update->pending_decode)
+          WaitForTextureDecodes();
+
         u32 src_x, src_y, dst_x, dst_y;
 
         // Note for understanding the math:
@@ -1081,6 +1238,22 @@ static void SetSamplerState(u32 index, float custom_tex_scale, bool custom_tex,
 
 void TextureCacheBase::BindTextures(BitSet32 used_textures)
 {
+  RetrieveTextureDecodes();
+
+  // Without the decoded contents the draw could differ from a synchronous decode. This would
+  // change the outcome of EFB copies to RAM and EFB peeks, so wait when determinism is needed.
+  if (Core::WantsDeterminism())
+  {
+    for (u32 i = 0; i < m_bound_textures.size(); i++)
+    {
+      if (used_textures[i] && m_bound_textures[i] && m_bound_textures[i]->pending_decode)
+      {
+        WaitForTextureDecodes();
+        break;
+      }
+    }
+  }
+
   auto& system = Core::System::GetInstance();
   auto& pixel_shader_manager = system.GetPixelShaderManager();
   for (u32 i = 0; i < m_bound_textures.size(); i++)
@@ -1244,6 +1417,153 @@ private:
   std::vector<Level> levels;
 };
 
+namespace
+{
+// Decodes all levels of a texture on a worker thread. The source data is copied when the item is
+// queued, as the game is free to overwrite its memory afterwards.
+class TextureDecodeWorkItem final : public VideoCommon::AsyncShaderCompiler::WorkItem
+{
+public:
+  struct Level
+  {
+    u32 level;
+    u32 width;
+    u32 height;
+    u32 expanded_width;
+    u32 expanded_height;
+    std::vector<u8> data;
+  };
+
+  TextureDecodeWorkItem(const RcTcacheEntry& entry, TextureFormat format, std::vector<u8> tlut,
+                        TLUTFormat tlut_format, std::vector<Level> levels)
+      : m_entry(entry), m_format(format), m_tlut(std::move(tlut)), m_tlut_format(tlut_format),
+        m_levels(std::move(levels))
+  {
+  }
+
+  bool Compile() override
+  {
+    ArbitraryMipmapDetector arbitrary_mip_detector;
+    for (Level& level : m_levels)
+    {
+      std::vector<u8> decoded(level.expanded_width * sizeof(u32) * level.expanded_height);
+      TexDecoder_Decode(decoded.data(), level.data.data(), level.expanded_width,
+                        level.expanded_height, m_format, m_tlut.data(), m_tlut_format);
+      level.data = std::move(decoded);
+      arbitrary_mip_detector.AddLevel(level.width, level.height, level.expanded_width,
+                                      level.data.data());
+    }
+
+    // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
+    std::vector<u8> downsample_buffer(m_levels[0].data.size() * 5 / 16);
+    m_has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(downsample_buffer.data());
+    return true;
+  }
+
+  void Retrieve() override
+  {
+    // The entry may have been destroyed, and its texture reused, while it was being decoded.
+    const RcTcacheEntry entry = m_entry.lock();
+    if (!entry || !entry->pending_decode)
+      return;
+
+    for (const Level& level : m_levels)
+    {
+      entry->texture->Load(level.level, level.width, level.height, level.expanded_width,
+                           level.data.data(), level.data.size());
+    }
+    entry->has_arbitrary_mips = m_has_arbitrary_mips;
+    entry->pending_decode = false;
+  }
+
+private:
+  std::weak_ptr<TCacheEntry> m_entry;
+  TextureFormat m_format;
+  std::vector<u8> m_tlut;
+  TLUTFormat m_tlut_format;
+  std::vector<Level> m_levels;
+  bool m_has_arbitrary_mips = false;
+};
+}  // namespace
+
+bool TextureCacheBase::QueueTextureDecode(RcTcacheEntry& entry,
+                                          const TextureCreationInfo& creation_info,
+                                          const TextureInfo& texture_info, u32 levels)
+{
+  if (!m_texture_decoder->HasWorkerThreads())
+    return false;
+
+  // RGBA8 textures in TMEM are split across both banks, and the dumper needs the decoded texture
+  // right away.
+  if ((texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8) ||
+      g_ActiveConfig.bDumpTextures)
+  {
+    return false;
+  }
+
+  const u32 expanded_width = texture_info.GetExpandedWidth();
+  const u32 expanded_height = texture_info.GetExpandedHeight();
+  if (expanded_width * expanded_height < ASYNC_DECODE_MIN_TEXELS)
+    return false;
+
+  std::vector<TextureDecodeWorkItem::Level> decode_levels;
+  decode_levels.reserve(levels);
+  decode_levels.push_back({0, texture_info.GetRawWidth(), texture_info.GetRawHeight(),
+                           expanded_width, expanded_height,
+                           std::vector<u8>(texture_info.GetData(),
+                                           texture_info.GetData() + texture_info.GetTextureSize())});
+  for (u32 level = 1; level != levels; ++level)
+  {
+    auto mip_level = texture_info.GetMipMapLevel(level - 1);
+    if (!mip_level)
+      continue;
+
+    decode_levels.push_back({level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
+                             mip_level->GetExpandedWidth(), mip_level->GetExpandedHeight(),
+                             std::vector<u8>(mip_level->GetData(),
+                                             mip_level->GetData() + mip_level->GetTextureSize())});
+  }
+
+  std::vector<u8> tlut;
+  if (creation_info.palette_size != 0)
+  {
+    tlut.assign(texture_info.GetTlutAddress(),
+                texture_info.GetTlutAddress() + creation_info.palette_size);
+  }
+
+  // Until the worker thread is done, the texture is transparent black.
+  const size_t placeholder_size = expanded_width * sizeof(u32) * expanded_height;
+  if (m_decode_placeholder.size() < placeholder_size)
+    m_decode_placeholder.resize(placeholder_size);
+  for (const TextureDecodeWorkItem::Level& level : decode_levels)
+  {
+    entry->texture->Load(level.level, level.width, level.height, level.expanded_width,
+                         m_decode_placeholder.data(),
+                         level.expanded_width * sizeof(u32) * level.expanded_height);
+  }
+
+  entry->pending_decode = true;
+  m_texture_decoder->QueueWorkItem(
+      VideoCommon::AsyncShaderCompiler::CreateWorkItem<TextureDecodeWorkItem>(
+          entry, texture_info.GetTextureFormat(), std::move(tlut), texture_info.GetTlutFormat(),
+          std::move(decode_levels)),
+      0);
+  return true;
+}
+
+void TextureCacheBase::RetrieveTextureDecodes()
+{
+  m_texture_decoder->RetrieveWorkItems();
+}
+
+void TextureCacheBase::WaitForTextureDecodes()
+{
+  while (m_texture_decoder->HasPendingWork())
+    std::this_thread::yield();
+
+  m_texture_decoder->RetrieveWorkItems();
+}
+
 TCacheEntry* TextureCacheBase::Load(const TextureInfo& texture_info)
 {
   if (auto entry = LoadImpl(texture_info, false))
@@ -1283,6 +1603,12 @@ TCacheEntry* TextureCacheBase::LoadImpl(const TextureInfo& texture_info, bool fo
 
     // Otherwise, hash the backing memory and check it's unchanged.
     // FIXME: this doesn't correctly handle textures from tmem.
+    if (!entry->invalidated && CanUseWriteTracking(texture_info) &&
+        Core::System::GetInstance().GetMemory().IsUnmodifiedSince(
+            texture_info.GetData(), texture_info.GetFullLevelSize(), entry->write_tracking_stamp))
+    {
+      return entry;
+    }
     if (!entry->invalidated && entry->base_hash == entry->CalculateHash())
     {
       return entry;
@@ -1353,17 +1679,30 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
                                                             MemoryUpdate::Type::TextureMap);
   }
 
+  // With write tracking, textures whose memory hasn't been written since they were last hashed can
+  // be used without hashing them again.
+  u64 write_tracking_stamp = 0;
+  if (CanUseWriteTracking(texture_info))
+  {
+    if (RcTcacheEntry entry = GetUnmodifiedTexture(texture_info, full_format))
+      return entry;
+
+    // Start tracking before hashing, so that writes while hashing aren't missed.
+    write_tracking_stamp = Core::System::GetInstance().GetMemory().TrackWrites(
+        texture_info.GetData(), texture_info.GetFullLevelSize());
+  }
+
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
-  base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
-                                textureCacheSafetyColorSampleSize);
+  base_hash = GetTextureHash(texture_info.GetData(), texture_info.GetTextureSize(),
+                            textureCacheSafetyColorSampleSize);
   u32 palette_size = 0;
   if (texture_info.GetPaletteSize())
   {
     palette_size = *texture_info.GetPaletteSize();
     full_hash =
-        base_hash ^ Common::GetHash64(texture_info.GetTlutAddress(), *texture_info.GetPaletteSize(),
-                                      textureCacheSafetyColorSampleSize);
+        base_hash ^ GetTextureHash(texture_info.GetTlutAddress(), *texture_info.GetPaletteSize(),
+                                   textureCacheSafetyColorSampleSize);
   }
   else
   {
@@ -1403,6 +1742,7 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
   int temp_frameCount = 0x7fffffff;
   TexAddrCache::iterator unconverted_copy = m_textures_by_address.end();
   TexAddrCache::iterator unreinterpreted_copy = m_textures_by_address.end();
+  bool palette_swapped = false;
 
   while (iter != iter_range.second)
   {
@@ -1488,12 +1828,19 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
                                         texture_info.GetTlutFormat());
         if (entry)
         {
+          entry->write_tracking_stamp = write_tracking_stamp;
           entry->texture->FinishedRendering();
           return entry;
         }
       }
     }
 
+    if (texture_info.GetPaletteSize() && !entry->IsCopy() && entry->base_hash == base_hash &&
+        entry->hash != full_hash)
+    {
+      palette_swapped = true;
+    }
+
     // Find the texture which hasn't been used for the longest time. Count paletted
     // textures as the same texture here, when the texture itself is the same. This
     // improves the performance a lot in some games that use paletted textures.
@@ -1545,25 +1892,29 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
       std::max(texture_info.GetTextureSize(), palette_size) <=
           (u32)textureCacheSafetyColorSampleSize * 8)
   {
-    auto hash_range = m_textures_by_hash.equal_range(full_hash);
-    TexHashCache::iterator hash_iter = hash_range.first;
-    while (hash_iter != hash_range.second)
-    {
-      RcTcacheEntry& entry = hash_iter->second;
+    RcTcacheEntry hash_entry;
+    m_textures_by_hash.ForEachWithHash(full_hash, [&](const RcTcacheEntry& entry) {
       // All parameters, except the address, need to match here
-      if (entry->format == full_format && entry->native_levels >= texture_info.GetLevelCount() &&
-          entry->native_width == texture_info.GetRawWidth() &&
-          entry->native_height == texture_info.GetRawHeight())
+      if (entry->format != full_format || entry->native_levels < texture_info.GetLevelCount() ||
+          entry->native_width != texture_info.GetRawWidth() ||
+          entry->native_height != texture_info.GetRawHeight())
       {
-        entry = DoPartialTextureUpdates(hash_iter->second, texture_info.GetTlutAddress(),
-                                        texture_info.GetTlutFormat());
-        if (entry)
-        {
-          entry->texture->FinishedRendering();
-          return entry;
-        }
+        return false;
+      }
+
+      hash_entry = entry;
+      return true;
+    });
+
+    if (hash_entry)
+    {
+      hash_entry = DoPartialTextureUpdates(hash_entry, texture_info.GetTlutAddress(),
+                                           texture_info.GetTlutFormat());
+      if (hash_entry)
+      {
+        hash_entry->texture->FinishedRendering();
+        return hash_entry;
       }
-      ++hash_iter;
     }
   }
 
@@ -1574,6 +1925,33 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
     InvalidateTexture(oldest_entry);
   }
 
+  // The same texture data is used with a different palette, so keep its indices on the GPU, and
+  // only run the palette conversion from now on.
+  if (palette_swapped && CanUsePaletteIndexTexture(texture_info))
+  {
+    RcTcacheEntry index_entry = GetPaletteIndexTexture(texture_info, base_hash);
+    if (index_entry)
+    {
+      RcTcacheEntry decoded_entry = ApplyPaletteToEntry(index_entry, texture_info.GetTlutAddress(),
+                                                        texture_info.GetTlutFormat());
+      if (decoded_entry)
+      {
+        decoded_entry->SetGeneralParameters(texture_info.GetRawAddress(),
+                                            texture_info.GetTextureSize(), full_format, false);
+        decoded_entry->SetHashes(base_hash, full_hash);
+        decoded_entry->memory_stride = decoded_entry->BytesPerRow();
+        decoded_entry = DoPartialTextureUpdates(decoded_entry, texture_info.GetTlutAddress(),
+                                                texture_info.GetTlutFormat());
+        if (decoded_entry)
+        {
+          INCSTAT(g_stats.num_textures_uploaded);
+          decoded_entry->texture->FinishedRendering();
+          return decoded_entry;
+        }
+      }
+    }
+  }
+
   std::vector<VideoCommon::CachedAsset<VideoCommon::GameTextureAsset>> cached_game_assets;
   std::vector<std::shared_ptr<VideoCommon::TextureData>> data_for_assets;
   bool has_arbitrary_mipmaps = false;
@@ -1649,9 +2027,49 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
   entry->linked_game_texture_assets = std::move(cached_game_assets);
   entry->linked_asset_dependencies = std::move(additional_dependencies);
   entry->texture_info_name = std::move(texture_name);
+  entry->write_tracking_stamp = write_tracking_stamp;
   return entry;
 }
 
+bool TextureCacheBase::CanUseWriteTracking(const TextureInfo& texture_info) const
+{
+  // Palettes are loaded from TMEM, so paletted textures still need to be hashed.
+  return g_ActiveConfig.bTextureWriteTracking && !texture_info.IsFromTmem() &&
+         !texture_info.GetPaletteSize() &&
+         Core::System::GetInstance().GetMemory().IsWriteTrackingEnabled();
+}
+
+RcTcacheEntry TextureCacheBase::GetUnmodifiedTexture(const TextureInfo& texture_info,
+                                                     const TextureAndTLUTFormat& full_format)
+{
+  auto& memory = Core::System::GetInstance().GetMemory();
+  const auto iter_range = m_textures_by_address.equal_range(texture_info.GetRawAddress());
+  for (auto iter = iter_range.first; iter != iter_range.second; ++iter)
+  {
+    // The same parameters as for hashed normal textures need to match.
+    const RcTcacheEntry& entry = iter->second;
+    if (entry->IsCopy() || entry->write_tracking_stamp == 0 || entry->format != full_format ||
+        entry->native_levels < texture_info.GetLevelCount() ||
+        entry->native_width != texture_info.GetRawWidth() ||
+        entry->native_height != texture_info.GetRawHeight() ||
+        !memory.IsUnmodifiedSince(texture_info.GetData(), texture_info.GetFullLevelSize(),
+                                  entry->write_tracking_stamp))
+    {
+      continue;
+    }
+
+    RcTcacheEntry updated_entry = DoPartialTextureUpdates(
+        iter->second, texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+    if (updated_entry)
+    {
+      updated_entry->texture->FinishedRendering();
+      return updated_entry;
+    }
+  }
+
+  return {};
+}
+
 // Note: the following function assumes all CustomTextureData has a single slice.  This is verified
 // with the 'GameTexture::Validate' function after the data is loaded. Only a single slice is
 // expected because each texture is loaded into a texture array
@@ -1727,90 +2145,93 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
         g_ActiveConfig.UseGPUTextureDecoding() &&
         !(texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8);
 
-    ArbitraryMipmapDetector arbitrary_mip_detector;
-
-    // Initialized to null because only software loading uses this buffer
-    u8* dst_buffer = nullptr;
-
-    if (!decode_on_gpu ||
-        !DecodeTextureOnGPU(
-            entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
-            texture_info.GetTextureFormat(), width, height, expanded_width, expanded_height,
-            creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth()),
-            texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
+    if (decode_on_gpu || !QueueTextureDecode(entry, creation_info, texture_info, texLevels))
     {
-      size_t decoded_texture_size = expanded_width * sizeof(u32) * expanded_height;
+      ArbitraryMipmapDetector arbitrary_mip_detector;
 
-      // Allocate memory for all levels at once
-      size_t total_texture_size = decoded_texture_size;
+      // Initialized to null because only software loading uses this buffer
+      u8* dst_buffer = nullptr;
 
-      // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
-      size_t mip_downsample_buffer_size = decoded_texture_size * 5 / 16;
-
-      size_t prev_level_size = decoded_texture_size;
-      for (u32 i = 1; i < texture_info.GetLevelCount(); ++i)
+      if (!decode_on_gpu ||
+          !DecodeTextureOnGPU(
+              entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
+              texture_info.GetTextureFormat(), width, height, expanded_width, expanded_height,
+              creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth()),
+              texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
       {
-        prev_level_size /= 4;
-        total_texture_size += prev_level_size;
-      }
+        size_t decoded_texture_size = expanded_width * sizeof(u32) * expanded_height;
 
-      // Add space for the downsampling at the end
-      total_texture_size += mip_downsample_buffer_size;
+        // Allocate memory for all levels at once
+        size_t total_texture_size = decoded_texture_size;
 
-      CheckTempSize(total_texture_size);
-      dst_buffer = m_temp;
-      if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
-      {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
-      }
-      else
-      {
-        TexDecoder_DecodeRGBA8FromTmem(dst_buffer, texture_info.GetData(),
-                                       texture_info.GetTmemOddAddress(), expanded_width,
-                                       expanded_height);
-      }
+        // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
+        size_t mip_downsample_buffer_size = decoded_texture_size * 5 / 16;
 
-      entry->texture->Load(0, width, height, expanded_width, dst_buffer, decoded_texture_size);
+        size_t prev_level_size = decoded_texture_size;
+        for (u32 i = 1; i < texture_info.GetLevelCount(); ++i)
+        {
+          prev_level_size /= 4;
+          total_texture_size += prev_level_size;
+        }
 
-      arbitrary_mip_detector.AddLevel(width, height, expanded_width, dst_buffer);
+        // Add space for the downsampling at the end
+        total_texture_size += mip_downsample_buffer_size;
 
-      dst_buffer += decoded_texture_size;
-    }
+        CheckTempSize(total_texture_size);
+        dst_buffer = m_temp;
+        if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
+        {
+          TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
+                            texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
+                            texture_info.GetTlutFormat());
+        }
+        else
+        {
+          TexDecoder_DecodeRGBA8FromTmem(dst_buffer, texture_info.GetData(),
+                                         texture_info.GetTmemOddAddress(), expanded_width,
+                                         expanded_height);
+        }
 
-    for (u32 level = 1; level != texLevels; ++level)
-    {
-      auto mip_level = texture_info.GetMipMapLevel(level - 1);
-      if (!mip_level)
-        continue;
+        entry->texture->Load(0, width, height, expanded_width, dst_buffer, decoded_texture_size);
 
-      if (!decode_on_gpu ||
-          !DecodeTextureOnGPU(entry, level, mip_level->GetData(), mip_level->GetTextureSize(),
-                              texture_info.GetTextureFormat(), mip_level->GetRawWidth(),
-                              mip_level->GetRawHeight(), mip_level->GetExpandedWidth(),
-                              mip_level->GetExpandedHeight(),
-                              creation_info.bytes_per_block *
-                                  (mip_level->GetExpandedWidth() / texture_info.GetBlockWidth()),
-                              texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
+        arbitrary_mip_detector.AddLevel(width, height, expanded_width, dst_buffer);
+
+        dst_buffer += decoded_texture_size;
+      }
+
+      for (u32 level = 1; level != texLevels; ++level)
       {
-        // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
-        const u32 decoded_mip_size =
-            mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
-                          mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
-        entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                             mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
-
-        arbitrary_mip_detector.AddLevel(mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                                        mip_level->GetExpandedWidth(), dst_buffer);
-
-        dst_buffer += decoded_mip_size;
+        auto mip_level = texture_info.GetMipMapLevel(level - 1);
+        if (!mip_level)
+          continue;
+
+        if (!decode_on_gpu ||
+            !DecodeTextureOnGPU(entry, level, mip_level->GetData(), mip_level->GetTextureSize(),
+                                texture_info.GetTextureFormat(), mip_level->GetRawWidth(),
+                                mip_level->GetRawHeight(), mip_level->GetExpandedWidth(),
+                                mip_level->GetExpandedHeight(),
+                                creation_info.bytes_per_block *
+                                    (mip_level->GetExpandedWidth() / texture_info.GetBlockWidth()),
+                                texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
+        {
+          // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
+          const u32 decoded_mip_size =
+              mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
+          TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
+                            mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
+                            texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+          entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
+                               mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
+
+          arbitrary_mip_detector.AddLevel(mip_level->GetRawWidth(), mip_level->GetRawHeight(),
+                                          mip_level->GetExpandedWidth(), dst_buffer);
+
+          dst_buffer += decoded_mip_size;
+        }
       }
-    }
 
-    entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
+      entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
+    }
 
     if (g_ActiveConfig.bDumpTextures && !skip_texture_dump && texLevels > 0)
     {
@@ -1829,12 +2250,13 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     }
   }
 
-  const auto iter = m_textures_by_address.emplace(texture_info.GetRawAddress(), entry);
+  const auto iter =
+      AddToAddressCache(texture_info.GetRawAddress(), texture_info.GetTextureSize(), entry);
   if (safety_color_sample_size == 0 ||
       std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
           (u32)safety_color_sample_size * 8)
   {
-    entry->textures_by_hash_iter = m_textures_by_hash.emplace(creation_info.full_hash, entry);
+    AddToHashCache(creation_info.full_hash, entry);
   }
 
   const TextureAndTLUTFormat full_format(texture_info.GetTextureFormat(),
@@ -1929,7 +2351,7 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
   entry->texture->FinishedRendering();
 
   // Insert into the texture cache so we can re-use it next frame, if needed.
-  m_textures_by_address.emplace(entry->addr, entry);
+  AddToAddressCache(entry->addr, entry->size_in_bytes, entry);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
   INCSTAT(g_stats.num_textures_uploaded);
 
@@ -2245,6 +2667,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   // Disadvantage of all methods: Calling this function requires the GPU to perform a pipeline flush
   // which stalls any further CPU processing.
   const bool is_xfb_copy = !is_depth_copy && !isIntensity && dstFormat == EFBCopyFormat::XFB;
+  g_gfx->SetGPUTimingPass(is_xfb_copy ? GPUTimingPass::XFBCopy : GPUTimingPass::EFBCopy);
   bool copy_to_vram =
       g_ActiveConfig.backend_info.bSupportsCopyToVram && !g_ActiveConfig.bDisableCopyToVRAM;
   bool copy_to_ram =
@@ -2268,7 +2691,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
     scaled_tex_h /= 2;
   }
 
-  if (!is_xfb_copy && !g_ActiveConfig.bCopyEFBScaled)
+  if (!is_xfb_copy && (!g_ActiveConfig.bCopyEFBScaled || IsNativeHalfScaleCopy(scaleByHalf)))
   {
     // No upscaling
     scaled_tex_w = tex_w;
@@ -2349,8 +2772,8 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   }
 
   // We also linear filtering for both box filtering and downsampling higher resolutions to 1x.
-  // TODO: This only produces perfect downsampling for 2x IR, other resolutions will need more
-  //       complex down filtering to average all pixels and produce the correct result.
+  // Above 2x IR, native resolution copies average several linear samples, see
+  // CopyEFBToCacheEntry.
   const bool linear_filter =
       !is_depth_copy &&
       (scaleByHalf || g_framebuffer_manager->GetEFBScale() != 1 || y_scale > 1.0f);
@@ -2517,11 +2940,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
 
       // Do not load textures by hash, if they were at least partly overwritten by an efb copy.
       // In this case, comparing the hash is not enough to check, if two textures are identical.
-      if (overlapping_entry->textures_by_hash_iter != m_textures_by_hash.end())
-      {
-        m_textures_by_hash.erase(overlapping_entry->textures_by_hash_iter);
-        overlapping_entry->textures_by_hash_iter = m_textures_by_hash.end();
-      }
+      RemoveFromHashCache(overlapping_entry.get());
     }
     ++iter.first;
   }
@@ -2544,7 +2963,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   {
     const u64 hash = entry->CalculateHash();
     entry->SetHashes(hash, hash);
-    m_textures_by_address.emplace(dstAddr, std::move(entry));
+    AddToAddressCache(dstAddr, entry->size_in_bytes, std::move(entry));
   }
 }
 
@@ -2553,6 +2972,11 @@ void TextureCacheBase::FlushEFBCopies()
   if (m_pending_efb_copies.empty())
     return;
 
+  // Wait for the most recent copy first. Copies complete in the order they were submitted, so this
+  // is the only wait for the whole batch, and command buffers are not split between the copies. The
+  // remaining flushes only have to map the staging textures.
+  m_pending_efb_copies.back()->pending_efb_copy->Flush();
+
   for (auto& entry : m_pending_efb_copies)
     FlushEFBCopy(entry.get());
   m_pending_efb_copies.clear();
@@ -2701,7 +3125,6 @@ RcTcacheEntry TextureCacheBase::AllocateCacheEntry(const TextureConfig& config)
 
   auto cacheEntry =
       std::make_shared<TCacheEntry>(std::move(alloc->texture), std::move(alloc->framebuffer));
-  cacheEntry->textures_by_hash_iter = m_textures_by_hash.end();
   cacheEntry->id = m_last_entry_id++;
   return cacheEntry;
 }
@@ -2771,17 +3194,37 @@ TextureCacheBase::TexAddrCache::iterator TextureCacheBase::GetTexCacheIter(TCach
   return m_textures_by_address.end();
 }
 
+TextureCacheBase::TexAddrCache::iterator
+TextureCacheBase::AddToAddressCache(u32 addr, u32 size_in_bytes, RcTcacheEntry entry)
+{
+  m_max_texture_size_in_bytes = std::max(m_max_texture_size_in_bytes, size_in_bytes);
+  return m_textures_by_address.emplace(addr, std::move(entry));
+}
+
+void TextureCacheBase::AddToHashCache(u64 hash, const RcTcacheEntry& entry)
+{
+  entry->textures_by_hash_key = hash;
+  m_textures_by_hash.Insert(hash, entry);
+}
+
+void TextureCacheBase::RemoveFromHashCache(TCacheEntry* entry)
+{
+  if (!entry->textures_by_hash_key)
+    return;
+
+  m_textures_by_hash.Erase(*entry->textures_by_hash_key, entry);
+  entry->textures_by_hash_key.reset();
+}
+
 std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
 TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
 {
   // We index by the starting address only, so there is no way to query all textures
-  // which end after the given addr. But the GC textures have a limited size, so we
-  // look for all textures which have a start address bigger than addr minus the maximal
-  // texture size. But this yields false-positives which must be checked later on.
-
-  // 1024 x 1024 texel times 8 nibbles per texel
-  constexpr u32 max_texture_size = 1024 * 1024 * 4;
-  u32 lower_addr = addr > max_texture_size ? addr - max_texture_size : 0;
+  // which end after the given addr. But we know the size of the largest texture in the
+  // cache, so we look for all textures which have a start address bigger than addr minus
+  // that size. But this yields false-positives which must be checked later on.
+  const u32 lower_addr =
+      addr > m_max_texture_size_in_bytes ? addr - m_max_texture_size_in_bytes : 0;
   auto begin = m_textures_by_address.lower_bound(lower_addr);
   auto end = m_textures_by_address.upper_bound(addr + size_in_bytes);
 
@@ -2796,11 +3239,7 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
 
   RcTcacheEntry& entry = iter->second;
 
-  if (entry->textures_by_hash_iter != m_textures_by_hash.end())
-  {
-    m_textures_by_hash.erase(entry->textures_by_hash_iter);
-    entry->textures_by_hash_iter = m_textures_by_hash.end();
-  }
+  RemoveFromHashCache(entry.get());
 
   // If this is a pending EFB copy, we don't want to flush it here.
   // Why? Because let's say a game is rendering a bloom-type effect, using EFB copies to essentially
@@ -2871,6 +3310,13 @@ bool TextureCacheBase::CreateUtilityTextures()
   return true;
 }
 
+bool TextureCacheBase::IsNativeHalfScaleCopy(bool scale_by_half)
+{
+  // Half-scale copies are mostly used as blur and bloom sources, which gain little from being
+  // copied at the internal resolution.
+  return scale_by_half && g_ActiveConfig.bCopyEFBHalfScaleNative;
+}
+
 void TextureCacheBase::CopyEFBToCacheEntry(RcTcacheEntry& entry, bool is_depth_copy,
                                            const MathUtil::Rectangle<int>& src_rect,
                                            bool scale_by_half, bool linear_filter,
@@ -2881,10 +3327,20 @@ void TextureCacheBase::CopyEFBToCacheEntry(RcTcacheEntry& entry, bool is_depth_c
   // Flush EFB pokes first, as they're expected to be included.
   g_framebuffer_manager->FlushEFBPokes();
 
+  // Copies made at native resolution from a scaled EFB cover several EFB texels per copy texel.
+  // For color, average all of them rather than the 2x2 a single linear sample reads.
+  const bool scaled_copy = g_ActiveConfig.bCopyEFBScaled &&
+                           (entry->is_xfb_copy || !IsNativeHalfScaleCopy(scale_by_half));
+  const bool native_copy = !scaled_copy && !entry->is_xfb_copy;
+  const u32 footprint =
+      native_copy ? g_framebuffer_manager->GetEFBScale() * (scale_by_half ? 2 : 1) : 1;
+  const bool downsample = linear_filter && footprint > 2;
+
   // Get the pipeline which we will be using. If the compilation failed, this will be null.
-  const AbstractPipeline* copy_pipeline = g_shader_cache->GetEFBCopyToVRAMPipeline(
-      TextureConversionShaderGen::GetShaderUid(dst_format, is_depth_copy, is_intensity,
-                                               scale_by_half, 1.0f / gamma, filter_coefficients));
+  const AbstractPipeline* copy_pipeline =
+      g_shader_cache->GetEFBCopyToVRAMPipeline(TextureConversionShaderGen::GetShaderUid(
+          dst_format, is_depth_copy, is_intensity, scale_by_half, downsample, 1.0f / gamma,
+          filter_coefficients));
   if (!copy_pipeline)
   {
     WARN_LOG_FMT(VIDEO, "Skipping EFB copy to VRAM due to missing pipeline.");
@@ -2910,7 +3366,10 @@ void TextureCacheBase::CopyEFBToCacheEntry(RcTcacheEntry& entry, bool is_depth_c
     float clamp_top;
     float clamp_bottom;
     float pixel_height;
-    u32 padding;
+    u32 downsample_taps;
+    float src_texel_width;
+    float src_texel_height;
+    std::array<u32, 2> padding;
   };
   Uniforms uniforms;
   const float rcp_efb_width = 1.0f / static_cast<float>(g_framebuffer_manager->GetEFBWidth());
@@ -2931,8 +3390,11 @@ void TextureCacheBase::CopyEFBToCacheEntry(RcTcacheEntry& entry, bool is_depth_c
   uniforms.clamp_top = (static_cast<float>(top_coord) + .5f) * rcp_efb_height;
   const u32 bottom_coord = (clamp_bottom ? framebuffer_rect.bottom : efb_height) - 1;
   uniforms.clamp_bottom = (static_cast<float>(bottom_coord) + .5f) * rcp_efb_height;
-  uniforms.pixel_height = g_ActiveConfig.bCopyEFBScaled ? rcp_efb_height : 1.0f / EFB_HEIGHT;
-  uniforms.padding = 0;
+  uniforms.pixel_height = scaled_copy ? rcp_efb_height : 1.0f / EFB_HEIGHT;
+  uniforms.downsample_taps = (footprint + 1) / 2;
+  uniforms.src_texel_width = rcp_efb_width;
+  uniforms.src_texel_height = rcp_efb_height;
+  uniforms.padding = {};
   g_vertex_manager->UploadUtilityUniforms(&uniforms, sizeof(uniforms));
 
   // Use the copy pipeline to render the VRAM copy.
@@ -3083,10 +3545,11 @@ bool TextureCacheBase::DecodeTextureOnGPU(RcTcacheEntry& entry, u32 dst_level, c
 
   // Copy from decoding texture -> final texture
   // This is because we don't want to have to create compute view for every layer
+  // The caller calls FinishedRendering() once all levels have been decoded, so the texture isn't
+  // transitioned back and forth for each mip level.
   const auto copy_rect = entry->texture->GetConfig().GetMipRect(dst_level);
   entry->texture->CopyRectangleFromTexture(m_decoding_texture.get(), copy_rect, 0, 0, copy_rect, 0,
                                            dst_level);
-  entry->texture->FinishedRendering();
   return true;
 }
 
@@ -3169,7 +3632,7 @@ u64 TCacheEntry::CalculateHash() const
   u8* ptr = memory.GetPointerForRange(addr, size_in_bytes);
   if (memory_stride == bytes_per_row)
   {
-    return Common::GetHash64(ptr, size_in_bytes, hash_sample_size);
+    return GetTextureHash(ptr, size_in_bytes, hash_sample_size);
   }
   else
   {
@@ -3188,7 +3651,7 @@ u64 TCacheEntry::CalculateHash() const
     {
       // Multiply by a prime number to mix the hash up a bit. This prevents identical blocks from
       // canceling each other out
-      temp_hash = (temp_hash * 397) ^ Common::GetHash64(ptr, bytes_per_row, samples_per_row);
+      temp_hash = (temp_hash * 397) ^ GetTextureHash(ptr, bytes_per_row, samples_per_row);
       ptr += memory_stride;
     }
     return temp_hash;
@@ -24,6 +24,7 @@
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/TextureCacheHashIndex.h"
 #include "VideoCommon/TextureConfig.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/TextureInfo.h"
@@ -34,9 +35,11 @@ class AbstractFramebuffer;
 class AbstractStagingTexture;
 class PointerWrap;
 struct VideoConfig;
+enum class TextureHashFunction : int;
 
 namespace VideoCommon
 {
+class AsyncShaderCompiler;
 class CustomTextureData;
 class GameTextureAsset;
 }  // namespace VideoCommon
@@ -141,6 +144,10 @@ struct TCacheEntry
   // Indicates that this TCacheEntry has been invalided from m_textures_by_address
   bool invalidated = false;
 
+  // Indicates that the contents are still being decoded by a worker thread, the texture only
+  // holds a placeholder until they are uploaded
+  bool pending_decode = false;
+
   bool reference_changed = false;  // used by xfb to determine when a reference xfb changed
 
   // Texture dimensions from the GameCube's point of view
@@ -151,9 +158,11 @@ struct TCacheEntry
   // used to delete textures which haven't been used for TEXTURE_KILL_THRESHOLD frames
   int frameCount = FRAMECOUNT_INVALID;
 
-  // Keep an iterator to the entry in m_textures_by_hash, so it does not need to be searched when
-  // removing the cache entry
-  std::multimap<u64, std::shared_ptr<TCacheEntry>>::iterator textures_by_hash_iter;
+  // Write tracking stamp from when the texture was last known to match memory, 0 if not tracked
+  u64 write_tracking_stamp = 0;
+
+  // The hash this entry was added to m_textures_by_hash with, if it was added
+  std::optional<u64> textures_by_hash_key;
 
   // This is used to keep track of both:
   //   * efb copies used by this partially updated texture
@@ -324,6 +333,9 @@ protected:
                        const MathUtil::Rectangle<int>& src_rect, bool scale_by_half,
                        bool linear_filter, float y_scale, float gamma, bool clamp_top,
                        bool clamp_bottom, const std::array<u32, 3>& filter_coefficients);
+  // Whether scaled EFB copies with these parameters are made at native resolution anyway.
+  static bool IsNativeHalfScaleCopy(bool scale_by_half);
+
   virtual void CopyEFBToCacheEntry(RcTcacheEntry& entry, bool is_depth_copy,
                                    const MathUtil::Rectangle<int>& src_rect, bool scale_by_half,
                                    bool linear_filter, EFBCopyFormat dst_format, bool is_intensity,
@@ -335,7 +347,6 @@ protected:
 
 private:
   using TexAddrCache = std::multimap<u32, RcTcacheEntry>;
-  using TexHashCache = std::multimap<u64, RcTcacheEntry>;
 
   using TexPool = std::unordered_multimap<TextureConfig, TexPoolEntry>;
 
@@ -357,19 +368,44 @@ private:
 
   RcTcacheEntry ApplyPaletteToEntry(RcTcacheEntry& entry, const u8* palette, TLUTFormat tlutfmt);
 
+  bool CanUsePaletteIndexTexture(const TextureInfo& texture_info) const;
+  RcTcacheEntry GetPaletteIndexTexture(const TextureInfo& texture_info, u64 base_hash);
+
   RcTcacheEntry ReinterpretEntry(const RcTcacheEntry& existing_entry, TextureFormat new_format);
 
+  bool CanUseWriteTracking(const TextureInfo& texture_info) const;
+  RcTcacheEntry GetUnmodifiedTexture(const TextureInfo& texture_info,
+                                     const TextureAndTLUTFormat& full_format);
+
   RcTcacheEntry DoPartialTextureUpdates(RcTcacheEntry& entry_to_update, const u8* palette,
                                         TLUTFormat tlutfmt);
   void StitchXFBCopy(RcTcacheEntry& entry_to_update);
 
   void CheckTempSize(size_t required_size);
 
+  // Decodes all levels of the texture on a worker thread. Returns false if the texture has to be
+  // decoded synchronously instead.
+  bool QueueTextureDecode(RcTcacheEntry& entry, const TextureCreationInfo& creation_info,
+                          const TextureInfo& texture_info, u32 levels);
+
+  // Uploads the textures which have been decoded by the worker threads.
+  void RetrieveTextureDecodes();
+
+  // Waits until all queued textures have been decoded and uploaded.
+  void WaitForTextureDecodes();
+
   RcTcacheEntry AllocateCacheEntry(const TextureConfig& config);
   std::optional<TexPoolEntry> AllocateTexture(const TextureConfig& config);
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
+  // Frees the oldest pooled render targets while they use more than the pool's VRAM budget.
+  void TrimRenderTargetPool();
+  static size_t GetPooledTextureSize(const TextureConfig& config);
   TexAddrCache::iterator GetTexCacheIter(TCacheEntry* entry);
 
+  TexAddrCache::iterator AddToAddressCache(u32 addr, u32 size_in_bytes, RcTcacheEntry entry);
+  void AddToHashCache(u64 hash, const RcTcacheEntry& entry);
+  void RemoveFromHashCache(TCacheEntry* entry);
+
   // Return all possible overlapping textures. As addr+size of the textures is not
   // indexed, this may return false positives.
   std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
@@ -407,21 +443,41 @@ private:
   // but it's possible for invalidated TCache entries to live on elsewhere
   TexAddrCache m_textures_by_address;
 
+  // Upper bound for size_in_bytes of the entries in m_textures_by_address, which limits how far
+  // FindOverlappingTextures has to look back. Tightened again by Cleanup.
+  u32 m_max_texture_size_in_bytes = 0;
+
   // m_textures_by_hash is an alternative view of the texture cache
   // All textures in here will also be in m_textures_by_address
-  TexHashCache m_textures_by_hash;
+  TextureCacheHashIndex m_textures_by_hash;
 
   // m_bound_textures are actually active in the current draw
   // It's valid for textures to be in here after they've been invalidated
   std::array<RcTcacheEntry, 8> m_bound_textures{};
 
+  // Paletted textures which are used with several palettes keep their indices in a texture, so
+  // palette swaps only need a GPU conversion. These are not in m_textures_by_address.
+  struct PaletteIndexKey
+  {
+    u32 address;
+    u32 width;
+    u32 height;
+    TextureFormat format;
+    u64 base_hash;
+
+    auto operator<=>(const PaletteIndexKey&) const = default;
+  };
+  std::map<PaletteIndexKey, RcTcacheEntry> m_palette_index_textures;
+
   TexPool m_texture_pool;
+  std::vector<TexPool::iterator> m_render_targets_to_trim;
   u64 m_last_entry_id = 0;
 
   // Backup configuration values
   struct BackupConfig
   {
     int color_samples;
+    TextureHashFunction texture_hash_function;
     bool texfmt_overlay;
     bool texfmt_overlay_center;
     bool hires_textures;
@@ -432,6 +488,7 @@ private:
     bool gpu_texture_decoding;
     bool disable_vram_copies;
     bool arbitrary_mipmap_detection;
+    u32 texture_decoding_threads;
     bool graphics_mods;
     u32 graphics_mod_change_count;
   };
@@ -444,6 +501,12 @@ private:
   // Decoding texture used for GPU texture decoding.
   std::unique_ptr<AbstractTexture> m_decoding_texture;
 
+  // Worker threads for background texture decoding.
+  std::unique_ptr<VideoCommon::AsyncShaderCompiler> m_texture_decoder;
+
+  // Zeroes uploaded to textures which are decoded in the background.
+  std::vector<u8> m_decode_placeholder;
+
   // Pool of readback textures used for deferred EFB copies.
   std::vector<std::unique_ptr<AbstractStagingTexture>> m_efb_copy_staging_texture_pool;
 
@@ -0,0 +1,98 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/TextureCacheHashIndex.h"
+
+#include <utility>
+
+static constexpr size_t MIN_CAPACITY = 64;
+
+void TextureCacheHashIndex::Insert(u64 hash, std::shared_ptr<TCacheEntry> entry)
+{
+  // Keep the load factor, including tombstones, below 3/4.
+  if ((m_size + m_removed + 1) * 4 > m_slots.size() * 3)
+  {
+    size_t capacity = MIN_CAPACITY;
+    while ((m_size + 1) * 2 > capacity)
+      capacity *= 2;
+    Rebuild(capacity);
+  }
+
+  for (size_t i = GetHomeSlot(hash);; i = (i + 1) & m_mask)
+  {
+    Slot& slot = m_slots[i];
+    if (slot.state == SlotState::Used)
+      continue;
+
+    if (slot.state == SlotState::Removed)
+      m_removed--;
+
+    slot.hash = hash;
+    slot.entry = std::move(entry);
+    slot.state = SlotState::Used;
+    m_size++;
+    return;
+  }
+}
+
+bool TextureCacheHashIndex::Erase(u64 hash, const TCacheEntry* entry)
+{
+  if (m_slots.empty())
+    return false;
+
+  for (size_t i = GetHomeSlot(hash);; i = (i + 1) & m_mask)
+  {
+    Slot& slot = m_slots[i];
+    if (slot.state == SlotState::Empty)
+      return false;
+
+    if (slot.state == SlotState::Used && slot.hash == hash && slot.entry.get() == entry)
+    {
+      slot.entry.reset();
+      slot.state = SlotState::Removed;
+      m_size--;
+      m_removed++;
+      return true;
+    }
+  }
+}
+
+void TextureCacheHashIndex::Clear()
+{
+  // Move the entries out first, as destroying them can call back into the texture cache.
+  std::vector<Slot> slots = std::move(m_slots);
+  m_slots.clear();
+  m_mask = 0;
+  m_size = 0;
+  m_removed = 0;
+}
+
+size_t TextureCacheHashIndex::GetHomeSlot(u64 hash) const
+{
+  // Fibonacci hashing, so that hashes which only differ in their upper bits are spread out too.
+  return static_cast<size_t>((hash * 0x9E3779B97F4A7C15ULL) >> 32) & m_mask;
+}
+
+void TextureCacheHashIndex::Rebuild(size_t capacity)
+{
+  std::vector<Slot> old_slots(capacity);
+  std::swap(old_slots, m_slots);
+  m_mask = capacity - 1;
+  m_size = 0;
+  m_removed = 0;
+
+  for (Slot& old_slot : old_slots)
+  {
+    if (old_slot.state != SlotState::Used)
+      continue;
+
+    size_t i = GetHomeSlot(old_slot.hash);
+    while (m_slots[i].state != SlotState::Empty)
+      i = (i + 1) & m_mask;
+
+    m_slots[i].hash = old_slot.hash;
+    m_slots[i].entry = std::move(old_slot.entry);
+    m_slots[i].state = SlotState::Used;
+    m_size++;
+  }
+}
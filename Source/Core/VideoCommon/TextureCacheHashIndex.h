@@ -0,0 +1,83 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+struct TCacheEntry;
+
+// Maps texture content hashes to texture cache entries. Several entries can share a hash.
+//
+// The entries are kept in a flat array and found by linear probing, so a lookup touches a few
+// adjacent slots instead of walking the nodes of a tree. Removed entries leave a tombstone behind,
+// which keeps the probe sequences of the other entries intact. Tombstones are dropped whenever the
+// array is rebuilt.
+class TextureCacheHashIndex
+{
+public:
+  void Insert(u64 hash, std::shared_ptr<TCacheEntry> entry);
+
+  // Returns false if the entry was not found under the given hash.
+  bool Erase(u64 hash, const TCacheEntry* entry);
+
+  void Clear();
+
+  size_t Size() const { return m_size; }
+
+  // Calls func for every entry with the given hash, until it returns true. The index must not be
+  // modified by func.
+  template <typename Func>
+  void ForEachWithHash(u64 hash, Func&& func) const
+  {
+    if (m_slots.empty())
+      return;
+
+    for (size_t i = GetHomeSlot(hash);; i = (i + 1) & m_mask)
+    {
+      const Slot& slot = m_slots[i];
+      if (slot.state == SlotState::Empty)
+        return;
+      if (slot.state == SlotState::Used && slot.hash == hash && func(slot.entry))
+        return;
+    }
+  }
+
+  // Calls func(hash, entry) for every entry in the index.
+  template <typename Func>
+  void ForEach(Func&& func) const
+  {
+    for (const Slot& slot : m_slots)
+    {
+      if (slot.state == SlotState::Used)
+        func(slot.hash, slot.entry);
+    }
+  }
+
+private:
+  enum class SlotState : u8
+  {
+    Empty,
+    Used,
+    Removed,
+  };
+
+  struct Slot
+  {
+    u64 hash = 0;
+    std::shared_ptr<TCacheEntry> entry;
+    SlotState state = SlotState::Empty;
+  };
+
+  size_t GetHomeSlot(u64 hash) const;
+  void Rebuild(size_t capacity);
+
+  std::vector<Slot> m_slots;
+  size_t m_mask = 0;
+  size_t m_size = 0;
+  size_t m_removed = 0;
+};
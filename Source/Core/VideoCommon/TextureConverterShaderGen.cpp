@@ -13,7 +13,7 @@
 namespace TextureConversionShaderGen
 {
 TCShaderUid GetShaderUid(EFBCopyFormat dst_format, bool is_depth_copy, bool is_intensity,
-                         bool scale_by_half, float gamma_rcp,
+                         bool scale_by_half, bool downsample, float gamma_rcp,
                          const std::array<u32, 3>& filter_coefficients)
 {
   TCShaderUid out;
@@ -49,6 +49,7 @@ TCShaderUid GetShaderUid(EFBCopyFormat dst_format, bool is_depth_copy, bool is_i
   uid_data->copy_filter_can_overflow = TextureCacheBase::CopyFilterCanOverflow(filter_coefficients);
   // If the gamma is needed, then include that too.
   uid_data->apply_gamma = gamma_rcp != 1.0f;
+  uid_data->downsample = downsample;
 
   return out;
 }
@@ -61,6 +62,8 @@ static void WriteHeader(APIType api_type, ShaderCode& out)
             "  float gamma_rcp;\n"
             "  float2 clamp_tb;\n"
             "  float pixel_height;\n"
+            "  uint downsample_taps;\n"
+            "  float2 src_texel_size;\n"
             "}};\n");
 }
 
@@ -104,10 +107,33 @@ ShaderCode GeneratePixelShader(APIType api_type, const UidData* uid_data)
   WriteHeader(api_type, out);
 
   out.Write("SAMPLER_BINDING(0) uniform sampler2DArray samp0;\n");
-  out.Write("uint4 SampleEFB(float3 uv, float y_offset) {{\n"
-            "  float4 tex_sample = texture(samp0, float3(uv.x, clamp(uv.y + (y_offset * "
-            "pixel_height), clamp_tb.x, clamp_tb.y), {}));\n",
-            mono_depth ? "0.0" : "uv.z");
+  if (uid_data->downsample)
+  {
+    // The copy is smaller than the scaled EFB region by more than the 2x2 texels a single linear
+    // sample covers, so average a grid of linear samples spanning the whole footprint instead.
+    out.Write("uint4 SampleEFB(float3 uv, float y_offset) {{\n"
+              "  float4 tex_sample = float4(0.0, 0.0, 0.0, 0.0);\n"
+              "  float y = uv.y + (y_offset * pixel_height);\n"
+              "  float start = float(downsample_taps - 1u) * -0.5;\n"
+              "  for (uint i = 0u; i < downsample_taps; i++) {{\n"
+              "    for (uint j = 0u; j < downsample_taps; j++) {{\n"
+              "      float2 offset = (float2(start + float(j), start + float(i)) * 2.0) *\n"
+              "                      src_texel_size;\n"
+              "      tex_sample += texture(samp0, float3(uv.x + offset.x,\n"
+              "                                          clamp(y + offset.y, clamp_tb.x, "
+              "clamp_tb.y), {}));\n"
+              "    }}\n"
+              "  }}\n"
+              "  tex_sample /= float(downsample_taps * downsample_taps);\n",
+              mono_depth ? "0.0" : "uv.z");
+  }
+  else
+  {
+    out.Write("uint4 SampleEFB(float3 uv, float y_offset) {{\n"
+              "  float4 tex_sample = texture(samp0, float3(uv.x, clamp(uv.y + (y_offset * "
+              "pixel_height), clamp_tb.x, clamp_tb.y), {}));\n",
+              mono_depth ? "0.0" : "uv.z");
+  }
   if (uid_data->is_depth_copy)
   {
     if (!g_ActiveConfig.backend_info.bSupportsReversedDepthRange)
@@ -28,6 +28,7 @@ struct UidData
   u32 all_copy_filter_coefs_needed : 1;
   u32 copy_filter_can_overflow : 1;
   u32 apply_gamma : 1;
+  u32 downsample : 1;
 };
 #pragma pack()
 
@@ -37,7 +38,7 @@ ShaderCode GenerateVertexShader(APIType api_type);
 ShaderCode GeneratePixelShader(APIType api_type, const UidData* uid_data);
 
 TCShaderUid GetShaderUid(EFBCopyFormat dst_format, bool is_depth_copy, bool is_intensity,
-                         bool scale_by_half, float gamma_rcp,
+                         bool scale_by_half, bool downsample, float gamma_rcp,
                          const std::array<u32, 3>& filter_coefficients);
 
 }  // namespace TextureConversionShaderGen
@@ -57,9 +58,9 @@ struct fmt::formatter<TextureConversionShaderGen::UidData>
     return fmt::format_to(ctx.out(),
                           "dst_format: {}, efb_has_alpha: {}, is_depth_copy: {}, is_intensity: {}, "
                           "scale_by_half: {}, all_copy_filter_coefs_needed: {}, "
-                          "copy_filter_can_overflow: {}, apply_gamma: {}",
+                          "copy_filter_can_overflow: {}, apply_gamma: {}, downsample: {}",
                           dst_format, uid.efb_has_alpha, uid.is_depth_copy, uid.is_intensity,
                           uid.scale_by_half, uid.all_copy_filter_coefs_needed,
-                          uid.copy_filter_can_overflow, uid.apply_gamma);
+                          uid.copy_filter_can_overflow, uid.apply_gamma, uid.downsample);
   }
 };
@@ -0,0 +1,399 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/TextureDecoder.h"
+
+#include <arm_neon.h>
+#include <cstring>
+
+#include "Common/CommonTypes.h"
+#include "Common/Swap.h"
+
+#include "VideoCommon/LookUpTables.h"
+#include "VideoCommon/TextureDecoder_Util.h"
+
+// GameCube/Wii texture decoder, using NEON for all of the common formats.
+//
+// The output is bit-identical to TextureDecoder_Generic.cpp. Big endian 16-bit texels are loaded
+// with vld2q_u8, which splits them into a vector of high bytes and a vector of low bytes, so that
+// all of the bit manipulation can be done on 16 texels at a time with 8-bit lanes.
+
+static inline u32 DecodePixel_IA8(u16 val)
+{
+  int a = val & 0xFF;
+  int i = val >> 8;
+  return i | (i << 8) | (i << 16) | (a << 24);
+}
+
+static inline u32 DecodePixel_RGB565(u16 val)
+{
+  int r, g, b, a;
+  r = Convert5To8((val >> 11) & 0x1f);
+  g = Convert6To8((val >> 5) & 0x3f);
+  b = Convert5To8((val)&0x1f);
+  a = 0xFF;
+  return r | (g << 8) | (b << 16) | (a << 24);
+}
+
+static inline u32 DecodePixel_RGB5A3(u16 val)
+{
+  int r, g, b, a;
+  if ((val & 0x8000))
+  {
+    r = Convert5To8((val >> 10) & 0x1f);
+    g = Convert5To8((val >> 5) & 0x1f);
+    b = Convert5To8((val)&0x1f);
+    a = 0xFF;
+  }
+  else
+  {
+    a = Convert3To8((val >> 12) & 0x7);
+    r = Convert4To8((val >> 8) & 0xf);
+    g = Convert4To8((val >> 4) & 0xf);
+    b = Convert4To8((val)&0xf);
+  }
+  return r | (g << 8) | (b << 16) | (a << 24);
+}
+
+static inline u32 DecodePixel_Paletted(u16 pixel, TLUTFormat tlutfmt)
+{
+  switch (tlutfmt)
+  {
+  case TLUTFormat::IA8:
+    return DecodePixel_IA8(pixel);
+  case TLUTFormat::RGB565:
+    return DecodePixel_RGB565(Common::swap16(pixel));
+  case TLUTFormat::RGB5A3:
+    return DecodePixel_RGB5A3(Common::swap16(pixel));
+  default:
+    return 0;
+  }
+}
+
+// Decodes the first count entries of the TLUT, so that the paletted formats only need a lookup
+// per texel.
+static void DecodePalette(u32* palette, const u8* tlut_, u32 count, TLUTFormat tlutfmt)
+{
+  const u16* tlut = reinterpret_cast<const u16*>(tlut_);
+  for (u32 i = 0; i < count; i++)
+    palette[i] = DecodePixel_Paletted(tlut[i], tlutfmt);
+}
+
+static inline uint8x8_t Expand4To8(uint8x8_t v)
+{
+  return vorr_u8(vshl_n_u8(v, 4), v);
+}
+
+static inline uint8x16_t Expand3To8(uint8x16_t v)
+{
+  return vorrq_u8(vorrq_u8(vshlq_n_u8(v, 5), vshlq_n_u8(v, 2)), vshrq_n_u8(v, 1));
+}
+
+static inline uint8x16_t Expand4To8(uint8x16_t v)
+{
+  return vorrq_u8(vshlq_n_u8(v, 4), v);
+}
+
+static inline uint8x16_t Expand5To8(uint8x16_t v)
+{
+  return vorrq_u8(vshlq_n_u8(v, 3), vshrq_n_u8(v, 2));
+}
+
+static inline uint8x16_t Expand6To8(uint8x16_t v)
+{
+  return vorrq_u8(vshlq_n_u8(v, 2), vshrq_n_u8(v, 4));
+}
+
+// Writes the 16 texels of a 4x4 block, given one vector per component in texel order.
+static inline void StoreBlock4x4(u32* dst, int width, uint8x16_t r, uint8x16_t g, uint8x16_t b,
+                                 uint8x16_t a)
+{
+  const uint16x8_t rg_lo = vreinterpretq_u16_u8(vzip1q_u8(r, g));
+  const uint16x8_t rg_hi = vreinterpretq_u16_u8(vzip2q_u8(r, g));
+  const uint16x8_t ba_lo = vreinterpretq_u16_u8(vzip1q_u8(b, a));
+  const uint16x8_t ba_hi = vreinterpretq_u16_u8(vzip2q_u8(b, a));
+
+  vst1q_u32(dst, vreinterpretq_u32_u16(vzip1q_u16(rg_lo, ba_lo)));
+  vst1q_u32(dst + width, vreinterpretq_u32_u16(vzip2q_u16(rg_lo, ba_lo)));
+  vst1q_u32(dst + width * 2, vreinterpretq_u32_u16(vzip1q_u16(rg_hi, ba_hi)));
+  vst1q_u32(dst + width * 3, vreinterpretq_u32_u16(vzip2q_u16(rg_hi, ba_hi)));
+}
+
+// Writes a row of 8 texels that have the same value in all four components.
+static inline void StoreRowI8(u32* dst, uint8x8_t i)
+{
+  vst4_u8(reinterpret_cast<u8*>(dst), (uint8x8x4_t{{i, i, i, i}}));
+}
+
+// Decodes two rows of 8 C4 texels, using the palette split into one table per component.
+static inline void DecodeRowsC4(u32* dst0, u32* dst1, const u8* src, const uint8x16x4_t& palette)
+{
+  const uint8x8_t val = vld1_u8(src);
+  const uint8x8_t hi = vshr_n_u8(val, 4);
+  const uint8x8_t lo = vand_u8(val, vdup_n_u8(0xF));
+  const uint8x16_t indices = vcombine_u8(vzip1_u8(hi, lo), vzip2_u8(hi, lo));
+
+  const uint8x16_t r = vqtbl1q_u8(palette.val[0], indices);
+  const uint8x16_t g = vqtbl1q_u8(palette.val[1], indices);
+  const uint8x16_t b = vqtbl1q_u8(palette.val[2], indices);
+  const uint8x16_t a = vqtbl1q_u8(palette.val[3], indices);
+
+  vst4_u8(reinterpret_cast<u8*>(dst0),
+          (uint8x8x4_t{{vget_low_u8(r), vget_low_u8(g), vget_low_u8(b), vget_low_u8(a)}}));
+  vst4_u8(reinterpret_cast<u8*>(dst1),
+          (uint8x8x4_t{{vget_high_u8(r), vget_high_u8(g), vget_high_u8(b), vget_high_u8(a)}}));
+}
+
+static inline void DecodeBytes_C8(u32* dst, const u8* src, const u32* palette)
+{
+  for (int x = 0; x < 8; x++)
+    dst[x] = palette[src[x]];
+}
+
+static inline void DecodeBytes_C14X2(u32* dst, const u16* src, const u8* tlut_, TLUTFormat tlutfmt)
+{
+  const u16* tlut = (u16*)tlut_;
+  for (int x = 0; x < 4; x++)
+  {
+    u16 val = Common::swap16(src[x]);
+    *dst++ = DecodePixel_Paletted(tlut[(val & 0x3FFF)], tlutfmt);
+  }
+}
+
+static inline void DecodeBlock_IA8(u32* dst, int width, const u8* src)
+{
+  // Each texel is stored as alpha followed by intensity.
+  const uint8x16x2_t texels = vld2q_u8(src);
+  const uint8x16_t a = texels.val[0];
+  const uint8x16_t i = texels.val[1];
+  StoreBlock4x4(dst, width, i, i, i, a);
+}
+
+static inline void DecodeBlock_RGB565(u32* dst, int width, const u8* src)
+{
+  const uint8x16x2_t texels = vld2q_u8(src);
+  const uint8x16_t hi = texels.val[0];
+  const uint8x16_t lo = texels.val[1];
+
+  const uint8x16_t r = Expand5To8(vshrq_n_u8(hi, 3));
+  const uint8x16_t g =
+      Expand6To8(vorrq_u8(vshlq_n_u8(vandq_u8(hi, vdupq_n_u8(0x7)), 3), vshrq_n_u8(lo, 5)));
+  const uint8x16_t b = Expand5To8(vandq_u8(lo, vdupq_n_u8(0x1F)));
+  StoreBlock4x4(dst, width, r, g, b, vdupq_n_u8(0xFF));
+}
+
+static inline void DecodeBlock_RGB5A3(u32* dst, int width, const u8* src)
+{
+  const uint8x16x2_t texels = vld2q_u8(src);
+  const uint8x16_t hi = texels.val[0];
+  const uint8x16_t lo = texels.val[1];
+
+  // RGB555 if the top bit is set
+  const uint8x16_t r5 = Expand5To8(vandq_u8(vshrq_n_u8(hi, 2), vdupq_n_u8(0x1F)));
+  const uint8x16_t g5 =
+      Expand5To8(vorrq_u8(vshlq_n_u8(vandq_u8(hi, vdupq_n_u8(0x3)), 3), vshrq_n_u8(lo, 5)));
+  const uint8x16_t b5 = Expand5To8(vandq_u8(lo, vdupq_n_u8(0x1F)));
+
+  // RGB4A3 otherwise
+  const uint8x16_t a3 = Expand3To8(vandq_u8(vshrq_n_u8(hi, 4), vdupq_n_u8(0x7)));
+  const uint8x16_t r4 = Expand4To8(vandq_u8(hi, vdupq_n_u8(0xF)));
+  const uint8x16_t g4 = Expand4To8(vshrq_n_u8(lo, 4));
+  const uint8x16_t b4 = Expand4To8(vandq_u8(lo, vdupq_n_u8(0xF)));
+
+  const uint8x16_t opaque = vtstq_u8(hi, vdupq_n_u8(0x80));
+  StoreBlock4x4(dst, width, vbslq_u8(opaque, r5, r4), vbslq_u8(opaque, g5, g4),
+                vbslq_u8(opaque, b5, b4), vbslq_u8(opaque, vdupq_n_u8(0xFF), a3));
+}
+
+static inline void DecodeBlock_RGBA8(u32* dst, int width, const u8* src)
+{
+  // The first 32 bytes hold alpha and red, the next 32 bytes green and blue.
+  const uint8x16x2_t ar = vld2q_u8(src);
+  const uint8x16x2_t gb = vld2q_u8(src + 32);
+  StoreBlock4x4(dst, width, ar.val[1], gb.val[0], gb.val[1], ar.val[0]);
+}
+
+static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
+{
+  // S3TC Decoder (Note: GCN decodes differently from PC so we can't use native support)
+  u16 c1 = Common::swap16(src->color1);
+  u16 c2 = Common::swap16(src->color2);
+  int blue1 = Convert5To8(c1 & 0x1F);
+  int blue2 = Convert5To8(c2 & 0x1F);
+  int green1 = Convert6To8((c1 >> 5) & 0x3F);
+  int green2 = Convert6To8((c2 >> 5) & 0x3F);
+  int red1 = Convert5To8((c1 >> 11) & 0x1F);
+  int red2 = Convert5To8((c2 >> 11) & 0x1F);
+  u32 colors[4];
+  colors[0] = MakeRGBA(red1, green1, blue1, 255);
+  colors[1] = MakeRGBA(red2, green2, blue2, 255);
+  if (c1 > c2)
+  {
+    colors[2] =
+        MakeRGBA(DXTBlend(red2, red1), DXTBlend(green2, green1), DXTBlend(blue2, blue1), 255);
+    colors[3] =
+        MakeRGBA(DXTBlend(red1, red2), DXTBlend(green1, green2), DXTBlend(blue1, blue2), 255);
+  }
+  else
+  {
+    // color[3] is the same as color[2] (average of both colors), but transparent.
+    // This differs from DXT1 where color[3] is transparent black.
+    colors[2] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 255);
+    colors[3] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 0);
+  }
+
+  // Each line byte holds four 2-bit indices, the leftmost texel in the top bits. Spread them out
+  // to one index per texel, then turn every index into the byte offsets of its color.
+  static constexpr u8 spread[16] = {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3};
+  static constexpr s8 shifts[16] = {-6, -4, -2, 0, -6, -4, -2, 0, -6, -4, -2, 0, -6, -4, -2, 0};
+  static constexpr u8 byte_offsets[16] = {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3};
+
+  u32 lines;
+  std::memcpy(&lines, src->lines, sizeof(lines));
+
+  const uint8x16_t color_table = vld1q_u8(reinterpret_cast<const u8*>(colors));
+  const uint8x16_t spread_table = vld1q_u8(spread);
+  const uint8x16_t offsets = vld1q_u8(byte_offsets);
+
+  const uint8x16_t line_bytes = vqtbl1q_u8(vreinterpretq_u8_u32(vdupq_n_u32(lines)), spread_table);
+  const uint8x16_t indices =
+      vandq_u8(vshlq_u8(line_bytes, vld1q_s8(shifts)), vdupq_n_u8(0x3));
+  const uint8x16_t color_offsets = vshlq_n_u8(indices, 2);
+
+  for (int y = 0; y < 4; y++)
+  {
+    const uint8x16_t row_offsets =
+        vqtbl1q_u8(color_offsets, vaddq_u8(spread_table, vdupq_n_u8(static_cast<u8>(y * 4))));
+    const uint8x16_t texels = vqtbl1q_u8(color_table, vaddq_u8(row_offsets, offsets));
+    vst1q_u8(reinterpret_cast<u8*>(dst), texels);
+    dst += pitch;
+  }
+}
+
+void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
+                            const u8* tlut, TLUTFormat tlutfmt)
+{
+  const int Wsteps4 = (width + 3) / 4;
+  const int Wsteps8 = (width + 7) / 8;
+
+  switch (texformat)
+  {
+  case TextureFormat::C4:
+  {
+    u32 palette[16];
+    DecodePalette(palette, tlut, 16, tlutfmt);
+    const uint8x16x4_t palette_planes = vld4q_u8(reinterpret_cast<const u8*>(palette));
+
+    for (int y = 0; y < height; y += 8)
+      for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+        for (int iy = 0, xStep = 8 * yStep; iy < 8; iy += 2, xStep += 2)
+        {
+          DecodeRowsC4(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x,
+                       src + 4 * xStep, palette_planes);
+        }
+  }
+  break;
+  case TextureFormat::I4:
+  {
+    for (int y = 0; y < height; y += 8)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 8; iy += 2, src += 8)
+        {
+          const uint8x8_t val = vld1_u8(src);
+          const uint8x8_t hi = Expand4To8(vshr_n_u8(val, 4));
+          const uint8x8_t lo = Expand4To8(vand_u8(val, vdup_n_u8(0xF)));
+          StoreRowI8(dst + (y + iy) * width + x, vzip1_u8(hi, lo));
+          StoreRowI8(dst + (y + iy + 1) * width + x, vzip2_u8(hi, lo));
+        }
+  }
+  break;
+  case TextureFormat::I8:  // speed critical
+  {
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 4; ++iy, src += 8)
+          StoreRowI8(dst + (y + iy) * width + x, vld1_u8(src));
+  }
+  break;
+  case TextureFormat::C8:
+  {
+    u32 palette[256];
+    DecodePalette(palette, tlut, 256, tlutfmt);
+
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+        for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+          DecodeBytes_C8(dst + (y + iy) * width + x, src + 8 * xStep, palette);
+  }
+  break;
+  case TextureFormat::IA4:
+  {
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 4; iy++, src += 8)
+        {
+          const uint8x8_t val = vld1_u8(src);
+          const uint8x8_t a = Expand4To8(vshr_n_u8(val, 4));
+          const uint8x8_t l = Expand4To8(vand_u8(val, vdup_n_u8(0xF)));
+          vst4_u8(reinterpret_cast<u8*>(dst + (y + iy) * width + x), (uint8x8x4_t{{l, l, l, a}}));
+        }
+  }
+  break;
+  case TextureFormat::IA8:
+  {
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4, src += 32)
+        DecodeBlock_IA8(dst + y * width + x, width, src);
+  }
+  break;
+  case TextureFormat::C14X2:
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+        for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+          DecodeBytes_C14X2(dst + (y + iy) * width + x, (u16*)(src + 8 * xStep), tlut, tlutfmt);
+    break;
+  case TextureFormat::RGB565:
+  {
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4, src += 32)
+        DecodeBlock_RGB565(dst + y * width + x, width, src);
+  }
+  break;
+  case TextureFormat::RGB5A3:
+  {
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4, src += 32)
+        DecodeBlock_RGB5A3(dst + y * width + x, width, src);
+  }
+  break;
+  case TextureFormat::RGBA8:  // speed critical
+  {
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4, src += 64)
+        DecodeBlock_RGBA8(dst + y * width + x, width, src);
+  }
+  break;
+  case TextureFormat::CMPR:  // speed critical
+    // The metroid games use this format almost exclusively.
+    {
+      for (int y = 0; y < height; y += 8)
+      {
+        for (int x = 0; x < width; x += 8)
+        {
+          DecodeDXTBlock(dst + y * width + x, (DXTBlock*)src, width);
+          src += sizeof(DXTBlock);
+          DecodeDXTBlock(dst + y * width + x + 4, (DXTBlock*)src, width);
+          src += sizeof(DXTBlock);
+          DecodeDXTBlock(dst + (y + 4) * width + x, (DXTBlock*)src, width);
+          src += sizeof(DXTBlock);
+          DecodeDXTBlock(dst + (y + 4) * width + x + 4, (DXTBlock*)src, width);
+          src += sizeof(DXTBlock);
+        }
+      }
+      break;
+    }
+  case TextureFormat::XFB:
+    TexDecoder_DecodeXFB(reinterpret_cast<u8*>(dst), src, width, height, width * 2);
+    break;
+  }
+}
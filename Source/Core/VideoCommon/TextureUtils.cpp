@@ -3,15 +3,20 @@
 
 #include "VideoCommon/TextureUtils.h"
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
+#include "Common/Image.h"
 #include "Common/Logging/Log.h"
 
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/ConfigManager.h"
 
+#include "VideoCommon/AbstractGfx.h"
+#include "VideoCommon/AbstractStagingTexture.h"
 #include "VideoCommon/AbstractTexture.h"
 
 namespace
@@ -67,6 +72,11 @@ void TextureDumper::DumpTexture(const ::AbstractTexture& texture, std::string ba
 
     NOTICE_LOG_FMT(VIDEO, "Found {} dumped textures that will not be re-dumped.",
                    m_dumped_textures.size());
+
+    m_png_encoder.Reset("Texture Dumper", [](PNGEncodeJob job) {
+      Common::SavePNG(job.filename, job.data.data(), Common::ImageByteFormat::RGBA, job.width,
+                      job.height, static_cast<int>(job.width * 4), job.compression_level);
+    });
   }
 
   const std::string name = BuildDumpTextureFilename(std::move(basename), level, is_arbitrary);
@@ -74,7 +84,24 @@ void TextureDumper::DumpTexture(const ::AbstractTexture& texture, std::string ba
   if (file_existed)
     return;
 
-  texture.Save(fmt::format("{}/{}.png", dump_dir, name), level,
-               Config::Get(Config::GFX_TEXTURE_PNG_COMPRESSION_LEVEL));
+  const TextureConfig& config = texture.GetConfig();
+  const u32 level_width = std::max(1u, config.width >> level);
+  const u32 level_height = std::max(1u, config.height >> level);
+  const TextureConfig readback_config(level_width, level_height, 1, 1, 1,
+                                      AbstractTextureFormat::RGBA8, 0,
+                                      AbstractTextureType::Texture_2DArray);
+  auto readback_texture =
+      g_gfx->CreateStagingTexture(StagingTextureType::Readback, readback_config);
+  if (!readback_texture)
+    return;
+
+  readback_texture->CopyFromTexture(&texture, 0, level);
+
+  PNGEncodeJob job{fmt::format("{}/{}.png", dump_dir, name), {}, level_width, level_height,
+                   Config::Get(Config::GFX_TEXTURE_PNG_COMPRESSION_LEVEL)};
+  job.data.resize(static_cast<size_t>(level_width) * level_height * 4);
+  readback_texture->ReadTexels(MathUtil::Rectangle<int>(0, 0, level_width, level_height),
+                               job.data.data(), level_width * 4);
+  m_png_encoder.Push(std::move(job));
 }
 }  // namespace VideoCommon::TextureUtils
@@ -5,8 +5,10 @@
 
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
 
 class AbstractTexture;
 
@@ -20,7 +22,20 @@ public:
                    bool is_arbitrary);
 
 private:
+  struct PNGEncodeJob
+  {
+    std::string filename;
+    std::vector<u8> data;
+    u32 width;
+    u32 height;
+    int compression_level;
+  };
+
   std::unordered_set<std::string> m_dumped_textures;
+
+  // PNG encoding is slow, so it is done on a worker thread. Only the readback happens on the GPU
+  // thread. Queued textures are still written out when the dumper is destroyed.
+  Common::WorkQueueThread<PNGEncodeJob> m_png_encoder;
 };
 
 void DumpTexture(const ::AbstractTexture& texture, std::string basename, u32 level,
@@ -20,6 +20,13 @@ struct pixel_ubershader_uid_data
   u32 uint_output : 1;
   u32 no_dual_src : 1;
 
+  // Bakes the fields below into the shader instead of reading them from the uniforms, giving a
+  // cheaper shader which is only valid for that state. Never set for the precompiled ubershaders.
+  u32 partially_specialized : 1;
+  u32 num_tev_stages : 4;
+  u32 alpha_test_pass : 1;
+  u32 fog_off : 1;
+
   u32 NumValues() const { return sizeof(pixel_ubershader_uid_data); }
 };
 #pragma pack()
@@ -27,6 +34,7 @@ struct pixel_ubershader_uid_data
 using PixelShaderUid = ShaderUid<pixel_ubershader_uid_data>;
 
 PixelShaderUid GetPixelShaderUid();
+PixelShaderUid GetPartiallySpecializedPixelShaderUid();
 
 ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
                           const pixel_ubershader_uid_data* uid_data,
@@ -44,9 +52,16 @@ struct fmt::formatter<UberShader::pixel_ubershader_uid_data>
   template <typename FormatContext>
   auto format(const UberShader::pixel_ubershader_uid_data& uid, FormatContext& ctx) const
   {
-    return fmt::format_to(
+    auto out = fmt::format_to(
         ctx.out(), "Pixel UberShader for {} texgens{}{}{}{}", uid.num_texgens,
         uid.early_depth ? ", early-depth" : "", uid.per_pixel_depth ? ", per-pixel depth" : "",
         uid.uint_output ? ", uint output" : "", uid.no_dual_src ? ", no dual-source blending" : "");
+    if (uid.partially_specialized)
+    {
+      out = fmt::format_to(out, ", specialized for {} TEV stages{}{}", uid.num_tev_stages + 1,
+                           uid.alpha_test_pass ? ", no alpha test" : "",
+                           uid.fog_off ? ", no fog" : "");
+    }
+    return out;
   }
 };
@@ -31,6 +31,7 @@ public:
 
   bool operator==(const VertexLoaderUID& rh) const { return vid == rh.vid; }
   size_t GetHash() const { return hash; }
+  const std::array<u32, 5>& GetData() const { return vid; }
 
 private:
   size_t CalculateHash() const
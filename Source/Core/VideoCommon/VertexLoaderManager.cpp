@@ -15,14 +15,18 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 
+#include "Core/ConfigManager.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
 
 #include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/IndexGenerator.h"
@@ -50,7 +54,17 @@ u32 g_current_components;
 typedef std::unordered_map<VertexLoaderUID, std::unique_ptr<VertexLoaderBase>> VertexLoaderMap;
 static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
-// TODO - change into array of pointers. Keep a map of all seen so far.
+
+// UIDs of the loaders in g_main_vertex_loaders and g_preprocess_vertex_loaders. Games often rewrite
+// the VCD between draws, which marks every VAT dirty, so this avoids going to the map when the
+// loader for a group didn't actually change.
+static std::array<VertexLoaderUID, CP_NUM_VAT_REG> s_main_vertex_loader_uids;
+static std::array<VertexLoaderUID, CP_NUM_VAT_REG> s_preprocess_vertex_loader_uids;
+
+// Guarded by s_vertex_loader_map_lock.
+static File::IOFile s_vertex_loader_uid_cache_file;
+constexpr u32 VERTEX_LOADER_UID_CACHE_MAGIC = 0x4449564C;  // LVID
+constexpr u32 VERTEX_LOADER_UID_CACHE_VERSION = 1;
 
 Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
 
@@ -72,10 +86,86 @@ void Init()
 void Clear()
 {
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  s_vertex_loader_uid_cache_file.Close();
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
 }
 
+static void AppendVertexLoaderUID(const VertexLoaderUID& uid)
+{
+  if (!s_vertex_loader_uid_cache_file.IsOpen())
+    return;
+
+  if (!s_vertex_loader_uid_cache_file.WriteArray(uid.GetData().data(), uid.GetData().size()))
+  {
+    WARN_LOG_FMT(VIDEO, "Writing vertex loader UID to cache failed, closing file.");
+    s_vertex_loader_uid_cache_file.Close();
+  }
+}
+
+void LoadVertexLoaderUIDCache()
+{
+  using SerializedUID = std::array<u32, 5>;
+  constexpr size_t HEADER_SIZE = sizeof(u32) + sizeof(u32);
+
+  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  const std::string filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".vtxuidcache";
+  File::IOFile& file = s_vertex_loader_uid_cache_file;
+  if (file.Open(filename, "rb+"))
+  {
+    u32 magic;
+    u32 version;
+    std::vector<SerializedUID> uids;
+    bool valid = file.ReadBytes(&magic, sizeof(magic)) &&
+                 file.ReadBytes(&version, sizeof(version)) &&
+                 magic == VERTEX_LOADER_UID_CACHE_MAGIC &&
+                 version == VERTEX_LOADER_UID_CACHE_VERSION &&
+                 (file.GetSize() - HEADER_SIZE) % sizeof(SerializedUID) == 0;
+    if (valid)
+    {
+      uids.resize((file.GetSize() - HEADER_SIZE) / sizeof(SerializedUID));
+      valid = file.ReadArray(uids.data(), uids.size());
+    }
+
+    // Only the loaders are created here. Their native vertex formats are looked up on first use,
+    // as the preprocessing thread could get to a loader first.
+    for (const SerializedUID& data : uids)
+    {
+      TVtxDesc vtx_desc;
+      VAT vtx_attr;
+      vtx_desc.low.Hex = data[0];
+      vtx_desc.high.Hex = data[1];
+      vtx_attr.g0.Hex = data[2];
+      vtx_attr.g1.Hex = data[3];
+      vtx_attr.g2.Hex = data[4];
+
+      const VertexLoaderUID uid(vtx_desc, vtx_attr);
+      if (!s_vertex_loader_map.contains(uid))
+      {
+        s_vertex_loader_map.emplace(uid, VertexLoaderBase::CreateVertexLoader(vtx_desc, vtx_attr));
+        INCSTAT(g_stats.num_vertex_loaders);
+      }
+    }
+
+    // Append new UIDs at the end. If the file is invalid, it is truncated below.
+    if (!valid || !file.Seek(0, File::SeekOrigin::End))
+      file.Close();
+
+    INFO_LOG_FMT(VIDEO, "Read {} vertex loader UIDs from {}", uids.size(), filename);
+  }
+
+  if (!file.IsOpen() && file.Open(filename, "wb"))
+  {
+    file.WriteBytes(&VERTEX_LOADER_UID_CACHE_MAGIC, sizeof(VERTEX_LOADER_UID_CACHE_MAGIC));
+    file.WriteBytes(&VERTEX_LOADER_UID_CACHE_VERSION, sizeof(VERTEX_LOADER_UID_CACHE_VERSION));
+
+    // Keep what we already know, in case the file was only truncated.
+    for (const auto& it : s_vertex_loader_map)
+      AppendVertexLoaderUID(it.first);
+  }
+}
+
 void UpdateVertexArrayPointers()
 {
   // Anything to update?
@@ -204,14 +294,21 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group)
   constexpr BitSet8& attr_dirty = IsPreprocess ? g_preprocess_vat_dirty : g_main_vat_dirty;
   constexpr auto& vertex_loaders =
       IsPreprocess ? g_preprocess_vertex_loaders : g_main_vertex_loaders;
+  constexpr auto& vertex_loader_uids =
+      IsPreprocess ? s_preprocess_vertex_loader_uids : s_main_vertex_loader_uids;
 
-  VertexLoaderBase* loader;
+  VertexLoaderUID uid(state->vtx_desc, state->vtx_attr[vtx_attr_group]);
+  VertexLoaderBase* loader = vertex_loaders[vtx_attr_group];
+  if (loader && vertex_loader_uids[vtx_attr_group] == uid)
+  {
+    attr_dirty[vtx_attr_group] = false;
+    return loader;
+  }
 
   // We are not allowed to create a native vertex format on preprocessing as this is on the wrong
   // thread
   bool check_for_native_format = !IsPreprocess;
 
-  VertexLoaderUID uid(state->vtx_desc, state->vtx_attr[vtx_attr_group]);
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
   VertexLoaderMap::iterator iter = s_vertex_loader_map.find(uid);
   if (iter != s_vertex_loader_map.end())
@@ -226,6 +323,7 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group)
         VertexLoaderBase::CreateVertexLoader(state->vtx_desc, state->vtx_attr[vtx_attr_group]));
     loader = it->second.get();
     INCSTAT(g_stats.num_vertex_loaders);
+    AppendVertexLoaderUID(uid);
   }
   if (check_for_native_format)
   {
@@ -233,6 +331,7 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group)
     loader->m_native_vertex_format = GetOrCreateMatchingFormat(loader->m_native_vtx_decl);
   }
   vertex_loaders[vtx_attr_group] = loader;
+  vertex_loader_uids[vtx_attr_group] = uid;
   attr_dirty[vtx_attr_group] = false;
   return loader;
 }
@@ -420,6 +519,9 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
 
     count = loader->RunVertices(src, dst.GetPointer(), count);
 
+    if (g_ActiveConfig.bBBoxEnable && g_bounding_box->IsEnabled())
+      g_vertex_manager->UpdateBoundingBoxEstimate(loader, primitive, dst.GetPointer(), count);
+
     if (can_cpu_cull && !cullall)
     {
       if (!g_vertex_manager->AreAllVerticesCulled(loader, primitive, dst.GetPointer(), count))
@@ -28,6 +28,10 @@ using NativeVertexFormatMap =
 void Init();
 void Clear();
 
+// Creates the vertex loaders which were used by the current game in previous sessions, and
+// records any new ones for the next session.
+void LoadVertexLoaderUIDCache();
+
 void MarkAllDirty();
 
 // Creates or obtains a pointer to a VertexFormat representing decl.
@@ -3,9 +3,12 @@
 
 #include "VideoCommon/VertexManagerBase.h"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <memory>
+#include <span>
+#include <string>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -13,12 +16,14 @@
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/SmallVector.h"
+#include "Common/TraceProfiler.h"
 
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/System.h"
 
 #include "VideoCommon/AbstractGfx.h"
+#include "VideoCommon/BPFunctions.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/DataReader.h"
@@ -145,6 +150,53 @@ bool VertexManagerBase::AreAllVerticesCulled(VertexLoaderBase* loader,
   return m_cpu_cull.AreAllVerticesCulled(loader, primitive, src, count);
 }
 
+void VertexManagerBase::UpdateBoundingBoxEstimate(VertexLoaderBase* loader,
+                                                  OpcodeDecoder::Primitive primitive,
+                                                  const u8* src, u32 count)
+{
+  // Only estimate draws whose rasterized pixels all reach the bounding box update at the end of
+  // the pixel shader, so that the extents of the vertices contain the real result.
+  const AlphaTestResult alpha_test = bpmem.alpha_test.TestResult();
+  if (!g_ActiveConfig.bBBoxCPUEstimate || primitive >= OpcodeDecoder::Primitive::GX_DRAW_LINES ||
+      alpha_test == AlphaTestResult::Undetermined ||
+      (bpmem.zmode.testenable && bpmem.zmode.func != CompareMode::Always))
+  {
+    g_bounding_box->InvalidateEstimate();
+    return;
+  }
+
+  // Nothing is drawn at all.
+  if (alpha_test == AlphaTestResult::Fail || bpmem.genMode.cullmode == CullMode::All)
+    return;
+  const BPFunctions::ScissorResult scissor = BPFunctions::ComputeScissorRects();
+  if (scissor.m_result.empty())
+    return;
+
+  MathUtil::Rectangle<float> bounds;
+  if (scissor.m_result.size() != 1 || !m_cpu_cull.GetScreenBounds(loader, src, count, &bounds))
+  {
+    g_bounding_box->InvalidateEstimate();
+    return;
+  }
+
+  // Grow the extents by a pixel to cover the rasterizer's rounding. The positions are clamped
+  // before converting so that far off-screen vertices can't overflow.
+  const BPFunctions::ScissorRect& rect = scissor.m_result.front();
+  const auto to_efb = [](float position, int offset) {
+    return static_cast<int>(std::clamp(position - offset, -1024.0f, 2048.0f));
+  };
+  const int left = std::max(to_efb(std::floor(bounds.left) - 1, rect.x_off), rect.rect.left);
+  const int right = std::min(to_efb(std::ceil(bounds.right) + 1, rect.x_off), rect.rect.right - 1);
+  const int top = std::max(to_efb(std::floor(bounds.top) - 1, rect.y_off), rect.rect.top);
+  const int bottom =
+      std::min(to_efb(std::ceil(bounds.bottom) + 1, rect.y_off), rect.rect.bottom - 1);
+  if (left > right || top > bottom)
+    return;
+
+  // The hardware updates the bounding box in 2x2 pixel quads.
+  g_bounding_box->UpdateEstimate(left & ~1, right | 1, top & ~1, bottom | 1);
+}
+
 DataReader VertexManagerBase::PrepareForAdditionalData(OpcodeDecoder::Primitive primitive,
                                                        u32 count, u32 stride, bool cullall)
 {
@@ -437,6 +489,9 @@ void VertexManagerBase::Flush()
   if (m_is_flushed)
     return;
 
+  TRACE_ZONE("VertexManager flush");
+  g_gfx->SetGPUTimingPass(GPUTimingPass::EFBDraw);
+
   m_is_flushed = true;
 
   if (m_draw_counter == 0)
@@ -555,7 +610,9 @@ void VertexManagerBase::Flush()
   CalculateBinormals(VertexLoaderManager::GetCurrentVertexFormat());
   // Calculate ZSlope for zfreeze
   const auto used_textures = UsedTextures();
-  std::vector<std::string> texture_names;
+  // The names are assigned into m_texture_names' existing strings rather than released after every
+  // flush, so that drawing with graphics mods enabled doesn't allocate for each draw call.
+  size_t num_texture_names = 0;
   Common::SmallVector<u32, 8> texture_units;
   if (!m_cull_all)
   {
@@ -573,16 +630,20 @@ void VertexManagerBase::Flush()
         const auto cache_entry = g_texture_cache->Load(TextureInfo::FromStage(i));
         if (cache_entry)
         {
-          if (std::find(texture_names.begin(), texture_names.end(),
-                        cache_entry->texture_info_name) == texture_names.end())
+          const auto names_end = m_texture_names.begin() + num_texture_names;
+          if (std::find(m_texture_names.begin(), names_end, cache_entry->texture_info_name) ==
+              names_end)
           {
-            texture_names.push_back(cache_entry->texture_info_name);
+            if (num_texture_names == m_texture_names.size())
+              m_texture_names.emplace_back();
+            m_texture_names[num_texture_names++] = cache_entry->texture_info_name;
             texture_units.push_back(i);
           }
         }
       }
     }
   }
+  const std::span<const std::string> texture_names(m_texture_names.data(), num_texture_names);
   vertex_shader_manager.SetConstants(texture_names, xf_state_manager);
   if (!bpmem.genMode.zfreeze)
   {
@@ -599,21 +660,17 @@ void VertexManagerBase::Flush()
   {
     CustomPixelShaderContents custom_pixel_shader_contents;
     std::optional<CustomPixelShader> custom_pixel_shader;
-    std::vector<std::string> custom_pixel_texture_names;
     std::span<u8> custom_pixel_shader_uniforms;
     bool skip = false;
-    for (size_t i = 0; i < texture_names.size(); i++)
+    for (const std::string& texture_name : texture_names)
     {
       GraphicsModActionData::DrawStarted draw_started{texture_units, &skip, &custom_pixel_shader,
                                                       &custom_pixel_shader_uniforms};
-      for (const auto& action : g_graphics_mod_manager->GetDrawStartedActions(texture_names[i]))
+      for (const auto& action : g_graphics_mod_manager->GetDrawStartedActions(texture_name))
       {
         action->OnDrawStarted(&draw_started);
         if (custom_pixel_shader)
-        {
           custom_pixel_shader_contents.shaders.push_back(*custom_pixel_shader);
-          custom_pixel_texture_names.push_back(texture_names[i]);
-        }
         custom_pixel_shader = std::nullopt;
       }
     }
@@ -897,7 +954,18 @@ void VertexManagerBase::UpdatePipelineObject()
 
     if (g_ActiveConfig.iShaderCompilationMode == ShaderCompilationMode::AsynchronousUberShaders)
     {
-      // Specialized shaders not ready, use the ubershaders.
+      // Specialized shaders not ready, prefer an ubershader with the slow-changing state baked
+      // in, which runs faster than the generic one and is shared by many specialized shaders.
+      VideoCommon::GXUberPipelineUid partial_uid = m_current_uber_pipeline_config;
+      partial_uid.ps_uid = UberShader::GetPartiallySpecializedPixelShaderUid();
+      const auto partial_res = g_shader_cache->GetUberPipelineForUidAsync(partial_uid);
+      if (partial_res && *partial_res)
+      {
+        m_current_pipeline_object = *partial_res;
+        return;
+      }
+
+      // Otherwise, use the generic ubershaders.
       m_current_pipeline_object =
           g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
     }
@@ -986,6 +1054,9 @@ void VertexManagerBase::OnEndFrame()
   m_last_efb_copy_draw_counter = 0;
   m_scheduled_command_buffer_kicks.clear();
 
+  if (g_ActiveConfig.bPerfQueriesAsyncReadback && PerfQueryBase::ShouldEmulate())
+    g_perf_query->PollResults();
+
   // If we have no CPU access at all, leave everything in the one command buffer for maximum
   // parallelism between CPU/GPU, at the cost of slightly higher latency.
   if (m_cpu_accesses_this_frame.empty())
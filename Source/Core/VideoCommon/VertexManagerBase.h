@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "Common/BitSet.h"
@@ -108,6 +109,10 @@ public:
   void AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices);
   bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
                             const u8* src, u32 count);
+  // Adds the draw to the CPU-side bounding box estimate, or invalidates the estimate if the draw
+  // isn't simple enough to estimate. Called for every draw while bounding box is enabled.
+  void UpdateBoundingBoxEstimate(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                                 const u8* src, u32 count);
   virtual DataReader PrepareForAdditionalData(OpcodeDecoder::Primitive primitive, u32 count,
                                               u32 stride, bool cullall);
   /// Switch cullall off after a call to PrepareForAdditionalData with cullall true
@@ -244,6 +249,9 @@ private:
   bool m_unflushed_efb_copy = false;
   std::vector<u32> m_cpu_accesses_this_frame;
   std::vector<u32> m_scheduled_command_buffer_kicks;
+
+  // Names of the textures used by the current draw, see Flush().
+  std::vector<std::string> m_texture_names;
   bool m_allow_background_execution = true;
 
   std::unique_ptr<CustomShaderCache> m_custom_shader_cache;
@@ -158,7 +158,7 @@ bool VertexShaderManager::UseVertexDepthRange()
 
 // Syncs the shader constant buffers with xfmem
 // TODO: A cleaner way to control the matrices without making a mess in the parameters field
-void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
+void VertexShaderManager::SetConstants(std::span<const std::string> textures,
                                        XFStateManager& xf_state_manager)
 {
   if (constants.missing_color_hex != g_ActiveConfig.iMissingColorValue)
@@ -290,11 +290,10 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     const float* norm =
         &xfmem.normalMatrices[3 * (g_main_cp_state.matrix_index_a.PosNormalMtxIdx & 31)];
 
-    memcpy(constants.posnormalmatrix.data(), pos, 3 * sizeof(float4));
-    memcpy(constants.posnormalmatrix[3].data(), norm, 3 * sizeof(float));
-    memcpy(constants.posnormalmatrix[4].data(), norm + 3, 3 * sizeof(float));
-    memcpy(constants.posnormalmatrix[5].data(), norm + 6, 3 * sizeof(float));
-    dirty = true;
+    UpdateData(&dirty, constants.posnormalmatrix.data(), pos, 3 * sizeof(float4));
+    UpdateData(&dirty, constants.posnormalmatrix[3].data(), norm, 3 * sizeof(float));
+    UpdateData(&dirty, constants.posnormalmatrix[4].data(), norm + 3, 3 * sizeof(float));
+    UpdateData(&dirty, constants.posnormalmatrix[5].data(), norm + 6, 3 * sizeof(float));
   }
 
   if (xf_state_manager.DidTexMatrixAChange())
@@ -309,9 +308,9 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
 
     for (size_t i = 0; i < pos_matrix_ptrs.size(); ++i)
     {
-      memcpy(constants.texmatrices[3 * i].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
+      UpdateData(&dirty, constants.texmatrices[3 * i].data(), pos_matrix_ptrs[i],
+                 3 * sizeof(float4));
     }
-    dirty = true;
   }
 
   if (xf_state_manager.DidTexMatrixBChange())
@@ -326,9 +325,9 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
 
     for (size_t i = 0; i < pos_matrix_ptrs.size(); ++i)
     {
-      memcpy(constants.texmatrices[3 * i + 12].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
+      UpdateData(&dirty, constants.texmatrices[3 * i + 12].data(), pos_matrix_ptrs[i],
+                 3 * sizeof(float4));
     }
-    dirty = true;
   }
 
   if (xf_state_manager.DidViewportChange())
@@ -4,6 +4,8 @@
 #pragma once
 
 #include <array>
+#include <cstring>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -26,7 +28,7 @@ public:
 
   // constant management
   void SetProjectionMatrix(XFStateManager& xf_state_manager);
-  void SetConstants(const std::vector<std::string>& textures, XFStateManager& xf_state_manager);
+  void SetConstants(std::span<const std::string> textures, XFStateManager& xf_state_manager);
 
   // data: 3 floats representing the X, Y and Z vertex model coordinates and the posmatrix index.
   // out:  4 floats which will be initialized with the corresponding clip space coordinates
@@ -58,6 +60,17 @@ public:
     UpdateValue(dirty, old_value, new_value);
   }
 
+  // Matrix index changes frequently point at matrices with the same contents as the ones that are
+  // already loaded, which would otherwise cause the whole constant block to be uploaded again.
+  static DOLPHIN_FORCE_INLINE void UpdateData(bool* dirty, void* old_data, const void* new_data,
+                                              size_t size)
+  {
+    if (std::memcmp(old_data, new_data, size) == 0)
+      return;
+    std::memcpy(old_data, new_data, size);
+    *dirty = true;
+  }
+
   template <size_t N>
   static DOLPHIN_FORCE_INLINE void UpdateOffsets(bool* dirty, bool include_components,
                                                  std::array<u32, N>* old_value,
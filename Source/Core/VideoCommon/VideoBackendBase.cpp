@@ -57,6 +57,7 @@
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/RenderBase.h"
+#include "VideoCommon/Spirv.h"
 #include "VideoCommon/TMEM.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -124,8 +125,11 @@ u32 VideoBackendBase::Video_AccessEFB(EFBAccessType type, u32 x, u32 y, u32 data
     return 0;
   }
 
+  auto& system = Core::System::GetInstance();
   if (type == EFBAccessType::PokeColor || type == EFBAccessType::PokeZ)
   {
+    system.GetFifo().SyncGPU(Fifo::SyncGPUReason::EFBPoke);
+
     AsyncRequests::Event e;
     e.type = type == EFBAccessType::PokeColor ? AsyncRequests::Event::EFB_POKE_COLOR :
                                                 AsyncRequests::Event::EFB_POKE_Z;
@@ -138,6 +142,8 @@ u32 VideoBackendBase::Video_AccessEFB(EFBAccessType type, u32 x, u32 y, u32 data
   }
   else
   {
+    system.GetFifo().SyncGPU(Fifo::SyncGPUReason::EFBPeek);
+
     AsyncRequests::Event e;
     u32 result;
     e.type = type == EFBAccessType::PeekColor ? AsyncRequests::Event::EFB_PEEK_COLOR :
@@ -158,6 +164,11 @@ u32 VideoBackendBase::Video_GetQueryResult(PerfQueryType type)
     return 0;
   }
 
+  // Return the last known values rather than waiting for the host GPU. They are updated once per
+  // frame, see VertexManagerBase::OnEndFrame.
+  if (g_ActiveConfig.bPerfQueriesAsyncReadback)
+    return g_perf_query->GetQueryResult(type);
+
   auto& system = Core::System::GetInstance();
   system.GetFifo().SyncGPU(Fifo::SyncGPUReason::PerfQuery);
 
@@ -392,6 +403,8 @@ bool VideoBackendBase::InitializeShared(std::unique_ptr<AbstractGfx> gfx,
   g_Config.VerifyValidity();
   UpdateActiveConfig();
 
+  if (g_ActiveConfig.bShaderCache)
+    VertexLoaderManager::LoadVertexLoaderUIDCache();
   g_shader_cache->InitializeShaderCache();
 
   return true;
@@ -418,6 +431,7 @@ void VideoBackendBase::ShutdownShared()
   g_widescreen.reset();
   g_presenter.reset();
   g_gfx.reset();
+  SPIRV::CloseDiskCache();
 
   m_initialized = false;
 
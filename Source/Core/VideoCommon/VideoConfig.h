@@ -48,6 +48,12 @@ enum class ShaderCompilationMode : int
   AsynchronousSkipRendering
 };
 
+enum class TextureHashFunction : int
+{
+  Default,
+  XXH3,
+};
+
 enum class TextureFilteringMode : int
 {
   Default,
@@ -116,6 +122,7 @@ struct VideoConfig final
   // General
   bool bVSync = false;
   bool bVSyncActive = false;
+  bool bLowLatencyPresent = false;
   bool bWidescreenHack = false;
   AspectMode aspect_mode{};
   int custom_aspect_width = 1;
@@ -132,6 +139,8 @@ struct VideoConfig final
   u32 iMultisamples = 0;
   bool bSSAA = false;
   int iEFBScale = 0;
+  bool bDynamicEFBScale = false;
+  int iDynamicEFBScaleMin = 1;
   TextureFilteringMode texture_filtering_mode = TextureFilteringMode::Default;
   OutputResamplingMode output_resampling_mode = OutputResamplingMode::Default;
   int iMaxAnisotropy = 0;
@@ -170,6 +179,9 @@ struct VideoConfig final
   bool bShowGraphs = false;
   bool bShowSpeed = false;
   bool bShowSpeedColors = false;
+  bool bShowAudioLatency = false;
+  bool bShowPresentLatency = false;
+  bool bShowGPUTimes = false;
   int iPerfSampleUSec = 0;
   bool bShowNetPlayPing = false;
   bool bShowNetPlayMessages = false;
@@ -211,8 +223,13 @@ struct VideoConfig final
   // Hacks
   bool bEFBAccessEnable = false;
   bool bEFBAccessDeferInvalidation = false;
+  bool bEFBAccessDelayed = false;
+  bool bTextureWriteTracking = false;
   bool bPerfQueriesEnable = false;
+  bool bPerfQueriesAsyncReadback = false;
   bool bBBoxEnable = false;
+  bool bBBoxAsyncReadback = false;
+  bool bBBoxCPUEstimate = false;
   bool bForceProgressive = false;
   bool bCPUCull = false;
 
@@ -223,8 +240,11 @@ struct VideoConfig final
   bool bDeferEFBCopies = false;
   bool bImmediateXFB = false;
   bool bSkipPresentingDuplicateXFBs = false;
+  bool bFrameSkip = false;
   bool bCopyEFBScaled = false;
+  bool bCopyEFBHalfScaleNative = false;
   int iSafeTextureCache_ColorSamples = 0;
+  TextureHashFunction texture_hash_function = TextureHashFunction::Default;
   float fAspectRatioHackW = 1;  // Initial value needed for the first frame
   float fAspectRatioHackH = 1;
   bool bEnablePixelLighting = false;
@@ -269,12 +289,20 @@ struct VideoConfig final
   bool bWaitForShadersBeforeStarting = false;
   ShaderCompilationMode iShaderCompilationMode{};
 
+  // Directory with pipeline UID caches from other installs, which are merged into ours.
+  std::string sSharedUIDCachePath;
+
   // Number of shader compiler threads.
   // 0 disables background compilation.
   // -1 uses an automatic number based on the CPU threads.
   int iShaderCompilerThreads = 0;
   int iShaderPrecompilerThreads = 0;
 
+  // Number of threads that decode newly loaded textures in the background.
+  // 0 decodes textures on the GPU thread when they are first used.
+  // -1 uses an automatic number based on the CPU threads.
+  int iTextureDecodingThreads = 0;
+
   // Loading custom drivers on Android
   std::string customDriverLibraryName;
 
@@ -337,6 +365,7 @@ struct VideoConfig final
     bool bSupportsVSLinePointExpand = false;
     bool bSupportsGLLayerInFS = true;
     bool bSupportsHDROutput = false;
+    bool bSupportsLowLatencyPresent = false;
   } backend_info;
 
   // Utility
@@ -381,6 +410,7 @@ struct VideoConfig final
   bool UsingUberShaders() const;
   u32 GetShaderCompilerThreads() const;
   u32 GetShaderPrecompilerThreads() const;
+  u32 GetTextureDecodingThreads() const;
 
   float GetCustomAspectRatio() const { return (float)custom_aspect_width / custom_aspect_height; }
 };
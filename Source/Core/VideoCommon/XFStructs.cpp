@@ -3,6 +3,8 @@
 
 #include "VideoCommon/XFStructs.h"
 
+#include <algorithm>
+
 #include "Common/BitUtils.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -119,6 +121,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETVIEWPORT + 3:
     case XFMEM_SETVIEWPORT + 4:
     case XFMEM_SETVIEWPORT + 5:
+      if (((u32*)&xfmem)[address] == value)
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetViewportChanged();
       system.GetPixelShaderManager().SetViewportChanged();
@@ -132,6 +136,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETPROJECTION + 4:
     case XFMEM_SETPROJECTION + 5:
     case XFMEM_SETPROJECTION + 6:
+      if (((u32*)&xfmem)[address] == value)
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetProjectionChanged();
       system.GetGeometryShaderManager().SetProjectionChanged();
@@ -150,6 +156,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETTEXMTXINFO + 5:
     case XFMEM_SETTEXMTXINFO + 6:
     case XFMEM_SETTEXMTXINFO + 7:
+      if (((u32*)&xfmem)[address] == value)
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetTexMatrixInfoChanged(address - XFMEM_SETTEXMTXINFO);
       break;
@@ -162,6 +170,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETPOSTMTXINFO + 5:
     case XFMEM_SETPOSTMTXINFO + 6:
     case XFMEM_SETPOSTMTXINFO + 7:
+      if (((u32*)&xfmem)[address] == value)
+        break;
       g_vertex_manager->Flush();
       xf_state_manager.SetTexMatrixInfoChanged(address - XFMEM_SETPOSTMTXINFO);
       break;
@@ -231,12 +241,28 @@ void LoadXFReg(u16 base_address, u8 transfer_size, const u8* data)
       base_address = XFMEM_REGISTERS_START;
     }
 
-    XFMemWritten(xf_state_manager, xf_mem_transfer_size, xf_mem_base);
+    // Games often reload matrices and lights that haven't changed. Only the words which differ
+    // need to end the current batch and be re-uploaded.
+    u32* const xf_mem = reinterpret_cast<u32*>(&xfmem) + xf_mem_base;
+    u32 first_changed = xf_mem_transfer_size;
+    u32 last_changed = 0;
     for (u32 i = 0; i < xf_mem_transfer_size; i++)
     {
-      ((u32*)&xfmem)[xf_mem_base + i] = Common::swap32(data);
-      data += 4;
+      if (xf_mem[i] != Common::swap32(data + i * 4))
+      {
+        first_changed = std::min(first_changed, i);
+        last_changed = i;
+      }
+    }
+
+    if (first_changed < xf_mem_transfer_size)
+    {
+      XFMemWritten(xf_state_manager, last_changed - first_changed + 1,
+                   xf_mem_base + first_changed);
+      for (u32 i = first_changed; i <= last_changed; i++)
+        xf_mem[i] = Common::swap32(data + i * 4);
     }
+    data += xf_mem_transfer_size * 4;
   }
 
   // write to XF regs
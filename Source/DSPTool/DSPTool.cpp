@@ -1,16 +1,23 @@
 // Copyright 2009 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <chrono>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include <fmt/format.h>
 
+#include "Common/CommonPaths.h"
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
+#include "Common/MemoryUtil.h"
 #include "Common/StringUtil.h"
+#include "Common/Swap.h"
 #include "Core/DSP/DSPCodeUtil.h"
+#include "Core/DSP/DSPCore.h"
 #include "Core/DSP/DSPDisassembler.h"
 #include "Core/DSP/DSPHost.h"
 #include "Core/DSP/DSPTables.h"
@@ -362,6 +369,206 @@ static bool PerformAssembly(const std::string& input_name, const std::string& ou
   return true;
 }
 
+static bool LoadDSPRom(u16* rom, const std::string& filename, u32 size_in_bytes)
+{
+  std::string bytes;
+  if (!File::ReadFileToString(filename, bytes) || bytes.size() != size_in_bytes)
+  {
+    printf("ERROR: Could not load %s\n", filename.c_str());
+    return false;
+  }
+
+  const u16* words = reinterpret_cast<const u16*>(bytes.c_str());
+  for (u32 i = 0; i < size_in_bytes / 2; ++i)
+    rom[i] = Common::swap16(words[i]);
+
+  return true;
+}
+
+static std::optional<std::vector<u32>> LoadMails(const std::string& filename)
+{
+  std::vector<u32> mails;
+  if (filename.empty())
+    return mails;
+
+  std::string text;
+  if (!File::ReadFileToString(filename, text))
+  {
+    printf("ERROR: Could not read %s\n", filename.c_str());
+    return std::nullopt;
+  }
+
+  for (const std::string& line : SplitString(text, '\n'))
+  {
+    const std::string mail_text(StripWhitespace(line));
+    if (mail_text.empty())
+      continue;
+
+    u32 mail;
+    if (!TryParse(mail_text, &mail, 16))
+    {
+      printf("ERROR: Invalid mail \"%s\" in %s\n", mail_text.c_str(), filename.c_str());
+      return std::nullopt;
+    }
+    mails.push_back(mail);
+  }
+
+  return mails;
+}
+
+struct BenchmarkResult
+{
+  std::vector<u32> mails;
+  std::vector<u16> dram;
+  u64 cycles = 0;
+  double seconds = 0;
+};
+
+// Runs a ucode on a headless DSP core. The given CPU mails are sent one at a time whenever the
+// CPU mailbox is empty, and every mail the ucode sends back is recorded. DMAs and accelerator
+// reads see zeroes, since there is no emulated main memory or ARAM.
+static std::optional<BenchmarkResult> RunBenchmark(DSP::DSPInitOptions::CoreType core_type,
+                                                   const std::vector<u16>& code,
+                                                   const std::vector<u32>& mails, u64 max_cycles)
+{
+  // Roughly the amount of cycles DSPLLE runs per update when not on a separate thread.
+  constexpr int CYCLES_PER_SLICE = 0x1000;
+
+  DSP::DSPInitOptions opts;
+  const std::string gc_sys_dir = File::GetSysDirectory() + GC_SYS_DIR DIR_SEP;
+  if (!LoadDSPRom(opts.irom_contents.data(), gc_sys_dir + DSP_IROM, DSP::DSP_IROM_BYTE_SIZE) ||
+      !LoadDSPRom(opts.coef_contents.data(), gc_sys_dir + DSP_COEF, DSP::DSP_COEF_BYTE_SIZE))
+  {
+    return std::nullopt;
+  }
+  opts.core_type = core_type;
+
+  DSP::DSPCore dsp;
+  if (!dsp.Initialize(opts))
+    return std::nullopt;
+
+  // Skip the IROM boot sequence and start directly at the ucode entry point, like the IROM does
+  // once it has DMAed a ucode to IRAM.
+  DSP::SDSP& state = dsp.DSPState();
+  Common::UnWriteProtectMemory(state.iram, DSP::DSP_IRAM_BYTE_SIZE, false);
+  std::copy_n(code.begin(), std::min<size_t>(code.size(), DSP::DSP_IRAM_SIZE), state.iram);
+  Common::WriteProtectMemory(state.iram, DSP::DSP_IRAM_BYTE_SIZE, false);
+  dsp.ClearIRAM();
+  state.GetAnalyzer().Analyze(state);
+  state.pc = 0;
+  state.control_reg &= ~DSP::CR_HALT;
+
+  BenchmarkResult result;
+  size_t next_mail = 0;
+  const auto start = std::chrono::steady_clock::now();
+  while (result.cycles < max_cycles && (state.control_reg & DSP::CR_HALT) == 0)
+  {
+    if (next_mail < mails.size() && (dsp.PeekMailbox(DSP::Mailbox::CPU) & 0x80000000) == 0)
+    {
+      dsp.WriteMailboxHigh(DSP::Mailbox::CPU, static_cast<u16>(mails[next_mail] >> 16));
+      dsp.WriteMailboxLow(DSP::Mailbox::CPU, static_cast<u16>(mails[next_mail]));
+      ++next_mail;
+    }
+
+    dsp.RunCycles(CYCLES_PER_SLICE);
+    result.cycles += CYCLES_PER_SLICE;
+
+    const u32 dsp_mail = dsp.PeekMailbox(DSP::Mailbox::DSP);
+    if ((dsp_mail & 0x80000000) != 0)
+    {
+      result.mails.push_back(dsp_mail);
+      dsp.ReadMailboxLow(DSP::Mailbox::DSP);
+    }
+  }
+  result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  result.dram.assign(state.dram, state.dram + DSP::DSP_DRAM_SIZE);
+  dsp.Shutdown();
+  return result;
+}
+
+static void PrintBenchmarkResult(const char* name, const BenchmarkResult& result)
+{
+  printf("%s: %llu cycles in %.3f s (%.2f MHz), %zu mails sent\n", name,
+         static_cast<unsigned long long>(result.cycles), result.seconds,
+         result.cycles / result.seconds / 1000000.0, result.mails.size());
+}
+
+// Compares the mails and DMEM produced by the interpreter and the JIT. Differences in the amount
+// of mails can be expected for ucodes that never halt, as both cores time slices differently.
+static bool CompareBenchmarkResults(const BenchmarkResult& a, const BenchmarkResult& b)
+{
+  bool match = true;
+
+  const size_t mail_count = std::min(a.mails.size(), b.mails.size());
+  const auto mail_mismatch = std::mismatch(a.mails.begin(), a.mails.begin() + mail_count,
+                                           b.mails.begin());
+  if (mail_mismatch.first != a.mails.begin() + mail_count)
+  {
+    printf("Mail %zu differs: %08x (interpreter) != %08x (JIT)\n",
+           static_cast<size_t>(mail_mismatch.first - a.mails.begin()), *mail_mismatch.first,
+           *mail_mismatch.second);
+    match = false;
+  }
+
+  size_t differing_words = 0;
+  for (size_t i = 0; i < a.dram.size(); ++i)
+  {
+    if (a.dram[i] == b.dram[i])
+      continue;
+
+    if (differing_words == 0)
+      printf("DMEM differs first at %04zx: %04x (interpreter) != %04x (JIT)\n", i, a.dram[i],
+             b.dram[i]);
+    ++differing_words;
+  }
+  if (differing_words != 0)
+  {
+    printf("%zu DMEM words differ\n", differing_words);
+    match = false;
+  }
+
+  return match;
+}
+
+static bool PerformBenchmark(const std::string& input_name, const std::string& mail_name,
+                             u64 max_cycles)
+{
+  if (input_name.empty())
+  {
+    printf("Benchmark: Must specify input.\n");
+    return false;
+  }
+
+  std::string binary_code;
+  File::ReadFileToString(input_name, binary_code);
+  const std::vector<u16> code = DSP::BinaryStringBEToCode(binary_code);
+
+  const std::optional<std::vector<u32>> mails = LoadMails(mail_name);
+  if (!mails)
+    return false;
+
+  const auto interpreter_result =
+      RunBenchmark(DSP::DSPInitOptions::CoreType::Interpreter, code, *mails, max_cycles);
+  if (!interpreter_result)
+    return false;
+  PrintBenchmarkResult("Interpreter", *interpreter_result);
+
+#if defined(_M_X86_64) || defined(_M_ARM_64)
+  const auto jit_result =
+      RunBenchmark(DSP::DSPInitOptions::CoreType::JIT64, code, *mails, max_cycles);
+  if (!jit_result)
+    return false;
+  PrintBenchmarkResult("JIT", *jit_result);
+
+  if (!CompareBenchmarkResults(*interpreter_result, *jit_result))
+    return false;
+  printf("Interpreter and JIT results match.\n");
+#endif
+
+  return true;
+}
+
 static bool IsHelpFlag(const std::string& argument)
 {
   return argument == "--help" || argument == "-?";
@@ -378,12 +585,14 @@ static bool IsHelpFlag(const std::string& argument)
 //   dsptool [-f] -h asdf.h asdf.txt
 // Print results from DSPSpy register dump
 //   dsptool -p dsp_dump0.bin
+// Run a ucode on the interpreter and the JIT, feeding it mails from a text file
+//   dsptool -b -mail mails.txt -n 100000000 ucode.bin
 int main(int argc, const char* argv[])
 {
   if (argc == 1 || (argc == 2 && IsHelpFlag(argv[1])))
   {
-    printf("USAGE: DSPTool [-?] [--help] [-f] [-d] [-m] [-p <FILE>] [-o <FILE>] [-h <FILE>] <DSP "
-           "ASSEMBLER FILE>\n");
+    printf("USAGE: DSPTool [-?] [--help] [-f] [-d] [-m] [-b] [-p <FILE>] [-o <FILE>] [-h <FILE>] "
+           "<DSP ASSEMBLER FILE>\n");
     printf("-? / --help: Prints this message\n");
     printf("-d: Disassemble\n");
     printf("-m: Input file contains a list of files (Header assembly only)\n");
@@ -396,6 +605,11 @@ int main(int argc, const char* argv[])
     printf("-pm <DUMP FILE>: Print results of DSPSpy register dump (convert PROD values)\n");
     printf("-psm <DUMP FILE>: Print results of DSPSpy register dump (convert PROD values/disable "
            "SR output)\n");
+    printf("-b: Run the input binary on the DSP interpreter and JIT, compare their results and "
+           "print their speed\n");
+    printf("-mail <MAIL FILE>: CPU mails (one hexadecimal value per line) to send when "
+           "benchmarking\n");
+    printf("-n <CYCLES>: Maximum number of DSP cycles to run when benchmarking\n");
 
     return 0;
   }
@@ -403,7 +617,10 @@ int main(int argc, const char* argv[])
   std::string input_name;
   std::string output_header_name;
   std::string output_name;
+  std::string mail_name;
+  u64 benchmark_cycles = 100'000'000;
 
+  bool benchmark = false;
   bool disassemble = false, compare = false, multiple = false, outputSize = false, force = false,
        print_results = false, print_results_prodhack = false, print_results_srhack = false;
   for (int i = 1; i < argc; i++)
@@ -423,6 +640,23 @@ int main(int argc, const char* argv[])
       if (++i < argc)
         output_header_name = argv[i];
     }
+    else if (argument == "-b")
+    {
+      benchmark = true;
+    }
+    else if (argument == "-mail")
+    {
+      if (++i < argc)
+        mail_name = argv[i];
+    }
+    else if (argument == "-n")
+    {
+      if (++i < argc && !TryParse(argv[i], &benchmark_cycles))
+      {
+        printf("ERROR: Invalid cycle count.\n");
+        return 1;
+      }
+    }
     else if (argument == "-c")
     {
       compare = true;
@@ -482,6 +716,11 @@ int main(int argc, const char* argv[])
     return 1;
   }
 
+  if (benchmark)
+  {
+    return PerformBenchmark(input_name, mail_name, benchmark_cycles) ? 0 : 1;
+  }
+
   if (compare)
   {
     return PerformBinaryComparison(input_name, output_name) ? 0 : 1;
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <gtest/gtest.h>
+#include <array>
+#include <memory>
 #include <thread>
 
 #include "Common/SPSCQueue.h"
@@ -68,3 +70,101 @@ TEST(SPSCQueue, MultiThreaded)
   popper_thread.join();
   inserter_thread.join();
 }
+
+TEST(SPSCQueue, PopReleasesElement)
+{
+  Common::SPSCQueue<std::shared_ptr<u32>> q;
+  const auto element = std::make_shared<u32>(1);
+
+  q.Push(element);
+  EXPECT_EQ(2, element.use_count());
+  q.Pop();
+  EXPECT_EQ(1, element.use_count());
+
+  // Reuses the element that was just popped.
+  q.Push(element);
+  std::shared_ptr<u32> v;
+  EXPECT_TRUE(q.Pop(v));
+  v.reset();
+  EXPECT_EQ(1, element.use_count());
+}
+
+TEST(BoundedSPSCQueue, Simple)
+{
+  Common::BoundedSPSCQueue<u32, 4> q;
+
+  EXPECT_EQ(0u, q.Size());
+  EXPECT_TRUE(q.Empty());
+
+  // Wrap around the ring buffer a few times.
+  for (u32 i = 0; i < 10; ++i)
+  {
+    for (u32 j = 0; j < 4; ++j)
+      EXPECT_TRUE(q.TryPush(i * 4 + j));
+    EXPECT_FALSE(q.TryPush(0u));
+    EXPECT_EQ(4u, q.Size());
+
+    EXPECT_EQ(i * 4, q.Front());
+    for (u32 j = 0; j < 4; ++j)
+    {
+      u32 v;
+      EXPECT_TRUE(q.TryPop(v));
+      EXPECT_EQ(i * 4 + j, v);
+    }
+    u32 v;
+    EXPECT_FALSE(q.TryPop(v));
+    EXPECT_TRUE(q.Empty());
+  }
+
+  q.TryPush(1u);
+  q.Clear();
+  EXPECT_TRUE(q.Empty());
+}
+
+TEST(BoundedSPSCQueue, Batch)
+{
+  Common::BoundedSPSCQueue<u32, 8> q;
+  const std::array<u32, 6> in{0, 1, 2, 3, 4, 5};
+
+  EXPECT_EQ(6u, q.PushBatch(in));
+  EXPECT_EQ(2u, q.PushBatch(in));
+  EXPECT_EQ(0u, q.PushBatch(in));
+
+  std::array<u32, 5> out{};
+  EXPECT_EQ(5u, q.PopBatch(out));
+  EXPECT_EQ((std::array<u32, 5>{0, 1, 2, 3, 4}), out);
+  EXPECT_EQ(3u, q.PopBatch(out));
+  EXPECT_EQ(5u, out[0]);
+  EXPECT_EQ(0u, out[1]);
+  EXPECT_EQ(1u, out[2]);
+  EXPECT_EQ(0u, q.PopBatch(out));
+}
+
+TEST(BoundedSPSCQueue, MultiThreaded)
+{
+  Common::BoundedSPSCQueue<u32, 64> q;
+
+  auto inserter = [&q]() {
+    for (u32 i = 0; i < 100000; ++i)
+    {
+      q.WaitForSpace();
+      EXPECT_TRUE(q.TryPush(i));
+    }
+  };
+
+  auto popper = [&q]() {
+    for (u32 i = 0; i < 100000; ++i)
+    {
+      q.WaitForData();
+      u32 v;
+      EXPECT_TRUE(q.TryPop(v));
+      EXPECT_EQ(i, v);
+    }
+  };
+
+  std::thread popper_thread(popper);
+  std::thread inserter_thread(inserter);
+
+  popper_thread.join();
+  inserter_thread.join();
+}
@@ -0,0 +1,95 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+
+#include <gtest/gtest.h>
+
+#include "Common/Event.h"
+#include "Common/TaskPool.h"
+
+TEST(TaskPool, RunsAllTasks)
+{
+  Common::TaskPool pool(4);
+  Common::TaskGroup group(Common::TaskPriority::Normal, pool);
+
+  std::atomic<u32> sum = 0;
+  for (u32 i = 1; i <= 1000; ++i)
+    group.Run([&sum, i] { sum += i; });
+  group.Wait();
+
+  EXPECT_EQ(500500u, sum.load());
+}
+
+TEST(TaskPool, TasksCanSubmitTasks)
+{
+  Common::TaskPool pool(2);
+  Common::TaskGroup group(Common::TaskPriority::Normal, pool);
+
+  std::atomic<u32> count = 0;
+  for (u32 i = 0; i < 10; ++i)
+  {
+    group.Run([&] {
+      for (u32 j = 0; j < 10; ++j)
+        group.Run([&count] { ++count; });
+    });
+  }
+  group.Wait();
+
+  EXPECT_EQ(100u, count.load());
+}
+
+TEST(TaskPool, CancelDropsQueuedTasks)
+{
+  Common::TaskPool pool(1);
+  Common::TaskGroup group(Common::TaskPriority::Normal, pool);
+
+  Common::Event started;
+  Common::Event release;
+  std::atomic<u32> count = 0;
+  group.Run([&] {
+    started.Set();
+    release.Wait();
+  });
+  for (u32 i = 0; i < 10; ++i)
+    group.Run([&count] { ++count; });
+
+  started.Wait();
+  EXPECT_FALSE(group.IsCancelling());
+  std::thread cancel_thread([&] { group.Cancel(); });
+  while (!group.IsCancelling())
+    std::this_thread::yield();
+  release.Set();
+  cancel_thread.join();
+
+  EXPECT_EQ(0u, count.load());
+  EXPECT_FALSE(group.IsCancelling());
+
+  // The group can be used again after cancelling.
+  group.Run([&count] { ++count; });
+  group.Wait();
+  EXPECT_EQ(1u, count.load());
+}
+
+TEST(TaskPool, BackgroundTasksRunAfterNormalTasks)
+{
+  Common::TaskPool pool(1);
+  Common::TaskGroup normal(Common::TaskPriority::Normal, pool);
+  Common::TaskGroup background(Common::TaskPriority::Background, pool);
+
+  // Keep the only worker busy until everything is queued.
+  Common::Event release;
+  normal.Run([&release] { release.Wait(); });
+
+  std::atomic<u32> order = 0;
+  u32 background_order = 0;
+  u32 normal_order = 0;
+  background.Run([&] { background_order = ++order; });
+  normal.Run([&] { normal_order = ++order; });
+  release.Set();
+
+  background.Wait();
+  normal.Wait();
+  EXPECT_EQ(1u, normal_order);
+  EXPECT_EQ(2u, background_order);
+}
@@ -185,3 +185,80 @@ TEST(DSPAccelerator, CurrentAddressSkips)
   accelerator.TestRead();
   EXPECT_EQ(accelerator.GetCurrentAddress(), 0x00000013u);
 }
+
+// Accelerator over a fixed block of pseudo-random memory, used to compare bulk and single reads.
+class MemoryAccelerator : public DSP::Accelerator
+{
+public:
+  explicit MemoryAccelerator(bool expose_memory) : m_expose_memory(expose_memory)
+  {
+    u32 seed = 0x12345678;
+    for (u8& byte : m_memory)
+    {
+      seed = seed * 1103515245 + 12345;
+      byte = static_cast<u8>(seed >> 16);
+    }
+  }
+
+protected:
+  void OnEndException() override
+  {
+    // Loop like the AX ucode does, which also resets the reads stopped flag.
+    SetPredScale(0x12);
+    SetYn1(0);
+    SetYn2(0);
+  }
+  u8 ReadMemory(u32 address) override { return m_memory[address % m_memory.size()]; }
+  const u8* GetMemoryRange(u32 address, u32 size) override
+  {
+    if (!m_expose_memory || address + size > m_memory.size())
+      return nullptr;
+    return m_memory.data() + address;
+  }
+  void WriteMemory(u32 address, u8 value) override {}
+
+  bool m_expose_memory;
+  std::array<u8, 0x400> m_memory{};
+};
+
+TEST(DSPAccelerator, BulkReadsMatchSingleReads)
+{
+  std::array<s16, 16> coefs{};
+  for (size_t i = 0; i < coefs.size(); ++i)
+    coefs[i] = static_cast<s16>(((i * 0x1357) & 0x7fff) - 0x2000);
+
+  for (u16 format : {0x00, 0x0A, 0x19})
+  {
+    for (u32 end_address : {0x20u, 0x21u, 0x2fu, 0x30u, 0x31u, 0x1ffu})
+    {
+      for (bool expose_memory : {false, true})
+      {
+        MemoryAccelerator single(false);
+        MemoryAccelerator bulk(expose_memory);
+        for (MemoryAccelerator* accelerator : {&single, &bulk})
+        {
+          accelerator->SetSampleFormat(format);
+          accelerator->SetStartAddress(0x2);
+          accelerator->SetEndAddress(end_address);
+          accelerator->SetCurrentAddress(0x5);
+          accelerator->SetPredScale(0x34);
+          accelerator->SetYn1(0);
+          accelerator->SetYn2(0);
+        }
+
+        for (u32 count : {1u, 7u, 16u, 33u, 100u})
+        {
+          std::array<s16, 100> bulk_samples;
+          bulk.ReadSamples(coefs.data(), bulk_samples.data(), count);
+          for (u32 i = 0; i < count; ++i)
+            EXPECT_EQ(bulk_samples[i], static_cast<s16>(single.Read(coefs.data())));
+
+          EXPECT_EQ(bulk.GetCurrentAddress(), single.GetCurrentAddress());
+          EXPECT_EQ(bulk.GetYn1(), single.GetYn1());
+          EXPECT_EQ(bulk.GetYn2(), single.GetYn2());
+          EXPECT_EQ(bulk.GetPredScale(), single.GetPredScale());
+        }
+      }
+    }
+  }
+}
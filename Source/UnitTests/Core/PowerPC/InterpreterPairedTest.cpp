@@ -0,0 +1,127 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cmath>
+#include <optional>
+
+#include <gtest/gtest.h>
+
+#include "Common/BitUtils.h"
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/Interpreter/Interpreter_FPUtils.h"
+#include "Core/PowerPC/Interpreter/Interpreter_PairedUtils.h"
+#include "Core/PowerPC/PowerPC.h"
+
+#include "TestValues.h"
+
+namespace
+{
+PowerPC::PairedSingle MakePair(u64 ps0, u64 ps1)
+{
+  PowerPC::PairedSingle pair;
+  pair.SetBoth(ps0, ps1);
+  return pair;
+}
+
+// Checks that whenever the fast path is taken, the scalar path produces the same bits without
+// touching the FPSCR.
+template <typename FastPath, typename ScalarPath>
+void CompareWithScalar(FastPath fast_path, ScalarPath scalar_path)
+{
+  for (u64 a : double_test_values)
+  {
+    for (u64 b : double_test_values)
+    {
+      for (u64 c : {u64{0x3FF0'0000'0000'0000}, u64{0xC00C'CCCC'CCCC'CCCD}, a, b})
+      {
+        const auto pa = MakePair(a, b);
+        const auto pb = MakePair(b, c);
+        const auto pc = MakePair(c, a);
+
+        const std::optional<PairedSingleResult> fast = fast_path(pa, pb, pc);
+        if (!fast)
+          continue;
+
+        PowerPC::PowerPCState ppc_state;
+        const float ps0 = scalar_path(ppc_state, pa.PS0AsDouble(), pb.PS0AsDouble(),
+                                      pc.PS0AsDouble());
+        const float ps1 = scalar_path(ppc_state, pa.PS1AsDouble(), pb.PS1AsDouble(),
+                                      pc.PS1AsDouble());
+
+        EXPECT_EQ(Common::BitCast<u32>(fast->ps0), Common::BitCast<u32>(ps0));
+        EXPECT_EQ(Common::BitCast<u32>(fast->ps1), Common::BitCast<u32>(ps1));
+        EXPECT_EQ(ppc_state.fpscr.Hex, 0u);
+      }
+    }
+  }
+}
+}  // namespace
+
+TEST(InterpreterPaired, Add)
+{
+  CompareWithScalar(
+      [](const auto& a, const auto& b, const auto&) { return TryPairedAdd({}, a, b); },
+      [](auto& ppc_state, double a, double b, double) {
+        return ForceSingle(ppc_state.fpscr, NI_add(ppc_state, a, b).value);
+      });
+}
+
+TEST(InterpreterPaired, Sub)
+{
+  CompareWithScalar(
+      [](const auto& a, const auto& b, const auto&) { return TryPairedSub({}, a, b); },
+      [](auto& ppc_state, double a, double b, double) {
+        return ForceSingle(ppc_state.fpscr, NI_sub(ppc_state, a, b).value);
+      });
+}
+
+TEST(InterpreterPaired, Mul)
+{
+  CompareWithScalar(
+      [](const auto& a, const auto&, const auto& c) { return TryPairedMul({}, a, c); },
+      [](auto& ppc_state, double a, double, double c) {
+        return ForceSingle(ppc_state.fpscr, NI_mul(ppc_state, a, Force25Bit(c)).value);
+      });
+}
+
+TEST(InterpreterPaired, Div)
+{
+  CompareWithScalar(
+      [](const auto& a, const auto& b, const auto&) { return TryPairedDiv({}, a, b); },
+      [](auto& ppc_state, double a, double b, double) {
+        return ForceSingle(ppc_state.fpscr, NI_div(ppc_state, a, b).value);
+      });
+}
+
+TEST(InterpreterPaired, MulAdd)
+{
+  CompareWithScalar(
+      [](const auto& a, const auto& b, const auto& c) {
+        return TryPairedMulAdd({}, a, c, b, false, false);
+      },
+      [](auto& ppc_state, double a, double b, double c) {
+        return ForceSingle(ppc_state.fpscr, NI_madd(ppc_state, a, Force25Bit(c), b).value);
+      });
+}
+
+TEST(InterpreterPaired, NegativeMulSub)
+{
+  CompareWithScalar(
+      [](const auto& a, const auto& b, const auto& c) {
+        return TryPairedMulAdd({}, a, c, b, true, true);
+      },
+      [](auto& ppc_state, double a, double b, double c) {
+        const float result =
+            ForceSingle(ppc_state.fpscr, NI_msub(ppc_state, a, Force25Bit(c), b).value);
+        return std::isnan(result) ? result : -result;
+      });
+}
+
+TEST(InterpreterPaired, NonIEEEModeUsesScalarPath)
+{
+  UReg_FPSCR fpscr;
+  fpscr.NI = 1;
+  const auto one = MakePair(0x3FF0'0000'0000'0000, 0x3FF0'0000'0000'0000);
+  EXPECT_FALSE(TryPairedAdd(fpscr, one, one));
+  EXPECT_FALSE(TryPairedMulAdd(fpscr, one, one, one, false, false));
+}